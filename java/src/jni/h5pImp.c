@@ -4137,6 +4137,8 @@ Java_hdf_hdf5lib_H5_H5Pset_1mdc_1config
     const char *str;
     H5AC_cache_config_t cacheinfo;
 
+    HDmemset(&cacheinfo, 0, sizeof(H5AC_cache_config_t));
+
     cls = ENVPTR->GetObjectClass(ENVPAR cache_config);
     fid = ENVPTR->GetFieldID(ENVPAR cls, "version", "I");
     if(fid == 0) {
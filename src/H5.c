@@ -51,6 +51,8 @@
 /* Local Prototypes */
 /********************/
 static void H5_debug_mask(const char*);
+static int H5_api_stats_cmp(const void *_stat1, const void *_stat2);
+static void H5_dump_api_stats(FILE *stream);
 #ifdef H5_HAVE_PARALLEL
 static int H5_mpi_delete_cb(MPI_Comm comm, int keyval, void *attr_val, int *flag);
 #endif /*H5_HAVE_PARALLEL*/
@@ -64,6 +66,9 @@ static int H5_mpi_delete_cb(MPI_Comm comm, int keyval, void *attr_val, int *flag
 /* Library Private Variables */
 /*****************************/
 
+/* Statistics for the API routines called while collecting them */
+static H5_api_stat_t *H5_api_stats_head_g = NULL;
+
 /* HDF5 API Entered variable */
 /* (move to H5.c when new FUNC_ENTER macros in actual use -QAK) */
 hbool_t H5_api_entered_g = FALSE;
@@ -226,6 +231,10 @@ H5_init_library(void)
     if(H5FS_init() < 0)
        HGOTO_ERROR(H5E_FUNC, H5E_CANTINIT, FAIL, "unable to initialize FS interface")
 
+    /* The memory budget polls (and garbage collects) the free lists */
+    if(H5MM_budget_register(H5_MEM_FREE_LISTS, H5FL_get_free_mem, H5FL_garbage_coll) < 0)
+        HGOTO_ERROR(H5E_FUNC, H5E_CANTINIT, FAIL, "unable to register free lists with memory budget")
+
     /* Debugging? */
     H5_debug_mask("-all");
     H5_debug_mask(HDgetenv("HDF5_DEBUG"));
@@ -291,6 +300,7 @@ H5_term_library(void)
         /* Try to organize these so the "higher" level components get shut
          * down before "lower" level components that they might rely on. -QAK
          */
+        pending += DOWN(ES);
         pending += DOWN(L);
 
         /* Close the "top" of various interfaces (IDs, etc) but don't shut
@@ -388,6 +398,10 @@ H5_term_library(void)
     } /* end if */
 #endif
 
+    /* Dump the API call statistics, if requested */
+    if(H5_debug_g.apistats_out)
+        H5_dump_api_stats(H5_debug_g.apistats_out);
+
     /* Free open debugging streams */
     while(H5_debug_g.open_stream) {
         H5_debug_open_stream_t  *tmp_open_stream;
@@ -535,6 +549,394 @@ done:
     FUNC_LEAVE_API(ret_value)
 }   /* end H5set_free_list_limits() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5get_free_list_stats
+ *
+ * Purpose:	Retrieves usage statistics for the library's free lists: the
+ *      memory each list holds for reuse and how many of its allocation
+ *      requests were served from that memory.  Only lists that have
+ *      been used since the library was initialized are reported.
+ *
+ *      On input, *NLISTS is the number of elements in STATS, which
+ *      may be NULL if *NLISTS is zero.  On output, *NLISTS is the
+ *      number of free lists in use, which may be larger than the
+ *      number of elements filled in.
+ *
+ * Parameters:
+ *  H5_free_list_stats_t stats[]; OUT: Statistics for each free list
+ *  size_t *nlists;      IN/OUT: Size of STATS / number of free lists
+ *
+ * Return:	Success:	non-negative
+ *
+ *		Failure:	negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5get_free_list_stats(H5_free_list_stats_t stats[], size_t *nlists)
+{
+    herr_t                  ret_value = SUCCEED;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "*x*z", stats, nlists);
+
+    /* Check args */
+    if(!nlists)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "nlists parameter cannot be NULL")
+    if(*nlists > 0 && !stats)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "stats parameter cannot be NULL")
+
+    /* Call the free list function to gather the statistics */
+    if(H5FL_get_free_list_stats(stats, nlists) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGET, FAIL, "can't get free list statistics")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+}   /* end H5get_free_list_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5set_api_stats
+ *
+ * Purpose:	Turns collecting call statistics for the API routines on or
+ *      off.  While on, each call to an API routine is timed, and its
+ *      routine's call count, total and maximum latency and latency
+ *      histogram are updated.  The statistics are kept when collection
+ *      is turned off, and can be retrieved with H5get_api_stats().
+ *
+ *      Collection can also be turned on by setting the HDF5_DEBUG
+ *      environment variable to "apistats", which also dumps the
+ *      statistics to the standard error stream when the library is
+ *      closed.
+ *
+ * Return:	Success:	non-negative
+ *
+ *		Failure:	negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5set_api_stats(hbool_t enable)
+{
+    herr_t                  ret_value = SUCCEED;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "b", enable);
+
+    H5_debug_g.apistats = enable;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+}   /* end H5set_api_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5get_api_stats
+ *
+ * Purpose:	Retrieves the call statistics for the API routines called
+ *      while collecting statistics (see H5set_api_stats()).
+ *
+ *      On input, *NFUNCS is the number of elements in STATS, which
+ *      may be NULL if *NFUNCS is zero.  On output, *NFUNCS is the
+ *      number of routines with statistics, which may be larger than
+ *      the number of elements filled in.
+ *
+ * Parameters:
+ *  H5_api_stats_t stats[]; OUT: Statistics for each API routine
+ *  size_t *nfuncs;      IN/OUT: Size of STATS / number of API routines
+ *
+ * Return:	Success:	non-negative
+ *
+ *		Failure:	negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5get_api_stats(H5_api_stats_t stats[], size_t *nfuncs)
+{
+    H5_api_stat_t          *stat;
+    size_t                  n = 0;
+    herr_t                  ret_value = SUCCEED;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "*x*z", stats, nfuncs);
+
+    /* Check args */
+    if(!nfuncs)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "nfuncs parameter cannot be NULL")
+    if(*nfuncs > 0 && !stats)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "stats parameter cannot be NULL")
+
+    for(stat = H5_api_stats_head_g; stat; stat = stat->next, n++)
+        if(n < *nfuncs)
+            stats[n] = stat->stats;
+    *nfuncs = n;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+}   /* end H5get_api_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5reset_api_stats
+ *
+ * Purpose:	Clears the call statistics for all the API routines.
+ *
+ * Return:	Success:	non-negative
+ *
+ *		Failure:	negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5reset_api_stats(void)
+{
+    H5_api_stat_t          *stat;
+    herr_t                  ret_value = SUCCEED;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE0("e","");
+
+    for(stat = H5_api_stats_head_g; stat; stat = stat->next) {
+        const char *name = stat->stats.name;
+
+        HDmemset(&stat->stats, 0, sizeof(stat->stats));
+        stat->stats.name = name;
+    } /* end for */
+
+done:
+    FUNC_LEAVE_API(ret_value)
+}   /* end H5reset_api_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5set_memory_limit
+ *
+ * Purpose:	Sets a limit on the memory held by the library's caches and
+ *      buffers as a whole: the metadata caches, the chunk caches, page
+ *      buffers, metadata accumulators, sieve buffers and free lists
+ *      of all open files and datasets.  The components still have
+ *      their own size limits; this is an overall budget on top of
+ *      them.
+ *
+ *      When the budget is exceeded the free lists are garbage
+ *      collected, and the chunk caches evict entries before caching
+ *      another chunk until the library is back under budget.  The
+ *      metadata caches and page buffers are counted against the
+ *      budget but are only limited by their own configuration.
+ *
+ *      A limit of 0 (the default) removes the budget.
+ *
+ * Return:	Success:	non-negative
+ *
+ *		Failure:	negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5set_memory_limit(size_t limit)
+{
+    herr_t                  ret_value = SUCCEED;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "z", limit);
+
+    H5MM_budget_set_limit(limit);
+
+    /* Release what can be released right away if already over budget */
+    (void)H5MM_budget_exceeded((size_t)0);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+}   /* end H5set_memory_limit() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5get_memory_limit
+ *
+ * Purpose:	Retrieves the limit set with H5set_memory_limit(), or 0 if
+ *      there is none.
+ *
+ * Return:	Success:	non-negative
+ *
+ *		Failure:	negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5get_memory_limit(size_t *limit)
+{
+    herr_t                  ret_value = SUCCEED;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "*z", limit);
+
+    if(!limit)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "limit parameter cannot be NULL")
+
+    *limit = H5MM_budget_get_limit();
+
+done:
+    FUNC_LEAVE_API(ret_value)
+}   /* end H5get_memory_limit() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5get_memory_usage
+ *
+ * Purpose:	Retrieves the memory currently held by each of the
+ *      components counted against the library's memory budget (see
+ *      H5set_memory_limit()), and their total.
+ *
+ *      USAGE, if not NULL, must have H5_MEM_NCOMPONENTS elements and
+ *      is indexed by H5_mem_component_t.  TOTAL may be NULL.
+ *
+ * Parameters:
+ *  size_t usage[];      OUT: Bytes held by each component
+ *  size_t *total;       OUT: Bytes held by all the components
+ *
+ * Return:	Success:	non-negative
+ *
+ *		Failure:	negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5get_memory_usage(size_t usage[], size_t *total)
+{
+    size_t                  tot;
+    herr_t                  ret_value = SUCCEED;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "*z*z", usage, total);
+
+    if(!usage && !total)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "usage and total parameters cannot both be NULL")
+
+    tot = H5MM_budget_get_usage(usage);
+    if(total)
+        *total = tot;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+}   /* end H5get_memory_usage() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5_api_stats_update
+ *
+ * Purpose:	Accounts for one call to an API routine, when it returns.
+ *      *STATP is the routine's pointer to its statistics, which are
+ *      allocated and added to the list of routines called on its first
+ *      timed call.  The API lock must be held.
+ *
+ *      This is called from FUNC_LEAVE_API, so it must not call any
+ *      function that uses the FUNC_ENTER/FUNC_LEAVE macros.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_api_stats_update(H5_api_stat_t **statp, const char *func, uint64_t start_usec)
+{
+    H5_api_stat_t *stat = *statp;
+    uint64_t    elapsed_usec = H5_now_usec() - start_usec;
+    uint64_t    usec = elapsed_usec;    /* Latency, shifted to find its bucket */
+    unsigned    bucket = 0;             /* Latency histogram bucket */
+
+    if(NULL == stat) {
+        /* Use HDcalloc here, since these are never released (the routines
+         * keep pointing at them) and shouldn't count as library memory.
+         */
+        if(NULL == (stat = (H5_api_stat_t *)HDcalloc((size_t)1, sizeof(H5_api_stat_t))))
+            return;
+        stat->stats.name = func;
+        stat->next = H5_api_stats_head_g;
+        H5_api_stats_head_g = stat;
+        *statp = stat;
+    } /* end if */
+
+    stat->stats.ncalls++;
+    stat->stats.total_usec += elapsed_usec;
+    if(elapsed_usec > stat->stats.max_usec)
+        stat->stats.max_usec = elapsed_usec;
+
+    /* Bucket N holds latencies of [2^(N-1), 2^N) microseconds */
+    while(usec > 0 && bucket < (H5_API_STATS_NBUCKETS - 1)) {
+        usec >>= 1;
+        bucket++;
+    } /* end while */
+    stat->stats.latency[bucket]++;
+} /* end H5_api_stats_update() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5_api_stats_cmp
+ *
+ * Purpose:	Sorts API routine statistics by total latency, largest
+ *      first.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_api_stats_cmp(const void *_stat1, const void *_stat2)
+{
+    const H5_api_stat_t *stat1 = *(const H5_api_stat_t * const *)_stat1;
+    const H5_api_stat_t *stat2 = *(const H5_api_stat_t * const *)_stat2;
+
+    if(stat1->stats.total_usec > stat2->stats.total_usec)
+        return -1;
+    if(stat1->stats.total_usec < stat2->stats.total_usec)
+        return 1;
+    return HDstrcmp(stat1->stats.name, stat2->stats.name);
+} /* end H5_api_stats_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5_dump_api_stats
+ *
+ * Purpose:	Prints the API call statistics to STREAM, the routines
+ *      taking the most time first.
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_dump_api_stats(FILE *stream)
+{
+    H5_api_stat_t **sorted;
+    H5_api_stat_t *stat;
+    size_t      nfuncs = 0;
+    size_t      u;
+
+    for(stat = H5_api_stats_head_g; stat; stat = stat->next)
+        nfuncs++;
+    if(0 == nfuncs)
+        return;
+    if(NULL == (sorted = (H5_api_stat_t **)HDmalloc(nfuncs * sizeof(H5_api_stat_t *))))
+        return;
+    for(stat = H5_api_stats_head_g, u = 0; stat; stat = stat->next, u++)
+        sorted[u] = stat;
+    HDqsort(sorted, nfuncs, sizeof(H5_api_stat_t *), H5_api_stats_cmp);
+
+    HDfprintf(stream, "HDF5 API call statistics:\n");
+    HDfprintf(stream, "%-32s %12s %14s %10s %12s\n", "Routine", "Calls",
+            "Total (us)", "Mean (us)", "Max (us)");
+    for(u = 0; u < nfuncs; u++) {
+        const H5_api_stats_t *stats = &sorted[u]->stats;
+
+        if(0 == stats->ncalls)
+            continue;
+        HDfprintf(stream, "%-32s %12Hu %14Hu %10.1f %12Hu\n", stats->name,
+                stats->ncalls, stats->total_usec,
+                (double)stats->total_usec / (double)stats->ncalls,
+                stats->max_usec);
+    } /* end for */
+
+    HDfree(sorted);
+} /* end H5_dump_api_stats() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5_debug_mask
@@ -555,6 +957,10 @@ done:
  *              should be shown. This also turns on tracing as if the
  *              'trace' word was shown.
  *
+ *              The name 'apistats' turns on collecting API call
+ *              statistics (see H5set_api_stats) and dumps them to the
+ *              stream when the library is closed.
+ *
  * Return:      void
  *
  *-------------------------------------------------------------------------
@@ -597,6 +1003,9 @@ H5_debug_mask(const char *s)
             } else if (!HDstrcmp(pkg_name, "ttimes")) {
                 H5_debug_g.trace = stream;
                 H5_debug_g.ttimes = (hbool_t)!clear;
+            } else if (!HDstrcmp(pkg_name, "apistats")) {
+                H5_debug_g.apistats = (hbool_t)!clear;
+                H5_debug_g.apistats_out = clear ? NULL : stream;
             } else if (!HDstrcmp(pkg_name, "all")) {
                 for (i=0; i<(size_t)H5_NPKGS; i++)
                     H5_debug_g.pkg[i].stream = clear ? NULL : stream;
@@ -673,7 +673,7 @@ H5Aread(hid_t attr_id, hid_t dtype_id, void *buf)
     hid_t  aapl_id = H5P_DEFAULT;  /* temp access plist */
     herr_t ret_value;           /* Return value */
 
-    FUNC_ENTER_API(FAIL)
+    FUNC_ENTER_API_SHARED(FAIL)
     H5TRACE3("e", "ii*x", attr_id, dtype_id, buf);
 
     /* check arguments */
@@ -696,6 +696,79 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Aread() */
 
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5Aread_multi
+ PURPOSE
+    Read in data from several attributes of an object
+ USAGE
+    herr_t H5Aread_multi (loc_id, count, attr_name, dtype_id, buf)
+        hid_t loc_id;           IN: Object whose attributes to read
+        size_t count;           IN: Number of attributes to read
+        const char *attr_name[];  IN: Names of attributes, or NULL for all
+        const hid_t dtype_id[]; IN: Memory datatype of each buffer
+        void *buf[];            IN: Buffer for data of each attribute
+ RETURNS
+    Non-negative on success/Negative on failure
+
+ DESCRIPTION
+        This function reads complete attributes from disk, without opening
+    each of them.  The object's attributes are located in a single pass over
+    its attribute storage.  If ATTR_NAME is NULL, all of the object's
+    attributes are read, in increasing name order, and COUNT must be the
+    number of attributes the object has.
+--------------------------------------------------------------------------*/
+herr_t
+H5Aread_multi(hid_t loc_id, size_t count, const char *attr_name[],
+    const hid_t dtype_id[], void *buf[])
+{
+    H5G_loc_t loc;                      /* Object location */
+    const H5T_t **mem_types = NULL;     /* Memory datatypes */
+    hid_t  dxpl_id = H5AC_ind_read_dxpl_id; /* dxpl used by library */
+    hid_t  aapl_id = H5P_DEFAULT;       /* temp access plist */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE5("e", "iz**s*i**x", loc_id, count, attr_name, dtype_id, buf);
+
+    /* check arguments */
+    if(H5I_ATTR == H5I_get_type(loc_id))
+	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "location is not valid for an attribute")
+    if(H5G_loc(loc_id, &loc) < 0)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a location")
+    if(count > 0 && (NULL == dtype_id || NULL == buf))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "null datatype or buffer array")
+
+    /* Verify access property list and get correct dxpl */
+    if(H5P_verify_apl_and_dxpl(&aapl_id, H5P_CLS_AACC, &dxpl_id, loc_id, FALSE) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTSET, FAIL, "can't set access and transfer property lists")
+
+    if(count > 0) {
+        /* Check each attribute's name, datatype & buffer */
+        if(NULL == (mem_types = (const H5T_t **)H5MM_malloc(count * sizeof(H5T_t *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        for(u = 0; u < count; u++) {
+            if(attr_name && (!attr_name[u] || !*attr_name[u]))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no attribute name")
+            if(NULL == (mem_types[u] = (const H5T_t *)H5I_object_verify(dtype_id[u], H5I_DATATYPE)))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
+            if(NULL == buf[u])
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "null attribute buffer")
+        } /* end for */
+    } /* end if */
+
+    /* Read the attributes from the object header */
+    if(H5O_attr_read_multi(loc.oloc, count, attr_name, mem_types, buf, dxpl_id) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_READERROR, FAIL, "unable to read attributes")
+
+done:
+    mem_types = (const H5T_t **)H5MM_xfree(mem_types);
+
+    FUNC_LEAVE_API(ret_value)
+} /* H5Aread_multi() */
+
 
 /*--------------------------------------------------------------------------
  NAME
@@ -878,6 +878,47 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5AC_flush() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5AC_write_behind
+ *
+ * Purpose:     Write some dirty metadata to disk ahead of eviction, if
+ *              more than DIRTY_RATIO of the cache is dirty.  See
+ *              H5C_write_behind().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5AC_write_behind(H5F_t *f, hid_t dxpl_id, double dirty_ratio,
+    size_t max_bytes, hbool_t *more)
+{
+    herr_t ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(f->shared->cache);
+    HDassert(more);
+
+    *more = FALSE;
+
+#ifdef H5_HAVE_PARALLEL
+    /* Metadata writes in parallel are coordinated at sync points only */
+    if(H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI))
+        HGOTO_DONE(SUCCEED)
+#endif /* H5_HAVE_PARALLEL */
+
+    if(H5C_write_behind(f, dxpl_id, dirty_ratio, max_bytes, more) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "can't write dirty entries behind")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5AC_write_behind() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5AC_force_cache_image_load()
@@ -2160,7 +2201,7 @@ H5AC_get_cache_auto_resize_config(const H5AC_t *cache_ptr,
 
     /* Check args */
     if((cache_ptr == NULL) || (config_ptr == NULL) ||
-            (config_ptr->version != H5AC__CURR_CACHE_CONFIG_VERSION))
+            !H5AC__CACHE_CONFIG_VERSION_OK(config_ptr->version))
         HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Bad cache_ptr or config_ptr on entry")
 #ifdef H5_HAVE_PARALLEL
 {
@@ -2177,6 +2218,9 @@ H5AC_get_cache_auto_resize_config(const H5AC_t *cache_ptr,
         HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5C_get_cache_auto_resize_config() failed")
     if(H5C_get_evictions_enabled((const H5C_t *)cache_ptr, &evictions_enabled) < 0)
         HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5C_get_resize_enabled() failed")
+    if(config_ptr->version >= 2)
+        if(H5C_get_replacement_policy((const H5C_t *)cache_ptr, &config_ptr->rp_policy, &config_ptr->rp_hot_fraction) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5C_get_replacement_policy() failed")
 
     /* Set the information to return */
     if(internal_config.rpt_fcn == NULL)
@@ -2398,6 +2442,13 @@ H5AC_set_cache_auto_resize_config(H5AC_t *cache_ptr, H5AC_cache_config_t *config
         HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5C_set_cache_auto_resize_config() failed")
     if(H5C_set_evictions_enabled(cache_ptr, config_ptr->evictions_enabled) < 0)
         HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5C_set_evictions_enabled() failed")
+    if(config_ptr->version >= 2) {
+        if(H5C_set_replacement_policy(cache_ptr, config_ptr->rp_policy, config_ptr->rp_hot_fraction) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5C_set_replacement_policy() failed")
+    } /* end if */
+    else
+        if(H5C_set_replacement_policy(cache_ptr, H5C_rp__lru, H5C__DEFAULT_RP_HOT_FRACTION) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5C_set_replacement_policy() failed")
 
 #ifdef H5_HAVE_PARALLEL
 {
@@ -2497,7 +2548,7 @@ H5AC_validate_config(H5AC_cache_config_t *config_ptr)
     /* Check args */
     if(config_ptr == NULL)
         HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "NULL config_ptr on entry")
-    if(config_ptr->version != H5AC__CURR_CACHE_CONFIG_VERSION)
+    if(!H5AC__CACHE_CONFIG_VERSION_OK(config_ptr->version))
         HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Unknown config version")
 
     /* don't bother to test trace_file_name unless open_trace_file is TRUE */
@@ -2530,6 +2581,15 @@ H5AC_validate_config(H5AC_cache_config_t *config_ptr)
          (config_ptr->metadata_write_strategy != H5AC_METADATA_WRITE_STRATEGY__DISTRIBUTED))
         HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "config_ptr->metadata_write_strategy out of range")
 
+    /* version 1 configurations have no replacement policy fields */
+    if(config_ptr->version >= 2) {
+        if((config_ptr->rp_policy != H5C_rp__lru) && (config_ptr->rp_policy != H5C_rp__2q))
+            HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "config_ptr->rp_policy out of range")
+        else if((config_ptr->rp_policy == H5C_rp__2q) &&
+                ((config_ptr->rp_hot_fraction <= 0.0f) || (config_ptr->rp_hot_fraction >= 1.0f)))
+            HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "config_ptr->rp_hot_fraction must lie in (0.0, 1.0)")
+    } /* end if */
+
     if(H5AC__ext_config_2_int_config(config_ptr, &internal_config) < 0)
         HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5AC__ext_config_2_int_config() failed")
 
@@ -2677,7 +2737,7 @@ H5AC__ext_config_2_int_config(H5AC_cache_config_t *ext_conf_ptr,
 
     FUNC_ENTER_STATIC
 
-    if((ext_conf_ptr == NULL) || (ext_conf_ptr->version != H5AC__CURR_CACHE_CONFIG_VERSION) ||
+    if((ext_conf_ptr == NULL) || !H5AC__CACHE_CONFIG_VERSION_OK(ext_conf_ptr->version) ||
             (int_conf_ptr == NULL))
         HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Bad ext_conf_ptr or inf_conf_ptr on entry")
 
@@ -181,6 +181,7 @@ typedef H5C_notify_action_t     H5AC_notify_action_t;
 
 #define H5AC__CLASS_NO_FLAGS_SET 	H5C__CLASS_NO_FLAGS_SET
 #define H5AC__CLASS_SPECULATIVE_LOAD_FLAG H5C__CLASS_SPECULATIVE_LOAD_FLAG
+#define H5AC__CLASS_PARALLEL_SERIALIZE_FLAG H5C__CLASS_PARALLEL_SERIALIZE_FLAG
 
 /* The following flags should only appear in test code */
 #define H5AC__CLASS_SKIP_READS              H5C__CLASS_SKIP_READS
@@ -246,6 +247,15 @@ H5_DLLVAR hid_t H5AC_noio_dxpl_id;
    provided by the user (fill values in H5Dcreate) */
 H5_DLLVAR hid_t H5AC_rawdata_dxpl_id;
 
+/* Version 1 of H5AC_cache_config_t ends before the replacement policy
+ * fields.  It is still accepted, and implies the modified LRU policy.
+ */
+#define H5AC__CACHE_CONFIG_VERSION_1            1
+#define H5AC__CACHE_CONFIG_VERSION_1_SIZE       \
+                                offsetof(H5AC_cache_config_t, rp_policy)
+#define H5AC__CACHE_CONFIG_VERSION_OK(v)        \
+    ((v) == H5AC__CACHE_CONFIG_VERSION_1 || (v) == H5AC__CURR_CACHE_CONFIG_VERSION)
+
 /* Default cache configuration. */
 #define H5AC__DEFAULT_METADATA_WRITE_STRATEGY   \
                                 H5AC_METADATA_WRITE_STRATEGY__DISTRIBUTED
@@ -284,12 +294,14 @@ H5_DLLVAR hid_t H5AC_rawdata_dxpl_id;
   /* double      empty_reserve          = */ 0.1f,                            \
   /* size_t	 dirty_bytes_threshold  = */ (256 * 1024),                    \
   /* int	metadata_write_strategy = */                                  \
-				       H5AC__DEFAULT_METADATA_WRITE_STRATEGY  \
+				       H5AC__DEFAULT_METADATA_WRITE_STRATEGY, \
+  /* enum H5C_cache_rp_policy rp_policy = */ H5C_rp__lru,                     \
+  /* double      rp_hot_fraction        = */ H5C__DEFAULT_RP_HOT_FRACTION     \
 }
 #else /* H5_HAVE_PARALLEL */
 #define H5AC__DEFAULT_CACHE_CONFIG                                            \
 {                                                                             \
-  /* int         version                = */ H5C__CURR_AUTO_SIZE_CTL_VER,     \
+  /* int         version                = */ H5AC__CURR_CACHE_CONFIG_VERSION, \
   /* hbool_t     rpt_fcn_enabled        = */ FALSE,                           \
   /* hbool_t     open_trace_file        = */ FALSE,                           \
   /* hbool_t     close_trace_file       = */ FALSE,                           \
@@ -320,7 +332,9 @@ H5_DLLVAR hid_t H5AC_rawdata_dxpl_id;
   /* double      empty_reserve          = */ 0.1f,                            \
   /* size_t	 dirty_bytes_threshold  = */ (256 * 1024),                    \
   /* int	metadata_write_strategy = */                                  \
-				       H5AC__DEFAULT_METADATA_WRITE_STRATEGY  \
+				       H5AC__DEFAULT_METADATA_WRITE_STRATEGY, \
+  /* enum H5C_cache_rp_policy rp_policy = */ H5C_rp__lru,                     \
+  /* double      rp_hot_fraction        = */ H5C__DEFAULT_RP_HOT_FRACTION     \
 }
 #endif /* H5_HAVE_PARALLEL */
 
@@ -423,6 +437,8 @@ H5_DLL herr_t H5AC_destroy_flush_dependency(void *parent_thing, void *child_thin
 H5_DLL herr_t H5AC_unprotect(H5F_t *f, hid_t dxpl_id, const H5AC_class_t *type,
     haddr_t addr, void *thing, unsigned flags);
 H5_DLL herr_t H5AC_flush(H5F_t *f, hid_t dxpl_id);
+H5_DLL herr_t H5AC_write_behind(H5F_t *f, hid_t dxpl_id, double dirty_ratio,
+    size_t max_bytes, hbool_t *more);
 H5_DLL herr_t H5AC_mark_entry_dirty(void *thing);
 H5_DLL herr_t H5AC_mark_entry_clean(void *thing);
 H5_DLL herr_t H5AC_mark_entry_unserialized(void *thing);
@@ -436,9 +436,35 @@ extern "C" {
  *    To avoid possible messages from the past/future, all caches must
  *    wait until all caches are done before leaving the sync point.
  *
+ *
+ * Replacement Policy Configuration Fields:
+ *
+ * rp_policy:  Enumerated field selecting the replacement policy used to
+ *    choose entries for eviction.  The acceptable values are:
+ *
+ *    H5C_rp__lru:  Use the modified LRU policy.  This is the default, and
+ *       was the only policy supported before version 2 of this structure.
+ *
+ *    H5C_rp__2q:  Use a variant of the 2Q policy.  Entries that are
+ *       referenced again some time after their first reference join a
+ *       "hot" set, and are passed over when the LRU is scanned for
+ *       eviction candidates as long as the hot set fits within the
+ *       fraction of the cache given by rp_hot_fraction.  Entries that
+ *       are only referenced in a single burst -- as during a traversal
+ *       of the file -- are evicted first.
+ *
+ *       Pinned and protected entries are not on the LRU, and are thus
+ *       unaffected, as are flush dependencies.  Hot entries are still
+ *       subject to the age out size reduction modes.
+ *
+ * rp_hot_fraction:  Double in the range (0.0, 1.0) giving the fraction of
+ *    the maximum cache size that may be occupied by hot entries before
+ *    the least recently used of them are demoted.  Ignored unless
+ *    rp_policy is H5C_rp__2q.
+ *
  ****************************************************************************/
 
-#define H5AC__CURR_CACHE_CONFIG_VERSION     1
+#define H5AC__CURR_CACHE_CONFIG_VERSION     2
 #define H5AC__MAX_TRACE_FILE_NAME_LEN        1024
 
 #define H5AC_METADATA_WRITE_STRATEGY__PROCESS_0_ONLY    0
@@ -503,6 +529,11 @@ typedef struct H5AC_cache_config_t
     size_t                   dirty_bytes_threshold;
     int                      metadata_write_strategy;
 
+
+    /* replacement policy configuration fields: */
+    enum H5C_cache_rp_policy rp_policy;
+    double                   rp_hot_fraction;
+
 } H5AC_cache_config_t;
 
 
@@ -242,6 +242,8 @@ H5_DLL herr_t H5A_attr_release_table(H5A_attr_table_t *atable);
 H5_DLL herr_t H5O_attr_create(const H5O_loc_t *loc, hid_t dxpl_id, H5A_t *attr);
 H5_DLL H5A_t *H5O_attr_open_by_name(const H5O_loc_t *loc, const char *name,
     hid_t dxpl_id);
+H5_DLL herr_t H5O_attr_read_multi(const H5O_loc_t *loc, size_t count,
+    const char *names[], const H5T_t *mem_types[], void *bufs[], hid_t dxpl_id);
 H5_DLL H5A_t *H5O_attr_open_by_idx(const H5O_loc_t *loc, H5_index_t idx_type,
     H5_iter_order_t order, hsize_t n, hid_t dxpl_id);
 H5_DLL herr_t H5O_attr_update_shared(H5F_t *f, hid_t dxpl_id, H5O_t *oh,
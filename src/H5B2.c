@@ -295,6 +295,44 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5B2_insert() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B2_bulk_load
+ *
+ * Purpose:	Fill an empty B-tree with NREC records at once.  RECS is an
+ *		array of native records (each the size of the B-tree class'
+ *		native record), sorted in the order the class' 'compare'
+ *		callback defines and without duplicates.
+ *
+ *		The tree is built bottom-up with packed nodes, which is much
+ *		cheaper than inserting the records one at a time.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5B2_bulk_load(H5B2_t *bt2, hid_t dxpl_id, size_t nrec, const void *recs)
+{
+    herr_t	ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check arguments. */
+    HDassert(bt2);
+    HDassert(recs || nrec == 0);
+
+    /* Set the shared v2 B-tree header's file context for this operation */
+    bt2->hdr->f = bt2->f;
+
+    /* Load the records */
+    if(H5B2__bulk_load(bt2->hdr, dxpl_id, nrec, recs) < 0)
+        HGOTO_ERROR(H5E_BTREE, H5E_CANTINSERT, FAIL, "unable to bulk load records into B-tree")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5B2_bulk_load() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5B2_update
@@ -35,6 +35,7 @@
 #include "H5private.h"		/* Generic Functions			*/
 #include "H5B2pkg.h"		/* v2 B-trees				*/
 #include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5MMprivate.h"	/* Memory management			*/
 #include "H5VMprivate.h"	/* Vectors and arrays 			*/
 
 
@@ -56,6 +57,10 @@
 /********************/
 /* Local Prototypes */
 /********************/
+static herr_t H5B2__add_depth(H5B2_hdr_t *hdr);
+static herr_t H5B2__bulk_load_node(H5B2_hdr_t *hdr, hid_t dxpl_id,
+    uint16_t depth, void *parent, H5B2_node_ptr_t *node_ptr, size_t nrec,
+    const uint8_t *recs, const hsize_t *cap);
 static herr_t H5B2__update_child_flush_depends(H5B2_hdr_t *hdr, hid_t dxpl_id,
     unsigned depth, const H5B2_node_ptr_t *node_ptrs, unsigned start_idx,
     unsigned end_idx, void *old_parent, void *new_parent);
@@ -327,30 +332,23 @@ done:
 
 
 /*-------------------------------------------------------------------------
- * Function:	H5B2__split_root
- *
- * Purpose:	Split the root node
+ * Function:	H5B2__add_depth
  *
- * Return:	Success:	Non-negative
- *		Failure:	Negative
+ * Purpose:	Increment the depth of the B-tree and set up the node info
+ *		for the new root level.
  *
- * Programmer:	Quincey Koziol
- *		koziol@ncsa.uiuc.edu
- *		Feb  3 2005
+ * Return:	Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5B2__split_root(H5B2_hdr_t *hdr, hid_t dxpl_id)
+static herr_t
+H5B2__add_depth(H5B2_hdr_t *hdr)
 {
-    H5B2_internal_t *new_root = NULL;   /* Pointer to new root node */
-    unsigned new_root_flags = H5AC__NO_FLAGS_SET;   /* Cache flags for new root node */
-    H5B2_node_ptr_t old_root_ptr;       /* Old node pointer to root node in B-tree */
     size_t sz_max_nrec;                 /* Temporary variable for range checking */
     unsigned u_max_nrec_size;           /* Temporary variable for range checking */
     herr_t ret_value = SUCCEED;         /* Return value */
 
-    FUNC_ENTER_PACKAGE
+    FUNC_ENTER_STATIC
 
     /* Check arguments. */
     HDassert(hdr);
@@ -376,6 +374,42 @@ H5B2__split_root(H5B2_hdr_t *hdr, hid_t dxpl_id)
     if(NULL == (hdr->node_info[hdr->depth].node_ptr_fac = H5FL_fac_init(sizeof(H5B2_node_ptr_t) * (hdr->node_info[hdr->depth].max_nrec + 1))))
 	HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, FAIL, "can't create internal 'branch' node node pointer block factory")
 
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5B2__add_depth() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B2__split_root
+ *
+ * Purpose:	Split the root node
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ * Programmer:	Quincey Koziol
+ *		koziol@ncsa.uiuc.edu
+ *		Feb  3 2005
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5B2__split_root(H5B2_hdr_t *hdr, hid_t dxpl_id)
+{
+    H5B2_internal_t *new_root = NULL;   /* Pointer to new root node */
+    unsigned new_root_flags = H5AC__NO_FLAGS_SET;   /* Cache flags for new root node */
+    H5B2_node_ptr_t old_root_ptr;       /* Old node pointer to root node in B-tree */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments. */
+    HDassert(hdr);
+
+    /* Update depth of B-tree */
+    if(H5B2__add_depth(hdr) < 0)
+        HGOTO_ERROR(H5E_BTREE, H5E_CANTINIT, FAIL, "unable to increase depth of B-tree")
+
     /* Keep old root node pointer info */
     old_root_ptr = hdr->root;
 
@@ -1483,6 +1517,170 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5B2__insert() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B2__bulk_load_node
+ *
+ * Purpose:	Create the subtree of depth DEPTH holding the NREC native
+ *		records in RECS, filling in NODE_PTR to point to it.  The
+ *		records are spread evenly over the fewest children that can
+ *		hold them, so every node is (nearly) packed to its split
+ *		size.  CAP holds the capacity of a packed subtree of each
+ *		depth.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5B2__bulk_load_node(H5B2_hdr_t *hdr, hid_t dxpl_id, uint16_t depth,
+    void *parent, H5B2_node_ptr_t *node_ptr, size_t nrec, const uint8_t *recs,
+    const hsize_t *cap)
+{
+    H5B2_leaf_t *leaf = NULL;           /* New leaf node */
+    H5B2_internal_t *internal = NULL;   /* New internal node */
+    size_t rec_size = hdr->cls->nrec_size;  /* Size of a native record */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check arguments. */
+    HDassert(hdr);
+    HDassert(node_ptr);
+    HDassert(nrec > 0);
+    HDassert(recs);
+    HDassert(cap);
+    HDassert((hsize_t)nrec <= cap[depth]);
+
+    if(depth == 0) {
+        /* Create the leaf node & copy the records into it */
+        if(H5B2__create_leaf(hdr, dxpl_id, parent, node_ptr) < 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_CANTINIT, FAIL, "unable to create B-tree leaf node")
+        node_ptr->node_nrec = 0;
+        if(NULL == (leaf = H5B2__protect_leaf(hdr, dxpl_id, parent, node_ptr, FALSE, H5AC__NO_FLAGS_SET)))
+            HGOTO_ERROR(H5E_BTREE, H5E_CANTPROTECT, FAIL, "unable to protect B-tree leaf node")
+        HDmemcpy(H5B2_LEAF_NREC(leaf, hdr, 0), recs, nrec * rec_size);
+        leaf->nrec = (uint16_t)nrec;
+        node_ptr->node_nrec = (uint16_t)nrec;
+    } /* end if */
+    else {
+        size_t nchild;                  /* Number of children of the node */
+        size_t child_nrec;              /* Base # of records in each child */
+        size_t extra;                   /* # of children getting one more record */
+        size_t u;                       /* Local index variable */
+
+        /* Use the fewest children that can hold the records (at least two) */
+        nchild = (size_t)(((hsize_t)nrec + cap[depth - 1]) / (cap[depth - 1] + 1));
+        if(nchild < 2)
+            nchild = 2;
+        HDassert(nchild - 1 <= hdr->node_info[depth].split_nrec);
+        child_nrec = (nrec - (nchild - 1)) / nchild;
+        extra = (nrec - (nchild - 1)) % nchild;
+        HDassert(child_nrec > 0);
+
+        /* Create the internal node */
+        if(H5B2__create_internal(hdr, dxpl_id, parent, node_ptr, depth) < 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_CANTINIT, FAIL, "unable to create B-tree internal node")
+        node_ptr->node_nrec = 0;
+        if(NULL == (internal = H5B2__protect_internal(hdr, dxpl_id, parent, node_ptr, depth, FALSE, H5AC__NO_FLAGS_SET)))
+            HGOTO_ERROR(H5E_BTREE, H5E_CANTPROTECT, FAIL, "unable to protect B-tree internal node")
+
+        /* Build each child, followed by the record separating it from the next */
+        for(u = 0; u < nchild; u++) {
+            size_t curr_nrec = child_nrec + (u < extra ? 1 : 0);
+
+            if(H5B2__bulk_load_node(hdr, dxpl_id, (uint16_t)(depth - 1), internal, &internal->node_ptrs[u], curr_nrec, recs, cap) < 0)
+                HGOTO_ERROR(H5E_BTREE, H5E_CANTINIT, FAIL, "unable to create B-tree child node")
+            recs += curr_nrec * rec_size;
+
+            if(u < nchild - 1) {
+                HDmemcpy(H5B2_INT_NREC(internal, hdr, u), recs, rec_size);
+                recs += rec_size;
+            } /* end if */
+        } /* end for */
+        internal->nrec = (uint16_t)(nchild - 1);
+        node_ptr->node_nrec = (uint16_t)(nchild - 1);
+    } /* end else */
+    node_ptr->all_nrec = (hsize_t)nrec;
+
+done:
+    /* Release the new node (marked as dirty) */
+    if(leaf && H5AC_unprotect(hdr->f, dxpl_id, H5AC_BT2_LEAF, node_ptr->addr, leaf, H5AC__DIRTIED_FLAG) < 0)
+        HDONE_ERROR(H5E_BTREE, H5E_CANTUNPROTECT, FAIL, "unable to release B-tree leaf node")
+    if(internal && H5AC_unprotect(hdr->f, dxpl_id, H5AC_BT2_INT, node_ptr->addr, internal, H5AC__DIRTIED_FLAG) < 0)
+        HDONE_ERROR(H5E_BTREE, H5E_CANTUNPROTECT, FAIL, "unable to release B-tree internal node")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5B2__bulk_load_node() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B2__bulk_load
+ *
+ * Purpose:	Build the contents of an empty B-tree bottom-up from NREC
+ *		native records, which must already be sorted in the
+ *		B-tree's order and be unique.  Each node is written once,
+ *		packed to its split size, instead of being split and
+ *		redistributed over and over by individual insertions.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5B2__bulk_load(H5B2_hdr_t *hdr, hid_t dxpl_id, size_t nrec, const void *recs)
+{
+    hsize_t *cap = NULL;                /* Capacity of a packed subtree of each depth */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments. */
+    HDassert(hdr);
+    HDassert(recs || nrec == 0);
+
+    /* Only empty B-trees can be bulk loaded */
+    if(H5F_addr_defined(hdr->root.addr) || hdr->depth > 0)
+        HGOTO_ERROR(H5E_BTREE, H5E_EXISTS, FAIL, "B-tree is not empty")
+    if(nrec == 0)
+        HGOTO_DONE(SUCCEED)
+
+    /* Deepen the tree until a packed tree can hold all the records */
+    if(NULL == (cap = (hsize_t *)H5MM_malloc(sizeof(hsize_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    cap[0] = hdr->node_info[0].split_nrec;
+    if(cap[0] == 0)
+        HGOTO_ERROR(H5E_BTREE, H5E_BADVALUE, FAIL, "B-tree nodes too small to bulk load")
+    while((hsize_t)nrec > cap[hdr->depth]) {
+        hsize_t *tmp_cap;               /* Temporary pointer for reallocation */
+        unsigned split_nrec;            /* Split size of new level */
+
+        if(hdr->depth == (uint16_t)-1)
+            HGOTO_ERROR(H5E_BTREE, H5E_BADVALUE, FAIL, "too many records to bulk load")
+        if(H5B2__add_depth(hdr) < 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_CANTINIT, FAIL, "unable to increase depth of B-tree")
+        if(NULL == (tmp_cap = (hsize_t *)H5MM_realloc(cap, sizeof(hsize_t) * (size_t)(hdr->depth + 1))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        cap = tmp_cap;
+        if(0 == (split_nrec = hdr->node_info[hdr->depth].split_nrec))
+            HGOTO_ERROR(H5E_BTREE, H5E_BADVALUE, FAIL, "B-tree nodes too small to bulk load")
+        cap[hdr->depth] = ((hsize_t)(split_nrec + 1) * cap[hdr->depth - 1]) + split_nrec;
+    } /* end while */
+
+    /* Build the tree from the root down */
+    if(H5B2__bulk_load_node(hdr, dxpl_id, hdr->depth, hdr, &hdr->root, nrec, (const uint8_t *)recs, cap) < 0)
+        HGOTO_ERROR(H5E_BTREE, H5E_CANTINSERT, FAIL, "unable to bulk load records into B-tree")
+
+    /* Mark B-tree header as dirty */
+    if(H5B2__hdr_dirty(hdr) < 0)
+        HGOTO_ERROR(H5E_BTREE, H5E_CANTMARKDIRTY, FAIL, "unable to mark B-tree header dirty")
+
+done:
+    cap = (hsize_t *)H5MM_xfree(cap);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5B2__bulk_load() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5B2__iterate_node
@@ -105,6 +105,46 @@
 /* Local Typedefs */
 /******************/
 
+/* Batch of dirty entries serialized together by H5C__flush_ring_batched() */
+typedef struct H5C_serialize_batch_t {
+    const H5F_t *f;                     /* File the entries belong to        */
+    H5C_cache_entry_t **entries;        /* Entries, in increasing address order */
+    size_t nentries;                    /* Number of entries in the batch    */
+    size_t next;                        /* Index of the next entry to claim  */
+    hbool_t failed;                     /* Whether a serialize callback failed */
+#ifdef H5C_HAVE_SERIALIZE_THREADS
+    hbool_t threaded;                   /* Whether worker threads share the batch */
+    pthread_mutex_t mutex;              /* Protects 'next', 'failed' & the errors when threaded */
+    size_t nerrors;                     /* Number of errors recorded by worker threads */
+    H5E_error2_t errors[H5C__SERIALIZE_BATCH_MAX_ERRORS]; /* Errors recorded by worker threads, for the calling thread to push */
+#endif /* H5C_HAVE_SERIALIZE_THREADS */
+} H5C_serialize_batch_t;
+
+#ifdef H5C_HAVE_SERIALIZE_THREADS
+/* Worker thread of a cache's serialize pool */
+typedef struct H5C_serialize_worker_t {
+    H5C_serialize_pool_t *pool;         /* Pool the thread belongs to        */
+    unsigned idx;                       /* Index of the thread in the pool   */
+    pthread_t thread;                   /* The thread                        */
+} H5C_serialize_worker_t;
+
+/* Worker threads that share the serialization of batches with the thread
+ * flushing the cache (see the serialize_pool field of H5C_t)
+ */
+struct H5C_serialize_pool_t {
+    pthread_mutex_t mutex;              /* Protects the fields below         */
+    pthread_cond_t work_cond;           /* Signalled when a batch is posted or the pool stops */
+    pthread_cond_t done_cond;           /* Signalled when the workers are done with a batch */
+    H5C_serialize_batch_t *batch;       /* Batch being serialized            */
+    uint64_t generation;                /* Number of batches posted          */
+    unsigned nactive;                   /* Number of workers sharing the batch */
+    unsigned nbusy;                     /* Number of them still working on it */
+    hbool_t stop;                       /* Whether the workers should exit   */
+    unsigned nworkers;                  /* Number of worker threads started  */
+    H5C_serialize_worker_t workers[H5C__MAX_FLUSH_THREADS]; /* The worker threads */
+};
+#endif /* H5C_HAVE_SERIALIZE_THREADS */
+
 
 /********************/
 /* Local Prototypes */
@@ -136,6 +176,9 @@ static herr_t H5C__autoadjust__ageout__remove_excess_markers(H5C_t * cache_ptr);
 static herr_t H5C__flash_increase_cache_size(H5C_t * cache_ptr,
     size_t old_entry_size, size_t new_entry_size);
 
+static void H5C__budget_decrease_cache_size(H5C_t * cache_ptr,
+    size_t new_entry_size);
+
 static herr_t H5C_flush_invalidate_cache(H5F_t *f, hid_t dxpl_id, unsigned flags);
 
 static herr_t H5C_flush_invalidate_ring(H5F_t *f, hid_t dxpl_id, H5C_ring_t ring,
@@ -144,6 +187,19 @@ static herr_t H5C_flush_invalidate_ring(H5F_t *f, hid_t dxpl_id, H5C_ring_t ring
 static herr_t H5C_flush_ring(H5F_t *f, hid_t dxpl_id, H5C_ring_t ring,
     unsigned flags);
 
+static herr_t H5C__flush_ring_batched(H5F_t *f, hid_t dxpl_id, H5C_ring_t ring,
+    unsigned flags);
+static herr_t H5C__serialize_batch(H5C_t *cache_ptr,
+    H5C_serialize_batch_t *batch);
+static void H5C__serialize_batch_work(H5C_serialize_batch_t *batch);
+#ifdef H5C_HAVE_SERIALIZE_THREADS
+static herr_t H5C__serialize_pool_start(H5C_t *cache_ptr, unsigned nworkers);
+static void H5C__serialize_pool_stop(H5C_t *cache_ptr);
+static void *H5C__serialize_pool_thread(void *arg);
+#endif /* H5C_HAVE_SERIALIZE_THREADS */
+static herr_t H5C__write_batch(H5F_t *f, hid_t dxpl_id,
+    H5C_cache_entry_t **entries, size_t nentries);
+
 static void * H5C_load_entry(H5F_t *             f,
                              hid_t               dxpl_id,
 #ifdef H5_HAVE_PARALLEL
@@ -271,6 +327,9 @@ H5C_create(size_t		      max_cache_size,
     if(NULL == (cache_ptr->tag_list = H5SL_create(H5SL_TYPE_HADDR, NULL)))
         HGOTO_ERROR(H5E_CACHE, H5E_CANTCREATE, NULL, "can't create skip list for tagged entry addresses")
 
+    if(NULL == (cache_ptr->index = (H5C_cache_entry_t **)H5MM_calloc(((size_t)1 << H5C__HASH_TABLE_MIN_BITS) * sizeof(H5C_cache_entry_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for index")
+
     /* If we get this far, we should succeed.  Go ahead and initialize all
      * the fields.
      */
@@ -279,6 +338,9 @@ H5C_create(size_t		      max_cache_size,
 
     cache_ptr->flush_in_progress		= FALSE;
 
+    cache_ptr->flush_threads			= 0;
+    cache_ptr->serialize_pool			= NULL;
+
     cache_ptr->logging_enabled                  = FALSE;
 
     cache_ptr->currently_logging                = FALSE;
@@ -319,8 +381,8 @@ H5C_create(size_t		      max_cache_size,
 	cache_ptr->slist_ring_size[i]		= (size_t)0;
     } /* end for */
 
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++)
-        (cache_ptr->index)[i] = NULL;
+    cache_ptr->ht_bits				= H5C__HASH_TABLE_MIN_BITS;
+    cache_ptr->ht_len				= (uint32_t)1 << H5C__HASH_TABLE_MIN_BITS;
 
     cache_ptr->il_len				= 0;
     cache_ptr->il_size				= (size_t)0;
@@ -378,6 +440,11 @@ H5C_create(size_t		      max_cache_size,
     cache_ptr->dLRU_tail_ptr			= NULL;
 #endif /* H5C_MAINTAIN_CLEAN_AND_DIRTY_LRU_LISTS */
 
+    cache_ptr->rp_policy			= H5C_rp__lru;
+    cache_ptr->rp_hot_fraction			= H5C__DEFAULT_RP_HOT_FRACTION;
+    cache_ptr->rp_hot_size			= (size_t)0;
+    cache_ptr->rp_clock				= 0;
+
     cache_ptr->size_increase_possible		= FALSE;
     cache_ptr->flash_size_increase_possible     = FALSE;
     cache_ptr->flash_size_increase_threshold    = 0;
@@ -490,6 +557,9 @@ done:
             if(cache_ptr->tag_list != NULL)
                 H5SL_close(cache_ptr->tag_list);
 
+            if(cache_ptr->index != NULL)
+                cache_ptr->index = (H5C_cache_entry_t **)H5MM_xfree(cache_ptr->index);
+
             cache_ptr->magic = 0;
             cache_ptr = H5FL_FREE(H5C_t, cache_ptr);
         } /* end if */
@@ -869,6 +939,14 @@ H5C_dest(H5F_t * f, hid_t dxpl_id)
         cache_ptr->tag_list = NULL;
     } /* end if */
 
+    HDassert(cache_ptr->index_len == 0);
+    cache_ptr->index = (H5C_cache_entry_t **)H5MM_xfree(cache_ptr->index);
+
+#ifdef H5C_HAVE_SERIALIZE_THREADS
+    /* Stop the threads that serialize batches of entries */
+    H5C__serialize_pool_stop(cache_ptr);
+#endif /* H5C_HAVE_SERIALIZE_THREADS */
+
 #ifndef NDEBUG
 #if H5C_DO_SANITY_CHECKS
     if(cache_ptr->get_entry_ptr_from_addr_counter > 0)
@@ -1324,6 +1402,121 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_flush_to_min_clean() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C_write_behind
+ *
+ * Purpose:	Trickle dirty entries to disk ahead of eviction.
+ *
+ *		If more than DIRTY_RATIO of the maximum cache size is
+ *		dirty, flush dirty entries from the tail of the LRU list
+ *		(without evicting them) until half that much is dirty, or
+ *		until MAX_BYTES have been written.
+ *
+ *		Only entries that eviction could flush are considered:
+ *		pinned entries (which includes every flush dependency
+ *		parent) are not on the LRU list, and corked and prefetched
+ *		dirty entries are skipped, so flush dependency and SWMR
+ *		ordering is preserved.
+ *
+ *		Sets *MORE_PTR to TRUE if entries were written but the
+ *		cache is still above the threshold on return.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_write_behind(H5F_t *f, hid_t dxpl_id, double dirty_ratio,
+    size_t max_bytes, hbool_t *more_ptr)
+{
+    H5C_t *		cache_ptr;
+    hbool_t		write_permitted;
+    size_t		high_water;
+    size_t		low_water;
+    size_t		bytes_flushed = 0;
+    uint32_t		entries_examined = 0;
+    uint32_t		initial_list_len;
+    H5C_cache_entry_t *	entry_ptr;
+    H5C_cache_entry_t *	prev_ptr;
+    hbool_t		prev_is_dirty;
+    herr_t		ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(dirty_ratio > 0.0 && dirty_ratio <= 1.0);
+    HDassert(more_ptr);
+
+    cache_ptr = f->shared->cache;
+
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+
+    *more_ptr = FALSE;
+
+    high_water = (size_t)(dirty_ratio * (double)cache_ptr->max_cache_size);
+    if(cache_ptr->dirty_index_size <= high_water)
+        HGOTO_DONE(SUCCEED)
+    low_water = high_water / 2;
+
+    /* Leave the cache alone while it is already flushing, making space
+     * or being serialized -- the pass will be retried later.
+     */
+    if(cache_ptr->flush_in_progress || cache_ptr->msic_in_progress ||
+            cache_ptr->serialization_in_progress || cache_ptr->close_warning_received)
+        HGOTO_DONE(SUCCEED)
+
+    if(cache_ptr->check_write_permitted != NULL) {
+        if((cache_ptr->check_write_permitted)(f, &write_permitted) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "can't get write_permitted")
+    } /* end if */
+    else
+        write_permitted = cache_ptr->write_permitted;
+    if(!write_permitted)
+        HGOTO_DONE(SUCCEED)
+
+    initial_list_len = cache_ptr->LRU_list_len;
+    entry_ptr = cache_ptr->LRU_tail_ptr;
+    while(entry_ptr != NULL && cache_ptr->dirty_index_size > low_water &&
+            bytes_flushed < max_bytes && entries_examined <= (2 * initial_list_len)) {
+        HDassert(entry_ptr->magic == H5C__H5C_CACHE_ENTRY_T_MAGIC);
+        HDassert(!entry_ptr->is_protected);
+        HDassert(!entry_ptr->is_pinned);
+
+        prev_ptr = entry_ptr->prev;
+        prev_is_dirty = prev_ptr ? prev_ptr->is_dirty : FALSE;
+
+        if(entry_ptr->is_dirty && entry_ptr->type->id != H5AC_EPOCH_MARKER_ID &&
+                !entry_ptr->flush_in_progress && !entry_ptr->prefetched_dirty &&
+                !(entry_ptr->tag_info && entry_ptr->tag_info->corked)) {
+            /* Flush the entry, which moves it to the head of the LRU list */
+            cache_ptr->entries_removed_counter = 0;
+            cache_ptr->last_entry_removed_ptr  = NULL;
+            bytes_flushed += entry_ptr->size;
+
+            if(H5C__flush_single_entry(f, dxpl_id, entry_ptr, H5C__NO_FLAGS_SET) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to flush entry")
+
+            /* Start over from the tail if the flush disturbed the list */
+            if(prev_ptr != NULL && (cache_ptr->entries_removed_counter > 1 ||
+                    cache_ptr->last_entry_removed_ptr == prev_ptr ||
+                    prev_ptr->is_dirty != prev_is_dirty ||
+                    prev_ptr->is_protected || prev_ptr->is_pinned))
+                prev_ptr = cache_ptr->LRU_tail_ptr;
+        } /* end if */
+
+        entry_ptr = prev_ptr;
+        entries_examined++;
+    } /* end while */
+
+    *more_ptr = (hbool_t)(bytes_flushed > 0 && cache_ptr->dirty_index_size > high_water);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_write_behind() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C_insert_entry
@@ -1492,6 +1685,8 @@ H5C_insert_entry(H5F_t *             f,
     entry_ptr->coll_next = NULL;
     entry_ptr->coll_prev = NULL;
 #endif /* H5_HAVE_PARALLEL */
+    entry_ptr->rp_hot = FALSE;
+    entry_ptr->rp_last_ref = cache_ptr->rp_clock;
 
     /* initialize cache image related fields */
     entry_ptr->include_in_image 		= FALSE;
@@ -1526,6 +1721,10 @@ H5C_insert_entry(H5F_t *             f,
         if(H5C__flash_increase_cache_size(cache_ptr, 0, entry_ptr->size) < 0)
             HGOTO_ERROR(H5E_CACHE, H5E_CANTINS, FAIL, "H5C__flash_increase_cache_size failed")
 
+    /* Give memory back if the library is over its memory budget */
+    if(cache_ptr->evictions_enabled)
+        H5C__budget_decrease_cache_size(cache_ptr, entry_ptr->size);
+
     if(cache_ptr->index_size >= cache_ptr->max_cache_size)
         empty_space = 0;
     else
@@ -2587,6 +2786,10 @@ H5C_protect(H5F_t *		f,
                 HGOTO_ERROR(H5E_CACHE, H5E_CANTPROTECT, NULL, "H5C__flash_increase_cache_size failed")
         }
 
+        /* Give memory back if the library is over its memory budget */
+        if(cache_ptr->evictions_enabled)
+            H5C__budget_decrease_cache_size(cache_ptr, entry_ptr->size);
+
         if(cache_ptr->index_size >= cache_ptr->max_cache_size)
            empty_space = 0;
         else
@@ -2700,6 +2903,18 @@ H5C_protect(H5F_t *		f,
     HDassert(entry_ptr->addr == addr);
     HDassert(entry_ptr->type == type);
 
+    /* Under the 2Q policy, a hit that isn't correlated with the previous
+     * reference to the entry promotes it to the hot set.
+     */
+    if(cache_ptr->rp_policy == H5C_rp__2q) {
+        if(hit && !entry_ptr->rp_hot &&
+                (cache_ptr->rp_clock - entry_ptr->rp_last_ref) > H5C__2Q_CORRELATED_REF_PERIOD) {
+            entry_ptr->rp_hot = TRUE;
+            cache_ptr->rp_hot_size += entry_ptr->size;
+        } /* end if */
+        entry_ptr->rp_last_ref = cache_ptr->rp_clock++;
+    } /* end if */
+
     if(entry_ptr->is_protected) {
 	if(read_only && entry_ptr->is_read_only) {
 	    HDassert(entry_ptr->ro_ref_count > 0);
@@ -3106,6 +3321,74 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_set_evictions_enabled() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C_set_flush_threads()
+ *
+ * Purpose:     Set the number of threads that serialize dirty entries
+ *              when the cache is flushed.  Zero disables batched
+ *              serialization.  See the flush_threads field of H5C_t.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_set_flush_threads(H5C_t *cache_ptr, unsigned nthreads)
+{
+    herr_t ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if((cache_ptr == NULL) || (cache_ptr->magic != H5C__H5C_T_MAGIC))
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Bad cache_ptr on entry")
+    if(nthreads > H5C__MAX_FLUSH_THREADS)
+        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "too many flush threads")
+
+    cache_ptr->flush_threads = nthreads;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_set_flush_threads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C_set_replacement_policy()
+ *
+ * Purpose:     Select the replacement policy used by the cache, and the
+ *              fraction of the cache that hot entries may occupy under
+ *              the 2Q policy.
+ *
+ *              Switching policies doesn't disturb the LRU -- entries
+ *              promoted under 2Q simply stop being treated specially
+ *              under LRU, and are again if 2Q is re-selected.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_set_replacement_policy(H5C_t *cache_ptr, enum H5C_cache_rp_policy policy,
+    double hot_fraction)
+{
+    herr_t ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if((cache_ptr == NULL) || (cache_ptr->magic != H5C__H5C_T_MAGIC))
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Bad cache_ptr on entry")
+    if((policy != H5C_rp__lru) && (policy != H5C_rp__2q))
+        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "unknown replacement policy")
+    if((policy == H5C_rp__2q) && ((hot_fraction <= 0.0f) || (hot_fraction >= 1.0f)))
+        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "hot_fraction must lie in (0.0, 1.0)")
+
+    cache_ptr->rp_policy = policy;
+    cache_ptr->rp_hot_fraction = hot_fraction;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_set_replacement_policy() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C_unpin_entry_from_client()
@@ -5208,6 +5491,56 @@ done:
 
 } /* H5C__flash_increase_cache_size() */
 
+
+/*-------------------------------------------------------------------------
+ *
+ * Function:    H5C__budget_decrease_cache_size
+ *
+ * Purpose:     If the library would be over its memory budget (see
+ *              H5set_memory_limit()) with a new entry of new_entry_size
+ *              bytes in the cache, lower max_cache_size by as much as
+ *              the library is over, but not below
+ *              (cache_ptr->resize_ctl).min_size.
+ *
+ *              The entries are evicted by the caller's usual check of
+ *              the cache size against max_cache_size before the new
+ *              entry goes in, and by the check of size_decreased at the
+ *              end of H5C_protect().  Auto resize may grow the cache
+ *              again later, if the budget allows.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5C__budget_decrease_cache_size(H5C_t * cache_ptr, size_t new_entry_size)
+{
+    size_t overage;
+    size_t new_max_cache_size;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+
+    if((overage = H5MM_budget_overage(new_entry_size)) > 0) {
+        /* Leave room for the new entry in what remains */
+        if(cache_ptr->index_size + new_entry_size > overage + (cache_ptr->resize_ctl).min_size)
+            new_max_cache_size = cache_ptr->index_size + new_entry_size - overage;
+        else
+            new_max_cache_size = (cache_ptr->resize_ctl).min_size;
+
+        if(new_max_cache_size < cache_ptr->max_cache_size) {
+            cache_ptr->max_cache_size = new_max_cache_size;
+            cache_ptr->min_clean_size = (size_t)((double)new_max_cache_size *
+                    ((cache_ptr->resize_ctl).min_clean_fraction));
+            cache_ptr->size_decreased = TRUE;
+        } /* end if */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* H5C__budget_decrease_cache_size() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C_flush_invalidate_cache
@@ -5882,6 +6215,17 @@ H5C_flush_ring(H5F_t *f, hid_t dxpl_id, H5C_ring_t ring,  unsigned flags)
      */
     flushed_entries_last_pass = TRUE;
 
+    /* If requested, flush the entries that can be serialized concurrently
+     * in batches first.  The loop below then takes care of the rest of the
+     * ring.  Marked-entry flushes, the parallel case and flushes that
+     * build a cache image always take the loop below.
+     */
+    if(cache_ptr->flush_threads > 0 && !flush_marked_entries
+            && cache_ptr->aux_ptr == NULL
+            && !(cache_ptr->close_warning_received && cache_ptr->image_ctl.generate_image))
+        if(H5C__flush_ring_batched(f, dxpl_id, ring, flags) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "can't flush batched entries")
+
     /* Set the cache_ptr->slist_changed to false.
      *
      * This flag is set to TRUE by H5C__flush_single_entry if the 
@@ -6070,6 +6414,570 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_flush_ring() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__flush_ring_batched
+ *
+ * Purpose:	Flush the dirty entries of the specified ring whose client
+ *		class sets H5C__CLASS_PARALLEL_SERIALIZE_FLAG, a batch at a
+ *		time.
+ *
+ *		Each batch holds the unprotected entries of such classes
+ *		that are not held back by dirty flush dependency children,
+ *		in address order.  The entries' pre_serialize callbacks are
+ *		called on this thread, the entries are serialized (and so
+ *		checksummed) on cache_ptr->flush_threads threads, their
+ *		images are written in address order with adjacent images
+ *		combined into single writes, and then each entry is marked
+ *		clean as H5C__flush_single_entry() would.
+ *
+ *		Callbacks may take entries out of the cache, possibly ones
+ *		in the batch.  When that happens, the rest of the batch is
+ *		left for the next one, which is collected from the slist
+ *		afresh.
+ *
+ *		Since a flush dependency parent is only taken once all its
+ *		children are clean, i.e. in a batch after the one that
+ *		flushed the last of them, flush dependency order is
+ *		preserved.  Entries left over (other classes, flush-me-last
+ *		entries, parents of dirty entries of other classes, ...)
+ *		are flushed by the caller as usual.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__flush_ring_batched(H5F_t *f, hid_t dxpl_id, H5C_ring_t ring, unsigned flags)
+{
+    H5C_t *		cache_ptr = f->shared->cache;
+    H5C_serialize_batch_t batch;
+    H5C_cache_entry_t ** entries = NULL;
+    H5C_cache_entry_t *	entry_ptr;
+    H5SL_node_t * 	node_ptr;
+    size_t		nentries;
+    size_t		u;
+    herr_t		ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(cache_ptr->flush_threads > 0);
+    HDassert(cache_ptr->flush_in_progress);
+    HDassert((flags & H5C__FLUSH_MARKED_ENTRIES_FLAG) == 0);
+
+    if(NULL == (entries = (H5C_cache_entry_t **)H5MM_malloc(sizeof(H5C_cache_entry_t *) * H5C__SERIALIZE_BATCH_MAX_ENTRIES)))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for serialize batch")
+
+    do {
+        /* Collect the next batch */
+        nentries = 0;
+        for(node_ptr = H5SL_first(cache_ptr->slist_ptr);
+                node_ptr != NULL && nentries < H5C__SERIALIZE_BATCH_MAX_ENTRIES;
+                node_ptr = H5SL_next(node_ptr)) {
+            entry_ptr = (H5C_cache_entry_t *)H5SL_item(node_ptr);
+
+            HDassert(entry_ptr->magic == H5C__H5C_CACHE_ENTRY_T_MAGIC);
+            HDassert(entry_ptr->is_dirty);
+            HDassert(entry_ptr->in_slist);
+
+            if(entry_ptr->ring == ring && !entry_ptr->is_protected
+                    && !entry_ptr->flush_me_last && !entry_ptr->prefetched
+                    && entry_ptr->flush_dep_ndirty_children == 0
+                    && (entry_ptr->type->flags & H5C__CLASS_PARALLEL_SERIALIZE_FLAG)) {
+                HDassert(entry_ptr->flush_dep_nunser_children == 0);
+
+                entries[nentries++] = entry_ptr;
+            } /* end if */
+        } /* end for */
+
+        if(nentries == 0)
+            break;
+
+        /* Make sure every entry has an image buffer */
+        for(u = 0; u < nentries; u++) {
+            entry_ptr = entries[u];
+
+            if(NULL == entry_ptr->image_ptr) {
+                if(NULL == (entry_ptr->image_ptr = H5MM_malloc(entry_ptr->size + H5C_IMAGE_EXTRA_SPACE)))
+                    HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for on disk image buffer")
+#if H5C_DO_MEMORY_SANITY_CHECKS
+                HDmemcpy(((uint8_t *)entry_ptr->image_ptr) + entry_ptr->size, H5C_IMAGE_SANITY_VALUE, H5C_IMAGE_EXTRA_SPACE);
+#endif /* H5C_DO_MEMORY_SANITY_CHECKS */
+            } /* end if */
+        } /* end for */
+
+        /* Call the pre_serialize callbacks of the entries whose images
+         * are out of date.  These may touch the cache (e.g. an object
+         * header message inserting into the global heap), so start over if
+         * they took entries out of it or changed the slist.
+         */
+        cache_ptr->entries_removed_counter = 0;
+        cache_ptr->slist_changed = FALSE;
+        for(u = 0; u < nentries; u++) {
+            entry_ptr = entries[u];
+
+            if(!entry_ptr->image_up_to_date && entry_ptr->type->pre_serialize) {
+                haddr_t new_addr = HADDR_UNDEF;
+                size_t new_len = 0;
+                unsigned serialize_flags = H5C__SERIALIZE_NO_FLAGS_SET;
+
+                if((entry_ptr->type->pre_serialize)(f, dxpl_id, (void *)entry_ptr, entry_ptr->addr, entry_ptr->size, &new_addr, &new_len, &serialize_flags) < 0)
+                    HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to pre-serialize entry")
+                if(serialize_flags != H5C__SERIALIZE_NO_FLAGS_SET)
+                    HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "entry resized or moved by pre-serialize callback")
+
+                if(cache_ptr->entries_removed_counter > 0 || cache_ptr->slist_changed) {
+                    H5C__UPDATE_STATS_FOR_SLIST_SCAN_RESTART(cache_ptr)
+                    break;
+                } /* end if */
+            } /* end if */
+        } /* end for */
+        if(u < nentries)
+            continue;
+
+        /* Serialize the entries whose images are out of date */
+        batch.f = f;
+        batch.entries = entries;
+        batch.nentries = nentries;
+        batch.next = 0;
+        batch.failed = FALSE;
+        if(H5C__serialize_batch(cache_ptr, &batch) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to serialize entries")
+
+        /* Record the new images, and propagate the fact that the entries
+         * are serialized up the flush dependency chains, as
+         * H5C__generate_image() would.
+         */
+        for(u = 0; u < nentries; u++) {
+            entry_ptr = entries[u];
+
+            if(!entry_ptr->image_up_to_date) {
+#if H5C_DO_MEMORY_SANITY_CHECKS
+                HDassert(0 == HDmemcmp(((uint8_t *)entry_ptr->image_ptr) + entry_ptr->size, H5C_IMAGE_SANITY_VALUE, H5C_IMAGE_EXTRA_SPACE));
+#endif /* H5C_DO_MEMORY_SANITY_CHECKS */
+                entry_ptr->image_up_to_date = TRUE;
+
+                if(entry_ptr->flush_dep_nparents > 0)
+                    if(H5C__mark_flush_dep_serialized(entry_ptr) < 0)
+                        HGOTO_ERROR(H5E_CACHE, H5E_CANTNOTIFY, FAIL, "Can't propagate serialization status to fd parents")
+            } /* end if */
+        } /* end for */
+
+        /* Write the images */
+        if(H5C__write_batch(f, dxpl_id, entries, nentries) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "can't write serialize batch")
+
+        /* Finish flushing the entries.  An entry that was dirtied again by
+         * a callback since its image was written is flushed from scratch.
+         * If a callback took entries out of the cache or changed the slist,
+         * the rest of the batch may be gone, so leave it to the next batch.
+         */
+        cache_ptr->slist_changed = FALSE;
+        for(u = 0; u < nentries; u++) {
+            entry_ptr = entries[u];
+
+            cache_ptr->entries_removed_counter = 0;
+            if(H5C__flush_single_entry(f, dxpl_id, entry_ptr, flags | H5C__DURING_FLUSH_FLAG
+                    | (entry_ptr->image_up_to_date ? H5C__IMAGE_WRITTEN_FLAG : 0)) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Can't flush entry")
+
+            if(cache_ptr->entries_removed_counter > 0 || cache_ptr->slist_changed) {
+                H5C__UPDATE_STATS_FOR_SLIST_SCAN_RESTART(cache_ptr)
+                break;
+            } /* end if */
+        } /* end for */
+    } while(nentries > 0);
+
+done:
+    if(entries)
+        entries = (H5C_cache_entry_t **)H5MM_xfree(entries);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__flush_ring_batched() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__serialize_batch
+ *
+ * Purpose:	Call the serialize callbacks of the entries in BATCH whose
+ *		images are out of date, sharing the work between the calling
+ *		thread and up to cache_ptr->flush_threads - 1 threads of the
+ *		cache's serialize pool.
+ *
+ *		Only the serialize callbacks run on the workers.  Everything
+ *		that touches the cache's data structures is left to the
+ *		caller.  The workers record errors quietly on their own
+ *		error stacks, and the calling thread pushes them on its own
+ *		once the batch is done.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__serialize_batch(H5C_t *cache_ptr, H5C_serialize_batch_t *batch)
+{
+#ifdef H5C_HAVE_SERIALIZE_THREADS
+    H5C_serialize_pool_t * pool = NULL;
+    unsigned		nworkers = 0;
+    size_t		u;
+#endif /* H5C_HAVE_SERIALIZE_THREADS */
+    herr_t		ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(cache_ptr);
+    HDassert(batch);
+    HDassert(batch->nentries > 0);
+
+#ifdef H5C_HAVE_SERIALIZE_THREADS
+    batch->threaded = FALSE;
+    batch->nerrors = 0;
+    if(cache_ptr->flush_threads > 1 && batch->nentries > 1) {
+        nworkers = (unsigned)MIN(cache_ptr->flush_threads - 1, batch->nentries - 1);
+        if(H5C__serialize_pool_start(cache_ptr, nworkers) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTINIT, FAIL, "can't start serialize threads")
+        pool = cache_ptr->serialize_pool;
+
+        /* If the system wouldn't give us as many threads as requested,
+         * make do with the ones we have.
+         */
+        nworkers = MIN(nworkers, pool->nworkers);
+        if(nworkers > 0) {
+            if(0 != pthread_mutex_init(&batch->mutex, NULL))
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTINIT, FAIL, "can't initialize serialize batch mutex")
+            batch->threaded = TRUE;
+
+            /* Hand the batch to the workers */
+            pthread_mutex_lock(&pool->mutex);
+            pool->batch = batch;
+            pool->nactive = nworkers;
+            pool->nbusy = nworkers;
+            pool->generation++;
+            pthread_cond_broadcast(&pool->work_cond);
+            pthread_mutex_unlock(&pool->mutex);
+        } /* end if */
+    } /* end if */
+#endif /* H5C_HAVE_SERIALIZE_THREADS */
+
+    /* The calling thread serializes entries too */
+    H5C__serialize_batch_work(batch);
+
+#ifdef H5C_HAVE_SERIALIZE_THREADS
+    if(batch->threaded) {
+        /* Wait for the workers to finish with the batch */
+        pthread_mutex_lock(&pool->mutex);
+        while(pool->nbusy > 0)
+            pthread_cond_wait(&pool->done_cond, &pool->mutex);
+        pool->batch = NULL;
+        pthread_mutex_unlock(&pool->mutex);
+        pthread_mutex_destroy(&batch->mutex);
+
+        /* Push the errors the workers recorded */
+        for(u = 0; u < batch->nerrors; u++) {
+            const H5E_error2_t *err = &batch->errors[u];
+
+            (void)H5E_push_stack(NULL, err->file_name, err->func_name, err->line,
+                    err->cls_id, err->maj_num, err->min_num, err->desc);
+        } /* end for */
+    } /* end if */
+#endif /* H5C_HAVE_SERIALIZE_THREADS */
+
+    if(batch->failed)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to serialize entry")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__serialize_batch() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__serialize_batch_work
+ *
+ * Purpose:	Claim entries of BATCH one at a time and serialize them
+ *		until none are left.  Run by each thread sharing the batch.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5C__serialize_batch_work(H5C_serialize_batch_t *batch)
+{
+    H5C_cache_entry_t *	entry_ptr;
+    size_t		u;
+    hbool_t		failed;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for(;;) {
+#ifdef H5C_HAVE_SERIALIZE_THREADS
+        if(batch->threaded)
+            pthread_mutex_lock(&batch->mutex);
+#endif /* H5C_HAVE_SERIALIZE_THREADS */
+        u = batch->next++;
+#ifdef H5C_HAVE_SERIALIZE_THREADS
+        if(batch->threaded)
+            pthread_mutex_unlock(&batch->mutex);
+#endif /* H5C_HAVE_SERIALIZE_THREADS */
+
+        if(u >= batch->nentries)
+            break;
+
+        entry_ptr = batch->entries[u];
+        if(entry_ptr->image_up_to_date)
+            continue;
+
+        failed = (entry_ptr->type->serialize(batch->f, entry_ptr->image_ptr, entry_ptr->size, (void *)entry_ptr) < 0);
+
+        if(failed) {
+#ifdef H5C_HAVE_SERIALIZE_THREADS
+            if(batch->threaded)
+                pthread_mutex_lock(&batch->mutex);
+#endif /* H5C_HAVE_SERIALIZE_THREADS */
+            batch->failed = TRUE;
+#ifdef H5C_HAVE_SERIALIZE_THREADS
+            if(batch->threaded)
+                pthread_mutex_unlock(&batch->mutex);
+#endif /* H5C_HAVE_SERIALIZE_THREADS */
+        } /* end if */
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* H5C__serialize_batch_work() */
+
+#ifdef H5C_HAVE_SERIALIZE_THREADS
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__serialize_pool_start
+ *
+ * Purpose:	Make sure the cache's serialize pool has at least NWORKERS
+ *		worker threads, creating the pool if necessary.  Failing to
+ *		start a thread is not an error; the pool just has fewer.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__serialize_pool_start(H5C_t *cache_ptr, unsigned nworkers)
+{
+    H5C_serialize_pool_t * pool = cache_ptr->serialize_pool;
+    herr_t		ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(nworkers <= H5C__MAX_FLUSH_THREADS);
+
+    if(NULL == pool) {
+        if(NULL == (pool = (H5C_serialize_pool_t *)H5MM_calloc(sizeof(H5C_serialize_pool_t))))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for serialize pool")
+        if(0 != pthread_mutex_init(&pool->mutex, NULL)) {
+            pool = (H5C_serialize_pool_t *)H5MM_xfree(pool);
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTINIT, FAIL, "can't initialize serialize pool mutex")
+        } /* end if */
+        pthread_cond_init(&pool->work_cond, NULL);
+        pthread_cond_init(&pool->done_cond, NULL);
+        cache_ptr->serialize_pool = pool;
+    } /* end if */
+
+    while(pool->nworkers < nworkers) {
+        H5C_serialize_worker_t *worker = &pool->workers[pool->nworkers];
+
+        worker->pool = pool;
+        worker->idx = pool->nworkers;
+        if(0 != pthread_create(&worker->thread, NULL, H5C__serialize_pool_thread, worker))
+            break;
+        pool->nworkers++;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__serialize_pool_start() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__serialize_pool_stop
+ *
+ * Purpose:	Stop and join the threads of the cache's serialize pool,
+ *		if it has one, and free the pool.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5C__serialize_pool_stop(H5C_t *cache_ptr)
+{
+    H5C_serialize_pool_t * pool = cache_ptr->serialize_pool;
+    unsigned		u;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(pool) {
+        pthread_mutex_lock(&pool->mutex);
+        pool->stop = TRUE;
+        pthread_cond_broadcast(&pool->work_cond);
+        pthread_mutex_unlock(&pool->mutex);
+
+        for(u = 0; u < pool->nworkers; u++)
+            pthread_join(pool->workers[u].thread, NULL);
+
+        pthread_cond_destroy(&pool->done_cond);
+        pthread_cond_destroy(&pool->work_cond);
+        pthread_mutex_destroy(&pool->mutex);
+        cache_ptr->serialize_pool = (H5C_serialize_pool_t *)H5MM_xfree(pool);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* H5C__serialize_pool_stop() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__serialize_pool_thread
+ *
+ * Purpose:	Body of a thread of a cache's serialize pool.  Waits for
+ *		H5C__serialize_batch() to post a batch, helps serialize it if
+ *		the thread is among the ones the batch asked for, and hands
+ *		the errors it recorded to the batch, until the pool stops.
+ *
+ *		The thread doesn't hold the API lock, so it records errors
+ *		quietly, which takes no references on the error IDs.
+ *
+ * Return:      NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5C__serialize_pool_thread(void *arg)
+{
+    H5C_serialize_worker_t *worker = (H5C_serialize_worker_t *)arg;
+    H5C_serialize_pool_t * pool = worker->pool;
+    H5C_serialize_batch_t * batch;
+    uint64_t		generation = 0;
+
+    (void)H5E_set_quiet(NULL, TRUE);
+
+    pthread_mutex_lock(&pool->mutex);
+    for(;;) {
+        while(!pool->stop && pool->generation == generation)
+            pthread_cond_wait(&pool->work_cond, &pool->mutex);
+        if(pool->stop)
+            break;
+        generation = pool->generation;
+
+        /* Skip batches that asked for fewer threads, including the last
+         * one posted before this thread started.
+         */
+        if(worker->idx >= pool->nactive)
+            continue;
+        batch = pool->batch;
+        pthread_mutex_unlock(&pool->mutex);
+
+        H5C__serialize_batch_work(batch);
+
+        /* Hand over the errors recorded */
+        pthread_mutex_lock(&batch->mutex);
+        batch->nerrors += H5E_take_quiet_errors(NULL, batch->errors + batch->nerrors,
+                H5C__SERIALIZE_BATCH_MAX_ERRORS - batch->nerrors);
+        pthread_mutex_unlock(&batch->mutex);
+
+        pthread_mutex_lock(&pool->mutex);
+        if(0 == --pool->nbusy)
+            pthread_cond_signal(&pool->done_cond);
+    } /* end for */
+    pthread_mutex_unlock(&pool->mutex);
+
+    return(NULL);
+} /* H5C__serialize_pool_thread() */
+#endif /* H5C_HAVE_SERIALIZE_THREADS */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__write_batch
+ *
+ * Purpose:	Write the up to date images of ENTRIES, which are sorted by
+ *		address, to the file.  Runs of entries of the same memory
+ *		type that are adjacent in the file are gathered into one
+ *		buffer of at most H5C__COALESCED_WRITE_MAX_SIZE bytes and
+ *		written together.  Without a page buffer, that is -- the
+ *		page buffer must see each entry's write on its own.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__write_batch(H5F_t *f, hid_t dxpl_id, H5C_cache_entry_t **entries,
+    size_t nentries)
+{
+    H5C_t *		cache_ptr = f->shared->cache;
+    uint8_t *		buf = NULL;     /* Buffer for gathering images */
+    hbool_t		coalesce;
+    size_t		u, v, w;
+    herr_t		ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(cache_ptr);
+    HDassert(entries);
+
+#if H5C_DO_SANITY_CHECKS
+    if(cache_ptr->check_write_permitted && !(cache_ptr->write_permitted))
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Write when writes are always forbidden!?!?!")
+#endif /* H5C_DO_SANITY_CHECKS */
+
+    coalesce = (f->shared->page_buf == NULL);
+
+    for(u = 0; u < nentries; u = v) {
+        H5FD_mem_t mem_type = entries[u]->type->mem_type;
+        haddr_t addr = entries[u]->addr;
+        size_t len = entries[u]->size;
+
+        HDassert(entries[u]->image_up_to_date);
+        HDassert(0 == (entries[u]->type->flags & H5C__CLASS_SKIP_WRITES));
+
+        /* Find the run of entries that can be written with this one */
+        for(v = u + 1; coalesce && v < nentries; v++) {
+            HDassert(H5F_addr_lt(entries[v - 1]->addr, entries[v]->addr));
+
+            if(entries[v]->type->mem_type != mem_type
+                    || !H5F_addr_eq(addr + len, entries[v]->addr)
+                    || (len + entries[v]->size) > H5C__COALESCED_WRITE_MAX_SIZE)
+                break;
+            len += entries[v]->size;
+        } /* end for */
+
+        if(v == u + 1) {
+            if(H5F_block_write(f, mem_type, addr, len, dxpl_id, entries[u]->image_ptr) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Can't write image to file")
+        } /* end if */
+        else {
+            uint8_t *p;
+
+            if(NULL == buf)
+                if(NULL == (buf = (uint8_t *)H5MM_malloc(H5C__COALESCED_WRITE_MAX_SIZE)))
+                    HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for write buffer")
+
+            for(w = u, p = buf; w < v; w++) {
+                HDmemcpy(p, entries[w]->image_ptr, entries[w]->size);
+                p += entries[w]->size;
+            } /* end for */
+
+            if(H5F_block_write(f, mem_type, addr, len, dxpl_id, buf) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Can't write images to file")
+        } /* end else */
+    } /* end for */
+
+done:
+    if(buf)
+        buf = (uint8_t *)H5MM_xfree(buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__write_batch() */
+
 
 /*-------------------------------------------------------------------------
  *
@@ -6115,6 +7023,7 @@ H5C__flush_single_entry(H5F_t *f, hid_t dxpl_id, H5C_cache_entry_t *entry_ptr,
     hbool_t		take_ownership;		/* external flag */
     hbool_t             del_from_slist_on_destroy;    /* external flag */
     hbool_t		during_flush;		/* external flag */
+    hbool_t		image_written;		/* external flag */
     hbool_t		write_entry;		/* internal flag */
     hbool_t		destroy_entry;		/* internal flag */
     hbool_t		generate_image;		/* internal flag */
@@ -6145,6 +7054,7 @@ H5C__flush_single_entry(H5F_t *f, hid_t dxpl_id, H5C_cache_entry_t *entry_ptr,
     during_flush           = ((flags & H5C__DURING_FLUSH_FLAG) != 0);
     generate_image         = ((flags & H5C__GENERATE_IMAGE_FLAG) != 0);
     update_page_buffer     = ((flags & H5C__UPDATE_PAGE_BUFFER_FLAG) != 0);
+    image_written          = ((flags & H5C__IMAGE_WRITTEN_FLAG) != 0);
 
     /* Set the flag for destroying the entry, based on the 'take ownership'
      * and 'destroy' flags
@@ -6259,14 +7169,17 @@ H5C__flush_single_entry(H5F_t *f, hid_t dxpl_id, H5C_cache_entry_t *entry_ptr,
             HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Write when writes are always forbidden!?!?!")
 #endif /* H5C_DO_SANITY_CHECKS */
 
-        /* Write the image to disk unless the write is suppressed.
+        /* Write the image to disk unless the write is suppressed, or
+         * the caller has already written it.
          *
-         * This happens if both suppress_image_entry_writes and 
+         * The write is suppressed if both suppress_image_entry_writes and 
          * entry_ptr->include_in_image are TRUE, or if the 
          * H5AC__CLASS_SKIP_WRITES is set in the entry's type.  This
          * flag should only be used in test code
          */
-        if((!suppress_image_entry_writes || !entry_ptr->include_in_image)
+        HDassert(!image_written || entry_ptr->image_up_to_date);
+        if(!image_written
+                && (!suppress_image_entry_writes || !entry_ptr->include_in_image)
                 && (((entry_ptr->type->flags) & H5C__CLASS_SKIP_WRITES) == 0)) {
             H5FD_mem_t mem_type = H5FD_MEM_DEFAULT;
 
@@ -6962,6 +7875,8 @@ H5C_load_entry(H5F_t *              f,
     entry->coll_next                    = NULL;
     entry->coll_prev                    = NULL;
 #endif /* H5_HAVE_PARALLEL */
+    entry->rp_hot                       = FALSE;
+    entry->rp_last_ref                  = f->shared->cache->rp_clock;
 
     /* initialize cache image related fields */
     entry->include_in_image             = FALSE;
@@ -7001,6 +7916,61 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_load_entry() */
 
+
+/*-------------------------------------------------------------------------
+ *
+ * Function:    H5C__resize_index
+ *
+ * Purpose:     Rebuild the index with 2^new_bits buckets, rehashing every
+ *		entry.  Entries are found through the index list, so the
+ *		old buckets need not be scanned.
+ *
+ *		Called from the index insertion and deletion macros when
+ *		the load of the index leaves its allowed range.  Resizing
+ *		is an optimization only: if the new array can't be
+ *		allocated the index keeps its current size.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5C__resize_index(H5C_t *cache_ptr, unsigned new_bits)
+{
+    H5C_cache_entry_t **new_index;
+    H5C_cache_entry_t *entry_ptr;
+    size_t new_len;
+    int k;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(new_bits >= H5C__HASH_TABLE_MIN_BITS);
+    HDassert(new_bits <= H5C__HASH_TABLE_MAX_BITS);
+
+    new_len = (size_t)1 << new_bits;
+    if(NULL != (new_index = (H5C_cache_entry_t **)H5MM_calloc(new_len * sizeof(H5C_cache_entry_t *)))) {
+        for(entry_ptr = cache_ptr->il_head; entry_ptr != NULL; entry_ptr = entry_ptr->il_next) {
+            k = H5C__HASH_BITS_FCN(new_bits, entry_ptr->addr);
+            entry_ptr->ht_prev = NULL;
+            entry_ptr->ht_next = new_index[k];
+            if(new_index[k] != NULL)
+                new_index[k]->ht_prev = entry_ptr;
+            new_index[k] = entry_ptr;
+        } /* end for */
+
+        H5MM_xfree(cache_ptr->index);
+        cache_ptr->index = new_index;
+        cache_ptr->ht_bits = new_bits;
+        cache_ptr->ht_len = (uint32_t)new_len;
+
+        H5C__UPDATE_STATS_FOR_HT_RESIZE(cache_ptr)
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* H5C__resize_index() */
+
 
 /*-------------------------------------------------------------------------
  *
@@ -7163,8 +8133,28 @@ H5C__make_space_in_cache(H5F_t *f, hid_t dxpl_id, size_t space_needed,
                     cache_ptr->entries_scanned_to_make_space++;
 #endif /* H5C_COLLECT_CACHE_STATS */
 
-                    if(H5C__flush_single_entry(f, dxpl_id, entry_ptr, H5C__FLUSH_INVALIDATE_FLAG | H5C__DEL_FROM_SLIST_ON_DESTROY_FLAG) < 0)
-                        HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to flush entry")
+                    if((cache_ptr->rp_policy == H5C_rp__2q) && entry_ptr->rp_hot &&
+                            ((double)cache_ptr->rp_hot_size <=
+                                cache_ptr->rp_hot_fraction * (double)cache_ptr->max_cache_size)) {
+                        /* Hot entry, and the hot set is within its quota --
+                         * give it another trip through the LRU instead of
+                         * evicting it.
+                         */
+                        H5C__FAKE_RP_FOR_MOST_RECENT_ACCESS(cache_ptr, entry_ptr, FAIL)
+                        didnt_flush_entry = TRUE;
+                    } /* end if */
+                    else {
+                        /* Demote hot entries in excess of the quota as they
+                         * reach the tail of the LRU.
+                         */
+                        if(entry_ptr->rp_hot) {
+                            entry_ptr->rp_hot = FALSE;
+                            cache_ptr->rp_hot_size -= entry_ptr->size;
+                        } /* end if */
+
+                        if(H5C__flush_single_entry(f, dxpl_id, entry_ptr, H5C__FLUSH_INVALIDATE_FLAG | H5C__DEL_FROM_SLIST_ON_DESTROY_FLAG) < 0)
+                            HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to flush entry")
+                    } /* end else */
                 } else {
                     /* We have enough space so don't flush clean entry. */
 #if H5C_COLLECT_CACHE_STATS
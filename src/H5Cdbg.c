@@ -110,7 +110,7 @@ H5C_dump_cache(H5C_t * cache_ptr, const char *  cache_name)
      * Do this, as we want to display cache entries in increasing address
      * order.
      */
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++) {
+    for(i = 0; i < (int)cache_ptr->ht_len; i++) {
         entry_ptr = cache_ptr->index[i];
 
         while(entry_ptr != NULL) {
@@ -670,6 +670,18 @@ H5C_stats(H5C_t * cache_ptr,
               average_successful_search_depth,
               average_failed_search_depth);
 
+    HDfprintf(stdout,
+              "%s  max HT search depth / HT resizes   = %d / %ld\n",
+              cache_ptr->prefix,
+              cache_ptr->max_ht_search_depth,
+              (long)(cache_ptr->ht_resizes));
+
+    HDfprintf(stdout,
+              "%s  HT buckets / Av. entries per bucket = %lu / %f\n",
+              cache_ptr->prefix,
+              (unsigned long)(cache_ptr->ht_len),
+              (double)(cache_ptr->index_len) / (double)(cache_ptr->ht_len));
+
     HDfprintf(stdout,
              "%s  current (max) index size / length  = %ld (%ld) / %lu (%lu)\n",
               cache_ptr->prefix,
@@ -1070,6 +1082,8 @@ H5C_stats__reset(H5C_t H5_ATTR_UNUSED * cache_ptr)
     cache_ptr->total_successful_ht_search_depth	= 0;
     cache_ptr->failed_ht_searches		= 0;
     cache_ptr->total_failed_ht_search_depth	= 0;
+    cache_ptr->max_ht_search_depth		= 0;
+    cache_ptr->ht_resizes			= 0;
 
     cache_ptr->max_index_len			= 0;
     cache_ptr->max_index_size			= (size_t)0;
@@ -657,6 +657,8 @@ H5C__deserialize_prefetched_entry(H5F_t *f, hid_t dxpl_id, H5C_t *cache_ptr,
     pf_entry_ptr->coll_next                 	= NULL;
     pf_entry_ptr->coll_prev                 	= NULL;
 #endif /* H5_HAVE_PARALLEL */
+    ds_entry_ptr->rp_hot                    	= FALSE;
+    ds_entry_ptr->rp_last_ref               	= cache_ptr->rp_clock;
 
     /* Initialize cache image related fields */
     ds_entry_ptr->include_in_image          	= FALSE;
@@ -37,8 +37,18 @@
 #include "H5Cprivate.h"
 
 /* Other private headers needed by this file */
+#include "H5MMprivate.h"        /* Memory management                    */
 #include "H5SLprivate.h"        /* Skip lists */
 
+/* Flushes serialize batches of entries on worker threads only in threadsafe
+ * builds, where each thread has its own error and function stacks for the
+ * serialize callbacks to use (see the flush_threads field of H5C_t).
+ */
+#if defined(H5_HAVE_THREADSAFE) && !defined(H5_HAVE_WIN_THREADS)
+#define H5C_HAVE_SERIALIZE_THREADS
+#include <pthread.h>
+#endif
+
 /**************************/
 /* Package Private Macros */
 /**************************/
@@ -47,9 +57,26 @@
 #define H5C__MAX_EPOCH_MARKERS                  10
 
 /* Cache configuration settings */
-#define H5C__HASH_TABLE_LEN     (64 * 1024) /* must be a power of 2 */
+#define H5C__HASH_TABLE_MIN_BITS 10      /* Initial & minimum index size is 2^this buckets */
+#define H5C__HASH_TABLE_MAX_BITS 28      /* Maximum index size is 2^this buckets */
 #define H5C__H5C_T_MAGIC	0x005CAC0E
 
+/* Under the 2Q replacement policy, a hit on an entry promotes it to the
+ * hot set only if more than this many protects have been performed since
+ * its last reference.
+ */
+#define H5C__2Q_CORRELATED_REF_PERIOD   32
+
+/* Limits on the batches of entries serialized together when the cache is
+ * flushed with flush_threads set: the number of entries in one batch, and
+ * the size of one write assembled from the images of adjacent entries.
+ */
+#define H5C__SERIALIZE_BATCH_MAX_ENTRIES        4096
+#define H5C__COALESCED_WRITE_MAX_SIZE           ((size_t)(1024 * 1024))
+
+/* Most errors from worker threads kept for one batch */
+#define H5C__SERIALIZE_BATCH_MAX_ERRORS         32
+
 /* Initial allocated size of the "flush_dep_parent" array */
 #define H5C_FLUSH_DEP_PARENT_INIT 8
 
@@ -665,7 +692,12 @@ if ( ( ( ( (head_ptr) == NULL ) || ( (tail_ptr) == NULL ) ) &&             \
 	} else {                                                    \
 	    (cache_ptr)->failed_ht_searches++;                      \
 	    (cache_ptr)->total_failed_ht_search_depth += depth;     \
-	}
+	}                                                           \
+	if ( (depth) > (cache_ptr)->max_ht_search_depth )           \
+	    (cache_ptr)->max_ht_search_depth = (depth);
+
+#define H5C__UPDATE_STATS_FOR_HT_RESIZE(cache_ptr) \
+	(cache_ptr)->ht_resizes++;
 
 #define H5C__UPDATE_STATS_FOR_UNPIN(cache_ptr, entry_ptr) \
 	((cache_ptr)->unpins)[(entry_ptr)->type->id]++;
@@ -925,6 +957,7 @@ if ( ( ( ( (head_ptr) == NULL ) || ( (tail_ptr) == NULL ) ) &&             \
 #define H5C__UPDATE_STATS_FOR_HT_INSERTION(cache_ptr)
 #define H5C__UPDATE_STATS_FOR_HT_DELETION(cache_ptr)
 #define H5C__UPDATE_STATS_FOR_HT_SEARCH(cache_ptr, success, depth)
+#define H5C__UPDATE_STATS_FOR_HT_RESIZE(cache_ptr)
 #define H5C__UPDATE_STATS_FOR_INSERTION(cache_ptr, entry_ptr)
 #define H5C__UPDATE_STATS_FOR_CLEAR(cache_ptr, entry_ptr)
 #define H5C__UPDATE_STATS_FOR_FLUSH(cache_ptr, entry_ptr)
@@ -978,11 +1011,32 @@ if ( ( ( ( (head_ptr) == NULL ) || ( (tail_ptr) == NULL ) ) &&             \
  *
  ***********************************************************************/
 
-/* H5C__HASH_TABLE_LEN is defined in H5Cpkg.h.  It mut be a power of two. */
+/* The index has 2^ht_bits buckets.  The bucket of an address is taken
+ * from the high bits of its product with 2^64 / golden ratio (Fibonacci
+ * hashing), so every bit of the address contributes to it.
+ *
+ * The index is doubled in size when it holds more entries than buckets,
+ * and halved when it holds fewer than one entry per eight buckets, so
+ * that chains stay short however many entries are cached.
+ */
+
+#define H5C__HASH_MULT		((uint64_t)0x9E3779B97F4A7C15ULL)
+
+#define H5C__HASH_BITS_FCN(bits, x)					\
+    (int)(((uint64_t)(x) * H5C__HASH_MULT) >> (64 - (bits)))
+
+#define H5C__HASH_FCN(cache_ptr, x)					\
+    H5C__HASH_BITS_FCN((cache_ptr)->ht_bits, x)
 
-#define H5C__HASH_MASK		((size_t)(H5C__HASH_TABLE_LEN - 1) << 3)
+#define H5C__GROW_INDEX_IF_NEEDED(cache_ptr)                               \
+    if(((cache_ptr)->index_len > (cache_ptr)->ht_len) &&                   \
+            ((cache_ptr)->ht_bits < H5C__HASH_TABLE_MAX_BITS))             \
+        H5C__resize_index((cache_ptr), (cache_ptr)->ht_bits + 1);
 
-#define H5C__HASH_FCN(x)	(int)((unsigned)((x) & H5C__HASH_MASK) >> 3)
+#define H5C__SHRINK_INDEX_IF_NEEDED(cache_ptr)                             \
+    if(((cache_ptr)->index_len < ((cache_ptr)->ht_len >> 3)) &&            \
+            ((cache_ptr)->ht_bits > H5C__HASH_TABLE_MIN_BITS))             \
+        H5C__resize_index((cache_ptr), (cache_ptr)->ht_bits - 1);
 
 #if H5C_DO_SANITY_CHECKS
 
@@ -994,8 +1048,9 @@ if ( ( (cache_ptr) == NULL ) ||                                         \
      ( (entry_ptr)->ht_next != NULL ) ||                                \
      ( (entry_ptr)->ht_prev != NULL ) ||                                \
      ( (entry_ptr)->size <= 0 ) ||                                      \
-     ( H5C__HASH_FCN((entry_ptr)->addr) < 0 ) ||                        \
-     ( H5C__HASH_FCN((entry_ptr)->addr) >= H5C__HASH_TABLE_LEN ) ||     \
+     ( H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr) < 0 ) ||             \
+     ( H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr) >=                   \
+       (int)(cache_ptr)->ht_len ) ||                                    \
      ( (cache_ptr)->index_size !=                                       \
        ((cache_ptr)->clean_index_size +                                 \
 	(cache_ptr)->dirty_index_size) ) ||                             \
@@ -1046,14 +1101,15 @@ if ( ( (cache_ptr) == NULL ) ||                                         \
      ( (cache_ptr)->index_size < (entry_ptr)->size ) ||                 \
      ( ! H5F_addr_defined((entry_ptr)->addr) ) ||                       \
      ( (entry_ptr)->size <= 0 ) ||                                      \
-     ( H5C__HASH_FCN((entry_ptr)->addr) < 0 ) ||                        \
-     ( H5C__HASH_FCN((entry_ptr)->addr) >= H5C__HASH_TABLE_LEN ) ||     \
-     ( ((cache_ptr)->index)[(H5C__HASH_FCN((entry_ptr)->addr))]         \
+     ( H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr) < 0 ) ||             \
+     ( H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr) >=                   \
+       (int)(cache_ptr)->ht_len ) ||                                    \
+     ( ((cache_ptr)->index)[(H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr))] \
        == NULL ) ||                                                     \
-     ( ( ((cache_ptr)->index)[(H5C__HASH_FCN((entry_ptr)->addr))]       \
+     ( ( ((cache_ptr)->index)[(H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr))] \
        != (entry_ptr) ) &&                                              \
        ( (entry_ptr)->ht_prev == NULL ) ) ||                            \
-     ( ( ((cache_ptr)->index)[(H5C__HASH_FCN((entry_ptr)->addr))] ==    \
+     ( ( ((cache_ptr)->index)[(H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr))] == \
          (entry_ptr) ) &&                                               \
        ( (entry_ptr)->ht_prev != NULL ) ) ||                            \
      ( (cache_ptr)->index_size !=                                       \
@@ -1112,8 +1168,8 @@ if ( ( (cache_ptr) == NULL ) ||                                             \
      ( (cache_ptr)->index_size !=                                           \
        ((cache_ptr)->clean_index_size + (cache_ptr)->dirty_index_size) ) || \
      ( ! H5F_addr_defined(Addr) ) ||                                        \
-     ( H5C__HASH_FCN(Addr) < 0 ) ||                                         \
-     ( H5C__HASH_FCN(Addr) >= H5C__HASH_TABLE_LEN ) ) {                     \
+     ( H5C__HASH_FCN(cache_ptr, Addr) < 0 ) ||                              \
+     ( H5C__HASH_FCN(cache_ptr, Addr) >= (int)(cache_ptr)->ht_len ) ) {     \
     HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, fail_val, "pre HT search SC failed") \
 }
 
@@ -1323,7 +1379,7 @@ if ( ( (cache_ptr)->index_size !=                                           \
 {                                                                            \
     int k;                                                                   \
     H5C__PRE_HT_INSERT_SC(cache_ptr, entry_ptr, fail_val)                    \
-    k = H5C__HASH_FCN((entry_ptr)->addr);                                    \
+    k = H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr);                         \
     if(((cache_ptr)->index)[k] != NULL) {                                    \
         (entry_ptr)->ht_next = ((cache_ptr)->index)[k];                      \
         (entry_ptr)->ht_next->ht_prev = (entry_ptr);                         \
@@ -1331,6 +1387,7 @@ if ( ( (cache_ptr)->index_size !=                                           \
     ((cache_ptr)->index)[k] = (entry_ptr);                                   \
     (cache_ptr)->index_len++;                                                \
     (cache_ptr)->index_size += (entry_ptr)->size;                            \
+    H5MM_budget_add(H5_MEM_METADATA_CACHE, (entry_ptr)->size);               \
     ((cache_ptr)->index_ring_len[entry_ptr->ring])++;                        \
     ((cache_ptr)->index_ring_size[entry_ptr->ring])                          \
             += (entry_ptr)->size;                                            \
@@ -1347,10 +1404,13 @@ if ( ( (cache_ptr)->index_size !=                                           \
         (cache_ptr)->num_last_entries++;                                     \
         HDassert((cache_ptr)->num_last_entries <= 2);                        \
     }                                                                        \
+    if((entry_ptr)->rp_hot)                                                  \
+        (cache_ptr)->rp_hot_size += (entry_ptr)->size;                       \
     H5C__IL_DLL_APPEND((entry_ptr), (cache_ptr)->il_head,                    \
                        (cache_ptr)->il_tail, (cache_ptr)->il_len,            \
                        (cache_ptr)->il_size, fail_val)                       \
     H5C__UPDATE_STATS_FOR_HT_INSERTION(cache_ptr)                            \
+    H5C__GROW_INDEX_IF_NEEDED(cache_ptr)                                     \
     H5C__POST_HT_INSERT_SC(cache_ptr, entry_ptr, fail_val)                   \
 }
 
@@ -1358,7 +1418,7 @@ if ( ( (cache_ptr)->index_size !=                                           \
 {                                                                            \
     int k;                                                                   \
     H5C__PRE_HT_REMOVE_SC(cache_ptr, entry_ptr)                              \
-    k = H5C__HASH_FCN((entry_ptr)->addr);                                    \
+    k = H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr);                         \
     if((entry_ptr)->ht_next)                                                 \
         (entry_ptr)->ht_next->ht_prev = (entry_ptr)->ht_prev;                \
     if((entry_ptr)->ht_prev)                                                 \
@@ -1369,6 +1429,7 @@ if ( ( (cache_ptr)->index_size !=                                           \
     (entry_ptr)->ht_prev = NULL;                                             \
     (cache_ptr)->index_len--;                                                \
     (cache_ptr)->index_size -= (entry_ptr)->size;                            \
+    H5MM_budget_sub(H5_MEM_METADATA_CACHE, (entry_ptr)->size);               \
     ((cache_ptr)->index_ring_len[entry_ptr->ring])--;                        \
     ((cache_ptr)->index_ring_size[entry_ptr->ring])                          \
             -= (entry_ptr)->size;                                            \
@@ -1385,10 +1446,15 @@ if ( ( (cache_ptr)->index_size !=                                           \
         (cache_ptr)->num_last_entries--;                                     \
         HDassert((cache_ptr)->num_last_entries <= 1);                        \
     }                                                                        \
+    if((entry_ptr)->rp_hot) {                                                \
+        HDassert((cache_ptr)->rp_hot_size >= (entry_ptr)->size);             \
+        (cache_ptr)->rp_hot_size -= (entry_ptr)->size;                       \
+    }                                                                        \
     H5C__IL_DLL_REMOVE((entry_ptr), (cache_ptr)->il_head,                    \
                        (cache_ptr)->il_tail, (cache_ptr)->il_len,            \
                        (cache_ptr)->il_size, fail_val)                       \
     H5C__UPDATE_STATS_FOR_HT_DELETION(cache_ptr)                             \
+    H5C__SHRINK_INDEX_IF_NEEDED(cache_ptr)                                   \
     H5C__POST_HT_REMOVE_SC(cache_ptr, entry_ptr)                             \
 }
 
@@ -1397,7 +1463,7 @@ if ( ( (cache_ptr)->index_size !=                                           \
     int k;                                                                  \
     int depth = 0;                                                          \
     H5C__PRE_HT_SEARCH_SC(cache_ptr, Addr, fail_val)                        \
-    k = H5C__HASH_FCN(Addr);                                                \
+    k = H5C__HASH_FCN(cache_ptr, Addr);                                     \
     entry_ptr = ((cache_ptr)->index)[k];                                    \
     while(entry_ptr) {                                                      \
         if(H5F_addr_eq(Addr, (entry_ptr)->addr)) {                          \
@@ -1425,7 +1491,7 @@ if ( ( (cache_ptr)->index_size !=                                           \
 {                                                                           \
     int k;                                                                  \
     H5C__PRE_HT_SEARCH_SC(cache_ptr, Addr, fail_val)                        \
-    k = H5C__HASH_FCN(Addr);                                                \
+    k = H5C__HASH_FCN(cache_ptr, Addr);                                     \
     entry_ptr = ((cache_ptr)->index)[k];                                    \
     while(entry_ptr) {                                                      \
         if(H5F_addr_eq(Addr, (entry_ptr)->addr)) {                          \
@@ -1478,6 +1544,8 @@ if ( ( (cache_ptr)->index_size !=                                           \
 		                     entry_ptr, was_clean)                  \
     (cache_ptr)->index_size -= (old_size);                                  \
     (cache_ptr)->index_size += (new_size);                                  \
+    H5MM_budget_sub(H5_MEM_METADATA_CACHE, (old_size));                     \
+    H5MM_budget_add(H5_MEM_METADATA_CACHE, (new_size));                     \
     ((cache_ptr)->index_ring_size[entry_ptr->ring]) -= (old_size);          \
     ((cache_ptr)->index_ring_size[entry_ptr->ring]) += (new_size);          \
     if(was_clean) {                                                         \
@@ -1494,6 +1562,10 @@ if ( ( (cache_ptr)->index_size !=                                           \
 	(cache_ptr)->clean_index_size += (new_size);                        \
         ((cache_ptr)->clean_index_ring_size[entry_ptr->ring])+= (new_size); \
     }                                                                       \
+    if((entry_ptr)->rp_hot) {                                               \
+        (cache_ptr)->rp_hot_size -= (old_size);                             \
+        (cache_ptr)->rp_hot_size += (new_size);                             \
+    }                                                                       \
     H5C__DLL_UPDATE_FOR_SIZE_CHANGE((cache_ptr)->il_len,                    \
                                     (cache_ptr)->il_size,                   \
                                     (old_size), (new_size))                 \
@@ -3418,6 +3490,9 @@ if ( ( (entry_ptr) == NULL ) ||                                                \
 /* Package Private Typedefs */
 /****************************/
 
+/* Worker threads that serialize batches of entries (defined in H5C.c) */
+typedef struct H5C_serialize_pool_t H5C_serialize_pool_t;
+
 /****************************************************************************
  *
  * structure H5C_tag_info_t
@@ -3497,6 +3572,24 @@ typedef struct H5C_tag_info_t {
  * flush_in_progress: Boolean flag indicating whether a flush is in
  * 		progress.
  *
+ * flush_threads: Number of threads that serialize dirty entries when the
+ *		cache is flushed.  If this field is zero (the default), each
+ *		entry is serialized and written as it is flushed.  Otherwise,
+ *		H5C_flush_ring() first flushes entries whose client class
+ *		sets H5C__CLASS_PARALLEL_SERIALIZE_FLAG in batches:  the
+ *		entries in a batch are serialized by this many threads (the
+ *		calling thread included) and then written in address order,
+ *		with adjacent images combined into single writes.  In builds
+ *		that are not threadsafe, batches are serialized by the
+ *		calling thread alone.
+ *
+ * serialize_pool: Pointer to the worker threads that serialize batches
+ *		along with the calling thread, or NULL.  The threads are
+ *		started by the first batch that needs them (more are added
+ *		if flush_threads is raised later), wait for further batches
+ *		between flushes, and are stopped by H5C_dest().  This field
+ *		is always NULL in builds that are not threadsafe.
+ *
  * trace_file_ptr:  File pointer pointing to the trace file, which is used
  *              to record cache operations for use in simulations and design
  *              studies.  This field will usually be NULL, indicating that
@@ -3677,20 +3770,16 @@ typedef struct H5C_tag_info_t {
  *		index by ring.  Note that the sum of all cells in this array 
  *		must equal the value stored in dirty_index_size above.
  *
- * index:	Array of pointer to H5C_cache_entry_t of size
- *		H5C__HASH_TABLE_LEN.  At present, this value is a power
- *		of two, not the usual prime number.
+ * index:	Dynamically allocated array of pointer to H5C_cache_entry_t
+ *		of length ht_len.  Each cell heads the chain of entries
+ *		whose addresses hash to it (see H5C__HASH_FCN).  The array
+ *		is resized by H5C__resize_index() as entries are inserted
+ *		and deleted, keeping between one and 1/8 entry per bucket.
  *
- *		I hope that the variable size of cache elements, the large
- *		hash table size, and the way in which HDF5 allocates space
- *		will combine to avoid problems with periodicity.  If so, we
- *		can use a trivial hash function (a bit-and and a 3 bit left
- *		shift) with some small savings.
+ * ht_bits:	Base 2 logarithm of ht_len, between H5C__HASH_TABLE_MIN_BITS
+ *		and H5C__HASH_TABLE_MAX_BITS.
  *
- *		If not, it will become evident in the statistics. Changing
- *		to the usual prime number length hash table will require
- *		changing the H5C__HASH_FCN macro and the deletion of the
- *		H5C__HASH_MASK #define.  No other changes should be required.
+ * ht_len:	Number of buckets in the index.
  *
  * il_len:	Number of entries on the index list.  
  *
@@ -4043,6 +4132,33 @@ typedef struct H5C_tag_info_t {
  *              This field is NULL if the list is empty.
  *
  *
+ * Fields supporting the 2Q policy:
+ *
+ * The 2Q policy is layered on top of the modified LRU -- it uses the
+ * same lists, and differs only in that hot entries (see the rp_hot field
+ * of H5C_cache_entry_t) found at the tail of the LRU by
+ * H5C__make_space_in_cache() are moved to the head of the LRU instead
+ * of being evicted, as long as the hot set does not exceed its quota.
+ * Since the lists are unchanged, the pinned, protected and flush
+ * dependency code, and the age out code, need not know which policy is
+ * in effect.
+ *
+ * rp_policy:	Replacement policy currently in effect.  Initialized to
+ *		H5C_rp__lru.
+ *
+ * rp_hot_fraction: Fraction of max_cache_size that hot entries may
+ *		occupy before the least recently used of them are demoted
+ *		on reaching the tail of the LRU.
+ *
+ * rp_hot_size:	Number of bytes of entries in the index with their rp_hot
+ *		flag set.  Maintained by the index macros regardless of
+ *		the policy in effect.
+ *
+ * rp_clock:	Count of protects performed under the 2Q policy.  Used
+ *		with the rp_last_ref field of H5C_cache_entry_t to filter
+ *		correlated references.
+ *
+ *
  * Automatic cache size adjustment:
  *
  * While the default cache size is adequate for most cases, we can run into
@@ -4488,6 +4604,12 @@ typedef struct H5C_tag_info_t {
  *              entries examined in unsuccessful searches of the hash
  *		table in the current epoch.
  *
+ * max_ht_search_depth: Largest number of entries examined in a single
+ *		search of the hash table in the current epoch.
+ *
+ * ht_resizes:	Number of times the hash table has been resized in the
+ *		current epoch.
+ *
  * max_index_len:  Largest value attained by the index_len field in the
  *              current epoch.
  *
@@ -4676,6 +4798,8 @@ typedef struct H5C_tag_info_t {
 struct H5C_t {
     uint32_t			magic;
     hbool_t			flush_in_progress;
+    unsigned			flush_threads;
+    H5C_serialize_pool_t *	serialize_pool;
     FILE *			trace_file_ptr;
     hbool_t                     logging_enabled;
     hbool_t                     currently_logging;
@@ -4700,7 +4824,9 @@ struct H5C_t {
     size_t			clean_index_ring_size[H5C_RING_NTYPES];
     size_t			dirty_index_size;
     size_t			dirty_index_ring_size[H5C_RING_NTYPES];
-    H5C_cache_entry_t *	        index[H5C__HASH_TABLE_LEN];
+    H5C_cache_entry_t **        index;
+    unsigned                    ht_bits;
+    uint32_t                    ht_len;
     uint32_t                    il_len;
     size_t                      il_size;
     H5C_cache_entry_t *	        il_head;
@@ -4760,6 +4886,12 @@ struct H5C_t {
     H5C_cache_entry_t *	        dLRU_tail_ptr;
 #endif /* H5C_MAINTAIN_CLEAN_AND_DIRTY_LRU_LISTS */
 
+    /* Fields for the 2Q replacement policy */
+    enum H5C_cache_rp_policy    rp_policy;
+    double                      rp_hot_fraction;
+    size_t                      rp_hot_size;
+    int64_t                     rp_clock;
+
 #ifdef H5_HAVE_PARALLEL
     /* Fields for collective metadata reads */
     uint32_t                    coll_list_len;
@@ -4850,6 +4982,8 @@ struct H5C_t {
     int64_t			total_successful_ht_search_depth;
     int64_t			failed_ht_searches;
     int64_t			total_failed_ht_search_depth;
+    int				max_ht_search_depth;
+    int64_t			ht_resizes;
     uint32_t                    max_index_len;
     size_t                      max_index_size;
     size_t                      max_clean_index_size;
@@ -4938,6 +5072,7 @@ H5_DLL herr_t H5C__mark_flush_dep_unserialized(H5C_cache_entry_t * entry_ptr);
 H5_DLL herr_t H5C__make_space_in_cache(H5F_t * f, hid_t dxpl_id,
     size_t  space_needed, hbool_t write_permitted);
 H5_DLL herr_t H5C__flush_marked_entries(H5F_t * f, hid_t dxpl_id);
+H5_DLL void H5C__resize_index(H5C_t *cache_ptr, unsigned new_bits);
 H5_DLL herr_t H5C__generate_image(H5F_t *f, H5C_t *cache_ptr,
     H5C_cache_entry_t *entry_ptr, hid_t dxpl_id);
 H5_DLL herr_t H5C__serialize_cache(H5F_t *f, hid_t dxpl_id);
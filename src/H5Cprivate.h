@@ -66,6 +66,7 @@
 /* Flags for cache client class behavior */
 #define H5C__CLASS_NO_FLAGS_SET             ((unsigned)0x0)
 #define H5C__CLASS_SPECULATIVE_LOAD_FLAG    ((unsigned)0x1)
+#define H5C__CLASS_PARALLEL_SERIALIZE_FLAG  ((unsigned)0x8)
 /* The following flags may only appear in test code */
 #define H5C__CLASS_SKIP_READS               ((unsigned)0x2)
 #define H5C__CLASS_SKIP_WRITES              ((unsigned)0x4)
@@ -78,10 +79,8 @@
 /* Upper and lower limits on cache size.  These limits are picked
  * out of a hat -- you should be able to change them as necessary.
  *
- * However, if you need a very big cache, you should also increase the
- * size of the hash table (H5C__HASH_TABLE_LEN in H5Cpkg.h).  The current
- * upper bound on cache size is rather large for the current hash table
- * size.
+ * The hash table grows with the number of entries in the cache, up to
+ * 2^H5C__HASH_TABLE_MAX_BITS buckets (see H5Cpkg.h).
  */
 #define H5C__MAX_MAX_CACHE_SIZE		((size_t)(128 * 1024 * 1024))
 #define H5C__MIN_MAX_CACHE_SIZE		((size_t)(1024))
@@ -132,6 +131,8 @@
 #define H5C__MIN_AR_EPOCH_LENGTH		100
 #define H5C__DEF_AR_EPOCH_LENGTH		50000
 #define H5C__MAX_AR_EPOCH_LENGTH		1000000
+#define H5C__DEFAULT_RP_HOT_FRACTION		0.75f
+#define H5C__MAX_FLUSH_THREADS			64
 
 /* #defines of flags used in the flags parameters in some of the
  * following function calls.  Note that not all flags are applicable
@@ -184,6 +185,7 @@
  *      H5C__DEL_FROM_SLIST_ON_DESTROY_FLAG
  *      H5C__GENERATE_IMAGE_FLAG
  *      H5C__UPDATE_PAGE_BUFFER_FLAG
+ *      H5C__IMAGE_WRITTEN_FLAG
  */
 #define H5C__NO_FLAGS_SET			0x00000
 #define H5C__SET_FLUSH_MARKER_FLAG		0x00001
@@ -205,6 +207,7 @@
 #define H5C__DURING_FLUSH_FLAG                  0x10000 /* Set when the entire cache is being flushed */
 #define H5C__GENERATE_IMAGE_FLAG                0x20000 /* Set during parallel I/O */
 #define H5C__UPDATE_PAGE_BUFFER_FLAG            0x40000 /* Set during parallel I/O */
+#define H5C__IMAGE_WRITTEN_FLAG                 0x80000 /* Set when the entry's up to date image has already been written */
 
 /* Debugging/sanity checking/statistics settings */
 #ifndef NDEBUG
@@ -315,6 +318,20 @@ typedef struct H5C_t H5C_t;
  *		read past the end of file, the size is truncated to 
  *		avoid this, and processing proceeds as normal.
  *
+ *	H5C__CLASS_PARALLEL_SERIALIZE_FLAG: This flag is used only in
+ *		H5C_flush_ring().  It states that the class's
+ *		pre_serialize callback, if any, neither resizes nor
+ *		moves the entry (it is called on the flushing thread
+ *		before the entry's batch is serialized), and that its
+ *		serialize callback reads only the entry and the
+ *		structures it shares with other entries of the same data
+ *		structure, writes only to the entry, its image, and parts
+ *		of shared structures that belong to the entry, and
+ *		allocates nothing from free lists or other library
+ *		globals.  Entries of such classes
+ *		may be serialized concurrently with each other on worker
+ *		threads when the cache is flushed.
+ *
  *      The following flags may only appear in test code.
  *
  *	H5C__CLASS_SKIP_READS: This flags is intended only for use in test
@@ -1339,6 +1356,27 @@ typedef int H5C_ring_t;
  *		In either case, when there is no previous item, it should 
  *		be NULL.
  *
+ * 2Q:
+ *
+ * The 2Q policy (selected via H5C_set_replacement_policy()) uses the
+ * LRU list and the fields above unchanged, and adds a "hot"
+ * set to them.  An entry enters the hot set when it is hit again more
+ * than H5C__2Q_CORRELATED_REF_PERIOD protects after its previous
+ * reference -- repeated protects of the same entry in the course of a
+ * single operation do not count.  When a hot entry reaches the tail of
+ * the LRU list while the hot set is within its size quota, the eviction
+ * scan moves it back to the head of the LRU instead of evicting it.
+ * Thus a traversal that touches each entry once can only displace entries
+ * that have not been promoted.
+ *
+ * rp_hot:	Boolean flag indicating whether the entry is in the hot
+ *		set.  The sum of the sizes of all entries in the index
+ *		with this flag set is maintained in the rp_hot_size field
+ *		of H5C_t.
+ *
+ * rp_last_ref:	Value of the rp_clock field of H5C_t the last time the
+ *		entry was protected.  Used to filter correlated references.
+ *
  * Fields supporting the cache image feature:
  *
  * The following fields are used to store data about the entry which must 
@@ -1656,6 +1694,8 @@ typedef struct H5C_cache_entry_t {
     struct H5C_cache_entry_t   *coll_next;
     struct H5C_cache_entry_t   *coll_prev;
 #endif /* H5_HAVE_PARALLEL */
+    hbool_t                     rp_hot;
+    int64_t                     rp_last_ref;
 
     /* fields supporting cache image */
     hbool_t                     include_in_image;
@@ -2259,6 +2299,8 @@ H5_DLL herr_t H5C_get_tag(const void *thing, /*OUT*/ haddr_t *tag);
 herr_t H5C_verify_tag(int id, haddr_t tag);
 #endif
 H5_DLL herr_t H5C_flush_to_min_clean(H5F_t *f, hid_t dxpl_id);
+H5_DLL herr_t H5C_write_behind(H5F_t *f, hid_t dxpl_id, double dirty_ratio,
+    size_t max_bytes, hbool_t *more_ptr);
 H5_DLL herr_t H5C_get_cache_auto_resize_config(const H5C_t *cache_ptr,
     H5C_auto_size_ctl_t *config_ptr);
 H5_DLL herr_t H5C_get_cache_image_config(const H5C_t * cache_ptr,
@@ -2273,6 +2315,8 @@ H5_DLL herr_t H5C_get_entry_status(const H5F_t *f, haddr_t addr,
     hbool_t *is_flush_dep_parent_ptr, hbool_t *is_flush_dep_child_ptr,
     hbool_t *image_up_to_date_ptr);
 H5_DLL herr_t H5C_get_evictions_enabled(const H5C_t *cache_ptr, hbool_t *evictions_enabled_ptr);
+H5_DLL herr_t H5C_get_replacement_policy(const H5C_t *cache_ptr,
+    enum H5C_cache_rp_policy *policy_ptr, double *hot_fraction_ptr);
 H5_DLL void * H5C_get_aux_ptr(const H5C_t *cache_ptr);
 H5_DLL FILE *H5C_get_trace_file_ptr(const H5C_t *cache_ptr);
 H5_DLL FILE *H5C_get_trace_file_ptr_from_entry(const H5C_cache_entry_t *entry_ptr);
@@ -2298,6 +2342,9 @@ H5_DLL herr_t H5C_set_cache_auto_resize_config(H5C_t *cache_ptr, H5C_auto_size_c
 H5_DLL herr_t H5C_set_cache_image_config(const H5F_t *f, H5C_t *cache_ptr,
     H5C_cache_image_ctl_t *config_ptr);
 H5_DLL herr_t H5C_set_evictions_enabled(H5C_t *cache_ptr, hbool_t evictions_enabled);
+H5_DLL herr_t H5C_set_flush_threads(H5C_t *cache_ptr, unsigned nthreads);
+H5_DLL herr_t H5C_set_replacement_policy(H5C_t *cache_ptr,
+    enum H5C_cache_rp_policy policy, double hot_fraction);
 H5_DLL herr_t H5C_set_prefix(H5C_t *cache_ptr, char *prefix);
 H5_DLL herr_t H5C_set_trace_file_ptr(H5C_t *cache_ptr, FILE *trace_file_ptr);
 H5_DLL herr_t H5C_stats(H5C_t *cache_ptr, const char *cache_name,
@@ -321,6 +321,38 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_get_evictions_enabled() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C_get_replacement_policy()
+ *
+ * Purpose:     Copy the current replacement policy and hot set fraction
+ *              into *policy_ptr and *hot_fraction_ptr.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_get_replacement_policy(const H5C_t *cache_ptr,
+    enum H5C_cache_rp_policy *policy_ptr, double *hot_fraction_ptr)
+{
+    herr_t ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if((cache_ptr == NULL ) || (cache_ptr->magic != H5C__H5C_T_MAGIC))
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Bad cache_ptr on entry.")
+
+    if(policy_ptr == NULL || hot_fraction_ptr == NULL)
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Bad policy_ptr or hot_fraction_ptr on entry.")
+
+    *policy_ptr = cache_ptr->rp_policy;
+    *hot_fraction_ptr = cache_ptr->rp_hot_fraction;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_get_replacement_policy() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C_get_aux_ptr
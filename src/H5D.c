@@ -24,6 +24,7 @@
 #include "H5private.h"		/* Generic Functions			*/
 #include "H5Dpkg.h"		/* Datasets 				*/
 #include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5ESprivate.h"	/* Event sets                           */
 #include "H5FLprivate.h"	/* Free lists                           */
 #include "H5Iprivate.h"		/* IDs			  		*/
 
@@ -37,10 +38,16 @@
 /* Local Typedefs */
 /******************/
 
+/* Data for an H5Dclose_async() operation */
+typedef struct H5D_close_async_t {
+    hid_t dset_id;              /* Dataset ID to close */
+} H5D_close_async_t;
+
 
 /********************/
 /* Local Prototypes */
 /********************/
+static herr_t H5D__close_async_cb(void *udata);
 
 
 /*********************/
@@ -69,6 +76,9 @@ H5FL_BLK_EXTERN(type_conv);
 /* Local Variables */
 /*******************/
 
+/* Declare a free list to manage the H5D_close_async_t struct */
+H5FL_DEFINE_STATIC(H5D_close_async_t);
+
 
 
 /*-------------------------------------------------------------------------
@@ -342,6 +352,89 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dclose() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__close_async_cb
+ *
+ * Purpose:     Carries out an H5Dclose_async() operation.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__close_async_cb(void *_udata)
+{
+    H5D_close_async_t *udata = (H5D_close_async_t *)_udata;
+    herr_t  ret_value = SUCCEED;    /* Return value                     */
+
+    FUNC_ENTER_STATIC
+
+    /* Release the application's reference, then the one held by the
+     * operation, which closes the dataset.
+     */
+    if(H5I_dec_app_ref_always_close(udata->dset_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't decrement count on dataset ID")
+
+done:
+    if(H5I_dec_ref(udata->dset_id) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't decrement count on dataset ID")
+    udata = H5FL_FREE(H5D_close_async_t, udata);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__close_async_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dclose_async
+ *
+ * Purpose:     Starts closing a dataset as H5Dclose() does, as an
+ *              operation of the event set ES_ID.  The dataset ID remains
+ *              valid until the operations started before it in the event
+ *              set have completed, but should not be used again.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dclose_async(hid_t dset_id, hid_t es_id)
+{
+    H5ES_t *es;                     /* Event set                        */
+    H5D_close_async_t *udata = NULL;    /* Operation's data             */
+    herr_t  ret_value = SUCCEED;    /* Return value                     */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ii", dset_id, es_id);
+
+    /* Check args */
+    if(NULL == H5I_object_verify(dset_id, H5I_DATASET))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+    if(NULL == (es = (H5ES_t *)H5I_object_verify(es_id, H5I_EVENTSET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an event set ID")
+
+    if(NULL == (udata = H5FL_MALLOC(H5D_close_async_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+
+    /* Hold a reference on the ID, so it stays valid until the operation runs */
+    if(H5I_inc_ref(dset_id, FALSE) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINC, FAIL, "can't increment dataset reference count")
+    udata->dset_id = dset_id;
+
+    if(H5ES_insert(es, H5D__close_async_cb, udata) < 0) {
+        if(H5I_dec_ref(dset_id) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't decrement count on dataset ID")
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't start closing dataset")
+    } /* end if */
+    udata = NULL;
+
+done:
+    if(udata)
+        udata = H5FL_FREE(H5D_close_async_t, udata);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dclose_async() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5Dget_space
@@ -612,6 +705,10 @@ H5Dget_offset(hid_t dset_id)
     if(NULL == (dset = (H5D_t *)H5I_object_verify(dset_id, H5I_DATASET)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, HADDR_UNDEF, "not a dataset")
 
+    /* Load the layout of a lazily opened dataset */
+    if(dset->shared->layout_pending && H5D__load_layout(dset, H5AC_ind_read_dxpl_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, HADDR_UNDEF, "can't load storage layout")
+
     /* Set return value */
     ret_value = H5D__get_offset(dset);
 
@@ -1017,6 +1114,10 @@ H5Dformat_convert(hid_t dset_id)
     if(NULL == (dset = (H5D_t *)H5I_object_verify(dset_id, H5I_DATASET)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
 
+    /* Load the layout of a lazily opened dataset */
+    if(dset->shared->layout_pending && H5D__load_layout(dset, H5AC_ind_read_dxpl_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't load storage layout")
+
     switch(dset->shared->layout.type) {
 	case H5D_CHUNKED:
 	    /* Convert the chunk indexing type to version 1 B-tree if not */
@@ -1075,6 +1176,10 @@ H5Dget_chunk_index_type(hid_t did, H5D_chunk_index_t *idx_type)
     if(NULL == (dset = (H5D_t *)H5I_object_verify(did, H5I_DATASET)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
 
+    /* Load the layout of a lazily opened dataset */
+    if(dset->shared->layout_pending && H5D__load_layout(dset, H5AC_ind_read_dxpl_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't load storage layout")
+
     /* Should be a chunked dataset */
     if(dset->shared->layout.type != H5D_CHUNKED)
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dataset is not chunked")
@@ -1117,6 +1222,10 @@ H5Dget_chunk_storage_size(hid_t dset_id, const hsize_t *offset, hsize_t *chunk_n
     if( NULL == chunk_nbytes )
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid argument (null)")
 
+    /* Load the layout of a lazily opened dataset */
+    if(dset->shared->layout_pending && H5D__load_layout(dset, H5AC_ind_read_dxpl_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't load storage layout")
+
     if(H5D_CHUNKED != dset->shared->layout.type)
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
 
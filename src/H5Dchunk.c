@@ -1172,33 +1172,52 @@ H5D__chunk_io_init(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
             && !(io_info->using_mpi_vfd)
 #endif /* H5_HAVE_PARALLEL */
             && H5S_SEL_ALL != H5S_GET_SELECT_TYPE(file_space)) {
+        H5D_rdcc_t *rdcc = &(dataset->shared->cache.chunk);     /* Dataset's chunk cache */
+        H5S_t **single_space;                   /* Where the single chunk dataspace is kept */
+        H5D_chunk_info_t **single_chunk_info;   /* Where the single chunk's info is kept */
+
         /* Initialize skip list for chunk selections */
         fm->sel_chunks = NULL;
         fm->use_single = TRUE;
 
+        /* Use the dataset's cached single chunk info, unless another I/O
+         * operation on the dataset (in another thread, while it released the
+         * API lock) is using it.
+         */
+        if(rdcc->single_busy) {
+            single_space = &(fm->single_space);
+            single_chunk_info = &(fm->single_chunk_info);
+        } /* end if */
+        else {
+            single_space = &(rdcc->single_space);
+            single_chunk_info = &(rdcc->single_chunk_info);
+            rdcc->single_busy = TRUE;
+            fm->rdcc = rdcc;
+        } /* end else */
+
         /* Initialize single chunk dataspace */
-        if(NULL == dataset->shared->cache.chunk.single_space) {
+        if(NULL == *single_space) {
             /* Make a copy of the dataspace for the dataset */
-            if((dataset->shared->cache.chunk.single_space = H5S_copy(file_space, TRUE, FALSE)) == NULL)
+            if((*single_space = H5S_copy(file_space, TRUE, FALSE)) == NULL)
                 HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy file space")
 
             /* Resize chunk's dataspace dimensions to size of chunk */
-            if(H5S_set_extent_real(dataset->shared->cache.chunk.single_space, fm->chunk_dim) < 0)
+            if(H5S_set_extent_real(*single_space, fm->chunk_dim) < 0)
                 HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSET, FAIL, "can't adjust chunk dimensions")
 
             /* Set the single chunk dataspace to 'all' selection */
-            if(H5S_select_all(dataset->shared->cache.chunk.single_space, TRUE) < 0)
+            if(H5S_select_all(*single_space, TRUE) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "unable to set all selection")
         } /* end if */
-        fm->single_space = dataset->shared->cache.chunk.single_space;
+        fm->single_space = *single_space;
         HDassert(fm->single_space);
 
         /* Allocate the single chunk information */
-        if(NULL == dataset->shared->cache.chunk.single_chunk_info) {
-            if(NULL == (dataset->shared->cache.chunk.single_chunk_info = H5FL_MALLOC(H5D_chunk_info_t)))
+        if(NULL == *single_chunk_info) {
+            if(NULL == (*single_chunk_info = H5FL_MALLOC(H5D_chunk_info_t)))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk info")
         } /* end if */
-        fm->single_chunk_info = dataset->shared->cache.chunk.single_chunk_info;
+        fm->single_chunk_info = *single_chunk_info;
         HDassert(fm->single_chunk_info);
 
         /* Reset chunk template information */
@@ -1211,12 +1230,24 @@ H5D__chunk_io_init(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
     else {
         hbool_t sel_hyper_flag;         /* Whether file selection is a hyperslab */
 
-        /* Initialize skip list for chunk selections */
-        if(NULL == dataset->shared->cache.chunk.sel_chunks) {
-            if(NULL == (dataset->shared->cache.chunk.sel_chunks = H5SL_create(H5SL_TYPE_HSIZE, NULL)))
+        H5D_rdcc_t *rdcc = &(dataset->shared->cache.chunk);     /* Dataset's chunk cache */
+
+        /* Initialize skip list for chunk selections, using the dataset's
+         * cached one unless another I/O operation on the dataset is using it
+         */
+        if(rdcc->sel_chunks_busy) {
+            if(NULL == (fm->sel_chunks = H5SL_create(H5SL_TYPE_HSIZE, NULL)))
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "can't create skip list for chunk selections")
         } /* end if */
-        fm->sel_chunks = dataset->shared->cache.chunk.sel_chunks;
+        else {
+            if(NULL == rdcc->sel_chunks) {
+                if(NULL == (rdcc->sel_chunks = H5SL_create(H5SL_TYPE_HSIZE, NULL)))
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "can't create skip list for chunk selections")
+            } /* end if */
+            fm->sel_chunks = rdcc->sel_chunks;
+            rdcc->sel_chunks_busy = TRUE;
+            fm->rdcc = rdcc;
+        } /* end else */
         HDassert(fm->sel_chunks);
 
         /* We are not using single element mode */
@@ -2548,6 +2579,76 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_flush() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_write_behind
+ *
+ * Purpose:	Write some dirty chunks to disk ahead of preemption.  If
+ *		more than DIRTY_RATIO of the chunk cache is dirty, the least
+ *		recently used dirty chunks are flushed (and kept in the
+ *		cache) until half that much is dirty, or until MAX_BYTES
+ *		have been written.
+ *
+ *		Sets *MORE to TRUE if chunks were written but the cache is
+ *		still above the threshold.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_write_behind(const H5D_t *dset, hid_t dxpl_id, double dirty_ratio,
+    size_t max_bytes, hbool_t *more)
+{
+    H5D_dxpl_cache_t _dxpl_cache;       /* Data transfer property cache buffer */
+    H5D_dxpl_cache_t *dxpl_cache = &_dxpl_cache;   /* Data transfer property cache */
+    const H5D_rdcc_t *rdcc = &(dset->shared->cache.chunk);
+    H5D_rdcc_ent_t *ent, *next;         /* Cache entries */
+    size_t      chunk_size;             /* Size of each cached chunk */
+    size_t      nbytes_dirty;           /* Size of the dirty chunks */
+    size_t      high_water, low_water;  /* Thresholds for starting & stopping */
+    size_t      nbytes_written = 0;     /* Size of the chunks flushed */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(dset);
+    HDassert(H5D_CHUNKED == dset->shared->layout.type);
+    HDassert(more);
+
+    *more = FALSE;
+
+    /* Every cached chunk occupies the full chunk size */
+    chunk_size = dset->shared->layout.u.chunk.size;
+    nbytes_dirty = rdcc->ndirty * chunk_size;
+
+    high_water = (size_t)(dirty_ratio * (double)rdcc->nbytes_max);
+    if(nbytes_dirty <= high_water)
+        HGOTO_DONE(SUCCEED)
+    low_water = high_water / 2;
+
+    /* Fill the DXPL cache values for later use */
+    if(H5D__get_dxpl_cache(dxpl_id, &dxpl_cache) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't fill dxpl cache")
+
+    /* The head of the list is the least recently used end */
+    for(ent = rdcc->head; ent && nbytes_dirty > low_water && nbytes_written < max_bytes; ent = next) {
+        next = ent->next;
+        if(ent->dirty && !ent->locked) {
+            if(H5D__chunk_flush_entry(dset, dxpl_id, dxpl_cache, ent, FALSE) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush raw data chunk")
+            nbytes_dirty -= chunk_size;
+            nbytes_written += chunk_size;
+        } /* end if */
+    } /* end for */
+
+    *more = (hbool_t)(nbytes_written > 0 && nbytes_dirty > high_water);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_write_behind() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__chunk_io_term
@@ -2572,18 +2673,37 @@ H5D__chunk_io_term(const H5D_chunk_map_t *fm)
     if(fm->use_single) {
         /* Sanity checks */
         HDassert(fm->sel_chunks == NULL);
-        HDassert(fm->single_chunk_info);
-        HDassert(fm->single_chunk_info->fspace_shared);
-        HDassert(fm->single_chunk_info->mspace_shared);
 
-        /* Reset the selection for the single element I/O */
-        H5S_select_all(fm->single_space, TRUE);
+        if(fm->rdcc) {
+            /* Reset the selection for the single element I/O */
+            if(fm->single_space)
+                H5S_select_all(fm->single_space, TRUE);
+
+            /* Let the next I/O operation on the dataset use the cached info */
+            fm->rdcc->single_busy = FALSE;
+        } /* end if */
+        else {
+            /* Release the single chunk info used only by this I/O operation */
+            if(fm->single_space && H5S_close(fm->single_space) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "can't release single chunk dataspace")
+            if(fm->single_chunk_info)
+                (void)H5FL_FREE(H5D_chunk_info_t, fm->single_chunk_info);
+        } /* end else */
     } /* end if */
     else {
         /* Release the nodes on the list of selected chunks */
-        if(fm->sel_chunks)
+        if(fm->sel_chunks) {
             if(H5SL_free(fm->sel_chunks, H5D__free_chunk_info, NULL) < 0)
                 HGOTO_ERROR(H5E_PLIST, H5E_CANTNEXT, FAIL, "can't iterate over chunks")
+
+            /* Release a skip list used only by this I/O operation */
+            if(!fm->rdcc && H5SL_close(fm->sel_chunks) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "can't close chunk selection skip list")
+        } /* end if */
+
+        /* Let the next I/O operation on the dataset use the cached skip list */
+        if(fm->rdcc)
+            fm->rdcc->sel_chunks_busy = FALSE;
     } /* end else */
 
     /* Free the memory chunk dataspace template */
@@ -3185,6 +3305,8 @@ H5D__chunk_flush_entry(const H5D_t *dset, hid_t dxpl_id, const H5D_dxpl_cache_t
 
         /* Mark cache entry as clean */
         ent->dirty = FALSE;
+        HDassert(dset->shared->cache.chunk.ndirty > 0);
+        dset->shared->cache.chunk.ndirty--;
 
         /* Increment # of flushed entries */
         dset->shared->cache.chunk.stats.nflushes++;
@@ -3257,6 +3379,10 @@ H5D__chunk_cache_evict(const H5D_t *dset, hid_t dxpl_id, const H5D_dxpl_cache_t
     } /* end if */
     else {
         /* Don't flush, just free chunk */
+        if(ent->dirty) {
+            HDassert(rdcc->ndirty > 0);
+            rdcc->ndirty--;
+        } /* end if */
         if(ent->chunk != NULL)
             ent->chunk = (uint8_t *)H5D__chunk_mem_xfree(ent->chunk,
                     ((ent->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS) ? NULL
@@ -3293,6 +3419,7 @@ H5D__chunk_cache_evict(const H5D_t *dset, hid_t dxpl_id, const H5D_dxpl_cache_t
     HDassert(rdcc->slot[ent->idx] != ent);
     ent->idx = UINT_MAX;
     rdcc->nbytes_used -= dset->shared->layout.u.chunk.size;
+    H5MM_budget_sub(H5_MEM_CHUNK_CACHE, dset->shared->layout.u.chunk.size);
     --rdcc->nused;
 
     /* Free */
@@ -3309,6 +3436,12 @@ H5D__chunk_cache_evict(const H5D_t *dset, hid_t dxpl_id, const H5D_dxpl_cache_t
  *		room for something which is SIZE bytes.  Only unlocked
  *		entries are considered for preemption.
  *
+ *		Entries are also preempted while adding SIZE bytes would
+ *		take the chunk caches over the library's global memory
+ *		budget (see H5set_memory_limit), so the cache shrinks under
+ *		pressure.  Only chunk cache memory is counted here, since
+ *		that is all preempting entries can free.
+ *
  * Return:	Non-negative on success/Negative on failure
  *
  * Programmer:	Robb Matzke
@@ -3322,6 +3455,7 @@ H5D__chunk_cache_prune(const H5D_t *dset, hid_t dxpl_id,
 {
     const H5D_rdcc_t	*rdcc = &(dset->shared->cache.chunk);
     size_t		total = rdcc->nbytes_max;
+    size_t		excess;		/*bytes over the memory budget	*/
     const int		nmeth = 2;	/*number of methods		*/
     int		        w[1];		/*weighting as an interval	*/
     H5D_rdcc_ent_t	*p[2], *cur;	/*list pointers			*/
@@ -3345,6 +3479,10 @@ H5D__chunk_cache_prune(const H5D_t *dset, hid_t dxpl_id,
     p[0] = rdcc->head;
     p[1] = NULL;
 
+    /* Lower the target to bring the chunk caches within the memory budget */
+    if((excess = H5MM_budget_excess(H5_MEM_CHUNK_CACHE, size)) > 0)
+        total = MIN(total, (rdcc->nbytes_used + size) > excess ? (rdcc->nbytes_used + size) - excess : 0);
+
     while((p[0] || p[1]) && (rdcc->nbytes_used + size) > total) {
         int i;          /* Local index variable */
 
@@ -3642,33 +3780,49 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
             if(H5F_addr_defined(chunk_addr)) {
                 size_t my_chunk_alloc = chunk_alloc;	/* Allocated buffer size */
                 size_t buf_alloc = chunk_alloc;	        /* [Re-]allocated buffer size */
+#ifdef H5_HAVE_THREADSAFE
+                hbool_t prev_yield_ok;                  /* Previous setting for releasing the API lock */
+#endif /* H5_HAVE_THREADSAFE */
+                herr_t read_status;                     /* Status of reading the chunk */
+                herr_t pline_status = SUCCEED;          /* Status of unfiltering the chunk */
 
                 /* Chunk size on disk isn't [likely] the same size as the final chunk
                  * size in memory, so allocate memory big enough. */
                 if(NULL == (chunk = H5D__chunk_mem_alloc(my_chunk_alloc, (udata->new_unfilt_chunk ? old_pline : pline))))
                     HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for raw data chunk")
-                if(H5F_block_read(dset->oloc.file, H5FD_MEM_DRAW, chunk_addr, my_chunk_alloc, io_info->raw_dxpl_id, chunk) < 0)
-                    HGOTO_ERROR(H5E_IO, H5E_READERROR, NULL, "unable to read raw data chunk")
 
-                if(old_pline && old_pline->nused) {
-                    if(H5Z_pipeline(old_pline, H5Z_FLAG_REVERSE,
+#ifdef H5_HAVE_THREADSAFE
+                /* The chunk isn't in the cache yet, so other shared API calls
+                 * (e.g. H5Dread from other threads) may run while it's read
+                 * and unfiltered.  (The page buffer would share the buffers.)
+                 */
+                prev_yield_ok = H5TS_api_allow_yield(!H5F_HAS_PAGE_BUF(dset->oloc.file));
+#endif /* H5_HAVE_THREADSAFE */
+                read_status = H5F_block_read(dset->oloc.file, H5FD_MEM_DRAW, chunk_addr, my_chunk_alloc, io_info->raw_dxpl_id, chunk);
+                if(read_status >= 0 && old_pline && old_pline->nused)
+                    pline_status = H5Z_pipeline(old_pline, H5Z_FLAG_REVERSE,
                             &(udata->filter_mask),
                             io_info->dxpl_cache->err_detect,
                             io_info->dxpl_cache->filter_cb,
-                            &my_chunk_alloc, &buf_alloc, &chunk) < 0)
-                        HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, NULL, "data pipeline read failed")
+                            &my_chunk_alloc, &buf_alloc, &chunk);
+#ifdef H5_HAVE_THREADSAFE
+                (void)H5TS_api_allow_yield(prev_yield_ok);
+#endif /* H5_HAVE_THREADSAFE */
+                if(read_status < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, NULL, "unable to read raw data chunk")
+                if(pline_status < 0)
+                    HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, NULL, "data pipeline read failed")
 
-                    /* Reallocate chunk if necessary */
-                    if(udata->new_unfilt_chunk) {
-                        void *tmp_chunk = chunk;
+                /* Reallocate chunk if necessary */
+                if(old_pline && old_pline->nused && udata->new_unfilt_chunk) {
+                    void *tmp_chunk = chunk;
 
-                        if(NULL == (chunk = H5D__chunk_mem_alloc(my_chunk_alloc, pline))) {
-                            (void)H5D__chunk_mem_xfree(tmp_chunk, old_pline);
-                            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for raw data chunk")
-                        } /* end if */
-                        HDmemcpy(chunk, tmp_chunk, chunk_size);
+                    if(NULL == (chunk = H5D__chunk_mem_alloc(my_chunk_alloc, pline))) {
                         (void)H5D__chunk_mem_xfree(tmp_chunk, old_pline);
+                        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for raw data chunk")
                     } /* end if */
+                    HDmemcpy(chunk, tmp_chunk, chunk_size);
+                    (void)H5D__chunk_mem_xfree(tmp_chunk, old_pline);
                 } /* end if */
 
                 /* Increment # of cache misses */
@@ -3757,6 +3911,7 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
                 rdcc->slot[udata->idx_hint] = ent;
                 ent->idx = udata->idx_hint;
                 rdcc->nbytes_used += chunk_size;
+                H5MM_budget_add(H5_MEM_CHUNK_CACHE, chunk_size);
                 rdcc->nused++;
 
                 /* Add it to the linked list */
@@ -3837,7 +3992,7 @@ H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata,
     hbool_t dirty, void *chunk, uint32_t naccessed)
 {
     const H5O_layout_t *layout = &(io_info->dset->shared->layout); /* Dataset layout */
-    const H5D_rdcc_t	*rdcc = &(io_info->dset->shared->cache.chunk);
+    H5D_rdcc_t	*rdcc = &(io_info->dset->shared->cache.chunk);
     herr_t              ret_value = SUCCEED;      /* Return value */
 
     FUNC_ENTER_STATIC
@@ -3882,8 +4037,12 @@ H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata,
             fake_ent.chunk_block.length = udata->chunk_block.length;
             fake_ent.chunk = (uint8_t *)chunk;
 
-            if(H5D__chunk_flush_entry(io_info->dset, io_info->md_dxpl_id, io_info->dxpl_cache, &fake_ent, TRUE) < 0)
+            /* Count the chunk as dirty until it is flushed, like a cached one */
+            rdcc->ndirty++;
+            if(H5D__chunk_flush_entry(io_info->dset, io_info->md_dxpl_id, io_info->dxpl_cache, &fake_ent, TRUE) < 0) {
+                rdcc->ndirty--;
                 HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
+            } /* end if */
         } /* end if */
         else {
             if(chunk)
@@ -3905,7 +4064,10 @@ H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata,
         ent = rdcc->slot[udata->idx_hint];
         HDassert(ent->locked);
         if(dirty) {
-            ent->dirty = TRUE;
+            if(!ent->dirty) {
+                ent->dirty = TRUE;
+                rdcc->ndirty++;
+            } /* end if */
             ent->wr_count -= MIN(ent->wr_count, naccessed);
         } /* end if */
         else
@@ -86,6 +86,10 @@ H5Ddebug(hid_t dset_id)
     if(NULL == (dset = (H5D_t *)H5I_object_verify(dset_id, H5I_DATASET)))
 	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
 
+    /* Load the layout of a lazily opened dataset */
+    if(dset->shared->layout_pending && H5D__load_layout(dset, H5AC_ind_read_dxpl_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't load storage layout")
+
     /* Print B-tree information */
     if(H5D_CHUNKED == dset->shared->layout.type)
 	(void)H5D__chunk_dump_index(dset, H5AC_ind_read_dxpl_id, stdout);
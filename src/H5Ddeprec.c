@@ -271,6 +271,10 @@ H5D__extend(H5D_t *dataset, const hsize_t *size, hid_t dxpl_id)
     HDassert(dataset);
     HDassert(size);
 
+    /* Load the layout of a lazily opened dataset */
+    if(dataset->shared->layout_pending && H5D__load_layout(dataset, dxpl_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't load storage layout")
+
     /* Check if the filters in the DCPL will need to encode, and if so, can they? */
     if(H5D__check_filters(dataset) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't apply filters")
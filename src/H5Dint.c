@@ -64,6 +64,7 @@ static herr_t H5D__update_oh_info(H5F_t *file, hid_t dxpl_id, H5D_t *dset,
 static herr_t H5D_build_file_prefix(const H5D_t *dset, hid_t dapl_id, const char * prefix_type,
         char **file_prefix);
 static herr_t H5D__open_oid(H5D_t *dataset, hid_t dapl_id, hid_t dxpl_id);
+static herr_t H5D__open_layout(H5D_t *dataset, hid_t dapl_id, hid_t dxpl_id);
 static herr_t H5D__init_storage(const H5D_io_info_t *io_info, hbool_t full_overwrite,
         hsize_t old_dim[]);
 static herr_t H5D__append_flush_setup(H5D_t *dset, hid_t dapl_id);
@@ -506,6 +507,10 @@ H5D__get_space_status(H5D_t *dset, H5D_space_status_t *allocation, hid_t dxpl_id
 
     HDassert(dset);
 
+    /* Load the layout of a lazily opened dataset */
+    if(dset->shared->layout_pending && H5D__load_layout(dset, dxpl_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't load storage layout")
+
     /* Check for chunked layout */
     if(dset->shared->layout.type == H5D_CHUNKED) {
         /* For chunked layout set the space status by the storage size */
@@ -1542,15 +1547,16 @@ done:
 
 
 /*-------------------------------------------------------------------------
- * Function: H5D__open_oid
+ * Function: H5D__open_layout
  *
- * Purpose:  Opens a dataset for access.
+ * Purpose:  Reads the layout, pipeline, EFL & fill value messages of a
+ *           dataset being opened and initializes its storage layout.
  *
- * Return:   Dataset pointer on success, NULL on failure
+ * Return:   Non-negative on success/Negative on failure
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__open_oid(H5D_t *dataset, hid_t dapl_id, hid_t dxpl_id)
+H5D__open_layout(H5D_t *dataset, hid_t dapl_id, hid_t dxpl_id)
 {
     H5P_genplist_t *plist;              /* Property list */
     H5O_fill_t *fill_prop;              /* Pointer to dataset's fill value info */
@@ -1563,32 +1569,7 @@ H5D__open_oid(H5D_t *dataset, hid_t dapl_id, hid_t dxpl_id)
 
     /* check args */
     HDassert(dataset);
-
-    /* (Set the 'vl_type' parameter to FALSE since it doesn't matter from here) */
-    if(NULL == (dataset->shared = H5D__new(H5P_DATASET_CREATE_DEFAULT, FALSE, FALSE)))
-        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
-
-    /* Open the dataset object */
-    if(H5O_open(&(dataset->oloc)) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, FAIL, "unable to open")
-
-    /* Get the type and space */
-    if(NULL == (dataset->shared->type = (H5T_t *)H5O_msg_read(&(dataset->oloc), H5O_DTYPE_ID, NULL, dxpl_id)))
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to load type info from dataset header")
-
-    if(H5T_set_loc(dataset->shared->type, dataset->oloc.file, H5T_LOC_DISK) < 0)
-        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "invalid datatype location")
-
-    if(NULL == (dataset->shared->space = H5S_read(&(dataset->oloc), dxpl_id)))
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to load dataspace info from dataset header")
-
-    /* Cache the dataset's dataspace info */
-    if(H5D__cache_dataspace_info(dataset) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't cache dataspace info")
-
-    /* Get a datatype ID for the dataset's datatype */
-    if((dataset->shared->type_id = H5I_register(H5I_DATATYPE, dataset->shared->type, FALSE)) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTREGISTER, FAIL, "unable to register type")
+    HDassert(dataset->shared);
 
     /* Get dataset creation property list object */
     if(NULL == (plist = (H5P_genplist_t *)H5I_object(dataset->shared->dcpl_id)))
@@ -1686,14 +1667,90 @@ H5D__open_oid(H5D_t *dataset, hid_t dapl_id, hid_t dxpl_id)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize file storage")
     } /* end if */
 
+done:
+    if(ret_value < 0 && layout_init)
+        if(dataset->shared->layout.ops->dest && (dataset->shared->layout.ops->dest)(dataset, dxpl_id) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "unable to destroy layout info")
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
+} /* end H5D__open_layout() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: H5D__open_oid
+ *
+ * Purpose:  Opens a dataset for access.
+ *
+ *           If the DAPL asks for a lazy open, only the datatype and
+ *           dataspace are read here, and reading the rest of the
+ *           dataset's creation information & initializing its storage
+ *           layout is left to H5D__load_layout().
+ *
+ * Return:   Dataset pointer on success, NULL on failure
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__open_oid(H5D_t *dataset, hid_t dapl_id, hid_t dxpl_id)
+{
+    hbool_t lazy_open = FALSE;          /* Whether to defer loading the layout */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC_TAG(dxpl_id, dataset->oloc.addr, FAIL)
+
+    /* check args */
+    HDassert(dataset);
+
+    /* (Set the 'vl_type' parameter to FALSE since it doesn't matter from here) */
+    if(NULL == (dataset->shared = H5D__new(H5P_DATASET_CREATE_DEFAULT, FALSE, FALSE)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+
+    /* Open the dataset object */
+    if(H5O_open(&(dataset->oloc)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, FAIL, "unable to open")
+
+    /* Get the type and space */
+    if(NULL == (dataset->shared->type = (H5T_t *)H5O_msg_read(&(dataset->oloc), H5O_DTYPE_ID, NULL, dxpl_id)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to load type info from dataset header")
+
+    if(H5T_set_loc(dataset->shared->type, dataset->oloc.file, H5T_LOC_DISK) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "invalid datatype location")
+
+    if(NULL == (dataset->shared->space = H5S_read(&(dataset->oloc), dxpl_id)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to load dataspace info from dataset header")
+
+    /* Cache the dataset's dataspace info */
+    if(H5D__cache_dataspace_info(dataset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't cache dataspace info")
+
+    /* Get a datatype ID for the dataset's datatype */
+    if((dataset->shared->type_id = H5I_register(H5I_DATATYPE, dataset->shared->type, FALSE)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTREGISTER, FAIL, "unable to register type")
+
+    /* Check whether to defer loading the layout */
+    if(dapl_id != H5P_DATASET_ACCESS_DEFAULT) {
+        H5P_genplist_t *dapl;               /* Data access property list object pointer */
+
+        if(NULL == (dapl = (H5P_genplist_t *)H5I_object(dapl_id)))
+            HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for dapl ID")
+        if(H5P_get(dapl, H5D_ACS_LAZY_OPEN_NAME, &lazy_open) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get lazy open flag")
+
+        /* Keep a copy of the DAPL, for when the layout is loaded */
+        if(lazy_open && (dataset->shared->lazy_dapl_id = H5P_copy_plist(dapl, FALSE)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTCOPY, FAIL, "can't copy dataset access property list")
+    } /* end if */
+
+    /* Get the layout, pipeline, EFL & fill value information */
+    if(lazy_open)
+        dataset->shared->layout_pending = TRUE;
+    else if(H5D__open_layout(dataset, dapl_id, dxpl_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize storage layout")
+
 done:
     if(ret_value < 0) {
         if(H5F_addr_defined(dataset->oloc.addr) && H5O_close(&(dataset->oloc), NULL) < 0)
             HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "unable to release object header")
         if(dataset->shared) {
-            if(layout_init)
-                if(dataset->shared->layout.ops->dest && (dataset->shared->layout.ops->dest)(dataset, dxpl_id) < 0)
-                    HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "unable to destroy layout info")
             if(dataset->shared->space && H5S_close(dataset->shared->space) < 0)
                 HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "unable to release dataspace")
             if(dataset->shared->type) {
@@ -1706,12 +1763,51 @@ done:
                         HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "unable to release datatype")
                 } /* end else */
             } /* end if */
+            if(dataset->shared->lazy_dapl_id > 0 && H5I_dec_ref(dataset->shared->lazy_dapl_id) < 0)
+                HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't release dataset access property list")
         } /* end if */
     } /* end if */
 
     FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
 } /* end H5D__open_oid() */
 
+
+/*-------------------------------------------------------------------------
+ * Function: H5D__load_layout
+ *
+ * Purpose:  Loads the layout, pipeline, EFL & fill value information of
+ *           a lazily opened dataset, and initializes its storage layout,
+ *           the first time it's needed.
+ *
+ * Return:   Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__load_layout(H5D_t *dataset, hid_t dxpl_id)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* check args */
+    HDassert(dataset);
+    HDassert(dataset->shared);
+    HDassert(dataset->shared->layout_pending);
+
+    /* Read the messages & initialize the layout, as H5D__open_oid() would have */
+    if(H5D__open_layout(dataset, dataset->shared->lazy_dapl_id, dxpl_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize storage layout")
+    dataset->shared->layout_pending = FALSE;
+
+    /* Release the DAPL copy */
+    if(H5I_dec_ref(dataset->shared->lazy_dapl_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't release dataset access property list")
+    dataset->shared->lazy_dapl_id = H5I_INVALID_HID;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__load_layout() */
+
 
 /*-------------------------------------------------------------------------
  * Function: H5D_close
@@ -1742,6 +1838,10 @@ H5D_close(H5D_t *dataset)
     H5D__chunk_stats(dataset, FALSE);
 #endif /* H5D_CHUNK_DEBUG */
 
+    /* Cancel a write-behind pass queued for the dataset */
+    if(H5D__write_behind_cancel(dataset) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't cancel write-behind")
+
     dataset->shared->fo_count--;
     if(dataset->shared->fo_count == 0) {
 
@@ -1759,8 +1859,10 @@ H5D_close(H5D_t *dataset)
         switch(dataset->shared->layout.type) {
             case H5D_CONTIGUOUS:
                 /* Free the data sieve buffer, if it's been allocated */
-                if(dataset->shared->cache.contig.sieve_buf)
+                if(dataset->shared->cache.contig.sieve_buf) {
                     dataset->shared->cache.contig.sieve_buf = (unsigned char *)H5FL_BLK_FREE(sieve_buf,dataset->shared->cache.contig.sieve_buf);
+                    H5MM_budget_sub(H5_MEM_SIEVE_BUFFER, dataset->shared->cache.contig.sieve_buf_size);
+                } /* end if */
                 break;
 
             case H5D_CHUNKED:
@@ -1835,6 +1937,10 @@ H5D_close(H5D_t *dataset)
         /* Free the vds file prefix */
         dataset->shared->vds_prefix = (char *)H5MM_xfree(dataset->shared->vds_prefix);
 
+        /* Release the DAPL copy of a dataset whose layout was never loaded */
+        if(dataset->shared->layout_pending)
+            free_failed |= (H5I_dec_ref(dataset->shared->lazy_dapl_id) < 0);
+
         /* Release layout, fill-value, efl & pipeline messages */
         if(dataset->shared->dcpl_id != H5P_DATASET_CREATE_DEFAULT)
             free_failed |= (H5O_msg_reset(H5O_PLINE_ID, &dataset->shared->dcpl_cache.pline) < 0) ||
@@ -1947,8 +2053,10 @@ H5D_mult_refresh_close(hid_t dset_id, hid_t dxpl_id)
         switch(dataset->shared->layout.type) {
             case H5D_CONTIGUOUS:
                 /* Free the data sieve buffer, if it's been allocated */
-                if(dataset->shared->cache.contig.sieve_buf)
+                if(dataset->shared->cache.contig.sieve_buf) {
                     dataset->shared->cache.contig.sieve_buf = (unsigned char *)H5FL_BLK_FREE(sieve_buf,dataset->shared->cache.contig.sieve_buf);
+                    H5MM_budget_sub(H5_MEM_SIEVE_BUFFER, dataset->shared->cache.contig.sieve_buf_size);
+                } /* end if */
                 break;
 
             case H5D_CHUNKED:
@@ -2029,13 +2137,16 @@ H5D_mult_refresh_reopen(H5D_t *dataset, hid_t dxpl_id)
         if(H5D__cache_dataspace_info(dataset) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't cache dataspace info")
 
-        /* Release layout info */
-        if(H5O_msg_reset(H5O_LAYOUT_ID, &dataset->shared->layout) < 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTRESET, FAIL, "unable to reset layout info")
+        /* (A layout that hasn't been loaded yet will be read when it is) */
+        if(!dataset->shared->layout_pending) {
+            /* Release layout info */
+            if(H5O_msg_reset(H5O_LAYOUT_ID, &dataset->shared->layout) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTRESET, FAIL, "unable to reset layout info")
 
-        /* Re-load layout message info */
-        if(NULL == H5O_msg_read(&(dataset->oloc), H5O_LAYOUT_ID, &(dataset->shared->layout), dxpl_id))
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to read data layout message")
+            /* Re-load layout message info */
+            if(NULL == H5O_msg_read(&(dataset->oloc), H5O_LAYOUT_ID, &(dataset->shared->layout), dxpl_id))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to read data layout message")
+        } /* end if */
     } /* end if */
 
 done:
@@ -2359,6 +2470,10 @@ H5D__get_storage_size(H5D_t *dset, hid_t dxpl_id, hsize_t *storage_size)
 
     FUNC_ENTER_PACKAGE_TAG(dxpl_id, dset->oloc.addr, FAIL)
 
+    /* Load the layout of a lazily opened dataset */
+    if(dset->shared->layout_pending && H5D__load_layout(dset, dxpl_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't load storage layout")
+
     switch(dset->shared->layout.type) {
         case H5D_CHUNKED:
             if((*dset->shared->layout.ops->is_space_alloc)(&dset->shared->layout.storage)) {
@@ -2650,6 +2765,10 @@ H5D__set_extent(H5D_t *dset, const hsize_t *size, hid_t dxpl_id)
     if(0 == (H5F_INTENT(dset->oloc.file) & H5F_ACC_RDWR))
         HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "no write intent on file")
 
+    /* Load the layout of a lazily opened dataset */
+    if(dset->shared->layout_pending && H5D__load_layout(dset, dxpl_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't load storage layout")
+
     /* Check if we are allowed to modify the space; only datasets with chunked and external storage are allowed to be modified */
     if(H5D_COMPACT == dset->shared->layout.type)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "dataset has compact storage")
@@ -2861,8 +2980,10 @@ H5D__flush_real(H5D_t *dataset, hid_t dxpl_id)
     HDassert(dataset);
     HDassert(dataset->shared);
 
-    /* Avoid flushing the dataset (again) if it's closing */
-    if(!dataset->shared->closing) {
+    /* Avoid flushing the dataset (again) if it's closing, or if its layout
+     * hasn't been loaded yet (so there's nothing cached to flush)
+     */
+    if(!dataset->shared->closing && !dataset->shared->layout_pending) {
         /* Flush cached raw data for each kind of dataset layout */
         if(dataset->shared->layout.ops->flush &&
                 (dataset->shared->layout.ops->flush)(dataset, dxpl_id) < 0)
@@ -2899,6 +3020,7 @@ H5D__format_convert(H5D_t *dataset, hid_t dxpl_id)
 
     /* Check args */
     HDassert(dataset);
+    HDassert(!dataset->shared->layout_pending);
 
     switch(dataset->shared->layout.type) {
         case H5D_CHUNKED:
@@ -3178,6 +3300,10 @@ H5D_get_create_plist(H5D_t *dset)
 
     FUNC_ENTER_NOAPI(FAIL)
 
+    /* Load the layout of a lazily opened dataset */
+    if(dset->shared->layout_pending && H5D__load_layout(dset, H5AC_ind_read_dxpl_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't load storage layout")
+
     /* Check args */
     if(NULL == (dcpl_plist = (H5P_genplist_t *)H5I_object(dset->shared->dcpl_id)))
         HGOTO_ERROR(H5E_DATASET, H5E_BADTYPE, FAIL, "can't get property list")
@@ -3351,6 +3477,10 @@ H5D_get_access_plist(H5D_t *dset)
 
     FUNC_ENTER_NOAPI_NOINIT
 
+    /* Load the layout of a lazily opened dataset */
+    if(dset->shared->layout_pending && H5D__load_layout(dset, H5AC_ind_read_dxpl_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't load storage layout")
+
     /* Make a copy of the default dataset access property list */
     if(NULL == (old_plist = (H5P_genplist_t *)H5I_object(H5P_LST_DATASET_ACCESS_ID_g)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a property list")
@@ -3416,6 +3546,20 @@ H5D_get_space(H5D_t *dset)
 
     FUNC_ENTER_NOAPI_NOINIT
 
+    /* Load the layout of a lazily opened dataset whose extent could depend
+     *  on it (a virtual dataset's extent only changes if it's unlimited)
+     */
+    if(dset->shared->layout_pending) {
+        unsigned u;                     /* Local index variable */
+
+        for(u = 0; u < dset->shared->ndims; u++)
+            if(H5S_UNLIMITED == dset->shared->max_dims[u]) {
+                if(H5D__load_layout(dset, H5AC_ind_read_dxpl_id) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't load storage layout")
+                break;
+            } /* end if */
+    } /* end if */
+
     /* If the layout is virtual, update the extent */
     if(dset->shared->layout.type == H5D_VIRTUAL)
         if(H5D__virtual_set_extent_unlim(dset, H5AC_ind_read_dxpl_id) < 0)
@@ -3506,6 +3650,10 @@ H5D__refresh(hid_t dset_id, H5D_t *dset, hid_t dxpl_id)
     HDassert(dset);
     HDassert(dset->shared);
 
+    /* Load the layout of a lazily opened dataset */
+    if(dset->shared->layout_pending && H5D__load_layout(dset, dxpl_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't load storage layout")
+
     /* If the layout is virtual... */
     if(dset->shared->layout.type == H5D_VIRTUAL) {
         /* Hold open the source datasets' files */
@@ -24,6 +24,7 @@
 #include "H5private.h"		/* Generic Functions			*/
 #include "H5Dpkg.h"		/* Dataset functions			*/
 #include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5ESprivate.h"	/* Event sets                           */
 #include "H5FLprivate.h"	/* Free Lists                           */
 #include "H5Iprivate.h"		/* IDs			  		*/
 #include "H5MMprivate.h"        /* Memory management                    */
@@ -39,11 +40,43 @@
 /* Local Macros */
 /****************/
 
+/* Most bytes written by one write-behind pass over each cache */
+#define H5D_WRITE_BEHIND_MAX_BYTES      (1024 * 1024)
+
 
 /******************/
 /* Local Typedefs */
 /******************/
 
+/* Data for an H5Dread_async() or H5Dwrite_async() operation.  A reference
+ * is held on the dataset ID, and the memory datatype, selections and
+ * transfer properties are copies, so the application may close or change
+ * them once the operation has been started.
+ */
+typedef struct H5D_async_io_t {
+    hbool_t do_write;           /* Whether the operation is a write */
+    hbool_t direct_write;       /* Whether the write is a direct chunk write */
+    hid_t dset_id;              /* Dataset */
+    hid_t mem_type_id;          /* Copy of memory datatype */
+    H5S_t *mem_space;           /* Memory selection, or NULL for H5S_ALL */
+    H5S_t *file_space;          /* File selection, or NULL for H5S_ALL */
+    hid_t dxpl_id;              /* Copy of dataset transfer property list */
+    union {
+        void *rbuf;             /* Buffer to read into */
+        const void *wbuf;       /* Buffer to write from */
+    } u;
+} H5D_async_io_t;
+
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+/* Data for a queued write-behind pass.  No reference is held on the
+ * dataset, so that closing it (or its file) isn't held up by the pass;
+ * instead H5D_close() cancels the pass by resetting DSET.
+ */
+typedef struct H5D_write_behind_t {
+    H5D_t *dset;                /* Dataset, or NULL if the pass was cancelled */
+} H5D_write_behind_t;
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+
 
 /********************/
 /* Local Prototypes */
@@ -68,6 +101,20 @@ static herr_t H5D__ioinfo_term(H5D_io_info_t *io_info);
 #endif /* H5_HAVE_PARALLEL */
 static herr_t H5D__typeinfo_term(const H5D_type_info_t *type_info);
 
+/* Asynchronous I/O routines */
+static herr_t H5D__io_async(hbool_t do_write, hid_t dset_id, hid_t mem_type_id,
+    hid_t mem_space_id, hid_t file_space_id, hid_t dxpl_id, void *rbuf,
+    const void *wbuf, hid_t es_id);
+static herr_t H5D__io_async_cb(void *udata);
+static herr_t H5D__io_async_free(H5D_async_io_t *udata);
+
+/* Write-behind routines */
+static herr_t H5D__write_behind(H5D_t *dset);
+static herr_t H5D__write_behind_pass(H5D_t *dset, hbool_t *more);
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+static herr_t H5D__write_behind_cb(void *udata);
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+
 
 /*********************/
 /* Package Variables */
@@ -84,6 +131,14 @@ H5FL_BLK_DEFINE(type_conv);
 /* Declare a free list to manage the H5D_chunk_map_t struct */
 H5FL_DEFINE(H5D_chunk_map_t);
 
+/* Declare a free list to manage the H5D_async_io_t struct */
+H5FL_DEFINE_STATIC(H5D_async_io_t);
+
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+/* Declare a free list to manage the H5D_write_behind_t struct */
+H5FL_DEFINE_STATIC(H5D_write_behind_t);
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+
 
 
 /*-------------------------------------------------------------------------
@@ -129,7 +184,7 @@ H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
     uint32_t        direct_filters = 0;
     herr_t          ret_value = SUCCEED;    /* Return value */
 
-    FUNC_ENTER_API(FAIL)
+    FUNC_ENTER_API_SHARED(FAIL)
     H5TRACE6("e", "iiiiix", dset_id, mem_type_id, mem_space_id, file_space_id,
              plist_id, buf);
 
@@ -179,6 +234,10 @@ H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
         unsigned u;
         hsize_t  internal_offset[H5O_LAYOUT_NDIMS];
 
+        /* Load the layout of a lazily opened dataset */
+        if(dset->shared->layout_pending && H5D__load_layout(dset, plist_id) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't load storage layout")
+
         if(H5D_CHUNKED != dset->shared->layout.type)
             HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
 
@@ -314,10 +373,447 @@ H5Dwrite(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
     if(H5D__pre_write(dset, direct_write, mem_type_id, mem_space, file_space, dxpl_id, buf) < 0) 
         HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't prepare for writing data")
 
+    if(H5D__write_behind(dset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "can't write dirty data behind")
+
 done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dwrite() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dread_async
+ *
+ * Purpose:     Starts reading (part of) a dataset as H5Dread() does, as an
+ *              operation of the event set ES_ID.  BUF must not be used
+ *              until the operation has completed.  Direct chunk reads are
+ *              not supported.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dread_async(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
+    hid_t file_space_id, hid_t plist_id, void *buf/*out*/, hid_t es_id)
+{
+    herr_t          ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "iiiiixi", dset_id, mem_type_id, mem_space_id, file_space_id,
+             plist_id, buf, es_id);
+
+    if(H5D__io_async(FALSE, dset_id, mem_type_id, mem_space_id, file_space_id, plist_id, buf, NULL, es_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't start reading data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dread_async() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dwrite_async
+ *
+ * Purpose:     Starts writing (part of) a dataset as H5Dwrite() does, as
+ *              an operation of the event set ES_ID.  BUF must not be
+ *              modified until the operation has completed.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dwrite_async(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
+    hid_t file_space_id, hid_t dxpl_id, const void *buf, hid_t es_id)
+{
+    herr_t                  ret_value = SUCCEED;  /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "iiiii*xi", dset_id, mem_type_id, mem_space_id, file_space_id,
+             dxpl_id, buf, es_id);
+
+    if(H5D__io_async(TRUE, dset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id, NULL, buf, es_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't start writing data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dwrite_async() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__io_async
+ *
+ * Purpose:     Checks the arguments of H5Dread_async() or H5Dwrite_async()
+ *              as H5Dread() or H5Dwrite() would, then captures them and
+ *              inserts the operation in the event set.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__io_async(hbool_t do_write, hid_t dset_id, hid_t mem_type_id,
+    hid_t mem_space_id, hid_t file_space_id, hid_t dxpl_id, void *rbuf,
+    const void *wbuf, hid_t es_id)
+{
+    H5D_t           *dset;
+    H5ES_t          *es;
+    H5P_genplist_t  *plist;                 /* Property list pointer */
+    const H5S_t     *mem_space = NULL;
+    const H5S_t     *file_space = NULL;
+    hbool_t         direct = FALSE;
+    H5D_async_io_t  *udata = NULL;          /* Operation's data */
+    herr_t          ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* check arguments */
+    if(NULL == (dset = (H5D_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+    if(NULL == dset->oloc.file)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file")
+    if(NULL == (es = (H5ES_t *)H5I_object_verify(es_id, H5I_EVENTSET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an event set ID")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if(H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Get the dataset transfer property list */
+    if(NULL == (plist = (H5P_genplist_t *)H5I_object(dxpl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset transfer property list")
+
+    /* Retrieve the 'direct read' or 'direct write' flag */
+    if(H5P_get(plist, (do_write ? H5D_XFER_DIRECT_CHUNK_WRITE_FLAG_NAME : H5D_XFER_DIRECT_CHUNK_READ_FLAG_NAME), &direct) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "error getting flag for direct chunk I/O")
+    if(direct && !do_write)
+        HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "direct chunk reads can't be asynchronous")
+
+    /* Check dataspace selections if this is not a direct write */
+    if(!direct) {
+        if(NULL == H5I_object_verify(mem_type_id, H5I_DATATYPE))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
+        if(mem_space_id < 0 || file_space_id < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataspace")
+
+        if(H5S_ALL != mem_space_id) {
+            if(NULL == (mem_space = (const H5S_t *)H5I_object_verify(mem_space_id, H5I_DATASPACE)))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataspace")
+
+            /* Check for valid selection */
+            if(H5S_SELECT_VALID(mem_space) != TRUE)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, FAIL, "memory selection+offset not within extent")
+        } /* end if */
+        if(H5S_ALL != file_space_id) {
+            if(NULL == (file_space = (const H5S_t *)H5I_object_verify(file_space_id, H5I_DATASPACE)))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataspace")
+
+            /* Check for valid selection */
+            if(H5S_SELECT_VALID(file_space) != TRUE)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, FAIL, "file selection+offset not within extent")
+        } /* end if */
+    } /* end if */
+
+    /* Capture the arguments */
+    if(NULL == (udata = H5FL_CALLOC(H5D_async_io_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    udata->do_write = do_write;
+    udata->direct_write = direct;
+    udata->dset_id = H5I_INVALID_HID;
+    udata->mem_type_id = H5I_INVALID_HID;
+    udata->dxpl_id = H5I_INVALID_HID;
+    if(do_write)
+        udata->u.wbuf = wbuf;
+    else
+        udata->u.rbuf = rbuf;
+    if(mem_space && NULL == (udata->mem_space = H5S_copy(mem_space, FALSE, TRUE)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy memory dataspace")
+    if(file_space && NULL == (udata->file_space = H5S_copy(file_space, FALSE, TRUE)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy file dataspace")
+    if(H5I_inc_ref(dset_id, FALSE) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINC, FAIL, "can't increment dataset reference count")
+    udata->dset_id = dset_id;
+
+    /* Copy the memory datatype and transfer properties, so the application
+     * may modify or close them while the operation is pending.
+     */
+    if(!direct) {
+        H5T_t *mem_type;                    /* Copy of memory datatype */
+
+        if(NULL == (mem_type = H5T_copy((H5T_t *)H5I_object(mem_type_id), H5T_COPY_TRANSIENT)))
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCOPY, FAIL, "unable to copy memory datatype")
+        if((udata->mem_type_id = H5I_register(H5I_DATATYPE, mem_type, FALSE)) < 0) {
+            (void)H5T_close(mem_type);
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTREGISTER, FAIL, "unable to register memory datatype")
+        } /* end if */
+    } /* end if */
+    if((udata->dxpl_id = H5P_copy_plist(plist, FALSE)) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTCOPY, FAIL, "unable to copy dataset transfer property list")
+
+    if(H5ES_insert(es, H5D__io_async_cb, udata) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't insert operation in event set")
+    udata = NULL;
+
+done:
+    if(udata && H5D__io_async_free(udata) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't release operation")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__io_async() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__io_async_cb
+ *
+ * Purpose:     Carries out an H5Dread_async() or H5Dwrite_async()
+ *              operation.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__io_async_cb(void *_udata)
+{
+    H5D_async_io_t  *udata = (H5D_async_io_t *)_udata;
+    H5D_t           *dset;
+    herr_t          ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(NULL == (dset = (H5D_t *)H5I_object_verify(udata->dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+
+    if(udata->do_write) {
+        if(H5D__pre_write(dset, udata->direct_write, udata->mem_type_id, udata->mem_space, udata->file_space, udata->dxpl_id, udata->u.wbuf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+        if(H5D__write_behind(dset) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "can't write dirty data behind")
+    } /* end if */
+    else {
+        if(H5D__read(dset, udata->mem_type_id, udata->mem_space, udata->file_space, udata->dxpl_id, udata->u.rbuf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+    } /* end else */
+
+done:
+    if(H5D__io_async_free(udata) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't release operation")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__io_async_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__io_async_free
+ *
+ * Purpose:     Releases the references and copies held by an asynchronous
+ *              I/O operation.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__io_async_free(H5D_async_io_t *udata)
+{
+    herr_t          ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(udata);
+
+    if(udata->dset_id >= 0 && H5I_dec_ref(udata->dset_id) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't decrement dataset reference count")
+    if(udata->mem_type_id >= 0 && H5I_dec_ref(udata->mem_type_id) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't decrement datatype reference count")
+    if(udata->dxpl_id >= 0 && H5I_dec_ref(udata->dxpl_id) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't decrement property list reference count")
+    if(udata->mem_space && H5S_close(udata->mem_space) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't release memory dataspace")
+    if(udata->file_space && H5S_close(udata->file_space) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't release file dataspace")
+    udata = H5FL_FREE(H5D_async_io_t, udata);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__io_async_free() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__write_behind
+ *
+ * Purpose:     Called after data has been written to DSET.  If the
+ *              file has write-behind enabled (see H5Pset_write_behind),
+ *              trickles dirty chunks of the dataset and dirty metadata of
+ *              the file to disk.  With a background thread the pass is
+ *              queued for it, and is not queued again while one is
+ *              pending; otherwise one bounded pass is made now.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__write_behind(H5D_t *dset)
+{
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+    H5D_write_behind_t *udata = NULL;       /* Queued pass */
+#else /* H5ES_HAVE_BACKGROUND_THREAD */
+    hbool_t         more;                   /* Whether more could be written */
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+    herr_t          ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(dset);
+
+    if(H5F_WRITE_BEHIND_RATIO(dset->oloc.file) <= 0.0)
+        HGOTO_DONE(SUCCEED)
+#ifdef H5_HAVE_PARALLEL
+    /* Chunks and metadata may only be written collectively in parallel */
+    if(H5F_HAS_FEATURE(dset->oloc.file, H5FD_FEAT_HAS_MPI))
+        HGOTO_DONE(SUCCEED)
+#endif /* H5_HAVE_PARALLEL */
+
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+    if(dset->shared->wb_op)
+        HGOTO_DONE(SUCCEED)
+
+    if(NULL == (udata = H5FL_MALLOC(H5D_write_behind_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for write-behind")
+    udata->dset = dset;
+    if(H5ES_insert(NULL, H5D__write_behind_cb, udata) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't queue write-behind")
+    dset->shared->wb_op = udata;
+    udata = NULL;
+#else /* H5ES_HAVE_BACKGROUND_THREAD */
+    if(H5D__write_behind_pass(dset, &more) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "can't write dirty data behind")
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+
+done:
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+    if(udata)
+        udata = H5FL_FREE(H5D_write_behind_t, udata);
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__write_behind() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__write_behind_pass
+ *
+ * Purpose:     Makes one bounded write-behind pass over the chunk cache
+ *              of DSET and the metadata cache of its file.  Sets *MORE
+ *              if either is still above the threshold after data was
+ *              written.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__write_behind_pass(H5D_t *dset, hbool_t *more)
+{
+    double          ratio;                  /* Dirty ratio that starts write-behind */
+    hbool_t         chunk_more = FALSE;     /* Whether more chunks could be written */
+    hbool_t         md_more = FALSE;        /* Whether more metadata could be written */
+    herr_t          ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC_TAG(H5AC_ind_read_dxpl_id, dset->oloc.addr, FAIL)
+
+    HDassert(more);
+
+    ratio = H5F_WRITE_BEHIND_RATIO(dset->oloc.file);
+    if(H5D_CHUNKED == dset->shared->layout.type && dset->shared->cache.chunk.nslots > 0)
+        if(H5D__chunk_write_behind(dset, H5AC_ind_read_dxpl_id, ratio, (size_t)H5D_WRITE_BEHIND_MAX_BYTES, &chunk_more) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "can't write dirty chunks behind")
+    if(H5AC_write_behind(dset->oloc.file, H5AC_ind_read_dxpl_id, ratio, (size_t)H5D_WRITE_BEHIND_MAX_BYTES, &md_more) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "can't write dirty metadata behind")
+
+    *more = (hbool_t)(chunk_more || md_more);
+
+done:
+    FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
+} /* end H5D__write_behind_pass() */
+
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__write_behind_cb
+ *
+ * Purpose:     Runs a queued write-behind pass on the background thread,
+ *              queueing another if there is more to write.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__write_behind_cb(void *_udata)
+{
+    H5D_write_behind_t *udata = (H5D_write_behind_t *)_udata;
+    H5D_t           *dset = udata->dset;
+    hbool_t         more = FALSE;           /* Whether more could be written */
+    herr_t          ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Nothing to do if the dataset was closed since the pass was queued */
+    if(NULL == dset)
+        HGOTO_DONE(SUCCEED)
+    HDassert(dset->shared->wb_op == udata);
+    dset->shared->wb_op = NULL;
+
+    if(H5D__write_behind_pass(dset, &more) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "can't write dirty data behind")
+
+    /* Keep going, a bounded pass at a time, so other threads get the lock */
+    if(more && H5ES_insert(NULL, H5D__write_behind_cb, udata) >= 0) {
+        dset->shared->wb_op = udata;
+        udata = NULL;
+    } /* end if */
+
+done:
+    if(udata)
+        udata = H5FL_FREE(H5D_write_behind_t, udata);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__write_behind_cb() */
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__write_behind_cancel
+ *
+ * Purpose:     Called when DSET is closed, to cancel a write-behind pass
+ *              queued for it.  The pass is left in the queue, and frees
+ *              its data when it is reached.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__write_behind_cancel(H5D_t *dset)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(dset);
+
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+    if(dset->shared->wb_op && dset->shared->wb_op->dset == dset) {
+        dset->shared->wb_op->dset = NULL;
+        dset->shared->wb_op = NULL;
+    } /* end if */
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D__write_behind_cancel() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5D__pre_write
@@ -350,6 +846,10 @@ H5D__pre_write(H5D_t *dset, hbool_t direct_write, hid_t mem_type_id,
         if(NULL == (plist = (H5P_genplist_t *)H5I_object(dxpl_id)))
             HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset transfer property list")
 
+        /* Load the layout of a lazily opened dataset */
+        if(dset->shared->layout_pending && H5D__load_layout(dset, dxpl_id) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't load storage layout")
+
         if(H5D_CHUNKED != dset->shared->layout.type)
             HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
 
@@ -442,6 +942,10 @@ H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
     /* check args */
     HDassert(dataset && dataset->oloc.file);
 
+    /* Load the layout of a lazily opened dataset */
+    if(dataset->shared->layout_pending && H5D__load_layout(dataset, dxpl_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't load storage layout")
+
     if(!file_space)
         file_space = dataset->shared->space;
     if(!mem_space)
@@ -668,6 +1172,10 @@ H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space,
     /* check args */
     HDassert(dataset && dataset->oloc.file);
 
+    /* Load the layout of a lazily opened dataset */
+    if(dataset->shared->layout_pending && H5D__load_layout(dataset, dxpl_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't load storage layout")
+
     /* All filters in the DCPL must have encoding enabled. */
     if(!dataset->shared->checked_filters) {
         if(H5Z_can_apply(dataset->shared->dcpl_id, dataset->shared->type_id) < 0)
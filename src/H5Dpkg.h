@@ -372,6 +372,7 @@ typedef struct H5D_chunk_map_t {
     H5S_t  *single_space;       /* Dataspace for single chunk */
     H5D_chunk_info_t *single_chunk_info;  /* Pointer to single chunk's info */
     hbool_t use_single;         /* Whether I/O is on a single element */
+    struct H5D_rdcc_t *rdcc;    /* Chunk cache whose selection info is used, or NULL if it's private to this I/O */
 
     hsize_t last_index;         /* Index of last chunk operated on */
     H5D_chunk_info_t *last_chunk_info;  /* Pointer to last chunk's info */
@@ -420,11 +421,14 @@ typedef struct H5D_rdcc_t {
     struct H5D_rdcc_ent_t *tmp_head; /* Head of temporary doubly linked list.  Chunks on this list are not in the hash table (slot).  The head entry is a sentinel (does not refer to an actual chunk). */
     size_t        nbytes_used;  /* Current cached raw data in bytes */
     int           nused;        /* Number of chunk slots in use        */
+    size_t        ndirty;       /* Number of dirty chunks in the cache */
     H5D_chunk_cached_t last;    /* Cached copy of last chunk information */
     struct H5D_rdcc_ent_t **slot; /* Chunk slots, each points to a chunk*/
     H5SL_t        *sel_chunks;    /* Skip list containing information for each chunk selected */
     H5S_t         *single_space;  /* Dataspace for single element I/O on chunks */
     H5D_chunk_info_t    *single_chunk_info;  /* Pointer to single chunk's info */
+    hbool_t       sel_chunks_busy; /* Whether an I/O operation is using 'sel_chunks' */
+    hbool_t       single_busy;    /* Whether an I/O operation is using 'single_space' & 'single_chunk_info' */
 
     /* Cached information about scaled dataspace dimensions */
     hsize_t             scaled_dims[H5S_MAX_RANK];          /* The scaled dim sizes */
@@ -450,6 +454,7 @@ typedef struct H5D_rdcdc_t {
 typedef struct H5D_shared_t {
     size_t              fo_count;       /* Reference count */
     hbool_t             closing;        /* Flag to indicate dataset is closing */
+    struct H5D_write_behind_t *wb_op;   /* Queued write-behind pass, if any */
     hid_t               type_id;        /* ID for dataset's datatype    */
     H5T_t              *type;           /* Datatype for this dataset     */
     H5S_t              *space;          /* Dataspace of this dataset    */
@@ -457,6 +462,8 @@ typedef struct H5D_shared_t {
     H5D_dcpl_cache_t    dcpl_cache;     /* Cached DCPL values */
     H5O_layout_t        layout;         /* Data layout                  */
     hbool_t             checked_filters;/* TRUE if dataset passes can_apply check */
+    hbool_t             layout_pending; /* TRUE if the layout, pipeline, fill value & EFL haven't been loaded yet */
+    hid_t               lazy_dapl_id;   /* Copy of the DAPL the dataset was lazily opened with */
 
     /* Cached dataspace info */
     unsigned            ndims;                        /* The dataset's dataspace rank */
@@ -588,6 +595,7 @@ H5_DLL void *H5D__vlen_get_buf_size_alloc(size_t size, void *info);
 H5_DLL herr_t H5D__vlen_get_buf_size(void *elem, hid_t type_id, unsigned ndim,
     const hsize_t *point, void *op_data);
 H5_DLL herr_t H5D__check_filters(H5D_t *dataset);
+H5_DLL herr_t H5D__load_layout(H5D_t *dataset, hid_t dxpl_id);
 H5_DLL herr_t H5D__set_extent(H5D_t *dataset, const hsize_t *size, hid_t dxpl_id);
 H5_DLL herr_t H5D__get_dxpl_cache(hid_t dxpl_id, H5D_dxpl_cache_t **cache);
 H5_DLL herr_t H5D__flush_sieve_buf(H5D_t *dataset, hid_t dxpl_id);
@@ -602,6 +610,7 @@ H5_DLL herr_t H5D_set_io_info_dxpls(H5D_io_info_t *io_info, hid_t dxpl_id);
 H5_DLL herr_t H5D__format_convert(H5D_t *dataset, hid_t dxpl_id);
 
 /* Internal I/O routines */
+H5_DLL herr_t H5D__write_behind_cancel(H5D_t *dset);
 H5_DLL herr_t H5D__pre_write(H5D_t *dset, hbool_t direct_write, hid_t mem_type_id,
     const H5S_t *mem_space, const H5S_t *file_space, hid_t dxpl_id, const void *buf);
 H5_DLL herr_t H5D__read(H5D_t *dataset, hid_t mem_type_id,
@@ -686,6 +695,8 @@ H5_DLL herr_t H5D__chunk_set_sizes(H5D_t *dset);
 H5_DLL herr_t H5D__chunk_addrmap(const H5D_io_info_t *io_info, haddr_t chunk_addr[]);
 #endif /* H5_HAVE_PARALLEL */
 H5_DLL herr_t H5D__chunk_update_cache(H5D_t *dset, hid_t dxpl_id);
+H5_DLL herr_t H5D__chunk_write_behind(const H5D_t *dset, hid_t dxpl_id,
+    double dirty_ratio, size_t max_bytes, hbool_t *more);
 H5_DLL herr_t H5D__chunk_copy(H5F_t *f_src, H5O_storage_chunk_t *storage_src,
     H5O_layout_chunk_t *layout_src, H5F_t *f_dst, H5O_storage_chunk_t *storage_dst,
     const H5S_extent_t *ds_extent_src, const H5T_t *dt_src,
@@ -791,6 +802,7 @@ H5_DLL herr_t H5D__layout_compact_dirty_test(hid_t did, hbool_t *dirty);
 H5_DLL herr_t H5D__layout_idx_type_test(hid_t did, H5D_chunk_index_t *idx_type);
 H5_DLL herr_t H5D__layout_type_test(hid_t did, H5D_layout_t *layout_type);
 H5_DLL herr_t H5D__current_cache_size_test(hid_t did, size_t *nbytes_used, int *nused);
+H5_DLL herr_t H5D__layout_pending_test(hid_t did, hbool_t *pending);
 #endif /* H5D_TESTING */
 
 #endif /*_H5Dpkg_H*/
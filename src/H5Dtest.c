@@ -308,3 +308,43 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* H5D__current_cache_size_test() */
 
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5D__layout_pending_test
+ PURPOSE
+    Determine whether a lazily opened dataset's layout is yet to be loaded
+ USAGE
+    herr_t H5D__layout_pending_test(did, pending)
+        hid_t did;              IN: Dataset to query
+        hbool_t *pending;       OUT: Pointer to location to place flag
+ RETURNS
+    Non-negative on success, negative on failure
+ DESCRIPTION
+    Checks whether the layout, pipeline, fill value & EFL information of a
+    dataset hasn't been loaded yet.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    DO NOT USE THIS FUNCTION FOR ANYTHING EXCEPT TESTING
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5D__layout_pending_test(hid_t did, hbool_t *pending)
+{
+    H5D_t	*dset;          /* Pointer to dataset to query */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    if(NULL == (dset = (H5D_t *)H5I_object_verify(did, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+
+    if(pending)
+        *pending = dset->shared->layout_pending;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* H5D__layout_pending_test() */
+
@@ -207,6 +207,7 @@ H5E__init_package(void)
 
 #ifndef H5_HAVE_THREADSAFE
     H5E_stack_g[0].nused = 0;
+    H5E_stack_g[0].quiet = FALSE;
     H5E_set_default_auto(H5E_stack_g);
 #endif /* H5_HAVE_THREADSAFE */
 
@@ -377,6 +378,7 @@ H5E_get_stack(void)
 
         /* Set the thread-specific info */
         estack->nused = 0;
+        estack->quiet = FALSE;
         H5E_set_default_auto(estack);
 
         /* (It's not necessary to release this in this API, it is
@@ -1134,6 +1136,7 @@ H5E_set_current_stack(H5E_t *estack)
         current_error->line = new_error->line;
         if(NULL == (current_error->desc = H5MM_xstrdup(new_error->desc)))
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        current_stack->quiet_slot[u] = FALSE;
     } /* end for */
 
 done:
@@ -1740,3 +1743,74 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Eauto_is_v2() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Eset_quiet
+ *
+ * Purpose:	Turns "quiet" error recording on or off for the current
+ *		thread's default error stack.  While quiet, errors pushed
+ *		by the library record only the error class, major and minor
+ *		codes, function, file and line; the description is left as
+ *		the unformatted message string.  This is meant for code
+ *		that expects calls to fail (probing for objects inside
+ *		H5E_BEGIN_TRY, for instance) and never looks at the stack.
+ *
+ *		Errors pushed through H5Epush2() are always recorded in
+ *		full.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Eset_quiet(hbool_t quiet)
+{
+    H5E_t   *estack;            /* Error stack to operate on */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    /* Don't clear the error stack! :-) */
+    FUNC_ENTER_API_NOCLEAR(FAIL)
+    H5TRACE1("e", "b", quiet);
+
+    if(NULL == (estack = H5E_get_my_stack())) /*lint !e506 !e774 Make lint 'constant value Boolean' in non-threaded case */
+        HGOTO_ERROR(H5E_ERROR, H5E_CANTGET, FAIL, "can't get current error stack")
+
+    estack->quiet = quiet;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Eset_quiet() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Eget_quiet
+ *
+ * Purpose:	Retrieves whether "quiet" error recording is on for the
+ *		current thread's default error stack.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Eget_quiet(hbool_t *quiet)
+{
+    H5E_t   *estack;            /* Error stack to operate on */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    /* Don't clear the error stack! :-) */
+    FUNC_ENTER_API_NOCLEAR(FAIL)
+    H5TRACE1("e", "*b", quiet);
+
+    if(NULL == quiet)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid pointer")
+
+    if(NULL == (estack = H5E_get_my_stack())) /*lint !e506 !e774 Make lint 'constant value Boolean' in non-threaded case */
+        HGOTO_ERROR(H5E_ERROR, H5E_CANTGET, FAIL, "can't get current error stack")
+
+    *quiet = estack->quiet;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Eget_quiet() */
+
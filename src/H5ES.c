@@ -0,0 +1,662 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     Event sets, which track the asynchronous operations started
+ *              by the H5*_async() API routines.
+ *
+ *              In builds with a background thread (see H5ESprivate.h) the
+ *              operations from every event set are placed on a single FIFO
+ *              queue that the thread drains, taking the library's global
+ *              lock around each operation.  Otherwise each operation is
+ *              carried out as soon as it is inserted.
+ *
+ *              Since the background thread only carries out an operation
+ *              while holding the global lock, a thread holding the lock
+ *              knows every pending operation is still on the queue, and
+ *              can carry out queued operations itself instead of waiting.
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5ESmodule.h"         /* This source code file is part of the H5ES module */
+
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"          /* Generic Functions                        */
+#include "H5Eprivate.h"         /* Error handling                           */
+#include "H5ESprivate.h"        /* Event sets                               */
+#include "H5FLprivate.h"        /* Free Lists                               */
+#include "H5Iprivate.h"         /* IDs                                      */
+
+
+/****************/
+/* Local Macros */
+/****************/
+
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* Event set */
+struct H5ES_t {
+    size_t npending;            /* # of operations not yet completed        */
+    size_t nfailed;             /* # of completed operations that failed    */
+    hbool_t closed;             /* Whether the event set's ID was released  */
+};
+
+/* Asynchronous operation */
+typedef struct H5ES_op_t {
+    H5ES_op_func_t func;        /* Routine carrying out the operation       */
+    void *udata;                /* Operation's data, released by FUNC       */
+    H5ES_t *es;                 /* Event set the operation belongs to       */
+    struct H5ES_op_t *next;     /* Next operation in the queue              */
+} H5ES_op_t;
+
+
+/********************/
+/* Local Prototypes */
+/********************/
+static herr_t H5ES__close_cb(H5ES_t *es);
+static void H5ES__run_op(H5ES_op_t *op);
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+static H5ES_op_t *H5ES__dequeue(void);
+static void *H5ES__worker(void *arg);
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+/* Package initialization variable */
+hbool_t H5_PKG_INIT_VAR = FALSE;
+
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Declare a free list to manage the H5ES_t struct */
+H5FL_DEFINE_STATIC(H5ES_t);
+
+/* Declare a free list to manage the H5ES_op_t struct */
+H5FL_DEFINE_STATIC(H5ES_op_t);
+
+/* Event set ID class */
+static const H5I_class_t H5I_EVENTSET_CLS[1] = {{
+    H5I_EVENTSET,               /* ID class value */
+    0,                          /* Class flags */
+    0,                          /* # of reserved IDs for class */
+    (H5I_free_t)H5ES__close_cb  /* Callback routine for closing objects of this class */
+}};
+
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+/* Queue of operations waiting for the background thread.  The queue mutex
+ * also protects the counters in every event set and the background
+ * thread's state.  It may be acquired while holding the global API lock,
+ * never the other way around.
+ */
+static pthread_mutex_t H5ES_queue_mutex_g = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t H5ES_work_cond_g = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t H5ES_locked_cond_g = PTHREAD_COND_INITIALIZER;
+static H5ES_op_t *H5ES_queue_head_g = NULL;
+static H5ES_op_t *H5ES_queue_tail_g = NULL;
+
+/* Background thread */
+static pthread_t H5ES_worker_g;
+static hbool_t H5ES_worker_started_g = FALSE;
+static hbool_t H5ES_worker_stop_g = FALSE;     /* Set to make the thread exit */
+static hbool_t H5ES_worker_locking_g = FALSE;  /* Whether it's waiting for the API lock */
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__init_package
+ *
+ * Purpose:     Initialize interface-specific information
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5ES__init_package(void)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Initialize the atom group for the event set IDs */
+    if(H5I_register_type(H5I_EVENTSET_CLS) < 0)
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTINIT, FAIL, "unable to initialize ID group")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES__init_package() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES_term_package
+ *
+ * Purpose:     Terminate the H5ES interface.  Operations still waiting for
+ *              the background thread are carried out first, since they
+ *              hold references to the objects other interfaces close, and
+ *              then the thread is stopped.
+ *
+ * Return:      Success:    Positive if anything is done that might
+ *                          affect other interfaces; zero otherwise.
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+H5ES_term_package(void)
+{
+    int n = 0;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(H5_PKG_INIT_VAR) {
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+        H5ES_op_t *op;          /* Operation taken from the queue */
+
+        /* Carry out any queued operations on this thread */
+        do {
+            pthread_mutex_lock(&H5ES_queue_mutex_g);
+            op = H5ES__dequeue();
+            pthread_mutex_unlock(&H5ES_queue_mutex_g);
+
+            if(op) {
+                H5ES__run_op(op);
+                n++;
+            } /* end if */
+        } while(op);
+
+        /* Stop the background thread */
+        if(H5ES_worker_started_g) {
+            pthread_mutex_lock(&H5ES_queue_mutex_g);
+            H5ES_worker_stop_g = TRUE;
+            pthread_cond_signal(&H5ES_work_cond_g);
+
+            /* If the thread is waiting for the API lock, it can't see the
+             * request to stop until it gets the lock, so let it have it.
+             */
+            while(H5ES_worker_locking_g)
+                (void)H5TS_api_cond_wait(&H5ES_locked_cond_g, &H5ES_queue_mutex_g);
+            pthread_mutex_unlock(&H5ES_queue_mutex_g);
+
+            pthread_join(H5ES_worker_g, NULL);
+            H5ES_worker_started_g = FALSE;
+            H5ES_worker_stop_g = FALSE;
+        } /* end if */
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+
+        if(H5I_nmembers(H5I_EVENTSET) > 0) {
+            (void)H5I_clear_type(H5I_EVENTSET, FALSE, FALSE);
+            n++; /*H5I*/
+        } /* end if */
+        else if(0 == n) {
+            /* Destroy the event set ID group */
+            n += (H5I_dec_type_ref(H5I_EVENTSET) > 0);
+
+            /* Mark closed */
+            if(0 == n)
+                H5_PKG_INIT_VAR = FALSE;
+        } /* end else */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(n)
+} /* end H5ES_term_package() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__close_cb
+ *
+ * Purpose:     Called when the last reference to an event set ID is
+ *              released.  The event set is freed now if it has no
+ *              operations in progress, otherwise by the last of them to
+ *              complete.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5ES__close_cb(H5ES_t *es)
+{
+    hbool_t free_es;            /* Whether to free the event set now */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(es);
+
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+    pthread_mutex_lock(&H5ES_queue_mutex_g);
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+    es->closed = TRUE;
+    free_es = (hbool_t)(0 == es->npending);
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+    pthread_mutex_unlock(&H5ES_queue_mutex_g);
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+
+    if(free_es)
+        es = H5FL_FREE(H5ES_t, es);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5ES__close_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__run_op
+ *
+ * Purpose:     Carry out an operation and account for it in its event set,
+ *              if it has one.
+ *              Errors from the operation are counted, not reported, as
+ *              there is no API call left to report them to.
+ *
+ *              Must be called with the global API lock held.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5ES__run_op(H5ES_op_t *op)
+{
+    H5ES_t *es;                 /* Operation's event set */
+    hbool_t failed;             /* Whether the operation failed */
+    hbool_t free_es;            /* Whether to free the event set now */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(op);
+
+    es = op->es;
+    if((failed = (hbool_t)((op->func)(op->udata) < 0)))
+        H5E_clear_stack(NULL);
+
+    if(es) {
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+        pthread_mutex_lock(&H5ES_queue_mutex_g);
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+        HDassert(es->npending > 0);
+        es->npending--;
+        if(failed)
+            es->nfailed++;
+        free_es = (hbool_t)(es->closed && 0 == es->npending);
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+        pthread_mutex_unlock(&H5ES_queue_mutex_g);
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+
+        if(free_es)
+            es = H5FL_FREE(H5ES_t, es);
+    } /* end if */
+    op = H5FL_FREE(H5ES_op_t, op);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5ES__run_op() */
+
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__dequeue
+ *
+ * Purpose:     Take the operation at the head of the queue off it.
+ *
+ *              Must be called with the queue mutex held.
+ *
+ * Return:      The operation, or NULL if the queue is empty
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5ES_op_t *
+H5ES__dequeue(void)
+{
+    H5ES_op_t *op;              /* Operation taken from the queue */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(NULL != (op = H5ES_queue_head_g)) {
+        H5ES_queue_head_g = op->next;
+        if(NULL == H5ES_queue_head_g)
+            H5ES_queue_tail_g = NULL;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(op)
+} /* end H5ES__dequeue() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES__worker
+ *
+ * Purpose:     Body of the background thread: wait for operations to be
+ *              queued and carry them out in order, one per acquisition of
+ *              the global API lock so application threads can interleave,
+ *              until H5ES_term_package asks it to stop.
+ *
+ * Return:      NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5ES__worker(void H5_ATTR_UNUSED *arg)
+{
+    H5ES_op_t *op;              /* Operation taken from the queue */
+
+    pthread_mutex_lock(&H5ES_queue_mutex_g);
+    for(;;) {
+        /* Wait for work, without holding the API lock */
+        while(NULL == H5ES_queue_head_g && !H5ES_worker_stop_g)
+            pthread_cond_wait(&H5ES_work_cond_g, &H5ES_queue_mutex_g);
+        if(H5ES_worker_stop_g)
+            break;
+        H5ES_worker_locking_g = TRUE;
+        pthread_mutex_unlock(&H5ES_queue_mutex_g);
+
+        /* Take the API lock before dequeuing, so that library shutdown
+         * (which holds the lock) can't have the operation taken out from
+         * under it.
+         */
+        H5_API_LOCK
+        pthread_mutex_lock(&H5ES_queue_mutex_g);
+        H5ES_worker_locking_g = FALSE;
+        pthread_cond_broadcast(&H5ES_locked_cond_g);
+        op = H5ES__dequeue();
+        pthread_mutex_unlock(&H5ES_queue_mutex_g);
+
+        if(op)
+            H5ES__run_op(op);
+        H5_API_UNLOCK
+
+        pthread_mutex_lock(&H5ES_queue_mutex_g);
+    } /* end for */
+    pthread_mutex_unlock(&H5ES_queue_mutex_g);
+
+    return(NULL);
+} /* end H5ES__worker() */
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ES_insert
+ *
+ * Purpose:     Start an asynchronous operation in an event set.  FUNC is
+ *              called with UDATA once the operations started before it
+ *              have completed; from then on UDATA belongs to FUNC.  If
+ *              this routine fails, UDATA still belongs to the caller.
+ *
+ *              ES may be NULL for internal background work that no event
+ *              set waits on; errors from such operations are discarded.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5ES_insert(H5ES_t *es, H5ES_op_func_t func, void *udata)
+{
+    H5ES_op_t *op = NULL;       /* New operation */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(!es || !es->closed);
+    HDassert(func);
+
+    if(NULL == (op = H5FL_MALLOC(H5ES_op_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for operation")
+    op->func = func;
+    op->udata = udata;
+    op->es = es;
+    op->next = NULL;
+
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+    /* Queue the operation for the background thread, unless the library is
+     * shutting down, when the thread isn't restarted.
+     */
+    if(!H5_TERM_GLOBAL) {
+        pthread_mutex_lock(&H5ES_queue_mutex_g);
+        if(!H5ES_worker_started_g) {
+            if(0 != pthread_create(&H5ES_worker_g, NULL, H5ES__worker, NULL)) {
+                pthread_mutex_unlock(&H5ES_queue_mutex_g);
+                HGOTO_ERROR(H5E_EVENTSET, H5E_CANTINIT, FAIL, "can't create background thread")
+            } /* end if */
+            H5ES_worker_started_g = TRUE;
+        } /* end if */
+
+        if(es)
+            es->npending++;
+        if(H5ES_queue_tail_g)
+            H5ES_queue_tail_g->next = op;
+        else
+            H5ES_queue_head_g = op;
+        H5ES_queue_tail_g = op;
+        pthread_cond_signal(&H5ES_work_cond_g);
+        pthread_mutex_unlock(&H5ES_queue_mutex_g);
+        op = NULL;
+
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+
+    /* Carry out the operation right away */
+    if(es)
+        es->npending++;
+    H5ES__run_op(op);
+    op = NULL;
+
+done:
+    if(op)
+        op = H5FL_FREE(H5ES_op_t, op);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5ES_insert() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5EScreate
+ *
+ * Purpose:     Creates an empty event set.
+ *
+ * Return:      Success:    An event set ID
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5EScreate(void)
+{
+    H5ES_t *es;                 /* New event set */
+    hid_t ret_value;            /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE0("i","");
+
+    if(NULL == (es = H5FL_CALLOC(H5ES_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for event set")
+
+    if((ret_value = H5I_register(H5I_EVENTSET, es, TRUE)) < 0) {
+        es = H5FL_FREE(H5ES_t, es);
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTREGISTER, FAIL, "can't register event set")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5EScreate() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ESwait
+ *
+ * Purpose:     Waits for all the operations in an event set to complete.
+ *              The operations still queued are carried out on the calling
+ *              thread, along with the ones queued ahead of them, instead
+ *              of waiting for the background thread.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5ESwait(hid_t es_id)
+{
+    H5ES_t *es;                 /* Event set */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", es_id);
+
+    if(NULL == (es = (H5ES_t *)H5I_object_verify(es_id, H5I_EVENTSET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an event set ID")
+
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+    /* No operation can be in progress on the background thread while this
+     * thread holds the API lock, so the event set's pending operations are
+     * all still queued, unless one of them made this call.
+     */
+    pthread_mutex_lock(&H5ES_queue_mutex_g);
+    while(es->npending > 0) {
+        H5ES_op_t *op;          /* Operation taken from the queue */
+
+        if(NULL == (op = H5ES__dequeue())) {
+            pthread_mutex_unlock(&H5ES_queue_mutex_g);
+            HGOTO_ERROR(H5E_EVENTSET, H5E_CANTLOCK, FAIL, "can't wait for event set from within one of its operations")
+        } /* end if */
+        pthread_mutex_unlock(&H5ES_queue_mutex_g);
+
+        H5ES__run_op(op);
+
+        pthread_mutex_lock(&H5ES_queue_mutex_g);
+    } /* end while */
+    pthread_mutex_unlock(&H5ES_queue_mutex_g);
+#else /* H5ES_HAVE_BACKGROUND_THREAD */
+    HDassert(0 == es->npending);
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5ESwait() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ESget_count
+ *
+ * Purpose:     Retrieves the number of operations in an event set that
+ *              have not yet completed.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5ESget_count(hid_t es_id, size_t *count /*out*/)
+{
+    H5ES_t *es;                 /* Event set */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", es_id, count);
+
+    if(NULL == (es = (H5ES_t *)H5I_object_verify(es_id, H5I_EVENTSET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an event set ID")
+
+    if(count) {
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+        pthread_mutex_lock(&H5ES_queue_mutex_g);
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+        *count = es->npending;
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+        pthread_mutex_unlock(&H5ES_queue_mutex_g);
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+    } /* end if */
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5ESget_count() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ESget_err_count
+ *
+ * Purpose:     Retrieves the number of operations in an event set that
+ *              have completed and failed.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5ESget_err_count(hid_t es_id, size_t *num_errs /*out*/)
+{
+    H5ES_t *es;                 /* Event set */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", es_id, num_errs);
+
+    if(NULL == (es = (H5ES_t *)H5I_object_verify(es_id, H5I_EVENTSET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an event set ID")
+
+    if(num_errs) {
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+        pthread_mutex_lock(&H5ES_queue_mutex_g);
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+        *num_errs = es->nfailed;
+#ifdef H5ES_HAVE_BACKGROUND_THREAD
+        pthread_mutex_unlock(&H5ES_queue_mutex_g);
+#endif /* H5ES_HAVE_BACKGROUND_THREAD */
+    } /* end if */
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5ESget_err_count() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5ESclose
+ *
+ * Purpose:     Closes an event set.  Operations still in progress are not
+ *              affected; they complete in the background.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5ESclose(hid_t es_id)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", es_id);
+
+    if(H5I_EVENTSET != H5I_get_type(es_id))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an event set ID")
+
+    if(H5I_dec_app_ref(es_id) < 0)
+        HGOTO_ERROR(H5E_EVENTSET, H5E_CANTDEC, FAIL, "can't close event set")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5ESclose() */
@@ -0,0 +1,60 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-----------------------------------------------------------------------------
+ * File:    H5ESprivate.h
+ * Purpose: Library-private declarations for event sets
+ *---------------------------------------------------------------------------*/
+
+#ifndef _H5ESprivate_H
+#define _H5ESprivate_H
+
+/* Include package's public header */
+#include "H5ESpublic.h"
+
+/* Private headers needed by this file */
+#include "H5private.h"
+
+/**************************/
+/* Library Private Macros */
+/**************************/
+
+/* Operations are run on a background thread only when the library is
+ * threadsafe (and so has a global lock for the thread to take).  The
+ * Windows threads layer lacks the condition variables the queue needs.
+ */
+#if defined(H5_HAVE_THREADSAFE) && !defined(H5_HAVE_WIN_THREADS)
+#define H5ES_HAVE_BACKGROUND_THREAD
+#endif
+
+
+/****************************/
+/* Library Private Typedefs */
+/****************************/
+
+/* Event set */
+typedef struct H5ES_t H5ES_t;
+
+/* Callback that carries out an asynchronous operation.  It is called with
+ * the library's global lock held and must release UDATA, whether or not the
+ * operation succeeds.
+ */
+typedef herr_t (*H5ES_op_func_t)(void *udata);
+
+
+/***************************************/
+/* Library-private Function Prototypes */
+/***************************************/
+H5_DLL herr_t H5ES_insert(H5ES_t *es, H5ES_op_func_t func, void *udata);
+
+#endif /* _H5ESprivate_H */
+
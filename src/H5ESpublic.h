@@ -0,0 +1,52 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * This file contains public declarations for the H5ES (event set) module.
+ *
+ * An event set collects the operations started by the H5*_async() routines
+ * (H5Dwrite_async, H5Dread_async, H5Dclose_async, H5Fflush_async).  In
+ * threadsafe builds the operations are carried out, in the order they were
+ * started, by a library background thread; otherwise they are carried out
+ * before the H5*_async() routine returns.
+ *
+ * Buffers passed to an asynchronous operation stay owned by the
+ * application, which must not modify (for writes) or use (for reads) them
+ * until the operation has completed, i.e. until H5ESwait() returns or
+ * H5ESget_count() reports no operations in progress.  The IDs passed to an
+ * operation may be closed as soon as it has been started; dataspace
+ * selections are copied when the operation is started.
+ */
+#ifndef _H5ESpublic_H
+#define _H5ESpublic_H
+
+/* Public headers needed by this file */
+#include "H5public.h"
+#include "H5Ipublic.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Functions in H5ES.c */
+H5_DLL hid_t H5EScreate(void);
+H5_DLL herr_t H5ESwait(hid_t es_id);
+H5_DLL herr_t H5ESget_count(hid_t es_id, size_t *count);
+H5_DLL herr_t H5ESget_err_count(hid_t es_id, size_t *num_errs);
+H5_DLL herr_t H5ESclose(hid_t es_id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _H5ESpublic_H */
+
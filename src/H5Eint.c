@@ -662,7 +662,9 @@ H5E_set_auto(H5E_t *estack, const H5E_auto_op_t *op, void *client_data)
 /*-------------------------------------------------------------------------
  * Function:	H5E_printf_stack
  *
- * Purpose:	Printf-like wrapper around H5E_push_stack.
+ * Purpose:	Printf-like wrapper around H5E_push_stack.  When the
+ *		stack is in quiet mode the record is stored without
+ *		formatting the description (see H5Eset_quiet).
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -699,6 +701,34 @@ H5E_printf_stack(H5E_t *estack, const char *file, const char *func, unsigned lin
     HDassert(min_id > 0);
     HDassert(fmt);
 
+    /* Check for 'default' error stack */
+    if(estack == NULL)
+    	if(NULL == (estack = H5E_get_my_stack())) /*lint !e506 !e774 Make lint 'constant value Boolean' in non-threaded case */
+            HGOTO_DONE(FAIL)
+
+    /* In quiet mode, just record the codes and location.  The file and
+     * function names are static strings and the library's error IDs live
+     * until the library shuts down, so neither needs to be copied or
+     * referenced.  The description is left as the unformatted message.
+     */
+    if(estack->quiet) {
+        if(estack->nused < H5E_NSLOTS) {
+            H5E_error2_t *error = &(estack->slot[estack->nused]);
+
+            error->cls_id = cls_id;
+            error->maj_num = maj_id;
+            error->min_num = min_id;
+            error->func_name = func ? func : "Unknown_Function";
+            error->file_name = file ? file : "Unknown_File";
+            error->line = line;
+            error->desc = fmt;
+            estack->quiet_slot[estack->nused] = TRUE;
+            estack->nused++;
+        } /* end if */
+
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
 /* Note that the variable-argument parsing for the format is identical in
  *      the H5Epush2() routine - correct errors and make changes in both
  *      places. -QAK
@@ -780,6 +810,9 @@ herr_t
 H5E_push_stack(H5E_t *estack, const char *file, const char *func, unsigned line,
     hid_t cls_id, hid_t maj_id, hid_t min_id, const char *desc)
 {
+#ifdef H5_HAVE_THREADSAFE
+    hbool_t     resumed = FALSE;        /* Whether the API lock was taken back for the push */
+#endif /* H5_HAVE_THREADSAFE */
     herr_t	ret_value = SUCCEED;      /* Return value */
 
     /*
@@ -818,6 +851,13 @@ H5E_push_stack(H5E_t *estack, const char *file, const char *func, unsigned line,
     HDassert(estack);
 
     if(estack->nused < H5E_NSLOTS) {
+#ifdef H5_HAVE_THREADSAFE
+        /* The IDs are shared, so take back the API lock if this thread
+         * released it around raw data I/O.
+         */
+        resumed = H5TS_api_resume();
+#endif /* H5_HAVE_THREADSAFE */
+
         /* Increment the IDs to indicate that they are used in this stack */
         if(H5I_inc_ref(cls_id, FALSE) < 0)
             HGOTO_DONE(FAIL)
@@ -835,10 +875,16 @@ H5E_push_stack(H5E_t *estack, const char *file, const char *func, unsigned line,
 	estack->slot[estack->nused].line = line;
 	if(NULL == (estack->slot[estack->nused].desc = H5MM_xstrdup(desc)))
             HGOTO_DONE(FAIL)
+        estack->quiet_slot[estack->nused] = FALSE;
 	estack->nused++;
     } /* end if */
 
 done:
+#ifdef H5_HAVE_THREADSAFE
+    if(resumed)
+        (void)H5TS_api_yield();
+#endif /* H5_HAVE_THREADSAFE */
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5E_push_stack() */
 
@@ -873,6 +919,10 @@ H5E_clear_entries(H5E_t *estack, size_t nentries)
     for(u = 0; nentries > 0; nentries--, u++) {
         error = &(estack->slot[estack->nused - (u + 1)]);
 
+        /* Records pushed in quiet mode don't own anything */
+        if(estack->quiet_slot[estack->nused - (u + 1)])
+            continue;
+
         /* Decrement the IDs to indicate that they are no longer used by this stack */
         /* (In reverse order that they were incremented, so that reference counts work well) */
         if(H5I_dec_ref(error->min_num) < 0)
@@ -934,6 +984,77 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5E_clear_stack() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5E_set_quiet
+ *
+ * Purpose:	Private function to turn quiet error recording on or off
+ *		for an error stack.  Records pushed in quiet mode take no
+ *		references on the error IDs, so threads running library
+ *		code without the global lock use it.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5E_set_quiet(H5E_t *estack, hbool_t quiet)
+{
+    herr_t ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check for 'default' error stack */
+    if(estack == NULL)
+    	if(NULL == (estack = H5E_get_my_stack())) /*lint !e506 !e774 Make lint 'constant value Boolean' in non-threaded case */
+            HGOTO_ERROR(H5E_ERROR, H5E_CANTGET, FAIL, "can't get current error stack")
+
+    estack->quiet = quiet;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5E_set_quiet() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5E_take_quiet_errors
+ *
+ * Purpose:	Private function to copy up to NERRORS of the records pushed
+ *		in quiet mode on an error stack into ERRORS, oldest first,
+ *		and then empty the stack.  The copies own nothing, so they
+ *		may be handed to another thread to push on its own stack
+ *		with H5E_push_stack().
+ *
+ * Return:	Number of records copied (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5E_take_quiet_errors(H5E_t *estack, H5E_error2_t *errors, size_t nerrors)
+{
+    size_t      u;                      /* Local index variable */
+    size_t      ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(errors || 0 == nerrors);
+
+    /* Check for 'default' error stack */
+    if(estack == NULL)
+    	if(NULL == (estack = H5E_get_my_stack())) /*lint !e506 !e774 Make lint 'constant value Boolean' in non-threaded case */
+            HGOTO_DONE(0)
+
+    for(u = 0; u < estack->nused && ret_value < nerrors; u++)
+        if(estack->quiet_slot[u])
+            errors[ret_value++] = estack->slot[u];
+
+    if(estack->nused)
+        (void)H5E_clear_entries(estack, estack->nused);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5E_take_quiet_errors() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5E_pop
@@ -112,6 +112,8 @@ struct H5E_t {
     H5E_error2_t slot[H5E_NSLOTS];	/* Array of error records	     */
     H5E_auto_op_t auto_op;              /* Operator for 'automatic' error reporting */
     void *auto_data;                    /* Callback data for 'automatic error reporting */
+    hbool_t quiet;                      /* Whether library errors are pushed without formatting */
+    hbool_t quiet_slot[H5E_NSLOTS];     /* Whether each record was pushed in quiet mode (holds no references or copies) */
 };
 
 
@@ -186,6 +186,9 @@ H5_DLL herr_t H5E_push_stack(H5E_t *estack, const char *file, const char *func,
 H5_DLL herr_t H5E_printf_stack(H5E_t *estack, const char *file, const char *func,
     unsigned line, hid_t cls_id, hid_t maj_id, hid_t min_id, const char *fmt, ...)H5_ATTR_FORMAT(printf, 8, 9);
 H5_DLL herr_t H5E_clear_stack(H5E_t *estack);
+H5_DLL herr_t H5E_set_quiet(H5E_t *estack, hbool_t quiet);
+H5_DLL size_t H5E_take_quiet_errors(H5E_t *estack, H5E_error2_t *errors,
+    size_t nerrors);
 H5_DLL herr_t H5E_dump_api_stack(hbool_t is_api);
 
 #endif /* _H5Eprivate_H */
@@ -111,6 +111,29 @@ H5_DLLVAR hid_t H5E_ERR_CLS_g;
 }
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
 
+/*
+ * Like H5E_BEGIN_TRY/H5E_END_TRY, but also records errors pushed by the
+ * library in quiet mode (see H5Eset_quiet()), which avoids formatting
+ * the error descriptions for calls that are expected to fail:
+ *
+ * 	H5E_BEGIN_QUIET {
+ *	    ...stuff here that's likely to fail...
+ *      } H5E_END_QUIET;
+ *
+ * The same warning as for H5E_BEGIN_TRY applies.
+ */
+#define H5E_BEGIN_QUIET {						      \
+    hbool_t H5E_saved_quiet;						      \
+									      \
+    (void)H5Eget_quiet(&H5E_saved_quiet);				      \
+    (void)H5Eset_quiet(1);						      \
+    H5E_BEGIN_TRY
+
+#define H5E_END_QUIET							      \
+    H5E_END_TRY								      \
+    (void)H5Eset_quiet(H5E_saved_quiet);				      \
+}
+
 /*
  * Public API Convenience Macros for Error reporting - Documented
  */
@@ -172,6 +195,8 @@ H5_DLL herr_t H5Eget_auto2(hid_t estack_id, H5E_auto2_t *func, void **client_dat
 H5_DLL herr_t H5Eset_auto2(hid_t estack_id, H5E_auto2_t func, void *client_data);
 H5_DLL herr_t H5Eclear2(hid_t err_stack);
 H5_DLL herr_t H5Eauto_is_v2(hid_t err_stack, unsigned *is_stack);
+H5_DLL herr_t H5Eset_quiet(hbool_t quiet);
+H5_DLL herr_t H5Eget_quiet(hbool_t *quiet);
 H5_DLL ssize_t H5Eget_msg(hid_t msg_id, H5E_type_t *type, char *msg,
     size_t size);
 H5_DLL ssize_t H5Eget_num(hid_t error_stack_id);
@@ -26,8 +26,10 @@
 #include "H5ACprivate.h"        /* Metadata cache                       */
 #include "H5Dprivate.h"         /* Datasets                             */
 #include "H5Eprivate.h"         /* Error handling                       */
+#include "H5ESprivate.h"        /* Event sets                           */
 #include "H5Fpkg.h"             /* File access                          */
 #include "H5FDprivate.h"        /* File drivers                         */
+#include "H5FLprivate.h"        /* Free Lists                           */
 #include "H5Gprivate.h"         /* Groups                               */
 #include "H5Iprivate.h"         /* IDs                                  */
 #include "H5MFprivate.h"        /* File memory management               */
@@ -45,6 +47,12 @@
 /* Local Typedefs */
 /******************/
 
+/* Data for an H5Fflush_async() operation */
+typedef struct H5F_flush_async_t {
+    hid_t object_id;                    /* Object whose file to flush */
+    H5F_scope_t scope;                  /* Scope of the flush */
+} H5F_flush_async_t;
+
 
 /********************/
 /* Package Typedefs */
@@ -54,6 +62,9 @@
 /********************/
 /* Local Prototypes */
 /********************/
+static H5F_t *H5F__flush_obj_file(hid_t object_id);
+static herr_t H5F__flush_scope(H5F_t *f, H5F_scope_t scope);
+static herr_t H5F__flush_async_cb(void *udata);
 
 
 /*********************/
@@ -73,6 +84,9 @@ hbool_t H5_PKG_INIT_VAR = FALSE;
 /* Local Variables */
 /*******************/
 
+/* Declare a free list to manage the H5F_flush_async_t struct */
+H5FL_DEFINE_STATIC(H5F_flush_async_t);
+
 
 /* File ID class */
 static const H5I_class_t H5I_FILE_CLS[1] = {{
@@ -526,29 +540,28 @@ done:
 
 
 /*-------------------------------------------------------------------------
- * Function: H5Fflush
+ * Function: H5F__flush_obj_file
  *
- * Purpose:  Flushes all outstanding buffers of a file to disk but does
- *           not remove them from the cache.  The OBJECT_ID can be a file,
- *           dataset, group, attribute, or named data type.
+ * Purpose:  Retrieves the file to flush for the OBJECT_ID given to
+ *           H5Fflush() or H5Fflush_async().
  *
- * Return:   Non-negative on success/Negative on failure
+ * Return:   Success:    Pointer to the file
+ *           Failure:    NULL
  *-------------------------------------------------------------------------
  */
-herr_t
-H5Fflush(hid_t object_id, H5F_scope_t scope)
+static H5F_t *
+H5F__flush_obj_file(hid_t object_id)
 {
     H5F_t      *f = NULL;              /* File to flush */
     H5O_loc_t  *oloc = NULL;           /* Object location for ID */
-    herr_t      ret_value = SUCCEED;   /* Return value */
+    H5F_t      *ret_value = NULL;      /* Return value */
 
-    FUNC_ENTER_API(FAIL)
-    H5TRACE2("e", "iFs", object_id, scope);
+    FUNC_ENTER_STATIC
 
     switch(H5I_get_type(object_id)) {
         case H5I_FILE:
             if(NULL == (f = (H5F_t *)H5I_object(object_id)))
-                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid file identifier")
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "invalid file identifier")
             break;
 
         case H5I_GROUP:
@@ -556,7 +569,7 @@ H5Fflush(hid_t object_id, H5F_scope_t scope)
                 H5G_t    *grp;
 
                 if(NULL == (grp = (H5G_t *)H5I_object(object_id)))
-                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid group identifier")
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "invalid group identifier")
                 oloc = H5G_oloc(grp);
             }
             break;
@@ -566,7 +579,7 @@ H5Fflush(hid_t object_id, H5F_scope_t scope)
                 H5T_t    *type;
 
                 if(NULL == (type = (H5T_t *)H5I_object(object_id)))
-                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid type identifier")
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "invalid type identifier")
                 oloc = H5T_oloc(type);
             }
             break;
@@ -576,7 +589,7 @@ H5Fflush(hid_t object_id, H5F_scope_t scope)
                 H5D_t    *dset;
 
                 if(NULL == (dset = (H5D_t *)H5I_object(object_id)))
-                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid dataset identifier")
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "invalid dataset identifier")
                 oloc = H5D_oloc(dset);
             }
             break;
@@ -586,7 +599,7 @@ H5Fflush(hid_t object_id, H5F_scope_t scope)
                 H5A_t    *attr;
 
                 if(NULL == (attr = (H5A_t *)H5I_object(object_id)))
-                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid attribute identifier")
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "invalid attribute identifier")
                 oloc = H5A_oloc(attr);
             }
             break;
@@ -601,18 +614,43 @@ H5Fflush(hid_t object_id, H5F_scope_t scope)
         case H5I_ERROR_CLASS:
         case H5I_ERROR_MSG:
         case H5I_ERROR_STACK:
+        case H5I_EVENTSET:
         case H5I_NTYPES:
         default:
-            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file or file object")
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file or file object")
     } /* end switch */
 
     if(!f) {
         if(!oloc)
-            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "object is not assocated with a file")
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "object is not assocated with a file")
         f = oloc->file;
     } /* end if */
     if(!f)
-        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "object is not associated with a file")
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "object is not associated with a file")
+
+    /* Set return value */
+    ret_value = f;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__flush_obj_file() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: H5F__flush_scope
+ *
+ * Purpose:  Flushes a file, or the mounted file hierarchy it is part of,
+ *           for H5Fflush() or H5Fflush_async().
+ *
+ * Return:   Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__flush_scope(H5F_t *f, H5F_scope_t scope)
+{
+    herr_t      ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_STATIC
 
     /* Flush the file */
     /*
@@ -636,10 +674,118 @@ H5Fflush(hid_t object_id, H5F_scope_t scope)
         } /* end else */
     } /* end if */
 
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__flush_scope() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: H5Fflush
+ *
+ * Purpose:  Flushes all outstanding buffers of a file to disk but does
+ *           not remove them from the cache.  The OBJECT_ID can be a file,
+ *           dataset, group, attribute, or named data type.
+ *
+ * Return:   Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fflush(hid_t object_id, H5F_scope_t scope)
+{
+    H5F_t      *f = NULL;              /* File to flush */
+    herr_t      ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iFs", object_id, scope);
+
+    if(NULL == (f = H5F__flush_obj_file(object_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "can't get file to flush")
+
+    if(H5F__flush_scope(f, scope) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTFLUSH, FAIL, "unable to flush file")
+
 done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Fflush() */
 
+
+/*-------------------------------------------------------------------------
+ * Function: H5F__flush_async_cb
+ *
+ * Purpose:  Carries out an H5Fflush_async() operation.
+ *
+ * Return:   Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__flush_async_cb(void *_udata)
+{
+    H5F_flush_async_t *udata = (H5F_flush_async_t *)_udata;
+    H5F_t      *f;                     /* File to flush */
+    herr_t      ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(NULL == (f = H5F__flush_obj_file(udata->object_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "can't get file to flush")
+    if(H5F__flush_scope(f, udata->scope) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTFLUSH, FAIL, "unable to flush file")
+
+done:
+    if(H5I_dec_ref(udata->object_id) < 0)
+        HDONE_ERROR(H5E_FILE, H5E_CANTDEC, FAIL, "can't decrement object reference count")
+    udata = H5FL_FREE(H5F_flush_async_t, udata);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__flush_async_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: H5Fflush_async
+ *
+ * Purpose:  Starts flushing a file as H5Fflush() does, as an operation
+ *           of the event set ES_ID.
+ *
+ * Return:   Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fflush_async(hid_t object_id, H5F_scope_t scope, hid_t es_id)
+{
+    H5ES_t     *es;                    /* Event set */
+    H5F_flush_async_t *udata = NULL;   /* Operation's data */
+    herr_t      ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "iFsi", object_id, scope, es_id);
+
+    if(NULL == (es = (H5ES_t *)H5I_object_verify(es_id, H5I_EVENTSET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an event set ID")
+    if(NULL == H5F__flush_obj_file(object_id))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "can't get file to flush")
+
+    /* Keep the object open until the flush is carried out */
+    if(NULL == (udata = H5FL_MALLOC(H5F_flush_async_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    udata->object_id = object_id;
+    udata->scope = scope;
+    if(H5I_inc_ref(object_id, FALSE) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTINC, FAIL, "can't increment object reference count")
+
+    if(H5ES_insert(es, H5F__flush_async_cb, udata) < 0) {
+        if(H5I_dec_ref(object_id) < 0)
+            HDONE_ERROR(H5E_FILE, H5E_CANTDEC, FAIL, "can't decrement object reference count")
+        HGOTO_ERROR(H5E_FILE, H5E_CANTINSERT, FAIL, "can't start flush")
+    } /* end if */
+    udata = NULL;
+
+done:
+    if(udata)
+        udata = H5FL_FREE(H5F_flush_async_t, udata);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Fflush_async() */
+
 
 /*-------------------------------------------------------------------------
  * Function: H5Fclose
@@ -959,7 +1105,7 @@ H5Fget_mdc_config(hid_t file_id, H5AC_cache_config_t *config_ptr)
     /* Check args */
     if(NULL == (file = (H5F_t *)H5I_object_verify(file_id, H5I_FILE)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
-    if((NULL == config_ptr) || (config_ptr->version != H5AC__CURR_CACHE_CONFIG_VERSION))
+    if((NULL == config_ptr) || !H5AC__CACHE_CONFIG_VERSION_OK(config_ptr->version))
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Bad config_ptr")
 
     /* Go get the resize configuration */
@@ -1949,3 +2095,70 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Fget_mdc_image_info() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Fget_io_stats
+ *
+ * Purpose:     Retrieves the statistics for the reads and writes the
+ *              library has sent to the file driver since the file was
+ *              opened (or since the last call to H5Freset_io_stats).
+ *
+ * Return:      Success:        SUCCEED
+ *              Failure:        FAIL
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fget_io_stats(hid_t file_id, H5F_io_stats_t *stats)
+{
+    H5F_t      *file;                   /* File object for file ID */
+    herr_t     ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*x", file_id, stats);
+
+    /* Check args */
+    if(NULL == (file = (H5F_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+    if(NULL == stats)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "NULL stats pointer")
+
+    /* Get the statistics */
+    if(H5FD_get_io_stats(file->shared->lf, stats) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't retrieve I/O stats")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Fget_io_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Freset_io_stats
+ *
+ * Purpose:     Resets the statistics for the reads and writes sent to
+ *              the file driver.
+ *
+ * Return:      Success:        SUCCEED
+ *              Failure:        FAIL
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Freset_io_stats(hid_t file_id)
+{
+    H5F_t      *file;                   /* File object for file ID */
+    herr_t     ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", file_id);
+
+    /* Check args */
+    if(NULL == (file = (H5F_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+
+    /* Reset the statistics */
+    if(H5FD_reset_io_stats(file->shared->lf) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "can't reset I/O stats")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Freset_io_stats() */
+
@@ -110,7 +110,7 @@ const H5AC_class_t H5AC_FARRAY_HDR[1] = {{
     H5AC_FARRAY_HDR_ID,                 /* Metadata client ID */
     "Fixed-array Header",               /* Metadata client name (for debugging) */
     H5FD_MEM_FARRAY_HDR,                /* File space memory type for client */
-    H5AC__CLASS_NO_FLAGS_SET,           /* Client class behavior flags */
+    H5AC__CLASS_PARALLEL_SERIALIZE_FLAG, /* Client class behavior flags */
     H5FA__cache_hdr_get_initial_load_size,      /* 'get_initial_load_size' callback */
     NULL,				/* 'get_final_load_size' callback */
     H5FA__cache_hdr_verify_chksum,	/* 'verify_chksum' callback */
@@ -128,7 +128,7 @@ const H5AC_class_t H5AC_FARRAY_DBLOCK[1] = {{
     H5AC_FARRAY_DBLOCK_ID,              /* Metadata client ID */
     "Fixed Array Data Block",           /* Metadata client name (for debugging) */
     H5FD_MEM_FARRAY_DBLOCK,             /* File space memory type for client */
-    H5AC__CLASS_NO_FLAGS_SET,           /* Client class behavior flags */
+    H5AC__CLASS_PARALLEL_SERIALIZE_FLAG, /* Client class behavior flags */
     H5FA__cache_dblock_get_initial_load_size,   /* 'get_initial_load_size' callback */
     NULL,				/* 'get_final_load_size' callback */
     H5FA__cache_dblock_verify_chksum,	/* 'verify_chksum' callback */
@@ -146,7 +146,7 @@ const H5AC_class_t H5AC_FARRAY_DBLK_PAGE[1] = {{
     H5AC_FARRAY_DBLK_PAGE_ID,           /* Metadata client ID */
     "Fixed Array Data Block Page",      /* Metadata client name (for debugging) */
     H5FD_MEM_FARRAY_DBLK_PAGE,          /* File space memory type for client */
-    H5AC__CLASS_NO_FLAGS_SET,           /* Client class behavior flags */
+    H5AC__CLASS_PARALLEL_SERIALIZE_FLAG, /* Client class behavior flags */
     H5FA__cache_dblk_page_get_initial_load_size, /* 'get_initial_load_size' callback */
     NULL,				/* 'get_final_load_size' callback */
     H5FA__cache_dblk_page_verify_chksum, /* 'verify_chksum' callback */
@@ -38,6 +38,7 @@
 #include "H5Iprivate.h"		/* IDs			  		*/
 #include "H5MMprivate.h"	/* Memory management			*/
 #include "H5Pprivate.h"		/* Property lists			*/
+#include "H5SLprivate.h"	/* Skip lists				*/
 
 /****************/
 /* Local Macros */
@@ -48,6 +49,12 @@
 /* Local Typedefs */
 /******************/
 
+/* I/O statistics for an open file, kept outside of the H5FD_t struct */
+typedef struct H5FD_io_stats_node_t {
+    unsigned long       fileno;         /* Serial number of the file (key) */
+    H5F_io_stats_t      stats;          /* Reads & writes dispatched to the driver */
+} H5FD_io_stats_node_t;
+
 
 /********************/
 /* Package Typedefs */
@@ -59,6 +66,7 @@
 /********************/
 static herr_t H5FD_free_cls(H5FD_class_t *cls);
 static int H5FD_query(const H5FD_t *f, unsigned long *flags/*out*/);
+static int H5FD_io_stats_cmp(const void *key1, const void *key2);
 
 /*********************/
 /* Package Variables */
@@ -91,6 +99,12 @@ hbool_t H5_PKG_INIT_VAR = FALSE;
  */
 static unsigned long H5FD_file_serial_no_g;
 
+/* I/O statistics for the open files, keyed by file serial number */
+static H5SL_t *H5FD_io_stats_g = NULL;
+
+/* Declare a free list to manage the H5FD_io_stats_node_t struct */
+H5FL_DEFINE_STATIC(H5FD_io_stats_node_t);
+
 /* File driver ID class */
 static const H5I_class_t H5I_VFL_CLS[1] = {{
     H5I_VFL,			/* ID class value */
@@ -151,6 +165,12 @@ H5FD_term_package(void)
     FUNC_ENTER_NOAPI_NOINIT_NOERR
 
     if(H5_PKG_INIT_VAR) {
+        /* Release the (empty) I/O statistics list, if one is left */
+        if(H5FD_io_stats_g && 0 == H5SL_count(H5FD_io_stats_g)) {
+            H5SL_close(H5FD_io_stats_g);
+            H5FD_io_stats_g = NULL;
+        } /* end if */
+
         if(H5I_nmembers(H5I_VFL) > 0) {
             (void)H5I_clear_type(H5I_VFL, FALSE, FALSE);
             n++; /*H5I*/
@@ -690,6 +710,7 @@ H5FD_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
     H5P_genplist_t      *plist;                 /* Property list pointer */
     unsigned long       driver_flags = 0;       /* File-inspecific driver feature flags */
     H5FD_file_image_info_t file_image_info;     /* Initial file image */
+    H5FD_io_stats_node_t *io_stats;             /* I/O statistics for file */
     H5FD_t		*ret_value = NULL;      /* Return value */
 
     FUNC_ENTER_NOAPI(NULL)
@@ -764,6 +785,18 @@ H5FD_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
     /* (This will be changed later, when the superblock is located) */
     file->base_addr = 0;
 
+    /* Start with empty I/O statistics */
+    if(NULL == H5FD_io_stats_g)
+        if(NULL == (H5FD_io_stats_g = H5SL_create(H5SL_TYPE_GENERIC, H5FD_io_stats_cmp)))
+            HGOTO_ERROR(H5E_VFL, H5E_CANTCREATE, NULL, "can't create I/O statistics list")
+    if(NULL == (io_stats = H5FL_CALLOC(H5FD_io_stats_node_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "can't allocate I/O statistics")
+    io_stats->fileno = file->fileno;
+    if(H5SL_insert(H5FD_io_stats_g, io_stats, &io_stats->fileno) < 0) {
+        io_stats = H5FL_FREE(H5FD_io_stats_node_t, io_stats);
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINSERT, NULL, "can't insert I/O statistics")
+    } /* end if */
+
     /* Set return value */
     ret_value = file;
 
@@ -827,6 +860,18 @@ H5FD_close(H5FD_t *file)
     /* check args */
     HDassert(file && file->cls);
 
+    /* Release the file's I/O statistics */
+    if(H5FD_io_stats_g) {
+        H5FD_io_stats_node_t *io_stats;     /* I/O statistics for file */
+
+        if(NULL != (io_stats = (H5FD_io_stats_node_t *)H5SL_remove(H5FD_io_stats_g, &file->fileno)))
+            io_stats = H5FL_FREE(H5FD_io_stats_node_t, io_stats);
+        if(0 == H5SL_count(H5FD_io_stats_g)) {
+            H5SL_close(H5FD_io_stats_g);
+            H5FD_io_stats_g = NULL;
+        } /* end if */
+    } /* end if */
+
     /* Prepare to close file by clearing all public fields */
     driver = file->cls;
     if(H5I_dec_ref(file->driver_id) < 0)
@@ -1871,6 +1916,136 @@ H5FD_set_paged_aggr(H5FD_t *file, hbool_t paged)
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5FD_set_paged_aggr() */
 
+
+/*--------------------------------------------------------------------------
+ * Function:    H5FD_get_io_stats
+ *
+ * Purpose:     Retrieve the I/O statistics for the file, including the
+ *              totals over all the metadata types.
+ *
+ * Return:      Non-negative if succeed; negative if fails.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5FD_get_io_stats(const H5FD_t *file, H5F_io_stats_t *stats)
+{
+    const H5F_io_stats_t *io_stats;     /* I/O statistics for file */
+    H5FD_mem_t  mt;                     /* Memory type */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(file);
+    HDassert(stats);
+
+    if(NULL == (io_stats = H5FD__io_stats_lookup(file)))
+        HGOTO_ERROR(H5E_VFL, H5E_NOTFOUND, FAIL, "can't find I/O statistics for file")
+    HDmemcpy(stats, io_stats, sizeof(H5F_io_stats_t));
+
+    /* Sum up the metadata statistics */
+    HDmemset(&stats->meta_read, 0, sizeof(H5F_io_op_stats_t));
+    HDmemset(&stats->meta_write, 0, sizeof(H5F_io_op_stats_t));
+    for(mt = H5FD_MEM_DEFAULT; mt < H5FD_MEM_NTYPES; H5_INC_ENUM(H5FD_mem_t, mt))
+        if(H5FD_MEM_DRAW != mt) {
+            const H5F_io_op_stats_t *src[2];
+            H5F_io_op_stats_t *dst[2];
+            unsigned u, v;
+
+            src[0] = &io_stats->read[mt];
+            src[1] = &io_stats->write[mt];
+            dst[0] = &stats->meta_read;
+            dst[1] = &stats->meta_write;
+            for(u = 0; u < 2; u++) {
+                dst[u]->count += src[u]->count;
+                dst[u]->bytes += src[u]->bytes;
+                dst[u]->total_usec += src[u]->total_usec;
+                dst[u]->max_usec = MAX(dst[u]->max_usec, src[u]->max_usec);
+                for(v = 0; v < H5F_IO_STATS_NBUCKETS; v++)
+                    dst[u]->latency[v] += src[u]->latency[v];
+            } /* end for */
+        } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_get_io_stats() */
+
+
+/*--------------------------------------------------------------------------
+ * Function:    H5FD_reset_io_stats
+ *
+ * Purpose:     Reset the I/O statistics for the file.
+ *
+ * Return:      Non-negative if succeed; negative if fails.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5FD_reset_io_stats(H5FD_t *file)
+{
+    H5F_io_stats_t *io_stats;           /* I/O statistics for file */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(file);
+
+    if(NULL == (io_stats = H5FD__io_stats_lookup(file)))
+        HGOTO_ERROR(H5E_VFL, H5E_NOTFOUND, FAIL, "can't find I/O statistics for file")
+    HDmemset(io_stats, 0, sizeof(H5F_io_stats_t));
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_reset_io_stats() */
+
+
+/*--------------------------------------------------------------------------
+ * Function:    H5FD__io_stats_lookup
+ *
+ * Purpose:     Find the I/O statistics kept for an open file.
+ *
+ * Return:      Pointer to the statistics on success, NULL if the file
+ *              has none.
+ *
+ *--------------------------------------------------------------------------
+ */
+H5F_io_stats_t *
+H5FD__io_stats_lookup(const H5FD_t *file)
+{
+    H5FD_io_stats_node_t *io_stats = NULL;  /* I/O statistics for file */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(file);
+
+    if(H5FD_io_stats_g)
+        io_stats = (H5FD_io_stats_node_t *)H5SL_search(H5FD_io_stats_g, &file->fileno);
+
+    FUNC_LEAVE_NOAPI(io_stats ? &io_stats->stats : NULL)
+} /* end H5FD__io_stats_lookup() */
+
+
+/*--------------------------------------------------------------------------
+ * Function:    H5FD_io_stats_cmp
+ *
+ * Purpose:     Compare the serial numbers of two files, for the I/O
+ *              statistics skip list.
+ *
+ * Return:      A value like strcmp()
+ *
+ *--------------------------------------------------------------------------
+ */
+static int
+H5FD_io_stats_cmp(const void *key1, const void *key2)
+{
+    unsigned long fileno1 = *(const unsigned long *)key1;
+    unsigned long fileno2 = *(const unsigned long *)key2;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI((fileno1 > fileno2) - (fileno1 < fileno2))
+} /* end H5FD_io_stats_cmp() */
+
 
 /*-------------------------------------------------------------------------
 * Function: H5FDdriver_query
@@ -71,6 +71,8 @@ typedef struct H5FD_direct_t {
     haddr_t  pos;      /*current file I/O position  */
     int    op;      /*last operation    */
     H5FD_direct_fapl_t  fa;    /*file access properties  */
+    void        *copy_buf;      /*aligned copy buffer, kept across I/O calls */
+    size_t      copy_buf_size;  /*size of the copy buffer allocation    */
 #ifndef H5_HAVE_WIN32_API
     /*
      * On most systems the combination of device and i-node number uniquely
@@ -137,6 +139,7 @@ static herr_t H5FD_direct_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, h
 static herr_t H5FD_direct_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t H5FD_direct_lock(H5FD_t *_file, hbool_t rw);
 static herr_t H5FD_direct_unlock(H5FD_t *_file);
+static void *H5FD_direct_get_copy_buf(H5FD_direct_t *file, size_t size);
 
 
 static const H5FD_class_t H5FD_direct_g = {
@@ -605,6 +608,10 @@ H5FD_direct_close(H5FD_t *_file)
     if (HDclose(file->fd)<0)
         HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
 
+    /* Free with HDfree since it came from posix_memalign */
+    if(file->copy_buf)
+        HDfree(file->copy_buf);
+
     H5FL_FREE(H5FD_direct_t,file);
 
 done:
@@ -833,6 +840,55 @@ done:
 }
 
 
+/*-------------------------------------------------------------------------
+ * Function:  H5FD_direct_get_copy_buf
+ *
+ * Purpose:  Returns an aligned copy buffer of at least SIZE bytes for
+ *    unaligned I/O.  The buffer is kept in the file struct and
+ *    reused by later calls, so it is only reallocated when a
+ *    request needs a bigger buffer than any previous one (it is
+ *    never bigger than the maximal copy buffer size).
+ *
+ * Return:  Success:  Pointer to the copy buffer
+ *
+ *    Failure:  NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD_direct_get_copy_buf(H5FD_direct_t *file, size_t size)
+{
+    void    *ret_value = NULL;       /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+    HDassert(size > 0);
+    HDassert(size <= file->fa.cbsize);
+
+    if(size > file->copy_buf_size) {
+        /* Free with HDfree since it came from posix_memalign */
+        if(file->copy_buf) {
+            HDfree(file->copy_buf);
+            file->copy_buf = NULL;
+            file->copy_buf_size = 0;
+        } /* end if */
+
+        if(HDposix_memalign(&file->copy_buf, file->fa.mboundary, size) != 0) {
+            file->copy_buf = NULL;
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "HDposix_memalign failed")
+        } /* end if */
+        file->copy_buf_size = size;
+    } /* end if */
+
+    /* Set return value */
+    ret_value = file->copy_buf;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_direct_get_copy_buf() */
+
+
 /*-------------------------------------------------------------------------
  * Function:  H5FD_direct_read
  *
@@ -853,7 +909,7 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FD_direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+H5FD_direct_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
          size_t size, void *buf/*out*/)
 {
     H5FD_direct_t  *file = (H5FD_direct_t*)_file;
@@ -868,6 +924,8 @@ H5FD_direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
     haddr_t    read_size;              /* Size to read into copy buffer */
     size_t    copy_size = size;       /* Size remaining to read when using copy buffer */
     size_t              copy_offset;            /* Offset into copy buffer of the requested data */
+    haddr_t             mid_addr;               /* Start of the block-aligned part of the request */
+    haddr_t             mid_end;                /* End of the block-aligned part of the request */
 
     FUNC_ENTER_NOAPI_NOINIT
 
@@ -922,19 +980,38 @@ H5FD_direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
     addr += (haddr_t)nbytes;
     buf = (char*)buf + nbytes;
       }
+    } else if((mid_addr = ((addr + _fbsize - 1) / _fbsize) * _fbsize)
+                < (mid_end = ((addr + size) / _fbsize) * _fbsize)
+            && ((size_t)((unsigned char *)buf + (mid_addr - addr)) % _boundary == 0)) {
+        /* The request covers whole file blocks whose part of the user
+         * buffer is suitably aligned in memory: read those blocks directly
+         * into the user buffer and only go through the copy buffer for the
+         * partial blocks at either end.
+         */
+        if(mid_addr > addr)
+            if(H5FD_direct_read(_file, type, dxpl_id, addr, (size_t)(mid_addr - addr), buf) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read leading partial block")
+        if(H5FD_direct_read(_file, type, dxpl_id, mid_addr, (size_t)(mid_end - mid_addr), (unsigned char *)buf + (mid_addr - addr)) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read aligned blocks")
+        if(mid_end < addr + size)
+            if(H5FD_direct_read(_file, type, dxpl_id, mid_end, (size_t)((addr + size) - mid_end), (unsigned char *)buf + (mid_end - addr)) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read trailing partial block")
+
+        /* The nested calls have already updated the file position */
+        HGOTO_DONE(SUCCEED)
     } else {
             /* Calculate where we will begin copying from the copy buffer */
             copy_offset = (size_t)(addr % _fbsize);
 
-      /* allocate memory needed for the Direct IO option up to the maximal
-       * copy buffer size. Make a bigger buffer for aligned I/O if size is
+      /* Get the copy buffer needed for the Direct IO option, up to the maximal
+       * copy buffer size. Use a bigger buffer for aligned I/O if size is
        * smaller than maximal copy buffer. */
       alloc_size = ((copy_offset + size - 1) / _fbsize + 1) * _fbsize;
       if(alloc_size > _cbsize)
         alloc_size = _cbsize;
       HDassert(!(alloc_size % _fbsize));
-      if (HDposix_memalign(&copy_buf, _boundary, alloc_size) != 0)
-    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "HDposix_memalign failed")
+      if(NULL == (copy_buf = H5FD_direct_get_copy_buf(file, alloc_size)))
+    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to get copy buffer")
 
             /* look for the aligned position for reading the data */
             HDassert(!(((addr / _fbsize) * _fbsize) % _fbsize));
@@ -953,8 +1030,6 @@ H5FD_direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
      * system calls and partial results like sec2 driver does because the
      * data may no longer be aligned. It's expecially true when the data in
      * file is smaller than ALLOC_SIZE. */
-        HDmemset(copy_buf, 0, alloc_size);
-
                 /* Calculate how much data we have to read in this iteration
                  * (including unused parts of blocks) */
                 if((copy_size + copy_offset) < alloc_size)
@@ -971,6 +1046,10 @@ H5FD_direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
         if (-1==nbytes) /* error */
         HSYS_GOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
 
+        /* Zero the part of the copy buffer that lies past the end of file */
+        if((haddr_t)nbytes < read_size)
+        HDmemset((unsigned char *)copy_buf + nbytes, 0, (size_t)(read_size - (haddr_t)nbytes));
+
         /* Copy the needed data from the copy buffer to the output
          * buffer, and update copy_size.  If the copy buffer does not
                  * contain the rest of the data, just copy what's in the copy
@@ -992,12 +1071,6 @@ H5FD_direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
 
       /*Final step: update address*/
       addr = (haddr_t)(((addr + size - 1) / _fbsize + 1) * _fbsize);
-
-      if(copy_buf) {
-                /* Free with HDfree since it came from posix_memalign */
-                HDfree(copy_buf);
-                copy_buf = NULL;
-            } /* end if */
     }
 
     /* Update current position */
@@ -1006,10 +1079,6 @@ H5FD_direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
 
 done:
     if(ret_value<0) {
-        /* Free with HDfree since it came from posix_memalign */
-        if(copy_buf)
-            HDfree(copy_buf);
-
         /* Reset last file I/O information */
         file->pos = HADDR_UNDEF;
         file->op = OP_UNKNOWN;
@@ -1038,7 +1107,7 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FD_direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+H5FD_direct_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
     size_t size, const void *buf)
 {
     H5FD_direct_t  *file = (H5FD_direct_t*)_file;
@@ -1056,6 +1125,8 @@ H5FD_direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_U
     haddr_t             read_size;              /* Size to read into copy buffer */
     size_t              copy_size = size;       /* Size remaining to write when using copy buffer */
     size_t              copy_offset;            /* Offset into copy buffer of the data to write */
+    haddr_t             mid_addr;               /* Start of the block-aligned part of the request */
+    haddr_t             mid_end;                /* End of the block-aligned part of the request */
 
     FUNC_ENTER_NOAPI_NOINIT
 
@@ -1104,14 +1175,33 @@ H5FD_direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_U
     addr += (haddr_t)nbytes;
     buf = (const char*)buf + nbytes;
       }
+    } else if((mid_addr = ((addr + _fbsize - 1) / _fbsize) * _fbsize)
+                < (mid_end = ((addr + size) / _fbsize) * _fbsize)
+            && ((size_t)((const unsigned char *)buf + (mid_addr - addr)) % _boundary == 0)) {
+        /* The request covers whole file blocks whose part of the user
+         * buffer is suitably aligned in memory: write those blocks directly
+         * from the user buffer and only read-modify-write the partial blocks
+         * at either end through the copy buffer.
+         */
+        if(mid_addr > addr)
+            if(H5FD_direct_write(_file, type, dxpl_id, addr, (size_t)(mid_addr - addr), buf) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write leading partial block")
+        if(H5FD_direct_write(_file, type, dxpl_id, mid_addr, (size_t)(mid_end - mid_addr), (const unsigned char *)buf + (mid_addr - addr)) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write aligned blocks")
+        if(mid_end < addr + size)
+            if(H5FD_direct_write(_file, type, dxpl_id, mid_end, (size_t)((addr + size) - mid_end), (const unsigned char *)buf + (mid_end - addr)) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write trailing partial block")
+
+        /* The nested calls have already updated the file position and eof */
+        HGOTO_DONE(SUCCEED)
     } else {
             /* Calculate where we will begin reading from (on disk) and where we
              * will begin copying from the copy buffer */
             write_addr = (addr / _fbsize) * _fbsize;
             copy_offset = (size_t)(addr % _fbsize);
 
-      /* allocate memory needed for the Direct IO option up to the maximal
-       * copy buffer size. Make a bigger buffer for aligned I/O if size is
+      /* Get the copy buffer needed for the Direct IO option, up to the maximal
+       * copy buffer size. Use a bigger buffer for aligned I/O if size is
        * smaller than maximal copy buffer.
        */
       alloc_size = ((copy_offset + size - 1) / _fbsize + 1) * _fbsize;
@@ -1119,8 +1209,8 @@ H5FD_direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_U
                 alloc_size = _cbsize;
             HDassert(!(alloc_size % _fbsize));
 
-      if (HDposix_memalign(&copy_buf, _boundary, alloc_size) != 0)
-    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "HDposix_memalign failed")
+      if(NULL == (copy_buf = H5FD_direct_get_copy_buf(file, alloc_size)))
+    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to get copy buffer")
 
             /* look for the right position for reading or writing the data */
             if(HDlseek(file->fd, (HDoff_t)write_addr, SEEK_SET) < 0)
@@ -1225,12 +1315,6 @@ H5FD_direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_U
   /*Update the address and size*/
   addr = write_addr;
   buf = (const char*)buf + size;
-
-  if(copy_buf) {
-    /* Free with HDfree since it came from posix_memalign */
-      HDfree(copy_buf);
-      copy_buf = NULL;
-        } /* end if */
     }
 
     /* Update current position and eof */
@@ -1241,10 +1325,6 @@ H5FD_direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_U
 
 done:
     if(ret_value<0) {
-        /* Free with HDfree since it came from posix_memalign */
-        if(copy_buf)
-            HDfree(copy_buf);
-
         /* Reset last file I/O information */
         file->pos = HADDR_UNDEF;
         file->op = OP_UNKNOWN;
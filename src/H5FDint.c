@@ -57,6 +57,8 @@
 /********************/
 /* Local Prototypes */
 /********************/
+static void H5FD__update_io_stats(H5F_io_op_stats_t *stats, H5FD_mem_t type,
+    size_t size, uint64_t elapsed_usec);
 
 
 /*********************/
@@ -167,6 +169,12 @@ H5FD_read(H5FD_io_info_t *fdio_info, H5FD_mem_t type, haddr_t addr,
     H5FD_t      *file;
     H5P_genplist_t *io_dxpl;
     haddr_t     eoa = HADDR_UNDEF;
+    uint64_t    start_usec;             /* Time the driver call started */
+    H5F_io_stats_t *io_stats;           /* I/O statistics for file */
+#ifdef H5_HAVE_THREADSAFE
+    hbool_t     yielded = FALSE;        /* Whether the API lock was released for the driver call */
+#endif /* H5_HAVE_THREADSAFE */
+    herr_t      drv_ret;                /* Return value from driver */
     herr_t      ret_value = SUCCEED;       /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
@@ -224,10 +232,29 @@ H5FD_read(H5FD_io_info_t *fdio_info, H5FD_mem_t type, haddr_t addr,
     if(!(file->access_flags & H5F_ACC_SWMR_READ) && ((addr + file->base_addr + size) > eoa))
         HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu, eoa = %llu", (unsigned long long)(addr + file->base_addr), (unsigned long long)size, (unsigned long long)eoa)
 
+#ifdef H5_HAVE_THREADSAFE
+    /* Let other shared API calls into the library while the driver reads
+     * raw data, if the driver supports it and the caller allowed it.
+     */
+    if(H5FD_MEM_DRAW == type && (file->feature_flags & H5FD_FEAT_CONCURRENT_READ)
+            && !(file->access_flags & H5F_ACC_RDWR))
+        yielded = H5TS_api_yield();
+#endif /* H5_HAVE_THREADSAFE */
+
     /* Dispatch to driver */
-    if((file->cls->read)(file, type, H5P_PLIST_ID(io_dxpl), addr + file->base_addr, size, buf) < 0)
+    start_usec = H5_now_usec();
+    drv_ret = (file->cls->read)(file, type, H5P_PLIST_ID(io_dxpl), addr + file->base_addr, size, buf);
+#ifdef H5_HAVE_THREADSAFE
+    if(yielded)
+        H5TS_api_resume();
+#endif /* H5_HAVE_THREADSAFE */
+    if(drv_ret < 0)
         HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "driver read request failed")
 
+    /* Account for the I/O */
+    if(NULL != (io_stats = H5FD__io_stats_lookup(file)))
+        H5FD__update_io_stats(io_stats->read, type, size, H5_now_usec() - start_usec);
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_read() */
@@ -253,6 +280,8 @@ H5FD_write(const H5FD_io_info_t *fdio_info, H5FD_mem_t type, haddr_t addr,
     H5FD_t      *file;
     H5P_genplist_t *io_dxpl;
     haddr_t     eoa = HADDR_UNDEF;
+    uint64_t    start_usec;             /* Time the driver call started */
+    H5F_io_stats_t *io_stats;           /* I/O statistics for file */
     herr_t      ret_value = SUCCEED;       /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
@@ -304,13 +333,62 @@ H5FD_write(const H5FD_io_info_t *fdio_info, H5FD_mem_t type, haddr_t addr,
                     (unsigned long long)(addr+ file->base_addr), (unsigned long long)size, (unsigned long long)eoa)
 
     /* Dispatch to driver */
+    start_usec = H5_now_usec();
     if((file->cls->write)(file, type, H5P_PLIST_ID(io_dxpl), addr + file->base_addr, size, buf) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "driver write request failed")
 
+    /* Account for the I/O */
+    if(NULL != (io_stats = H5FD__io_stats_lookup(file)))
+        H5FD__update_io_stats(io_stats->write, type, size, H5_now_usec() - start_usec);
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD__update_io_stats
+ *
+ * Purpose:	Account for one read or write dispatched to the driver,
+ *		in the array of statistics (indexed by memory type) for
+ *		that kind of operation.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__update_io_stats(H5F_io_op_stats_t *stats, H5FD_mem_t type, size_t size,
+    uint64_t elapsed_usec)
+{
+    uint64_t    usec = elapsed_usec;    /* Latency, shifted to find its bucket */
+    unsigned    bucket = 0;             /* Latency histogram bucket */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(stats);
+
+    /* Pick the statistics for the memory type */
+    if(type < H5FD_MEM_DEFAULT || type >= H5FD_MEM_NTYPES)
+        type = H5FD_MEM_DEFAULT;
+    stats += type;
+
+    stats->count++;
+    stats->bytes += size;
+    stats->total_usec += elapsed_usec;
+    if(elapsed_usec > stats->max_usec)
+        stats->max_usec = elapsed_usec;
+
+    /* Bucket N holds latencies of [2^(N-1), 2^N) microseconds */
+    while(usec > 0 && bucket < (H5F_IO_STATS_NBUCKETS - 1)) {
+        usec >>= 1;
+        bucket++;
+    } /* end while */
+    stats->latency[bucket]++;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__update_io_stats() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5FD_set_eoa
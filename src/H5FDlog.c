@@ -40,6 +40,9 @@
 /* The driver identification number, initialized at runtime */
 static hid_t H5FD_LOG_g = 0;
 
+/* Number of binary trace records buffered before writing them to the log */
+#define H5FD_LOG_TRACE_NRECS    4096
+
 /* Driver-specific file access properties */
 typedef struct H5FD_log_fapl_t {
     char *logfile;              /* Allocated log file name */
@@ -133,6 +136,9 @@ typedef struct H5FD_log_t {
     double              total_truncate_time;    /* Total time spent in truncate operations              */
     size_t              iosize;                 /* Size of I/O information buffers                  */
     FILE                *logfp;                 /* Log file pointer                                 */
+    unsigned char       *trace_buf;             /* Buffer of encoded binary trace records           */
+    size_t              trace_nrecs;            /* Number of records in trace buffer                */
+    uint64_t            trace_start;            /* Time the file was opened (in microseconds)       */
     H5FD_log_fapl_t     fa;                     /* Driver-specific file access properties           */
 } H5FD_log_t;
 
@@ -182,6 +188,9 @@ static herr_t H5FD_log_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, hadd
 static herr_t H5FD_log_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t H5FD_log_lock(H5FD_t *_file, hbool_t rw);
 static herr_t H5FD_log_unlock(H5FD_t *_file);
+static herr_t H5FD_log_trace_flush(H5FD_log_t *file);
+static herr_t H5FD_log_trace_record(H5FD_log_t *file, unsigned op, H5FD_mem_t type,
+            haddr_t addr, hsize_t size, uint64_t start);
 
 static const H5FD_class_t H5FD_log_g = {
     "log",					/*name			*/
@@ -328,6 +337,12 @@ H5Pset_fapl_log(hid_t fapl_id, const char *logfile, unsigned long long flags, si
     /* Check arguments */
     if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+    if(flags & H5FD_LOG_TRACE) {
+        if(flags != H5FD_LOG_TRACE)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "binary trace can't be combined with other logging flags")
+        if(NULL == logfile)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "binary trace requires a log file name")
+    } /* end if */
 
     /* This shallow copy is correct! The string will be properly 
      * copied deep down in the H5P code. 
@@ -618,7 +633,23 @@ H5FD_log_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
         } /* end if */
 
         /* Set the log file pointer */
-        if(fa->logfile)
+        if(file->fa.flags & H5FD_LOG_TRACE) {
+            unsigned char hdr[H5FD_LOG_TRACE_HDR_SIZE];
+            unsigned char *p = hdr;
+
+            /* Set up the trace buffer & write the trace file header */
+            if(NULL == (file->trace_buf = (unsigned char *)H5MM_malloc(H5FD_LOG_TRACE_NRECS * H5FD_LOG_TRACE_REC_SIZE)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate trace buffer")
+            file->trace_start = H5_now_usec();
+            if(NULL == (file->logfp = HDfopen(fa->logfile, "wb")))
+                HSYS_GOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to open trace file")
+            HDmemcpy(p, H5FD_LOG_TRACE_MAGIC, (size_t)H5FD_LOG_TRACE_MAGIC_LEN);
+            p += H5FD_LOG_TRACE_MAGIC_LEN;
+            UINT32ENCODE(p, H5FD_LOG_TRACE_VERSION);
+            if(1 != HDfwrite(hdr, sizeof(hdr), (size_t)1, file->logfp))
+                HSYS_GOTO_ERROR(H5E_IO, H5E_WRITEERROR, NULL, "unable to write trace file header")
+        } /* end if */
+        else if(fa->logfile)
             file->logfp = HDfopen(fa->logfile, "w");
         else
             file->logfp = stderr;
@@ -651,8 +682,16 @@ done:
     if(NULL == ret_value) {
         if(fd >= 0)
             HDclose(fd);
-        if(file)
+        if(file) {
+            if(file->trace_buf) {
+                if(file->logfp)
+                    HDfclose(file->logfp);
+                H5MM_xfree(file->trace_buf);
+            } /* end if */
+            if(file->fa.logfile)
+                H5MM_xfree(file->fa.logfile);
             file = H5FL_FREE(H5FD_log_t, file);
+        } /* end if */
     } /* end if */
 
     FUNC_LEAVE_NOAPI(ret_value)
@@ -797,6 +836,11 @@ H5FD_log_close(H5FD_t *_file)
             file->nread = (unsigned char *)H5MM_xfree(file->nread);
         if(file->fa.flags & H5FD_LOG_FLAVOR)
             file->flavor = (unsigned char *)H5MM_xfree(file->flavor);
+        if(file->fa.flags & H5FD_LOG_TRACE) {
+            if(H5FD_log_trace_flush(file) < 0)
+                HDONE_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to flush trace buffer")
+            file->trace_buf = (unsigned char *)H5MM_xfree(file->trace_buf);
+        } /* end if */
         if(file->logfp != stderr)
             HDfclose(file->logfp);
     } /* end if */
@@ -1163,6 +1207,7 @@ H5FD_log_read(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, hadd
 #ifdef H5_HAVE_GETTIMEOFDAY
     struct timeval      timeval_start, timeval_stop;
 #endif /* H5_HAVE_GETTIMEOFDAY */
+    uint64_t            trace_start = 0;    /* Start time of operation, for binary trace */
     herr_t              ret_value = SUCCEED;       /* Return value */
 
     FUNC_ENTER_NOAPI_NOINIT
@@ -1189,6 +1234,9 @@ H5FD_log_read(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, hadd
         } /* end if */
     } /* end if */
 
+    if(file->fa.flags & H5FD_LOG_TRACE)
+        trace_start = H5_now_usec();
+
     /* Seek to the correct location */
     if(addr != file->pos || OP_READ != file->op) {
 #ifdef H5_HAVE_GETTIMEOFDAY
@@ -1326,6 +1374,10 @@ H5FD_log_read(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, hadd
 #endif /* H5_HAVE_GETTIMEOFDAY */
     } /* end if */
 
+    if(file->fa.flags & H5FD_LOG_TRACE)
+        if(H5FD_log_trace_record(file, H5FD_LOG_TRACE_OP_READ, type, orig_addr, (hsize_t)orig_size, trace_start) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to record read in trace")
+
     /* Update current position */
     file->pos = addr;
     file->op = OP_READ;
@@ -1365,6 +1417,7 @@ H5FD_log_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, had
 #ifdef H5_HAVE_GETTIMEOFDAY
     struct timeval      timeval_start, timeval_stop;
 #endif /* H5_HAVE_GETTIMEOFDAY */
+    uint64_t            trace_start = 0;    /* Start time of operation, for binary trace */
     herr_t              ret_value = SUCCEED;       /* Return value */
 
     FUNC_ENTER_NOAPI_NOINIT
@@ -1396,6 +1449,9 @@ H5FD_log_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, had
             file->nwrite[tmp_addr++]++;
     } /* end if */
 
+    if(file->fa.flags & H5FD_LOG_TRACE)
+        trace_start = H5_now_usec();
+
     /* Seek to the correct location */
     if(addr != file->pos || OP_WRITE != file->op) {
 #ifdef H5_HAVE_GETTIMEOFDAY
@@ -1527,6 +1583,10 @@ H5FD_log_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, had
 #endif /* H5_HAVE_GETTIMEOFDAY */
     } /* end if */
 
+    if(file->fa.flags & H5FD_LOG_TRACE)
+        if(H5FD_log_trace_record(file, H5FD_LOG_TRACE_OP_WRITE, type, orig_addr, (hsize_t)orig_size, trace_start) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to record write in trace")
+
     /* Update current position and eof */
     file->pos = addr;
     file->op = OP_WRITE;
@@ -1580,7 +1640,10 @@ H5FD_log_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_U
         DWORD           dwError;    /* DWORD error code from GetLastError() */
         BOOL            bError;     /* Boolean error flag */
 #endif /* H5_HAVE_WIN32_API */
+        uint64_t        trace_start = 0;    /* Start time of truncate, for binary trace */
 
+        if(file->fa.flags & H5FD_LOG_TRACE)
+            trace_start = H5_now_usec();
 #ifdef H5_HAVE_GETTIMEOFDAY
         if(file->fa.flags & H5FD_LOG_TIME_TRUNCATE)
             HDgettimeofday(&timeval_start, NULL);
@@ -1642,6 +1705,9 @@ H5FD_log_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_U
             HDfprintf(file->logfp, "\n");
 #endif /* H5_HAVE_GETTIMEOFDAY */
         } /* end if */
+        if(file->fa.flags & H5FD_LOG_TRACE)
+            if(H5FD_log_trace_record(file, H5FD_LOG_TRACE_OP_TRUNCATE, H5FD_MEM_DEFAULT, file->eoa, (hsize_t)0, trace_start) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to record truncate in trace")
 
         /* Update the eof value */
         file->eof = file->eoa;
@@ -1728,3 +1794,88 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_log_unlock() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_log_trace_flush
+ *
+ * Purpose:     Writes the buffered binary trace records to the log file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_log_trace_flush(H5FD_log_t *file)
+{
+    herr_t      ret_value = SUCCEED;                /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+    HDassert(file->trace_buf);
+
+    if(file->trace_nrecs > 0) {
+        if(file->trace_nrecs != HDfwrite(file->trace_buf, (size_t)H5FD_LOG_TRACE_REC_SIZE, file->trace_nrecs, file->logfp))
+            HSYS_GOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write trace records")
+        file->trace_nrecs = 0;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_log_trace_flush() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_log_trace_record
+ *
+ * Purpose:     Appends a record for an operation that began at time START
+ *              (from H5_now_usec) to the binary trace buffer, writing the
+ *              buffer out when it fills.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_log_trace_record(H5FD_log_t *file, unsigned op, H5FD_mem_t type,
+    haddr_t addr, hsize_t size, uint64_t start)
+{
+    uint64_t    now = H5_now_usec();                /* Current time */
+    uint64_t    duration;                           /* Duration of operation */
+    uint32_t    thread_id = 0;                      /* ID of calling thread */
+    unsigned char *p;                               /* Pointer into trace buffer */
+    herr_t      ret_value = SUCCEED;                /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+    HDassert(file->trace_buf);
+
+    if(file->trace_nrecs == H5FD_LOG_TRACE_NRECS)
+        if(H5FD_log_trace_flush(file) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to flush trace buffer")
+
+#ifdef H5_HAVE_THREADSAFE
+    thread_id = (uint32_t)H5TS_thread_id();
+#endif /* H5_HAVE_THREADSAFE */
+    duration = now - start;
+    if(duration > (uint64_t)0xffffffff)
+        duration = (uint64_t)0xffffffff;
+
+    /* Encode the record */
+    p = file->trace_buf + (file->trace_nrecs * H5FD_LOG_TRACE_REC_SIZE);
+    UINT64ENCODE(p, start - file->trace_start);
+    UINT64ENCODE(p, addr);
+    UINT64ENCODE(p, size);
+    UINT32ENCODE(p, duration);
+    UINT32ENCODE(p, thread_id);
+    *p++ = (unsigned char)op;
+    *p++ = (unsigned char)type;
+    *p++ = 0;
+    *p++ = 0;
+    file->trace_nrecs++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_log_trace_record() */
+
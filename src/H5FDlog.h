@@ -56,6 +56,27 @@
 #define H5FD_LOG_ALLOC      0x00040000
 #define H5FD_LOG_FREE       0x00080000
 #define H5FD_LOG_ALL        (H5FD_LOG_FREE|H5FD_LOG_ALLOC|H5FD_LOG_TIME_IO|H5FD_LOG_NUM_IO|H5FD_LOG_FLAVOR|H5FD_LOG_FILE_IO|H5FD_LOG_LOC_IO|H5FD_LOG_META_IO)
+/* Flag for writing a compact binary trace of each read/write/truncate to
+ * the log file instead of text.  Can't be combined with the other flags. */
+#define H5FD_LOG_TRACE      0x00100000
+
+/* Layout of a binary trace file (all integers little-endian):
+ *      header: H5FD_LOG_TRACE_MAGIC, then a 4-byte format version
+ *      record: 8-byte time (microseconds since the file was opened),
+ *              8-byte address, 8-byte size, 4-byte duration (microseconds),
+ *              4-byte thread ID, 1-byte operation, 1-byte H5FD_mem_t,
+ *              2 reserved bytes
+ */
+#define H5FD_LOG_TRACE_MAGIC        "H5FDTRAC"
+#define H5FD_LOG_TRACE_MAGIC_LEN    8
+#define H5FD_LOG_TRACE_VERSION      1
+#define H5FD_LOG_TRACE_HDR_SIZE     (H5FD_LOG_TRACE_MAGIC_LEN + 4)
+#define H5FD_LOG_TRACE_REC_SIZE     36
+
+/* Operations recorded in a binary trace */
+#define H5FD_LOG_TRACE_OP_READ      0
+#define H5FD_LOG_TRACE_OP_WRITE     1
+#define H5FD_LOG_TRACE_OP_TRUNCATE  2
 
 #ifdef __cplusplus
 extern "C" {
@@ -54,6 +54,7 @@ H5_DLL haddr_t H5FD_alloc_real(H5FD_t *file, hid_t dxpl_id, H5FD_mem_t type,
     hsize_t size, haddr_t *align_addr, hsize_t *align_size);
 H5_DLL herr_t H5FD_free_real(H5FD_t *file, hid_t dxpl_id, H5FD_mem_t type,
     haddr_t addr, hsize_t size);
+H5_DLL H5F_io_stats_t *H5FD__io_stats_lookup(const H5FD_t *file);
 
 /* Testing functions */
 #ifdef H5FD_TESTING
@@ -257,6 +257,13 @@ typedef enum H5F_mem_t	H5FD_mem_t;
      * the canonical HDF5 file format.
      */
 #define H5FD_FEAT_DEFAULT_VFD_COMPATIBLE        0x00008000
+    /*
+     * Defining H5FD_FEAT_CONCURRENT_READ for a VFL driver means that the
+     * driver's read callback can be called for raw data by several threads
+     * at once on a file opened read-only, without holding the library's
+     * global lock (in the thread-safe library).
+     */
+#define H5FD_FEAT_CONCURRENT_READ       0x00010000
 
 
 /* Forward declaration */
@@ -530,6 +530,9 @@ H5FD_sec2_query(const H5FD_t *_file, unsigned long *flags /* out */)
         *flags |= H5FD_FEAT_POSIX_COMPAT_HANDLE;    /* get_handle callback returns a POSIX file descriptor              */
         *flags |= H5FD_FEAT_SUPPORTS_SWMR_IO;       /* VFD supports the single-writer/multiple-readers (SWMR) pattern   */
         *flags |= H5FD_FEAT_DEFAULT_VFD_COMPATIBLE; /* VFD creates a file which can be opened with the default VFD      */
+#ifdef H5_HAVE_PREAD
+        *flags |= H5FD_FEAT_CONCURRENT_READ;        /* Raw data reads don't share the file offset between threads       */
+#endif /* H5_HAVE_PREAD */
 
         /* Check for flags that are set by h5repart */
         if(file && file->fam_to_sec2)
@@ -682,11 +685,13 @@ H5FD_sec2_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUS
     if(REGION_OVERFLOW(addr, size))
         HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr)
 
+#ifndef H5_HAVE_PREAD
     /* Seek to the correct location */
     if(addr != file->pos || OP_READ != file->op) {
         if(HDlseek(file->fd, (HDoff_t)addr, SEEK_SET) < 0)
             HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
     } /* end if */
+#endif /* H5_HAVE_PREAD */
 
     /* Read data, being careful of interrupted system calls, partial results,
      * and the end of the file.
@@ -705,13 +710,21 @@ H5FD_sec2_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUS
             bytes_in = (h5_posix_io_t)size;
 
         do {
+#ifdef H5_HAVE_PREAD
+            bytes_read = HDpread(file->fd, buf, bytes_in, (HDoff_t)addr);
+#else /* H5_HAVE_PREAD */
             bytes_read = HDread(file->fd, buf, bytes_in);
+#endif /* H5_HAVE_PREAD */
         } while(-1 == bytes_read && EINTR == errno);
         
         if(-1 == bytes_read) { /* error */
             int myerrno = errno;
             time_t mytime = HDtime(NULL);
+#ifdef H5_HAVE_PREAD
+            HDoff_t myoffset = (HDoff_t)addr;
+#else /* H5_HAVE_PREAD */
             HDoff_t myoffset = HDlseek(file->fd, (HDoff_t)0, SEEK_CUR);
+#endif /* H5_HAVE_PREAD */
 
             HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', buf = %p, total read size = %llu, bytes this sub-read = %llu, bytes actually read = %llu, offset = %llu", HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), buf, (unsigned long long)size, (unsigned long long)bytes_in, (unsigned long long)bytes_read, (unsigned long long)myoffset);
         } /* end if */
@@ -730,16 +743,20 @@ H5FD_sec2_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUS
         buf = (char *)buf + bytes_read;
     } /* end while */
 
+#ifndef H5_HAVE_PREAD
     /* Update current position */
     file->pos = addr;
     file->op = OP_READ;
+#endif /* H5_HAVE_PREAD */
 
 done:
+#ifndef H5_HAVE_PREAD
     if(ret_value < 0) {
         /* Reset last file I/O information */
         file->pos = HADDR_UNDEF;
         file->op = OP_UNKNOWN;
     } /* end if */
+#endif /* H5_HAVE_PREAD */
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_sec2_read() */
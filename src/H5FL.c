@@ -422,6 +422,8 @@ H5FL_reg_malloc(H5FL_reg_head_t *head H5FL_TRACK_PARAMS)
         if(H5FL_reg_init(head)<0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, NULL, "can't initialize 'regular' blocks")
 
+    head->nreqs++;
+
     /* Check for nodes available on the free list first */
     if(head->list!=NULL) {
         /* Get a pointer to the block on the free list */
@@ -435,6 +437,8 @@ H5FL_reg_malloc(H5FL_reg_head_t *head H5FL_TRACK_PARAMS)
 
         /* Decrement the amount of global "regular" free list memory in use */
         H5FL_reg_gc_head.mem_freed-=(head->size);
+
+        head->nhits++;
     } /* end if */
     /* Otherwise allocate a node */
     else {
@@ -900,6 +904,8 @@ H5FL_blk_malloc(H5FL_blk_head_t *head, size_t size H5FL_TRACK_PARAMS)
         if(H5FL_blk_init(head)<0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, NULL, "can't initialize 'block' list")
 
+    head->nreqs++;
+
     /* check if there is a free list for blocks of this size */
     /* and if there are any blocks available on the list */
     if((free_list=H5FL_blk_find_list(&(head->head),size))!=NULL && free_list->list!=NULL) {
@@ -914,6 +920,8 @@ H5FL_blk_malloc(H5FL_blk_head_t *head, size_t size H5FL_TRACK_PARAMS)
         /* Decrement the amount of global "block" free list memory in use */
         H5FL_blk_gc_head.mem_freed-=size;
 
+        head->nhits++;
+
     } /* end if */
     /* No free list available, or there are no nodes on the list, allocate a new node to give to the user */
     else {
@@ -1509,6 +1517,8 @@ H5FL_arr_malloc(H5FL_arr_head_t *head, size_t elem)
     /* Get the set of the memory block */
     mem_size=head->list_arr[elem].size;
 
+    head->nreqs++;
+
     /* Check for nodes available on the free list first */
     if(head->list_arr[elem].list!=NULL) {
         /* Get a pointer to the block on the free list */
@@ -1524,6 +1534,8 @@ H5FL_arr_malloc(H5FL_arr_head_t *head, size_t elem)
         /* Decrement the amount of global "array" free list memory in use */
         H5FL_arr_gc_head.mem_freed-=mem_size;
 
+        head->nhits++;
+
     } /* end if */
     /* Otherwise allocate a node */
     else {
@@ -2139,6 +2151,8 @@ H5FL_fac_malloc(H5FL_fac_head_t *head H5FL_TRACK_PARAMS)
     HDassert(head);
     HDassert(head->init);
 
+    head->nreqs++;
+
     /* Check for nodes available on the free list first */
     if(head->list!=NULL) {
         /* Get a pointer to the block on the free list */
@@ -2152,6 +2166,8 @@ H5FL_fac_malloc(H5FL_fac_head_t *head H5FL_TRACK_PARAMS)
 
         /* Decrement the amount of global "factory" free list memory in use */
         H5FL_fac_gc_head.mem_freed-=(head->size);
+
+        head->nhits++;
     } /* end if */
     /* Otherwise allocate a node */
     else {
@@ -2469,6 +2485,26 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* end H5FL_garbage_coll() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL_get_free_mem
+ *
+ * Purpose:	Report the memory held on all the free lists, for the
+ *              library's memory budget.
+ *
+ * Return:	Bytes of freed memory held for reuse
+ *
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5FL_get_free_mem(void)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(H5FL_reg_gc_head.mem_freed + H5FL_arr_gc_head.mem_freed
+            + H5FL_blk_gc_head.mem_freed + H5FL_fac_gc_head.mem_freed)
+}   /* end H5FL_get_free_mem() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5FL_set_free_list_limits
@@ -2531,3 +2567,106 @@ H5FL_set_free_list_limits(int reg_global_lim, int reg_list_lim, int arr_global_l
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* end H5FL_set_free_list_limits() */
 
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL_get_free_list_stats
+ *
+ * Purpose:	Gets usage statistics for the free lists in use, in the order
+ *      regular, array, block and factory lists.
+ *
+ * Parameters:
+ *  H5_free_list_stats_t *stats; OUT: Statistics for each free list
+ *  size_t *nlists;      IN/OUT: Number of elements in STATS / number of free
+ *                              lists in use
+ *
+ * Return:	Success:	non-negative
+ *
+ *		Failure:	negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FL_get_free_list_stats(H5_free_list_stats_t *stats, size_t *nlists)
+{
+    H5FL_reg_gc_node_t *reg_node;   /* Regular free list node */
+    H5FL_gc_arr_node_t *arr_node;   /* Array free list node */
+    H5FL_blk_gc_node_t *blk_node;   /* Block free list node */
+    H5FL_fac_gc_node_t *fac_node;   /* Factory free list node */
+    size_t max_nlists;          /* Number of elements in STATS */
+    size_t n = 0;               /* Number of free lists */
+
+    FUNC_ENTER_NOAPI_NOERR
+
+    HDassert(nlists);
+    HDassert(stats || 0 == *nlists);
+
+    max_nlists = *nlists;
+
+    for(reg_node = H5FL_reg_gc_head.first; reg_node != NULL; reg_node = reg_node->next, n++)
+        if(n < max_nlists) {
+            H5FL_reg_head_t *head = reg_node->list;
+            H5_free_list_stats_t *st = &stats[n];
+
+            st->name = head->name;
+            st->type = H5_FREE_LIST_REG;
+            st->size = head->size;
+            st->allocated = head->allocated;
+            st->onlist = head->onlist;
+            st->nrequests = head->nreqs;
+            st->nhits = head->nhits;
+            st->mem_held = st->onlist * head->size;
+        } /* end if */
+
+    for(arr_node = H5FL_arr_gc_head.first; arr_node != NULL; arr_node = arr_node->next, n++)
+        if(n < max_nlists) {
+            H5FL_arr_head_t *head = arr_node->list;
+            H5_free_list_stats_t *st = &stats[n];
+            int u;
+
+            st->name = head->name;
+            st->type = H5_FREE_LIST_ARR;
+            st->size = 0;
+            st->allocated = head->allocated;
+            st->onlist = 0;
+            for(u = 0; u < head->maxelem; u++)
+                st->onlist += head->list_arr[u].onlist;
+            st->mem_held = head->list_mem;
+            st->nrequests = head->nreqs;
+            st->nhits = head->nhits;
+        } /* end if */
+
+    for(blk_node = H5FL_blk_gc_head.first; blk_node != NULL; blk_node = blk_node->next, n++)
+        if(n < max_nlists) {
+            H5FL_blk_head_t *head = blk_node->pq;
+            H5_free_list_stats_t *st = &stats[n];
+
+            st->name = head->name;
+            st->type = H5_FREE_LIST_BLK;
+            st->size = 0;
+            st->allocated = head->allocated;
+            st->onlist = head->onlist;
+            st->mem_held = head->list_mem;
+            st->nrequests = head->nreqs;
+            st->nhits = head->nhits;
+        } /* end if */
+
+    for(fac_node = H5FL_fac_gc_head.first; fac_node != NULL; fac_node = fac_node->next, n++)
+        if(n < max_nlists) {
+            H5FL_fac_head_t *head = fac_node->list;
+            H5_free_list_stats_t *st = &stats[n];
+
+            st->name = NULL;
+            st->type = H5_FREE_LIST_FAC;
+            st->size = head->size;
+            st->allocated = head->allocated;
+            st->onlist = head->onlist;
+            st->mem_held = head->onlist * head->size;
+            st->nrequests = head->nreqs;
+            st->nhits = head->nhits;
+        } /* end if */
+
+    *nlists = n;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+}   /* end H5FL_get_free_list_stats() */
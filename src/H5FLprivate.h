@@ -101,6 +101,8 @@ typedef struct H5FL_reg_head_t {
     const char *name;   /* Name of the type */
     size_t size;        /* Size of the blocks in the list */
     H5FL_reg_node_t *list;  /* List of free blocks */
+    hsize_t nreqs;      /* Number of allocation requests */
+    hsize_t nhits;      /* Number of requests served from free blocks */
 } H5FL_reg_head_t;
 
 /*
@@ -109,7 +111,7 @@ typedef struct H5FL_reg_head_t {
 #define H5FL_REG_NAME(t)        H5_##t##_reg_free_list
 #ifndef H5_NO_REG_FREE_LISTS
 /* Common macros for H5FL_DEFINE & H5FL_DEFINE_STATIC */
-#define H5FL_DEFINE_COMMON(t) H5FL_reg_head_t H5FL_REG_NAME(t)={0,0,0,#t,sizeof(t),NULL}
+#define H5FL_DEFINE_COMMON(t) H5FL_reg_head_t H5FL_REG_NAME(t)={0,0,0,#t,sizeof(t),NULL,0,0}
 
 /* Declare a free list to manage objects of type 't' */
 #define H5FL_DEFINE(t) H5_DLL H5FL_DEFINE_COMMON(t)
@@ -170,6 +172,8 @@ typedef struct H5FL_blk_head_t {
     size_t list_mem;    /* Amount of memory in block on free list */
     const char *name;   /* Name of the type */
     H5FL_blk_node_t *head;  /* Pointer to first free list in queue */
+    hsize_t nreqs;      /* Number of allocation requests */
+    hsize_t nhits;      /* Number of requests served from free blocks */
 } H5FL_blk_head_t;
 
 /*
@@ -178,7 +182,7 @@ typedef struct H5FL_blk_head_t {
 #define H5FL_BLK_NAME(t)        H5_##t##_blk_free_list
 #ifndef H5_NO_BLK_FREE_LISTS
 /* Common macro for H5FL_BLK_DEFINE & H5FL_BLK_DEFINE_STATIC */
-#define H5FL_BLK_DEFINE_COMMON(t) H5FL_blk_head_t H5FL_BLK_NAME(t)={0,0,0,0,#t"_blk",NULL}
+#define H5FL_BLK_DEFINE_COMMON(t) H5FL_blk_head_t H5FL_BLK_NAME(t)={0,0,0,0,#t"_blk",NULL,0,0}
 
 /* Declare a free list to manage objects of type 't' */
 #define H5FL_BLK_DEFINE(t)  H5_DLL H5FL_BLK_DEFINE_COMMON(t)
@@ -243,6 +247,8 @@ typedef struct H5FL_arr_head_t {
     size_t base_size;      /* Size of the "base" object in the list */
     size_t elem_size;      /* Size of the array elements in the list */
     H5FL_arr_node_t *list_arr;  /* Array of lists of free blocks */
+    hsize_t nreqs;         /* Number of allocation requests */
+    hsize_t nhits;         /* Number of requests served from free blocks */
 } H5FL_arr_head_t;
 
 /*
@@ -251,7 +257,7 @@ typedef struct H5FL_arr_head_t {
 #define H5FL_ARR_NAME(t)        H5_##t##_arr_free_list
 #ifndef H5_NO_ARR_FREE_LISTS
 /* Common macro for H5FL_ARR_DEFINE & H5FL_ARR_DEFINE_STATIC (and H5FL_BARR variants) */
-#define H5FL_ARR_DEFINE_COMMON(b,t,m) H5FL_arr_head_t H5FL_ARR_NAME(t)={0,0,0,#t"_arr",m+1,b,sizeof(t),NULL}
+#define H5FL_ARR_DEFINE_COMMON(b,t,m) H5FL_arr_head_t H5FL_ARR_NAME(t)={0,0,0,#t"_arr",m+1,b,sizeof(t),NULL,0,0}
 
 /* Declare a free list to manage arrays of type 't' */
 #define H5FL_ARR_DEFINE(t,m)  H5_DLL H5FL_ARR_DEFINE_COMMON(0,t,m)
@@ -310,7 +316,7 @@ typedef struct H5FL_seq_head_t {
 #define H5FL_SEQ_NAME(t)        H5_##t##_seq_free_list
 #ifndef H5_NO_SEQ_FREE_LISTS
 /* Common macro for H5FL_SEQ_DEFINE & H5FL_SEQ_DEFINE_STATIC */
-#define H5FL_SEQ_DEFINE_COMMON(t) H5FL_seq_head_t H5FL_SEQ_NAME(t)={{0,0,0,0,#t"_seq",NULL},sizeof(t)}
+#define H5FL_SEQ_DEFINE_COMMON(t) H5FL_seq_head_t H5FL_SEQ_NAME(t)={{0,0,0,0,#t"_seq",NULL,0,0},sizeof(t)}
 
 /* Declare a free list to manage sequences of type 't' */
 #define H5FL_SEQ_DEFINE(t)  H5_DLL H5FL_SEQ_DEFINE_COMMON(t)
@@ -358,6 +364,8 @@ typedef struct H5FL_fac_head_t {
     size_t size;        /* Size of the blocks in the list */
     H5FL_fac_node_t *list;  /* List of free blocks */
     H5FL_fac_gc_node_t *prev_gc; /* Previous garbage collection node in list */
+    hsize_t nreqs;      /* Number of allocation requests */
+    hsize_t nhits;      /* Number of requests served from free blocks */
 } H5FL_fac_head_t;
 
 
@@ -420,9 +428,11 @@ H5_DLL herr_t H5FL_fac_term(H5FL_fac_head_t *head);
 
 /* General free list routines */
 H5_DLL herr_t H5FL_garbage_coll(void);
+H5_DLL size_t H5FL_get_free_mem(void);
 H5_DLL herr_t H5FL_set_free_list_limits(int reg_global_lim, int reg_list_lim,
     int arr_global_lim, int arr_list_lim, int blk_global_lim, int blk_list_lim,
     int fac_global_lim, int fac_list_lim);
+H5_DLL herr_t H5FL_get_free_list_stats(H5_free_list_stats_t *stats, size_t *nlists);
 H5_DLL int   H5FL_term_interface(void);
 
 #endif
@@ -38,6 +38,7 @@
 #include "H5Eprivate.h"		/* Error handling		  	*/
 #include "H5Fpkg.h"             /* File access				*/
 #include "H5FDprivate.h"	/* File drivers				*/
+#include "H5MMprivate.h"	/* Memory management			*/
 #include "H5VMprivate.h"	/* Vectors and arrays 			*/
 
 
@@ -50,6 +51,14 @@
 #define H5F_ACCUM_THRESHOLD     2048
 #define H5F_ACCUM_MAX_SIZE      (1024 *1024) /* Max. accum. buf size (max. I/Os will be 1/2 this size) */
 
+/* Change the accumulator's buffer size, keeping the memory budget current */
+#define H5F__ACCUM_SET_ALLOC_SIZE(A, S)                                     \
+{                                                                           \
+    H5MM_budget_sub(H5_MEM_ACCUMULATOR, (A)->alloc_size);                   \
+    (A)->alloc_size = (S);                                                  \
+    H5MM_budget_add(H5_MEM_ACCUMULATOR, (A)->alloc_size);                   \
+}
+
 
 /******************/
 /* Local Typedefs */
@@ -164,7 +173,7 @@ H5F__accum_read(const H5F_io_info2_t *fio_info, H5FD_mem_t map_type, haddr_t add
                         HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate metadata accumulator buffer")
 
                     /* Note the new buffer size */
-                    accum->alloc_size = new_alloc_size;
+                    H5F__ACCUM_SET_ALLOC_SIZE(accum, new_alloc_size)
 
                     /* Clear the memory */
                     HDmemset(accum->buf + accum->size, 0, (accum->alloc_size - accum->size));
@@ -395,7 +404,7 @@ H5F__accum_adjust(H5F_meta_accum_t *accum, const H5FD_io_info_t *fdio_info,
 
             /* Update accumulator info */
             accum->buf = new_buf;
-            accum->alloc_size = new_size;
+            H5F__ACCUM_SET_ALLOC_SIZE(accum, new_size)
 
             /* Clear the memory */
             HDmemset(accum->buf + accum->size, 0, (accum->alloc_size - (accum->size + size)));
@@ -626,7 +635,7 @@ H5F__accum_write(const H5F_io_info2_t *fio_info, H5FD_mem_t map_type, haddr_t ad
                                 HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate metadata accumulator buffer")
 
                             /* Note the new buffer size */
-                            accum->alloc_size = new_alloc_size;
+                            H5F__ACCUM_SET_ALLOC_SIZE(accum, new_alloc_size)
 
                             /* Clear the memory */
                             HDmemset(accum->buf + size, 0, (accum->alloc_size - size));
@@ -670,7 +679,7 @@ H5F__accum_write(const H5F_io_info2_t *fio_info, H5FD_mem_t map_type, haddr_t ad
                             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate metadata accumulator buffer")
 
                         /* Note the new buffer size */
-                        accum->alloc_size = new_size;
+                        H5F__ACCUM_SET_ALLOC_SIZE(accum, new_size)
 
                         /* Clear the memory */
                         clear_size = MAX(accum->size, size);
@@ -687,7 +696,7 @@ H5F__accum_write(const H5F_io_info2_t *fio_info, H5FD_mem_t map_type, haddr_t ad
                                 HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate metadata accumulator buffer")
 
                             /* Note the new buffer size */
-                            accum->alloc_size = tmp_size;
+                            H5F__ACCUM_SET_ALLOC_SIZE(accum, tmp_size)
                         } /* end if */
                     } /* end else */
 
@@ -718,7 +727,7 @@ H5F__accum_write(const H5F_io_info2_t *fio_info, H5FD_mem_t map_type, haddr_t ad
                         HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate metadata accumulator buffer")
 
                     /* Note the new buffer size */
-                    accum->alloc_size = new_size;
+                    H5F__ACCUM_SET_ALLOC_SIZE(accum, new_size)
 
                     /* Clear the memory */
                     HDmemset(accum->buf + size, 0, (accum->alloc_size - size));
@@ -1096,7 +1105,8 @@ H5F__accum_reset(const H5F_io_info2_t *fio_info, hbool_t flush)
             fio_info->f->shared->accum.buf = H5FL_BLK_FREE(meta_accum, fio_info->f->shared->accum.buf);
 
         /* Reset the buffer sizes & location */
-        fio_info->f->shared->accum.alloc_size = fio_info->f->shared->accum.size = 0;
+        H5F__ACCUM_SET_ALLOC_SIZE(&fio_info->f->shared->accum, 0)
+        fio_info->f->shared->accum.size = 0;
         fio_info->f->shared->accum.loc = HADDR_UNDEF;
         fio_info->f->shared->accum.dirty = FALSE;
         fio_info->f->shared->accum.dirty_len = 0;
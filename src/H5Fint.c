@@ -149,6 +149,12 @@ H5F_get_access_plist(H5F_t *f, hbool_t app_ref)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set data cache byte size")
     if(H5P_set(new_plist, H5F_ACS_PREEMPT_READ_CHUNKS_NAME, &(f->shared->rdcc_w0)) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set preempt read chunks")
+    if(H5P_set(new_plist, H5F_ACS_WRITE_BEHIND_RATIO_NAME, &(f->shared->write_behind_ratio)) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set write-behind dirty ratio")
+    if(H5P_set(new_plist, H5F_ACS_MDC_FLUSH_THREADS_NAME, &(f->shared->mdc_flush_threads)) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set number of metadata cache flush threads")
+    if(H5P_set(new_plist, H5F_ACS_PATH_CACHE_NENTRIES_NAME, &(f->shared->path_cache_nentries)) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set number of path lookup cache entries")
     if(H5P_set(new_plist, H5F_ACS_ALIGN_THRHD_NAME, &(f->shared->threshold)) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set alignment threshold")
     if(H5P_set(new_plist, H5F_ACS_ALIGN_NAME, &(f->shared->alignment)) < 0)
@@ -440,6 +446,7 @@ H5F_get_objects_cb(void *obj_ptr, hid_t obj_id, void *key)
             case H5I_ERROR_CLASS:
             case H5I_ERROR_MSG:
             case H5I_ERROR_STACK:
+            case H5I_EVENTSET:
             case H5I_NTYPES:
             default:
                 HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, H5_ITER_ERROR, "unknown or invalid data object")
@@ -894,6 +901,12 @@ H5F_new(H5F_file_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5FD_t
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get data cache byte size")
         if(H5P_get(plist, H5F_ACS_PREEMPT_READ_CHUNKS_NAME, &(f->shared->rdcc_w0)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get preempt read chunk")
+        if(H5P_get(plist, H5F_ACS_WRITE_BEHIND_RATIO_NAME, &(f->shared->write_behind_ratio)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get write-behind dirty ratio")
+        if(H5P_get(plist, H5F_ACS_MDC_FLUSH_THREADS_NAME, &(f->shared->mdc_flush_threads)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get number of metadata cache flush threads")
+        if(H5P_get(plist, H5F_ACS_PATH_CACHE_NENTRIES_NAME, &(f->shared->path_cache_nentries)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get number of path lookup cache entries")
         if(H5P_get(plist, H5F_ACS_ALIGN_THRHD_NAME, &(f->shared->threshold)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get alignment threshold")
         if(H5P_get(plist, H5F_ACS_ALIGN_NAME, &(f->shared->alignment)) < 0)
@@ -1010,6 +1023,8 @@ H5F_new(H5F_file_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5FD_t
          */
         if(H5AC_create(f, &(f->shared->mdc_initCacheCfg), &(f->shared->mdc_initCacheImageCfg)) < 0)
             HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "unable to create metadata cache")
+        if(H5C_set_flush_threads(f->shared->cache, f->shared->mdc_flush_threads) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "unable to set number of metadata cache flush threads")
 
         /* Create the file's "open object" information */
         if(H5FO_create(f) < 0)
@@ -1260,6 +1275,8 @@ H5F__dest(H5F_t *f, hid_t meta_dxpl_id, hid_t raw_dxpl_id, hbool_t flush)
         if(H5G_node_close(f) < 0)
             /* Push error, but keep going*/
             HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "problems closing file")
+        H5G_pcache_dest(f);
+        H5O_dcache_dest(f);
 
         /* Destroy file creation properties */
         if(H5I_GENPROP_LST != H5I_get_type(f->shared->fcpl_id))
@@ -2469,6 +2486,54 @@ H5F_set_grp_btree_shared(H5F_t *f, H5UC_t *rc)
 } /* H5F_set_grp_btree_shared() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5F_set_path_cache
+ *
+ * Purpose:     Set the path lookup cache for the file.
+ *
+ * Return:      None (can't fail)
+ *-------------------------------------------------------------------------
+ */
+void
+H5F_set_path_cache(H5F_t *f, struct H5G_pcache_t *pcache)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(f->shared);
+
+    f->shared->path_cache = pcache;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* H5F_set_path_cache() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_set_decode_cache
+ *
+ * Purpose:     Set the decoded message cache for the file.
+ *
+ * Return:      None (can't fail)
+ *-------------------------------------------------------------------------
+ */
+void
+H5F_set_decode_cache(H5F_t *f, struct H5O_dcache_t *dcache)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(f->shared);
+
+    f->shared->decode_cache = dcache;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* H5F_set_decode_cache() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5F_set_sohm_addr
  *
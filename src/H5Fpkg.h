@@ -296,6 +296,9 @@ struct H5F_file_t {
     size_t	rdcc_nslots;	/* Size of raw data chunk cache (slots)	*/
     size_t	rdcc_nbytes;	/* Size of raw data chunk cache	(bytes)	*/
     double	rdcc_w0;	/* Preempt read chunks first? [0.0..1.0]*/
+    double	write_behind_ratio; /* Dirty fraction that starts write-behind (0 = off) */
+    unsigned	mdc_flush_threads; /* Threads serializing metadata cache entries on flush (0 = off) */
+    size_t      path_cache_nentries; /* Entries in the path lookup cache (0 = off) */
     size_t      sieve_buf_size; /* Size of the data sieve buffer allocated (in bytes) */
     hsize_t	threshold;	/* Threshold for alignment		*/
     hsize_t	alignment;	/* Alignment				*/
@@ -308,6 +311,8 @@ struct H5F_file_t {
     struct H5G_t *root_grp;	/* Open root group			*/
     H5FO_t *open_objs;          /* Open objects in file                 */
     H5UC_t *grp_btree_shared;   /* Ref-counted group B-tree node info   */
+    struct H5G_pcache_t *path_cache; /* Path lookup cache               */
+    struct H5O_dcache_t *decode_cache; /* Decoded message cache         */
 
     /* File space allocation information */
     H5F_fspace_strategy_t fs_strategy; /* File space handling strategy	*/
@@ -311,14 +311,21 @@ typedef struct H5F_t H5F_t;
 #define H5F_RDCC_NSLOTS(F)      ((F)->shared->rdcc_nslots)
 #define H5F_RDCC_NBYTES(F)      ((F)->shared->rdcc_nbytes)
 #define H5F_RDCC_W0(F)          ((F)->shared->rdcc_w0)
+#define H5F_WRITE_BEHIND_RATIO(F) ((F)->shared->write_behind_ratio)
 #define H5F_SIEVE_BUF_SIZE(F)   ((F)->shared->sieve_buf_size)
 #define H5F_GC_REF(F)           ((F)->shared->gc_ref)
 #define H5F_STORE_MSG_CRT_IDX(F)    ((F)->shared->store_msg_crt_idx)
 #define H5F_SET_STORE_MSG_CRT_IDX(F, FL)    ((F)->shared->store_msg_crt_idx = (FL))
 #define H5F_GRP_BTREE_SHARED(F) ((F)->shared->grp_btree_shared)
 #define H5F_SET_GRP_BTREE_SHARED(F, RC) (((F)->shared->grp_btree_shared = (RC)) ? SUCCEED : FAIL)
+#define H5F_PATH_CACHE_NENTRIES(F) ((F)->shared->path_cache_nentries)
+#define H5F_PATH_CACHE(F)       ((F)->shared->path_cache)
+#define H5F_SET_PATH_CACHE(F, PC) ((F)->shared->path_cache = (PC))
+#define H5F_DECODE_CACHE(F)     ((F)->shared->decode_cache)
+#define H5F_SET_DECODE_CACHE(F, DC) ((F)->shared->decode_cache = (DC))
 #define H5F_USE_TMP_SPACE(F)    ((F)->shared->fs.use_tmp_space)
 #define H5F_IS_TMP_ADDR(F, ADDR) (H5F_addr_le((F)->shared->fs.tmp_addr, (ADDR)))
+#define H5F_HAS_PAGE_BUF(F)     ((F)->shared->page_buf != NULL)
 #ifdef H5_HAVE_PARALLEL
 #define H5F_COLL_MD_READ(F)     ((F)->coll_md_read)
 #endif /* H5_HAVE_PARALLEL */
@@ -368,14 +375,21 @@ typedef struct H5F_t H5F_t;
 #define H5F_RDCC_NSLOTS(F)      (H5F_rdcc_nslots(F))
 #define H5F_RDCC_NBYTES(F)      (H5F_rdcc_nbytes(F))
 #define H5F_RDCC_W0(F)          (H5F_rdcc_w0(F))
+#define H5F_WRITE_BEHIND_RATIO(F) (H5F_write_behind_ratio(F))
 #define H5F_SIEVE_BUF_SIZE(F)   (H5F_sieve_buf_size(F))
 #define H5F_GC_REF(F)           (H5F_gc_ref(F))
 #define H5F_STORE_MSG_CRT_IDX(F) (H5F_store_msg_crt_idx(F))
 #define H5F_SET_STORE_MSG_CRT_IDX(F, FL)    (H5F_set_store_msg_crt_idx((F), (FL)))
 #define H5F_GRP_BTREE_SHARED(F) (H5F_grp_btree_shared(F))
 #define H5F_SET_GRP_BTREE_SHARED(F, RC) (H5F_set_grp_btree_shared((F), (RC)))
+#define H5F_PATH_CACHE_NENTRIES(F) (H5F_path_cache_nentries(F))
+#define H5F_PATH_CACHE(F)       (H5F_path_cache(F))
+#define H5F_SET_PATH_CACHE(F, PC) (H5F_set_path_cache((F), (PC)))
+#define H5F_DECODE_CACHE(F)     (H5F_decode_cache(F))
+#define H5F_SET_DECODE_CACHE(F, DC) (H5F_set_decode_cache((F), (DC)))
 #define H5F_USE_TMP_SPACE(F)    (H5F_use_tmp_space(F))
 #define H5F_IS_TMP_ADDR(F, ADDR) (H5F_is_tmp_addr((F), (ADDR)))
+#define H5F_HAS_PAGE_BUF(F)     (H5F_has_page_buf(F))
 #ifdef H5_HAVE_PARALLEL
 #define H5F_COLL_MD_READ(F)     (H5F_coll_md_read(F))
 #endif /* H5_HAVE_PARALLEL */
@@ -503,6 +517,9 @@ typedef struct H5F_t H5F_t;
 #define H5F_ACS_PAGE_BUFFER_SIZE_NAME           "page_buffer_size" /* the maximum size for the page buffer cache */
 #define H5F_ACS_PAGE_BUFFER_MIN_META_PERC_NAME  "page_buffer_min_meta_perc" /* the min metadata percentage for the page buffer cache */
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_NAME   "page_buffer_min_raw_perc" /* the min raw data percentage for the page buffer cache */
+#define H5F_ACS_WRITE_BEHIND_RATIO_NAME         "write_behind_ratio" /* dirty fraction of the caches that starts write-behind */
+#define H5F_ACS_MDC_FLUSH_THREADS_NAME          "mdc_flush_threads" /* number of threads serializing metadata cache entries on flush */
+#define H5F_ACS_PATH_CACHE_NENTRIES_NAME        "path_cache_nentries" /* number of entries in the path lookup cache */
 
 /* ======================== File Mount properties ====================*/
 #define H5F_MNT_SYM_LOCAL_NAME         "local"                 /* Whether absolute symlinks local to file. */
@@ -764,6 +781,7 @@ H5_DLL hbool_t H5F_get_evict_on_close(const H5F_t *f);
 H5_DLL size_t H5F_rdcc_nbytes(const H5F_t *f);
 H5_DLL size_t H5F_rdcc_nslots(const H5F_t *f);
 H5_DLL double H5F_rdcc_w0(const H5F_t *f);
+H5_DLL double H5F_write_behind_ratio(const H5F_t *f);
 H5_DLL size_t H5F_sieve_buf_size(const H5F_t *f);
 H5_DLL unsigned H5F_gc_ref(const H5F_t *f);
 H5_DLL unsigned H5F_use_latest_flags(const H5F_t *f, unsigned fl);
@@ -772,8 +790,14 @@ H5_DLL herr_t H5F_set_store_msg_crt_idx(H5F_t *f, hbool_t flag);
 H5_DLL herr_t H5F_set_libver_bounds(H5F_t * f, H5F_libver_t low, H5F_libver_t high);
 H5_DLL struct H5UC_t *H5F_grp_btree_shared(const H5F_t *f);
 H5_DLL herr_t H5F_set_grp_btree_shared(H5F_t *f, struct H5UC_t *rc);
+H5_DLL size_t H5F_path_cache_nentries(const H5F_t *f);
+H5_DLL struct H5G_pcache_t *H5F_path_cache(const H5F_t *f);
+H5_DLL void H5F_set_path_cache(H5F_t *f, struct H5G_pcache_t *pcache);
+H5_DLL struct H5O_dcache_t *H5F_decode_cache(const H5F_t *f);
+H5_DLL void H5F_set_decode_cache(H5F_t *f, struct H5O_dcache_t *dcache);
 H5_DLL hbool_t H5F_use_tmp_space(const H5F_t *f);
 H5_DLL hbool_t H5F_is_tmp_addr(const H5F_t *f, haddr_t addr);
+H5_DLL hbool_t H5F_has_page_buf(const H5F_t *f);
 H5_DLL hsize_t H5F_get_alignment(const H5F_t *f);
 H5_DLL hsize_t H5F_get_threshold(const H5F_t *f);
 #ifdef H5_HAVE_PARALLEL
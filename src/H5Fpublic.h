@@ -214,6 +214,26 @@ typedef struct H5F_retry_info_t {
     uint32_t *retries[H5F_NUM_METADATA_READ_RETRY_TYPES];
 } H5F_retry_info_t;
 
+/* Data structures to report the I/O sent to the file driver */
+/* Used by public routine H5Fget_io_stats() */
+#define H5F_IO_STATS_NBUCKETS   24
+typedef struct H5F_io_op_stats_t {
+    hsize_t count;              /* Number of operations */
+    hsize_t bytes;              /* Number of bytes transferred */
+    hsize_t total_usec;         /* Total latency of the operations, in microseconds */
+    hsize_t max_usec;           /* Latency of the slowest operation, in microseconds */
+    hsize_t latency[H5F_IO_STATS_NBUCKETS];    /* Latency histogram: bucket 0 counts operations */
+                                /* taking less than 1 microsecond, bucket N counts operations */
+                                /* taking [2^(N-1), 2^N) microseconds.  The last bucket also */
+                                /* counts all slower operations. */
+} H5F_io_op_stats_t;
+typedef struct H5F_io_stats_t {
+    H5F_io_op_stats_t read[H5FD_MEM_NTYPES];    /* Reads, by type of file memory */
+    H5F_io_op_stats_t write[H5FD_MEM_NTYPES];   /* Writes, by type of file memory */
+    H5F_io_op_stats_t meta_read;    /* Reads of all metadata types (everything but H5FD_MEM_DRAW) */
+    H5F_io_op_stats_t meta_write;   /* Writes of all metadata types (everything but H5FD_MEM_DRAW) */
+} H5F_io_stats_t;
+
 /* Callback for H5Pset_object_flush_cb() in a file access property list */
 typedef herr_t (*H5F_flush_cb_t)(hid_t object_id, void *udata);
 
@@ -230,6 +250,7 @@ H5_DLL hid_t  H5Fopen(const char *filename, unsigned flags,
 		        hid_t access_plist);
 H5_DLL hid_t  H5Freopen(hid_t file_id);
 H5_DLL herr_t H5Fflush(hid_t object_id, H5F_scope_t scope);
+H5_DLL herr_t H5Fflush_async(hid_t object_id, H5F_scope_t scope, hid_t es_id);
 H5_DLL herr_t H5Fclose(hid_t file_id);
 H5_DLL hid_t  H5Fget_create_plist(hid_t file_id);
 H5_DLL hid_t  H5Fget_access_plist(hid_t file_id);
@@ -271,6 +292,8 @@ H5_DLL herr_t H5Freset_page_buffering_stats(hid_t file_id);
 H5_DLL herr_t H5Fget_page_buffering_stats(hid_t file_id, unsigned accesses[2],
     unsigned hits[2], unsigned misses[2], unsigned evictions[2], unsigned bypasses[2]);
 H5_DLL herr_t H5Fget_mdc_image_info(hid_t file_id, haddr_t *image_addr, hsize_t *image_size);
+H5_DLL herr_t H5Fget_io_stats(hid_t file_id, H5F_io_stats_t *stats);
+H5_DLL herr_t H5Freset_io_stats(hid_t file_id);
 
 #ifdef H5_HAVE_PARALLEL
 H5_DLL herr_t H5Fset_mpi_atomicity(hid_t file_id, hbool_t flag);
@@ -635,6 +635,28 @@ H5F_rdcc_w0(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->rdcc_w0)
 } /* end H5F_rdcc_w0() */
 
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_write_behind_ratio
+ *
+ * Purpose:  Retrieve the dirty fraction of the caches that starts
+ *           write-behind.
+ *
+ * Return:   The ratio, 0 if write-behind is disabled (can't fail)
+ *-------------------------------------------------------------------------
+ */
+double
+H5F_write_behind_ratio(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->write_behind_ratio)
+} /* end H5F_write_behind_ratio() */
+
 
 /*-------------------------------------------------------------------------
  * Function: H5F_get_base_addr
@@ -684,6 +706,69 @@ H5F_grp_btree_shared(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->grp_btree_shared)
 } /* end H5F_grp_btree_shared() */
 
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_path_cache_nentries
+ *
+ * Purpose:  Retrieve the number of entries in the path lookup cache.
+ *
+ * Return:   The number of entries, 0 if the cache is disabled (can't fail)
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5F_path_cache_nentries(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->path_cache_nentries)
+} /* end H5F_path_cache_nentries() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_path_cache
+ *
+ * Purpose:  Retrieve the path lookup cache for the file.
+ *
+ * Return:   The cache, NULL if it hasn't been created (can't fail)
+ *-------------------------------------------------------------------------
+ */
+struct H5G_pcache_t *
+H5F_path_cache(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->path_cache)
+} /* end H5F_path_cache() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_decode_cache
+ *
+ * Purpose:  Retrieve the decoded message cache for the file.
+ *
+ * Return:   The cache, NULL if it hasn't been created (can't fail)
+ *-------------------------------------------------------------------------
+ */
+struct H5O_dcache_t *
+H5F_decode_cache(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->decode_cache)
+} /* end H5F_decode_cache() */
+
 
 /*-------------------------------------------------------------------------
  * Function: H5F_sieve_buf_size
@@ -988,6 +1073,27 @@ H5F_use_tmp_space(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->use_tmp_space)
 } /* end H5F_use_tmp_space() */
 
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_has_page_buf
+ *
+ * Purpose:  Determine if the file's I/O goes through a page buffer.
+ *
+ * Return:   TRUE/FALSE on success/abort on failure (shouldn't fail)
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5F_has_page_buf(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->page_buf != NULL)
+} /* end H5F_has_page_buf() */
+
 #ifdef H5_HAVE_PARALLEL
 
 /*-------------------------------------------------------------------------
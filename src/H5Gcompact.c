@@ -47,16 +47,6 @@ typedef struct {
     const char *name;           /* Link name to search for */
 } H5G_iter_rm_t;
 
-/* User data for link message iteration when querying link info */
-typedef struct {
-    /* downward */
-    const char *name;           /* Name to search for */
-
-    /* upward */
-    H5O_link_t *lnk;            /* Link struct to fill in */
-    hbool_t found;              /* Flag to indicate that the object was found */
-} H5G_iter_lkp_t;
-
 /* Private macros */
 
 /* PRIVATE PROTOTYPES */
@@ -435,53 +425,7 @@ done:
 } /* end H5G__compact_iterate() */
 
 
-/*-------------------------------------------------------------------------
- * Function:	H5G_compact_lookup_cb
- *
- * Purpose:	Callback routine for searching 'link' messages for a particular
- *              name & gettting object location for it
- *
- * Return:	Non-negative on success/Negative on failure
- *
- * Programmer:	Quincey Koziol
- *		koziol@ncsa.uiuc.edu
- *		Sep 20 2005
- *
- *-------------------------------------------------------------------------
- */
-static herr_t
-H5G_compact_lookup_cb(const void *_mesg, unsigned H5_ATTR_UNUSED idx, void *_udata)
-{
-    const H5O_link_t *lnk = (const H5O_link_t *)_mesg;  /* Pointer to link */
-    H5G_iter_lkp_t *udata = (H5G_iter_lkp_t *)_udata;     /* 'User data' passed in */
-    herr_t ret_value = H5_ITER_CONT;           /* Return value */
 
-    FUNC_ENTER_NOAPI_NOINIT
-
-    /* check arguments */
-    HDassert(lnk);
-    HDassert(udata);
-
-    /* Check for name to get information */
-    if(HDstrcmp(lnk->name, udata->name) == 0) {
-        if(udata->lnk) {
-            /* Copy link information */
-            if(NULL == H5O_msg_copy(H5O_LINK_ID, lnk, udata->lnk))
-                HGOTO_ERROR(H5E_SYM, H5E_CANTCOPY, H5_ITER_ERROR, "can't copy link message")
-        } /* end if */
-
-        /* Indicate that the correct link was found */
-        udata->found = TRUE;
-
-        /* Stop iteration now */
-        HGOTO_DONE(H5_ITER_STOP)
-    } /* end if */
-
-done:
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5G_compact_lookup_cb() */
-
-
 /*-------------------------------------------------------------------------
  * Function:	H5G__compact_lookup
  *
@@ -499,8 +443,6 @@ htri_t
 H5G__compact_lookup(const H5O_loc_t *oloc, const char *name, H5O_link_t *lnk,
     hid_t dxpl_id)
 {
-    H5G_iter_lkp_t udata;               /* User data for iteration callback */
-    H5O_mesg_operator_t op;             /* Message operator */
     htri_t     ret_value = FAIL;        /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -509,19 +451,9 @@ H5G__compact_lookup(const H5O_loc_t *oloc, const char *name, H5O_link_t *lnk,
     HDassert(lnk && oloc->file);
     HDassert(name && *name);
 
-    /* Set up user data for iteration */
-    udata.name = name;
-    udata.lnk = lnk;
-    udata.found = FALSE;
-
-    /* Iterate through the link messages, adding them to the table */
-    op.op_type = H5O_MESG_OP_APP;
-    op.u.app_op = H5G_compact_lookup_cb;
-    if(H5O_msg_iterate(oloc, H5O_LINK_ID, &op, &udata, dxpl_id) < 0)
-        HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "error iterating over link messages")
-
-    /* Determine if we found the link we were looking for */
-    ret_value = (htri_t)udata.found;
+    /* Look up the link message (through the header's name index) */
+    if((ret_value = H5O_link_lookup(oloc, name, lnk, dxpl_id)) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "error searching link messages")
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -224,6 +224,12 @@ typedef struct {
     H5O_link_t  *lnk;                   /* Pointer to link                   */
 } H5G_fh_ud_lbi_t;
 
+/* Link being bulk inserted into dense link storage */
+typedef struct {
+    uint32_t    hash;                   /* Hash of link's name               */
+    const H5O_link_t *lnk;              /* Link to insert                    */
+} H5G_dense_bulk_ent_t;
+
 
 /********************/
 /* Package Typedefs */
@@ -233,6 +239,8 @@ typedef struct {
 /********************/
 /* Local Prototypes */
 /********************/
+static int H5G_dense_bulk_name_cmp(const void *_ent1, const void *_ent2);
+static int H5G_dense_bulk_corder_cmp(const void *_rec1, const void *_rec2);
 
 
 /*********************/
@@ -482,6 +490,182 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G__dense_insert() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_dense_bulk_name_cmp
+ *
+ * Purpose:	Callback for qsort() to sort links into 'name' index order
+ *		(by hash, then by name)
+ *
+ * Return:	An integer less than, equal to, or greater than zero
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5G_dense_bulk_name_cmp(const void *_ent1, const void *_ent2)
+{
+    const H5G_dense_bulk_ent_t *ent1 = (const H5G_dense_bulk_ent_t *)_ent1;
+    const H5G_dense_bulk_ent_t *ent2 = (const H5G_dense_bulk_ent_t *)_ent2;
+    int ret_value;                      /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(ent1->hash != ent2->hash)
+        ret_value = (ent1->hash < ent2->hash) ? -1 : 1;
+    else
+        ret_value = HDstrcmp(ent1->lnk->name, ent2->lnk->name);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_dense_bulk_name_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_dense_bulk_corder_cmp
+ *
+ * Purpose:	Callback for qsort() to sort 'creation order' index records
+ *
+ * Return:	An integer less than, equal to, or greater than zero
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5G_dense_bulk_corder_cmp(const void *_rec1, const void *_rec2)
+{
+    const H5G_dense_bt2_corder_rec_t *rec1 = (const H5G_dense_bt2_corder_rec_t *)_rec1;
+    const H5G_dense_bt2_corder_rec_t *rec2 = (const H5G_dense_bt2_corder_rec_t *)_rec2;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(rec1->corder < rec2->corder ? -1 : (rec1->corder > rec2->corder ? 1 : 0))
+} /* end H5G_dense_bulk_corder_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__dense_insert_many
+ *
+ * Purpose:	Insert NLINKS links into newly created (empty) dense link
+ *		storage for a group.  The links are stored in the fractal
+ *		heap in 'name' index order and the index v2 B-trees are
+ *		bulk loaded from sorted records, instead of inserting each
+ *		link into each B-tree in turn.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G__dense_insert_many(H5F_t *f, hid_t dxpl_id, const H5O_linfo_t *linfo,
+    size_t nlinks, const H5O_link_t *lnks)
+{
+    H5G_dense_bulk_ent_t *ents = NULL;  /* Links, in 'name' index order */
+    H5G_dense_bt2_name_rec_t *name_recs = NULL;     /* 'name' index records */
+    H5G_dense_bt2_corder_rec_t *corder_recs = NULL; /* 'creation order' index records */
+    H5HF_t *fheap = NULL;               /* Fractal heap handle */
+    H5B2_t *bt2_name = NULL;            /* v2 B-tree handle for name index */
+    H5B2_t *bt2_corder = NULL;          /* v2 B-tree handle for creation order index */
+    H5WB_t *wb = NULL;                  /* Wrapped buffer for link data */
+    uint8_t link_buf[H5G_LINK_BUF_SIZE];        /* Buffer for serializing link */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /*
+     * Check arguments.
+     */
+    HDassert(f);
+    HDassert(linfo);
+    HDassert(lnks || nlinks == 0);
+
+    if(nlinks == 0)
+        HGOTO_DONE(SUCCEED)
+
+    /* Sort the links into 'name' index order */
+    if(NULL == (ents = (H5G_dense_bulk_ent_t *)H5MM_malloc(sizeof(H5G_dense_bulk_ent_t) * nlinks)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    for(u = 0; u < nlinks; u++) {
+        ents[u].hash = H5_checksum_lookup3(lnks[u].name, HDstrlen(lnks[u].name), 0);
+        ents[u].lnk = &lnks[u];
+    } /* end for */
+    HDqsort(ents, nlinks, sizeof(H5G_dense_bulk_ent_t), H5G_dense_bulk_name_cmp);
+    for(u = 1; u < nlinks; u++)
+        if(0 == H5G_dense_bulk_name_cmp(&ents[u - 1], &ents[u]))
+            HGOTO_ERROR(H5E_SYM, H5E_EXISTS, FAIL, "link name is not unique")
+
+    /* Allocate the index records */
+    if(NULL == (name_recs = (H5G_dense_bt2_name_rec_t *)H5MM_malloc(sizeof(H5G_dense_bt2_name_rec_t) * nlinks)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    if(linfo->index_corder)
+        if(NULL == (corder_recs = (H5G_dense_bt2_corder_rec_t *)H5MM_malloc(sizeof(H5G_dense_bt2_corder_rec_t) * nlinks)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+
+    /* Wrap the local buffer for serialized links */
+    if(NULL == (wb = H5WB_wrap(link_buf, sizeof(link_buf))))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't wrap buffer")
+
+    /* Open the fractal heap */
+    if(NULL == (fheap = H5HF_open(f, dxpl_id, linfo->fheap_addr)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, FAIL, "unable to open fractal heap")
+
+    /* Insert the serialized links into the fractal heap, in index order */
+    for(u = 0; u < nlinks; u++) {
+        const H5O_link_t *lnk = ents[u].lnk;    /* Link to insert */
+        size_t link_size;               /* Size of serialized link in the heap */
+        void *link_ptr;                 /* Pointer to serialized link */
+
+        if((link_size = H5O_msg_raw_size(f, H5O_LINK_ID, FALSE, lnk)) == 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTGETSIZE, FAIL, "can't get link size")
+        if(NULL == (link_ptr = H5WB_actual(wb, link_size)))
+            HGOTO_ERROR(H5E_SYM, H5E_NOSPACE, FAIL, "can't get actual buffer")
+        if(H5O_msg_encode(f, H5O_LINK_ID, FALSE, (unsigned char *)link_ptr, lnk) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTENCODE, FAIL, "can't encode link")
+        if(H5HF_insert(fheap, dxpl_id, link_size, link_ptr, name_recs[u].id) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert link into fractal heap")
+        name_recs[u].hash = ents[u].hash;
+
+        if(corder_recs) {
+            HDmemcpy(corder_recs[u].id, name_recs[u].id, (size_t)H5G_DENSE_FHEAP_ID_LEN);
+            corder_recs[u].corder = lnk->corder;
+        } /* end if */
+    } /* end for */
+
+    /* Build the 'name' index v2 B-tree */
+    if(NULL == (bt2_name = H5B2_open(f, dxpl_id, linfo->name_bt2_addr, NULL)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, FAIL, "unable to open v2 B-tree for name index")
+    if(H5B2_bulk_load(bt2_name, dxpl_id, nlinks, name_recs) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to build v2 B-tree for name index")
+
+    /* Build the 'creation order' index v2 B-tree, if there is one */
+    if(corder_recs) {
+        HDqsort(corder_recs, nlinks, sizeof(H5G_dense_bt2_corder_rec_t), H5G_dense_bulk_corder_cmp);
+        for(u = 1; u < nlinks; u++)
+            if(corder_recs[u - 1].corder == corder_recs[u].corder)
+                HGOTO_ERROR(H5E_SYM, H5E_EXISTS, FAIL, "link creation order is not unique")
+
+        HDassert(H5F_addr_defined(linfo->corder_bt2_addr));
+        if(NULL == (bt2_corder = H5B2_open(f, dxpl_id, linfo->corder_bt2_addr, NULL)))
+            HGOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, FAIL, "unable to open v2 B-tree for creation order index")
+        if(H5B2_bulk_load(bt2_corder, dxpl_id, nlinks, corder_recs) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to build v2 B-tree for creation order index")
+    } /* end if */
+
+done:
+    /* Release resources */
+    if(fheap && H5HF_close(fheap, dxpl_id) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't close fractal heap")
+    if(bt2_name && H5B2_close(bt2_name, dxpl_id) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't close v2 B-tree for name index")
+    if(bt2_corder && H5B2_close(bt2_corder, dxpl_id) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't close v2 B-tree for creation order index")
+    if(wb && H5WB_unwrap(wb) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't close wrapped buffer")
+    ents = (H5G_dense_bulk_ent_t *)H5MM_xfree(ents);
+    name_recs = (H5G_dense_bt2_name_rec_t *)H5MM_xfree(name_recs);
+    corder_recs = (H5G_dense_bt2_corder_rec_t *)H5MM_xfree(corder_recs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__dense_insert_many() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5G_dense_lookup_cb
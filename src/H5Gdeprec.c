@@ -891,9 +891,9 @@ H5G_get_objinfo_cb(H5G_loc_t H5_ATTR_UNUSED *grp_loc/*in*/, const char *name, co
             H5O_info_t oinfo;           /* Object information */
 
             /* Go retrieve the object information */
-            /* (don't need index & heap info) */
+            /* (don't need attribute or index & heap info) */
             HDassert(obj_loc);
-            if(H5O_get_info(obj_loc->oloc, udata->dxpl_id, FALSE, &oinfo) < 0)
+            if(H5O_get_info(obj_loc->oloc, udata->dxpl_id, H5O_INFO_BASIC | H5O_INFO_TIME | H5O_INFO_HDR, &oinfo) < 0)
                 HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "unable to get object info")
 
             /* Get mapped object type */
@@ -45,6 +45,11 @@
 /* Local Macros */
 /****************/
 
+/* Number of links whose object headers are prefetched at a time, ahead
+ *      of visiting them
+ */
+#define H5G_VISIT_PREFETCH_NLINKS       64
+
 
 /******************/
 /* Local Typedefs */
@@ -62,6 +67,15 @@ typedef struct {
     void *op_data;              /* Application's op data */
 } H5G_iter_appcall_ud_t;
 
+/* Object addresses of the links in a group being visited */
+typedef struct {
+    H5F_t      *f;              /* File the group is in */
+    haddr_t    *addr;           /* Object address for each link, in iteration order (undefined for soft & external links) */
+    size_t      nlinks;         /* Number of links in the group */
+    size_t      nalloc;         /* Number of addresses allocated */
+    size_t      curr;           /* Index of the next link to visit */
+} H5G_visit_prefetch_t;
+
 /* User data for recursive traversal over links from a group */
 typedef struct {
     hid_t       gid;            /* The group ID for the starting group */
@@ -76,6 +90,7 @@ typedef struct {
     size_t      path_buf_size;  /* Size of path buffer */
     H5L_iterate_t op;           /* Application callback */
     void       *op_data;        /* Application's op data */
+    H5G_visit_prefetch_t *prefetch;     /* Object addresses for the group being visited */
 } H5G_iter_visit_ud_t;
 
 
@@ -89,6 +104,10 @@ typedef struct {
 /********************/
 
 static herr_t H5G_open_oid(H5G_t *grp, hid_t dxpl_id);
+static herr_t H5G_visit_prefetch_cb(const H5O_link_t *lnk, void *_udata);
+static herr_t H5G_visit_cb(const H5O_link_t *lnk, void *_udata);
+static herr_t H5G_visit_group(const H5O_loc_t *grp_oloc, H5_index_t idx_type,
+    H5G_iter_visit_ud_t *udata);
 
 
 /*********************/
@@ -865,6 +884,89 @@ H5G_free_visit_visited(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED
 } /* end H5G_free_visit_visited() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:	H5G_visit_prefetch_cb
+ *
+ * Purpose:     Callback function for gathering the object address of each
+ *              link in a group, before visiting it
+ *
+ * Return:	Success:        H5_ITER_CONT
+ *		Failure:	H5_ITER_ERROR
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G_visit_prefetch_cb(const H5O_link_t *lnk, void *_udata)
+{
+    H5G_visit_prefetch_t *prefetch = (H5G_visit_prefetch_t *)_udata;     /* User data for callback */
+    herr_t ret_value = H5_ITER_CONT;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Sanity check */
+    HDassert(lnk);
+    HDassert(prefetch);
+
+    /* Make room for another address */
+    if(prefetch->nlinks >= prefetch->nalloc) {
+        size_t new_alloc = MAX(H5G_VISIT_PREFETCH_NLINKS, 2 * prefetch->nalloc);
+        haddr_t *new_addr;
+
+        if(NULL == (new_addr = (haddr_t *)H5MM_realloc(prefetch->addr, new_alloc * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_SYM, H5E_NOSPACE, H5_ITER_ERROR, "can't allocate object address list")
+        prefetch->addr = new_addr;
+        prefetch->nalloc = new_alloc;
+    } /* end if */
+
+    /* Only hard links point to an object header in this file */
+    prefetch->addr[prefetch->nlinks++] = (lnk->type == H5L_TYPE_HARD) ? lnk->u.hard.addr : HADDR_UNDEF;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_visit_prefetch_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_visit_group
+ *
+ * Purpose:     Visit the links in one group.  The object addresses of the
+ *              group's links are gathered first, so that H5G_visit_cb can
+ *              prefetch the object headers of each window of links ahead of
+ *              loading them one by one.
+ *
+ * Return:	Success:        The return value of the link iteration
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G_visit_group(const H5O_loc_t *grp_oloc, H5_index_t idx_type,
+    H5G_iter_visit_ud_t *udata)
+{
+    H5G_visit_prefetch_t prefetch;      /* Object addresses for this group */
+    H5G_visit_prefetch_t *old_prefetch = udata->prefetch;      /* Object addresses for the parent group */
+    herr_t ret_value = FAIL;            /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Gather the object addresses */
+    HDmemset(&prefetch, 0, sizeof(prefetch));
+    prefetch.f = grp_oloc->file;
+    if(H5G__obj_iterate(grp_oloc, idx_type, udata->order, (hsize_t)0, NULL, H5G_visit_prefetch_cb, &prefetch, udata->dxpl_id) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_BADITER, FAIL, "can't gather link addresses")
+
+    /* Iterate over links in group */
+    udata->prefetch = &prefetch;
+    ret_value = H5G__obj_iterate(grp_oloc, idx_type, udata->order, (hsize_t)0, NULL, H5G_visit_cb, udata, udata->dxpl_id);
+
+done:
+    udata->prefetch = old_prefetch;
+    H5MM_xfree(prefetch.addr);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_visit_group() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	H5G_visit_cb
  *
@@ -898,6 +1000,16 @@ H5G_visit_cb(const H5O_link_t *lnk, void *_udata)
     HDassert(lnk);
     HDassert(udata);
 
+    /* Prefetch the object headers for the next window of links */
+    if(udata->prefetch && udata->prefetch->curr < udata->prefetch->nlinks) {
+        H5G_visit_prefetch_t *prefetch = udata->prefetch;
+
+        if((prefetch->curr % H5G_VISIT_PREFETCH_NLINKS) == 0)
+            if(H5O_prefetch_hdrs(prefetch->f, udata->dxpl_id, &prefetch->addr[prefetch->curr], MIN(H5G_VISIT_PREFETCH_NLINKS, prefetch->nlinks - prefetch->curr)) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTLOAD, H5_ITER_ERROR, "unable to prefetch object headers")
+        prefetch->curr++;
+    } /* end if */
+
     /* Check if we will need more space to store this link's relative path */
     /* ("+2" is for string terminator and possible '/' for group separator later) */
     link_name_len = HDstrlen(lnk->name);
@@ -1006,7 +1118,7 @@ H5G_visit_cb(const H5O_link_t *lnk, void *_udata)
                 udata->curr_loc = &obj_loc;
 
                 /* Iterate over links in group */
-                ret_value = H5G__obj_iterate(&obj_oloc, idx_type, udata->order, (hsize_t)0, NULL, H5G_visit_cb, udata, udata->dxpl_id);
+                ret_value = H5G_visit_group(&obj_oloc, idx_type, udata);
 
                 /* Restore location */
                 udata->curr_loc = old_loc;
@@ -1042,6 +1154,10 @@ done:
  *              callback with more than one link that points to a particular
  *              _object_.
  *
+ *              The object headers that the links in each group point to
+ *              are loaded into the metadata cache in batches, in address
+ *              order, before the links are visited.
+ *
  * Return:	Success:	The return value of the first operator that
  *				returns non-zero, or zero if all members were
  *				processed with no operator returning non-zero.
@@ -1157,7 +1273,7 @@ H5G_visit(hid_t loc_id, const char *group_name, H5_index_t idx_type,
     } /* end if */
 
     /* Call the link iteration routine */
-    if((ret_value = H5G__obj_iterate(&(grp->oloc), idx_type, order, (hsize_t)0, NULL, H5G_visit_cb, &udata, dxpl_id)) < 0)
+    if((ret_value = H5G_visit_group(&(grp->oloc), idx_type, &udata)) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_BADITER, FAIL, "can't visit links")
 
 done:
@@ -79,7 +79,7 @@ typedef struct {
 typedef struct {
     /* downward */
     hid_t dxpl_id;              /* DXPL to use for operation */
-    hbool_t want_ih_info;       /* Whether to retrieve the index & heap info */
+    unsigned fields;            /* Which object info fields to retrieve */
 
     /* upward */
     H5O_info_t  *oinfo;         /* Object information to retrieve */
@@ -185,6 +185,9 @@ H5G_loc(hid_t loc_id, H5G_loc_t *loc)
         case H5I_ERROR_STACK:
             HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to get group location of error class, message or stack")
 
+        case H5I_EVENTSET:
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to get group location of event set")
+
         case H5I_GROUP:
             {
                 H5G_t	*group;
@@ -696,7 +699,7 @@ H5G_loc_info_cb(H5G_loc_t H5_ATTR_UNUSED *grp_loc/*in*/, const char H5_ATTR_UNUS
         HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "name doesn't exist")
 
     /* Query object information */
-    if(H5O_get_info(obj_loc->oloc, udata->dxpl_id, udata->want_ih_info, udata->oinfo) < 0)
+    if(H5O_get_info(obj_loc->oloc, udata->dxpl_id, udata->fields, udata->oinfo) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't get object info")
 
 done:
@@ -722,7 +725,7 @@ done:
  *-------------------------------------------------------------------------
  */
 herr_t
-H5G_loc_info(H5G_loc_t *loc, const char *name, hbool_t want_ih_info, H5O_info_t *oinfo/*out*/,
+H5G_loc_info(H5G_loc_t *loc, const char *name, unsigned fields, H5O_info_t *oinfo/*out*/,
     hid_t lapl_id, hid_t dxpl_id)
 {
     H5G_loc_info_t udata;               /* User data for traversal callback */
@@ -737,7 +740,7 @@ H5G_loc_info(H5G_loc_t *loc, const char *name, hbool_t want_ih_info, H5O_info_t
 
     /* Set up user data for locating object */
     udata.dxpl_id = dxpl_id;
-    udata.want_ih_info = want_ih_info;
+    udata.fields = fields;
     udata.oinfo = oinfo;
 
     /* Traverse group hierarchy to locate object */
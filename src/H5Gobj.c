@@ -640,6 +640,130 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
 } /* end H5G_obj_insert() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_obj_insert_many
+ *
+ * Purpose:	Insert a batch of new links into the group described by
+ *		GRP_OLOC.  The links' names must be sorted in strictly
+ *		increasing order and none of them may already exist in the
+ *		group; both are checked before any link is inserted.  The
+ *		reference count of the object each hard link points to is
+ *		incremented.
+ *
+ *		When the links move an empty 'new format' group straight to
+ *		dense storage, its indices are bulk loaded instead of being
+ *		built one insertion at a time.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G_obj_insert_many(const H5O_loc_t *grp_oloc, size_t nlinks, H5O_link_t *lnks,
+    hid_t dxpl_id)
+{
+    H5O_link_t tmp_lnk;         /* Link looked up in group */
+    H5O_pline_t tmp_pline;      /* Pipeline message */
+    H5O_pline_t *pline = NULL;  /* Pointer to pipeline message */
+    H5O_linfo_t linfo;		/* Link info message */
+    htri_t linfo_exists;        /* Whether the link info message exists */
+    hbool_t use_bulk_dense = FALSE;     /* Whether to build dense storage from all the links */
+    size_t u;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI_TAG(dxpl_id, grp_oloc->addr, FAIL)
+
+    /* check arguments */
+    HDassert(grp_oloc && grp_oloc->file);
+    HDassert(lnks || nlinks == 0);
+
+    /* Check the names in the batch, then the names already in the group */
+    for(u = 0; u < nlinks; u++) {
+        htri_t exists;          /* Whether the link already exists */
+
+        HDassert(lnks[u].name && *lnks[u].name);
+        if(u > 0 && HDstrcmp(lnks[u - 1].name, lnks[u].name) >= 0)
+            HGOTO_ERROR(H5E_SYM, H5E_BADVALUE, FAIL, "link names are not sorted or not unique")
+
+        if((exists = H5G__obj_lookup(grp_oloc, lnks[u].name, &tmp_lnk, dxpl_id)) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check if link exists")
+        if(exists) {
+            H5O_msg_reset(H5O_LINK_ID, &tmp_lnk);
+            HGOTO_ERROR(H5E_SYM, H5E_EXISTS, FAIL, "name already exists")
+        } /* end if */
+    } /* end for */
+
+    /* Check if the links would move an empty 'new format' group straight
+     *  to dense storage, which can then be built from all the links at once
+     */
+    if((linfo_exists = H5G__obj_get_linfo(grp_oloc, &linfo, dxpl_id)) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
+    if(linfo_exists && linfo.nlinks == 0 && !H5F_addr_defined(linfo.fheap_addr)) {
+        H5O_ginfo_t ginfo;      /* Group info message */
+
+        if(NULL == H5O_msg_read(grp_oloc, H5O_GINFO_ID, &ginfo, dxpl_id))
+            HGOTO_ERROR(H5E_SYM, H5E_BADMESG, FAIL, "can't get group info")
+        use_bulk_dense = (nlinks > ginfo.max_compact);
+    } /* end if */
+
+    if(use_bulk_dense) {
+        htri_t pline_exists;    /* Whether the pipeline message exists */
+
+        /* Set the creation order for the new links */
+        if(linfo.track_corder)
+            for(u = 0; u < nlinks; u++) {
+                lnks[u].corder = linfo.max_corder++;
+                lnks[u].corder_valid = TRUE;
+            } /* end for */
+
+        /* Get the pipeline message, if it exists */
+        if((pline_exists = H5O_msg_exists(grp_oloc, H5O_PLINE_ID, dxpl_id)) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "unable to read object header")
+        if(pline_exists) {
+            if(NULL == H5O_msg_read(grp_oloc, H5O_PLINE_ID, &tmp_pline, dxpl_id))
+                HGOTO_ERROR(H5E_SYM, H5E_BADMESG, FAIL, "can't get link pipeline")
+            pline = &tmp_pline;
+        } /* end if */
+
+        /* Create the dense link storage and build it from the links */
+        if(H5G__dense_create(grp_oloc->file, dxpl_id, &linfo, pline) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "unable to create 'dense' form of new format group")
+        if(H5G__dense_insert_many(grp_oloc->file, dxpl_id, &linfo, nlinks, lnks) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert links into dense storage")
+
+        /* Update the number of objects in this group */
+        linfo.nlinks = nlinks;
+        if(H5O_msg_write(grp_oloc, H5O_LINFO_ID, 0, H5O_UPDATE_TIME, &linfo, dxpl_id) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't update link info message")
+
+        /* Increment link count on the objects of hard links */
+        for(u = 0; u < nlinks; u++)
+            if(lnks[u].type == H5L_TYPE_HARD) {
+                H5O_loc_t obj_oloc;     /* Object location */
+
+                H5O_loc_reset(&obj_oloc);
+                obj_oloc.file = grp_oloc->file;
+                obj_oloc.addr = lnks[u].u.hard.addr;
+                if(H5O_link(&obj_oloc, 1, dxpl_id) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_LINKCOUNT, FAIL, "unable to increment hard link count")
+            } /* end if */
+    } /* end if */
+    else {
+        /* Insert the links one at a time */
+        for(u = 0; u < nlinks; u++)
+            if(H5G_obj_insert(grp_oloc, lnks[u].name, &lnks[u], TRUE, H5O_TYPE_UNKNOWN, NULL, dxpl_id) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert link into group")
+    } /* end else */
+
+done:
+    /* Free any space used by the pipeline message */
+    if(pline && H5O_msg_reset(H5O_PLINE_ID, pline) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CANTFREE, FAIL, "can't release pipeline")
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
+} /* end H5G_obj_insert_many() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5G__obj_iterate
@@ -991,6 +1115,9 @@ H5G_obj_remove(const H5O_loc_t *oloc, H5RS_str_t *grp_full_path_r, const char *n
     HDassert(oloc);
     HDassert(name && *name);
 
+    /* Drop the link from the path lookup cache */
+    H5G__pcache_evict(oloc, name);
+
     /* Attempt to get the link info for this group */
     if((linfo_exists = H5G__obj_get_linfo(oloc, &linfo, dxpl_id)) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
@@ -1056,6 +1183,9 @@ H5G_obj_remove_by_idx(const H5O_loc_t *grp_oloc, H5RS_str_t *grp_full_path_r,
     /* Sanity check */
     HDassert(grp_oloc && grp_oloc->file);
 
+    /* The link's name isn't known here, so empty the path lookup cache */
+    H5G_pcache_clear(grp_oloc->file);
+
     /* Attempt to get the link info for this group */
     if((linfo_exists = H5G__obj_get_linfo(grp_oloc, &linfo, dxpl_id)) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
@@ -1110,6 +1240,8 @@ done:
  * Function:	H5G__obj_lookup
  *
  * Purpose:	Look up a link in a group, using the name as the key.
+ *              Links found are remembered in the file's path lookup cache,
+ *              if it's enabled.
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -1133,6 +1265,12 @@ H5G__obj_lookup(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *lnk,
     HDassert(grp_oloc && grp_oloc->file);
     HDassert(name && *name);
 
+    /* Check the path lookup cache first */
+    if((ret_value = H5G__pcache_lookup(grp_oloc, name, lnk)) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check path lookup cache")
+    if(ret_value)
+        HGOTO_DONE(TRUE)
+
     /* Attempt to get the link info message for this group */
     if((linfo_exists = H5G__obj_get_linfo(grp_oloc, &linfo, dxpl_id)) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
@@ -1155,6 +1293,10 @@ H5G__obj_lookup(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *lnk,
             HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "can't locate object")
     } /* end else */
 
+    /* Remember the link for the next lookup */
+    if(ret_value && H5G__pcache_insert(grp_oloc, lnk) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "can't add link to path lookup cache")
+
 done:
     FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
 } /* end H5G__obj_lookup() */
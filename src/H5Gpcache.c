@@ -0,0 +1,363 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:		H5Gpcache.c
+ *
+ * Purpose:		The path lookup cache: a per-file table of the links
+ *			found by H5G__obj_lookup, keyed on the address of the
+ *			group holding the link and the link's name.
+ *
+ *			The table is direct-mapped, with one entry per slot, so
+ *			a new entry simply replaces whatever hashed to the same
+ *			slot.  Entries are dropped when their link is removed
+ *			from the group, and the whole table is emptied when a
+ *			group's object header is deleted, since its address may
+ *			be reused.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5Gmodule.h"          /* This source code file is part of the H5G module */
+
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5Fprivate.h"		/* File access				*/
+#include "H5FLprivate.h"	/* Free Lists                           */
+#include "H5Gpkg.h"		/* Groups		  		*/
+#include "H5MMprivate.h"	/* Memory management			*/
+
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Map a group address & link name hash to a slot in the cache */
+#define H5G_PCACHE_HASH_MULT    ((uint64_t)0x9E3779B97F4A7C15ULL)
+#define H5G_PCACHE_SLOT(C, ADDR, HASH)                                        \
+    ((size_t)((((uint64_t)(ADDR) * H5G_PCACHE_HASH_MULT) ^ (uint64_t)(HASH)) & (uint64_t)((C)->nslots - 1)))
+
+/* Whether the cache can be used for a file */
+#define H5G_PCACHE_USABLE(F)                                                  \
+    (H5F_PATH_CACHE_NENTRIES(F) > 0 && !(H5F_INTENT(F) & H5F_ACC_SWMR_READ))
+
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* An entry in the path lookup cache */
+typedef struct H5G_pcache_ent_t {
+    haddr_t     grp_addr;       /* Address of the group holding the link */
+    uint32_t    hash;           /* Hash of the link's name */
+    H5O_link_t  lnk;            /* Copy of the link */
+} H5G_pcache_ent_t;
+
+/* The path lookup cache for a file */
+struct H5G_pcache_t {
+    size_t      nslots;         /* Number of slots (a power of two) */
+    size_t      nused;          /* Number of slots holding an entry */
+    H5G_pcache_ent_t **slot;    /* The slots */
+};
+
+
+/********************/
+/* Package Typedefs */
+/********************/
+
+
+/********************/
+/* Local Prototypes */
+/********************/
+static H5G_pcache_ent_t *H5G__pcache_find(const H5G_pcache_t *pcache,
+    haddr_t grp_addr, const char *name, uint32_t hash);
+static void H5G__pcache_free_ent(H5G_pcache_t *pcache, size_t u);
+
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Declare free lists to manage the cache & its entries */
+H5FL_DEFINE_STATIC(H5G_pcache_t);
+H5FL_DEFINE_STATIC(H5G_pcache_ent_t);
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__pcache_find
+ *
+ * Purpose:	Find the cache entry for a link, if it's cached.
+ *
+ * Return:	Pointer to the entry, or NULL if the link isn't cached
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5G_pcache_ent_t *
+H5G__pcache_find(const H5G_pcache_t *pcache, haddr_t grp_addr, const char *name,
+    uint32_t hash)
+{
+    H5G_pcache_ent_t *ent;              /* Entry in the link's slot */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    ent = pcache->slot[H5G_PCACHE_SLOT(pcache, grp_addr, hash)];
+    if(ent && (ent->hash != hash || !H5F_addr_eq(ent->grp_addr, grp_addr)
+            || HDstrcmp(ent->lnk.name, name)))
+        ent = NULL;
+
+    FUNC_LEAVE_NOAPI(ent)
+} /* end H5G__pcache_find() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__pcache_free_ent
+ *
+ * Purpose:	Release the entry in a slot of the cache.
+ *
+ * Return:	None
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5G__pcache_free_ent(H5G_pcache_t *pcache, size_t u)
+{
+    H5G_pcache_ent_t *ent = pcache->slot[u];    /* Entry to release */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(ent);
+
+    H5O_msg_reset(H5O_LINK_ID, &ent->lnk);
+    ent = H5FL_FREE(H5G_pcache_ent_t, ent);
+    pcache->slot[u] = NULL;
+    pcache->nused--;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5G__pcache_free_ent() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__pcache_lookup
+ *
+ * Purpose:	Look up a link in a group in the path lookup cache, and
+ *              make a copy of it in LNK if it's there.
+ *
+ * Return:	Success:	TRUE if the link was cached, FALSE if not
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5G__pcache_lookup(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *lnk)
+{
+    H5G_pcache_t *pcache;               /* File's path lookup cache */
+    H5G_pcache_ent_t *ent;              /* Cache entry for link */
+    htri_t ret_value = FALSE;           /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments */
+    HDassert(grp_oloc && grp_oloc->file);
+    HDassert(name && *name);
+    HDassert(lnk);
+
+    if(NULL == (pcache = H5F_PATH_CACHE(grp_oloc->file)) || !H5G_PCACHE_USABLE(grp_oloc->file))
+        HGOTO_DONE(FALSE)
+
+    if(NULL != (ent = H5G__pcache_find(pcache, grp_oloc->addr, name, H5_hash_string(name)))) {
+        if(NULL == H5O_msg_copy(H5O_LINK_ID, &ent->lnk, lnk))
+            HGOTO_ERROR(H5E_SYM, H5E_CANTCOPY, FAIL, "can't copy cached link")
+        ret_value = TRUE;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__pcache_lookup() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__pcache_insert
+ *
+ * Purpose:	Add a link found in a group to the path lookup cache,
+ *              creating the file's cache the first time.  Does nothing if
+ *              the cache is disabled for the file.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G__pcache_insert(const H5O_loc_t *grp_oloc, const H5O_link_t *lnk)
+{
+    H5G_pcache_t *pcache;               /* File's path lookup cache */
+    H5G_pcache_ent_t *ent = NULL;       /* New cache entry */
+    uint32_t hash;                      /* Hash of link name */
+    size_t u;                           /* Slot for link */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments */
+    HDassert(grp_oloc && grp_oloc->file);
+    HDassert(lnk && lnk->name);
+
+    if(!H5G_PCACHE_USABLE(grp_oloc->file))
+        HGOTO_DONE(SUCCEED)
+
+    /* Create the cache, if necessary */
+    if(NULL == (pcache = H5F_PATH_CACHE(grp_oloc->file))) {
+        size_t nslots = 1;
+
+        while(nslots < H5F_PATH_CACHE_NENTRIES(grp_oloc->file) && nslots <= (((size_t)-1) >> 1))
+            nslots <<= 1;
+
+        if(NULL == (pcache = H5FL_MALLOC(H5G_pcache_t)))
+            HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "can't allocate path lookup cache")
+        if(NULL == (pcache->slot = (H5G_pcache_ent_t **)H5MM_calloc(nslots * sizeof(H5G_pcache_ent_t *)))) {
+            pcache = H5FL_FREE(H5G_pcache_t, pcache);
+            HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "can't allocate path lookup cache slots")
+        } /* end if */
+        pcache->nslots = nslots;
+        pcache->nused = 0;
+        H5F_SET_PATH_CACHE(grp_oloc->file, pcache);
+    } /* end if */
+
+    /* Make a copy of the link */
+    if(NULL == (ent = H5FL_MALLOC(H5G_pcache_ent_t)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "can't allocate path lookup cache entry")
+    if(NULL == H5O_msg_copy(H5O_LINK_ID, lnk, &ent->lnk)) {
+        ent = H5FL_FREE(H5G_pcache_ent_t, ent);
+        HGOTO_ERROR(H5E_SYM, H5E_CANTCOPY, FAIL, "can't copy link")
+    } /* end if */
+    ent->grp_addr = grp_oloc->addr;
+    ent->hash = hash = H5_hash_string(lnk->name);
+
+    /* Replace whatever was in the link's slot */
+    u = H5G_PCACHE_SLOT(pcache, grp_oloc->addr, hash);
+    if(pcache->slot[u])
+        H5G__pcache_free_ent(pcache, u);
+    pcache->slot[u] = ent;
+    pcache->nused++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__pcache_insert() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__pcache_evict
+ *
+ * Purpose:	Drop a link in a group from the path lookup cache, if it's
+ *              there.
+ *
+ * Return:	None
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5G__pcache_evict(const H5O_loc_t *grp_oloc, const char *name)
+{
+    H5G_pcache_t *pcache;               /* File's path lookup cache */
+    uint32_t hash;                      /* Hash of link name */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Check arguments */
+    HDassert(grp_oloc && grp_oloc->file);
+    HDassert(name);
+
+    if(NULL != (pcache = H5F_PATH_CACHE(grp_oloc->file)) && pcache->nused > 0) {
+        hash = H5_hash_string(name);
+        if(H5G__pcache_find(pcache, grp_oloc->addr, name, hash))
+            H5G__pcache_free_ent(pcache, H5G_PCACHE_SLOT(pcache, grp_oloc->addr, hash));
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5G__pcache_evict() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_pcache_clear
+ *
+ * Purpose:	Drop all the entries in a file's path lookup cache.
+ *
+ * Return:	None
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5G_pcache_clear(H5F_t *f)
+{
+    H5G_pcache_t *pcache;               /* File's path lookup cache */
+    size_t u;                           /* Local index variable */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+
+    if(NULL != (pcache = H5F_PATH_CACHE(f)))
+        for(u = 0; u < pcache->nslots && pcache->nused > 0; u++)
+            if(pcache->slot[u])
+                H5G__pcache_free_ent(pcache, u);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5G_pcache_clear() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_pcache_dest
+ *
+ * Purpose:	Release a file's path lookup cache, when the file is closed.
+ *
+ * Return:	None
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5G_pcache_dest(H5F_t *f)
+{
+    H5G_pcache_t *pcache;               /* File's path lookup cache */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+
+    if(NULL != (pcache = H5F_PATH_CACHE(f))) {
+        H5G_pcache_clear(f);
+        H5MM_xfree(pcache->slot);
+        pcache = H5FL_FREE(H5G_pcache_t, pcache);
+        H5F_SET_PATH_CACHE(f, NULL);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5G_pcache_dest() */
+
@@ -464,6 +464,8 @@ H5_DLL herr_t H5G__dense_create(H5F_t *f, hid_t dxpl_id, H5O_linfo_t *linfo,
     const H5O_pline_t *pline);
 H5_DLL herr_t H5G__dense_insert(H5F_t *f, hid_t dxpl_id,
     const H5O_linfo_t *linfo, const H5O_link_t *lnk);
+H5_DLL herr_t H5G__dense_insert_many(H5F_t *f, hid_t dxpl_id,
+    const H5O_linfo_t *linfo, size_t nlinks, const H5O_link_t *lnks);
 H5_DLL htri_t H5G__dense_lookup(H5F_t *f, hid_t dxpl_id,
     const H5O_linfo_t *linfo, const char *name, H5O_link_t *lnk);
 H5_DLL herr_t H5G__dense_lookup_by_idx(H5F_t *f, hid_t dxpl_id,
@@ -503,6 +505,12 @@ H5_DLL herr_t H5G__obj_info(H5O_loc_t *oloc, H5G_info_t *grp_info, hid_t dxpl_id
 H5_DLL htri_t H5G__obj_lookup(const H5O_loc_t *grp_oloc, const char *name,
     H5O_link_t *lnk, hid_t dxpl_id);
 
+/* Functions that understand the path lookup cache */
+H5_DLL htri_t H5G__pcache_lookup(const H5O_loc_t *grp_oloc, const char *name,
+    H5O_link_t *lnk);
+H5_DLL herr_t H5G__pcache_insert(const H5O_loc_t *grp_oloc, const H5O_link_t *lnk);
+H5_DLL void H5G__pcache_evict(const H5O_loc_t *grp_oloc, const char *name);
+
 /*
  * These functions operate on group hierarchy names.
  */
@@ -181,6 +181,7 @@ typedef struct {
 typedef struct H5G_t H5G_t;
 typedef struct H5G_shared_t H5G_shared_t;
 typedef struct H5G_entry_t H5G_entry_t;
+typedef struct H5G_pcache_t H5G_pcache_t;
 
 /*
  * Library prototypes...  These are the ones that other packages routinely
@@ -228,6 +229,8 @@ H5_DLL herr_t H5G_link_to_info(const struct H5O_link_t *lnk, H5L_info_t *linfo);
 H5_DLL herr_t H5G_obj_insert(const struct H5O_loc_t *grp_oloc, const char *name,
     struct H5O_link_t *obj_lnk, hbool_t adj_link, H5O_type_t obj_type,
     const void *crt_info, hid_t dxpl_id);
+H5_DLL herr_t H5G_obj_insert_many(const struct H5O_loc_t *grp_oloc, size_t nlinks,
+    struct H5O_link_t *lnks, hid_t dxpl_id);
 H5_DLL ssize_t H5G_obj_get_name_by_idx(const struct H5O_loc_t *oloc, H5_index_t idx_type,
     H5_iter_order_t order, hsize_t n, char* name, size_t size, hid_t dxpl_id);
 H5_DLL herr_t H5G_obj_remove(const struct H5O_loc_t *oloc, H5RS_str_t *grp_full_path_r,
@@ -242,6 +245,12 @@ H5_DLL hid_t H5G_get_create_plist(H5G_t *grp);
  * These functions operate on symbol table nodes.
  */
 H5_DLL herr_t H5G_node_close(const H5F_t *f);
+
+/*
+ * These functions operate on the path lookup cache.
+ */
+H5_DLL void H5G_pcache_clear(H5F_t *f);
+H5_DLL void H5G_pcache_dest(H5F_t *f);
 H5_DLL herr_t H5G_node_debug(H5F_t *f, hid_t dxpl_id, haddr_t addr, FILE *stream,
 			      int indent, int fwidth, haddr_t heap);
 
@@ -280,7 +289,7 @@ H5_DLL herr_t H5G_loc_find_by_idx(H5G_loc_t *loc, const char *group_name,
 H5_DLL htri_t H5G_loc_exists(const H5G_loc_t *loc, const char *name,
     hid_t lapl_id, hid_t dxpl_id);
 H5_DLL herr_t H5G_loc_info(H5G_loc_t *loc, const char *name,
-    hbool_t want_ih_info, H5O_info_t *oinfo/*out*/, hid_t lapl_id,
+    unsigned fields, H5O_info_t *oinfo/*out*/, hid_t lapl_id,
     hid_t dxpl_id);
 H5_DLL herr_t H5G_loc_set_comment(H5G_loc_t *loc, const char *name,
     const char *comment, hid_t lapl_id, hid_t dxpl_id);
@@ -35,7 +35,6 @@
 #include "H5Ipkg.h"             /* IDs                                      */
 #include "H5MMprivate.h"        /* Memory management                        */
 #include "H5Oprivate.h"         /* Object headers                           */
-#include "H5SLprivate.h"        /* Skip Lists                               */
 
 /* Define this to compile in support for dumping ID information */
 /* #define H5I_DEBUG_OUTPUT */
@@ -54,6 +53,15 @@
 #define H5I_MAKE(g,i)	((((hid_t)(g) & TYPE_MASK) << ID_BITS) |	  \
 			     ((hid_t)(i) & ID_MASK))
 
+/* Log2 of the smallest hash table used for the IDs in a type */
+#define H5I_MIN_HASH_BITS       6
+
+/* Map an ID to its home bucket in a type's hash table.  (Fibonacci hashing,
+ * which spreads the sequential IDs handed out by H5I_register evenly.)
+ */
+#define H5I_HASH_MULT           ((uint64_t)0x9E3779B97F4A7C15ULL)
+#define H5I_HASH(T, ID)         ((size_t)(((uint64_t)(ID) * H5I_HASH_MULT) >> (64 - (T)->hash_bits)))
+
 /* Local typedefs */
 
 /* Atom information structure used */
@@ -62,6 +70,9 @@ typedef struct H5I_id_info_t {
     unsigned	count;		/* ref. count for this atom		    */
     unsigned    app_count;      /* ref. count of application visible atoms  */
     const void	*obj_ptr;	/* pointer associated with the atom	    */
+    hbool_t     removed;        /* Whether removal was deferred by H5I_clear_type */
+    struct H5I_id_info_t *prev; /* Previous ID in the type, in ID order     */
+    struct H5I_id_info_t *next; /* Next ID in the type, in ID order         */
 } H5I_id_info_t;
 
 /* ID type structure used */
@@ -70,7 +81,11 @@ typedef struct {
     unsigned	init_count;	/* # of times this type has been initialized*/
     uint64_t	id_count;	/* Current number of IDs held		    */
     uint64_t	nextid;		/* ID to use for the next atom		    */
-    H5SL_t      *ids;           /* Pointer to skip list that stores IDs     */
+    H5I_id_info_t **hash;       /* Open-addressed hash table of the IDs     */
+    unsigned    hash_bits;      /* Log2 of the number of hash table buckets */
+    H5I_id_info_t *first;       /* First ID in the type, in ID order        */
+    H5I_id_info_t *last;        /* Last ID in the type, in ID order         */
+    hbool_t     safe_iterating; /* Whether ID removals are being deferred   */
 } H5I_id_type_t;
 
 typedef struct {
@@ -119,13 +134,17 @@ H5FL_DEFINE_STATIC(H5I_id_type_t);
 H5FL_DEFINE_STATIC(H5I_class_t);
 
 /*--------------------- Local function prototypes ---------------------------*/
-static htri_t H5I__clear_type_cb(void *_id, void *key, void *udata);
+static htri_t H5I__clear_type_cb(H5I_id_info_t *id, H5I_clear_type_ud_t *udata);
 static int H5I__destroy_type(H5I_type_t type);
 static void *H5I__remove_verify(hid_t id, H5I_type_t id_type);
 static void *H5I__remove_common(H5I_id_type_t *type_ptr, hid_t id);
 static int H5I__inc_type_ref(H5I_type_t type);
 static int H5I__get_type_ref(H5I_type_t type);
 static H5I_id_info_t *H5I__find_id(hid_t id);
+static herr_t H5I__resize_hash(H5I_id_type_t *type_ptr, unsigned hash_bits);
+static herr_t H5I__insert_id(H5I_id_type_t *type_ptr, H5I_id_info_t *id_ptr);
+static void H5I__unhash_id(H5I_id_type_t *type_ptr, H5I_id_info_t *id_ptr);
+static void H5I__unlink_id(H5I_id_type_t *type_ptr, H5I_id_info_t *id_ptr);
 #ifdef H5I_DEBUG_OUTPUT
 static herr_t H5I__debug(H5I_type_t type);
 #endif /* H5I_DEBUG_OUTPUT */
@@ -160,7 +179,7 @@ H5I_term_package(void)
 
         /* How many types are still being used? */
         for(type = (H5I_type_t)0; type < H5I_next_type; H5_INC_ENUM(H5I_type_t, type))
-            if((type_ptr = H5I_id_type_list_g[type]) && type_ptr->ids)
+            if((type_ptr = H5I_id_type_list_g[type]) && type_ptr->hash)
                 n++;
 
         /* If no types are used then clean up */
@@ -168,7 +187,7 @@ H5I_term_package(void)
             for(type = (H5I_type_t)0; type < H5I_next_type; H5_INC_ENUM(H5I_type_t,type)) {
                 type_ptr = H5I_id_type_list_g[type];
                 if(type_ptr) {
-                    HDassert(NULL == type_ptr->ids);
+                    HDassert(NULL == type_ptr->hash);
                     type_ptr = H5FL_FREE(H5I_id_type_t, type_ptr);
                     H5I_id_type_list_g[type] = NULL;
                     n++;
@@ -305,8 +324,10 @@ H5I_register_type(const H5I_class_t *cls)
         type_ptr->cls = cls;
         type_ptr->id_count = 0;
         type_ptr->nextid = cls->reserved;
-        if(NULL == (type_ptr->ids = H5SL_create(H5SL_TYPE_HID, NULL)))
-            HGOTO_ERROR(H5E_ATOM, H5E_CANTCREATE, FAIL, "skip list creation failed")
+        type_ptr->first = type_ptr->last = NULL;
+        type_ptr->safe_iterating = FALSE;
+        if(H5I__resize_hash(type_ptr, H5I_MIN_HASH_BITS) < 0)
+            HGOTO_ERROR(H5E_ATOM, H5E_CANTCREATE, FAIL, "ID hash table creation failed")
     } /* end if */
 
     /* Increment the count of the times this type has been initialized */
@@ -315,8 +336,8 @@ H5I_register_type(const H5I_class_t *cls)
 done:
     if(ret_value < 0) {	/* Clean up on error */
         if(type_ptr) {
-            if(type_ptr->ids)
-                H5SL_close(type_ptr->ids);
+            if(type_ptr->hash)
+                type_ptr->hash = (H5I_id_info_t **)H5MM_xfree(type_ptr->hash);
             (void)H5FL_FREE(H5I_id_type_t, type_ptr);
         } /* end if */
     } /* end if */
@@ -494,6 +515,8 @@ herr_t
 H5I_clear_type(H5I_type_t type, hbool_t force, hbool_t app_ref)
 {
     H5I_clear_type_ud_t udata;          /* udata struct for callback */
+    H5I_id_info_t *id_ptr;              /* Current ID being worked with */
+    H5I_id_info_t *next_id_ptr;         /* Next ID in the type */
     int         ret_value = SUCCEED;    /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
@@ -509,9 +532,29 @@ H5I_clear_type(H5I_type_t type, hbool_t force, hbool_t app_ref)
     udata.force = force;
     udata.app_ref = app_ref;
 
-    /* Attempt to free all ids in the type */
-    if(H5SL_try_free_safe(udata.type_ptr->ids, H5I__clear_type_cb, &udata) < 0)
-        HGOTO_ERROR(H5E_ATOM, H5E_CANTDELETE, FAIL, "can't free ids in type")
+    /* Not currently supported */
+    HDassert(!udata.type_ptr->safe_iterating);
+
+    /* Attempt to free all ids in the type.  The 'free' callbacks may remove
+     * other IDs in this type, so removals are only marked while iterating
+     * and the marked IDs are released afterwards.
+     */
+    udata.type_ptr->safe_iterating = TRUE;
+    for(id_ptr = udata.type_ptr->first; id_ptr; id_ptr = id_ptr->next)
+        if(!id_ptr->removed && H5I__clear_type_cb(id_ptr, &udata)) {
+            H5I__unhash_id(udata.type_ptr, id_ptr);
+            id_ptr->removed = TRUE;
+        } /* end if */
+    udata.type_ptr->safe_iterating = FALSE;
+
+    /* Release the removed IDs */
+    for(id_ptr = udata.type_ptr->first; id_ptr; id_ptr = next_id_ptr) {
+        next_id_ptr = id_ptr->next;
+        if(id_ptr->removed) {
+            H5I__unlink_id(udata.type_ptr, id_ptr);
+            id_ptr = H5FL_FREE(H5I_id_info_t, id_ptr);
+        } /* end if */
+    } /* end for */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -524,8 +567,8 @@ done:
  * Purpose:     Attempts to free the specified ID , calling the free
  *              function for the object.
  *
- * Return:      Success:        Non-negative
- *              Failure:        negative
+ * Return:      TRUE if the ID should be removed from the type, FALSE
+ *              otherwise
  *
  * Programmer:  Neil Fortner
  *              Friday, July 10, 2015
@@ -533,10 +576,8 @@ done:
  *-------------------------------------------------------------------------
  */
 static htri_t
-H5I__clear_type_cb(void *_id, void H5_ATTR_UNUSED *key, void *_udata)
+H5I__clear_type_cb(H5I_id_info_t *id, H5I_clear_type_ud_t *udata)
 {
-    H5I_id_info_t       *id = (H5I_id_info_t *)_id; /* Current ID being worked with */
-    H5I_clear_type_ud_t *udata = (H5I_clear_type_ud_t *)_udata; /* udata struct */
     htri_t              ret_value = FALSE;    /* Return value */
 
     FUNC_ENTER_STATIC_NOERR
@@ -571,15 +612,6 @@ H5I__clear_type_cb(void *_id, void H5_ATTR_UNUSED *key, void *_udata)
             /* Indicate node should be removed from list */
             ret_value = TRUE;
         } /* end else */
-
-        /* Remove ID if requested */
-        if(ret_value) {
-            /* Free ID info */
-            id = H5FL_FREE(H5I_id_info_t, id);
-
-            /* Decrement the number of IDs in the type */
-            udata->type_ptr->id_count--;
-        } /* end if */
     } /* end if */
 
     FUNC_LEAVE_NOAPI(ret_value)
@@ -639,6 +671,7 @@ static herr_t
 H5I__destroy_type(H5I_type_t type)
 {
     H5I_id_type_t *type_ptr;	/* ptr to the atomic type */
+    H5I_id_info_t *id_ptr;      /* Current ID being released */
     herr_t ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
@@ -659,9 +692,12 @@ H5I__destroy_type(H5I_type_t type)
     if(type_ptr->cls->flags & H5I_CLASS_IS_APPLICATION)
         type_ptr->cls = H5FL_FREE(H5I_class_t, (void *)type_ptr->cls);
 
-    if(H5SL_close(type_ptr->ids) < 0)
-        HGOTO_ERROR(H5E_ATOM, H5E_CANTCLOSEOBJ, FAIL, "can't close skip list")
-    type_ptr->ids = NULL;
+    /* Release any IDs left behind, and the hash table */
+    while(NULL != (id_ptr = type_ptr->first)) {
+        H5I__unlink_id(type_ptr, id_ptr);
+        id_ptr = H5FL_FREE(H5I_id_info_t, id_ptr);
+    } /* end while */
+    type_ptr->hash = (H5I_id_info_t **)H5MM_xfree(type_ptr->hash);
 
     type_ptr = H5FL_FREE(H5I_id_type_t, type_ptr);
     H5I_id_type_list_g[type] = NULL;
@@ -742,9 +778,8 @@ H5I_register(H5I_type_t type, const void *object, hbool_t app_ref)
     id_ptr->obj_ptr = object;
 
     /* Insert into the type */
-    if (H5SL_insert(type_ptr->ids, id_ptr, &id_ptr->id) < 0)
-        HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, H5I_INVALID_HID, "can't insert ID node into skip list")
-    type_ptr->id_count++;
+    if (H5I__insert_id(type_ptr, id_ptr) < 0)
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, H5I_INVALID_HID, "can't insert ID node into type")
     type_ptr->nextid++;
 
     /* Sanity check for the 'nextid' getting too large and wrapping around */
@@ -812,9 +847,8 @@ H5I_register_with_id(H5I_type_t type, const void *object, hbool_t app_ref, hid_t
     id_ptr->obj_ptr = object;
 
     /* Insert into the type */
-    if(H5SL_insert(type_ptr->ids, id_ptr, &id_ptr->id) < 0)
-        HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, FAIL, "can't insert ID node into skip list")
-    type_ptr->id_count++;
+    if(H5I__insert_id(type_ptr, id_ptr) < 0)
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, FAIL, "can't insert ID node into type")
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1126,15 +1160,21 @@ H5I__remove_common(H5I_id_type_t *type_ptr, hid_t id)
     HDassert(type_ptr);
 
     /* Get the ID node for the ID */
-    if(NULL == (curr_id = (H5I_id_info_t *)H5SL_remove(type_ptr->ids, &id)))
-        HGOTO_ERROR(H5E_ATOM, H5E_CANTDELETE, NULL, "can't remove ID node from skip list")
+    if(NULL == (curr_id = H5I__find_id(id)))
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTDELETE, NULL, "can't remove ID node from type")
 
     /* (Casting away const OK -QAK) */
     ret_value = (void *)curr_id->obj_ptr;
-    curr_id = H5FL_FREE(H5I_id_info_t, curr_id);
 
-    /* Decrement the number of IDs in the type */
-    (type_ptr->id_count)--;
+    /* Remove the ID from the type, deferring its release if the type is
+     * being cleared */
+    H5I__unhash_id(type_ptr, curr_id);
+    if(type_ptr->safe_iterating)
+        curr_id->removed = TRUE;
+    else {
+        H5I__unlink_id(type_ptr, curr_id);
+        curr_id = H5FL_FREE(H5I_id_info_t, curr_id);
+    } /* end else */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1871,10 +1911,8 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5I__iterate_cb(void *_item, void H5_ATTR_UNUSED *_key, void *_udata)
+H5I__iterate_cb(H5I_id_info_t *item, H5I_iterate_ud_t *udata)
 {
-    H5I_id_info_t *item = (H5I_id_info_t *)_item;       /* Pointer to the ID node */
-    H5I_iterate_ud_t *udata = (H5I_iterate_ud_t *)_udata; /* User data for callback */
     int ret_value = H5_ITER_CONT;     /* Callback return value */
 
     FUNC_ENTER_STATIC_NOERR
@@ -1936,15 +1974,24 @@ H5I_iterate(H5I_type_t type, H5I_search_func_t func, void *udata, hbool_t app_re
     /* Only iterate through ID list if it is initialized and there are IDs in type */
     if (type_ptr && type_ptr->init_count > 0 && type_ptr->id_count > 0) {
         H5I_iterate_ud_t iter_udata;    /* User data for iteration callback */
-        herr_t iter_status;             /* Iteration status */
+        H5I_id_info_t *id_ptr;          /* Current ID */
+        H5I_id_info_t *next_id_ptr;     /* Next ID, in case the current one is removed */
+        int iter_status = H5_ITER_CONT; /* Iteration status */
 
         /* Set up iterator user data */
         iter_udata.user_func = func;
         iter_udata.user_udata = udata;
         iter_udata.app_ref = app_ref;
 
-        /* Iterate over IDs */
-        if ((iter_status = H5SL_iterate(type_ptr->ids, H5I__iterate_cb, &iter_udata)) < 0)
+        /* Iterate over IDs, in ID order */
+        for (id_ptr = type_ptr->first; id_ptr && iter_status == H5_ITER_CONT; id_ptr = next_id_ptr) {
+            /* Protect against the ID being removed by the callback */
+            next_id_ptr = id_ptr->next;
+
+            if (!id_ptr->removed)
+                iter_status = H5I__iterate_cb(id_ptr, &iter_udata);
+        } /* end for */
+        if (iter_status < 0)
             HGOTO_ERROR(H5E_ATOM, H5E_BADITER, FAIL, "iteration failed")
     }
 
@@ -1970,6 +2017,8 @@ H5I__find_id(hid_t id)
 {
     H5I_type_t		type;			/*ID's type		*/
     H5I_id_type_t	*type_ptr;		/*ptr to the type	*/
+    size_t		mask;			/*hash table index mask	*/
+    size_t		u;			/*hash table index	*/
     H5I_id_info_t	*ret_value = NULL;	/* Return value */
 
     FUNC_ENTER_STATIC_NOERR
@@ -1983,13 +2032,212 @@ H5I__find_id(hid_t id)
     if (!type_ptr || type_ptr->init_count <= 0)
         HGOTO_DONE(NULL)
 
-    /* Locate the ID node for the ID */
-    ret_value = (H5I_id_info_t *)H5SL_search(type_ptr->ids, &id);
+    /* Locate the ID node for the ID, probing from its home bucket */
+    mask = ((size_t)1 << type_ptr->hash_bits) - 1;
+    for (u = H5I_HASH(type_ptr, id); type_ptr->hash[u]; u = (u + 1) & mask)
+        if (type_ptr->hash[u]->id == id)
+            HGOTO_DONE(type_ptr->hash[u])
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I__find_id() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__resize_hash
+ *
+ * Purpose:     Allocate a hash table of 2^HASH_BITS buckets for a type and
+ *              move the type's IDs into it.
+ *
+ *              No error is pushed on failure, since callers shrinking the
+ *              table simply carry on with the old one.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5I__resize_hash(H5I_id_type_t *type_ptr, unsigned hash_bits)
+{
+    H5I_id_info_t **old_hash;           /* Previous hash table */
+    size_t      old_size;               /* # of buckets in previous table */
+    size_t      mask;                   /* New hash table index mask */
+    size_t      u, v;                   /* Hash table indices */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(type_ptr);
+    HDassert(hash_bits >= H5I_MIN_HASH_BITS && hash_bits < (sizeof(size_t) * 8) - 4);
+    HDassert(type_ptr->id_count < ((uint64_t)1 << hash_bits));
+
+    old_hash = type_ptr->hash;
+    old_size = old_hash ? (size_t)1 << type_ptr->hash_bits : 0;
+
+    if(NULL == (type_ptr->hash = (H5I_id_info_t **)H5MM_calloc(((size_t)1 << hash_bits) * sizeof(H5I_id_info_t *)))) {
+        type_ptr->hash = old_hash;
+        HGOTO_DONE(FAIL)
+    } /* end if */
+    type_ptr->hash_bits = hash_bits;
+
+    /* Re-insert the IDs from the previous table */
+    mask = ((size_t)1 << hash_bits) - 1;
+    for(u = 0; u < old_size; u++)
+        if(old_hash[u]) {
+            for(v = H5I_HASH(type_ptr, old_hash[u]->id); type_ptr->hash[v]; v = (v + 1) & mask)
+                ;
+            type_ptr->hash[v] = old_hash[u];
+        } /* end if */
+    old_hash = (H5I_id_info_t **)H5MM_xfree(old_hash);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__resize_hash() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__insert_id
+ *
+ * Purpose:     Add an ID to its type's hash table and to the type's list of
+ *              IDs, which is kept in ID order for iteration.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5I__insert_id(H5I_id_type_t *type_ptr, H5I_id_info_t *id_ptr)
+{
+    H5I_id_info_t *prev_ptr;            /* ID to link the new ID after */
+    size_t      mask;                   /* Hash table index mask */
+    size_t      u;                      /* Hash table index */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(type_ptr);
+    HDassert(type_ptr->hash);
+    HDassert(id_ptr);
+
+    /* Keep the hash table at most 3/4 full */
+    if(((type_ptr->id_count + 1) * 4) > ((uint64_t)3 << type_ptr->hash_bits))
+        if(H5I__resize_hash(type_ptr, type_ptr->hash_bits + 1) < 0)
+            HGOTO_ERROR(H5E_ATOM, H5E_CANTALLOC, FAIL, "unable to grow ID hash table")
+
+    /* Put the ID in the first free bucket from its home bucket on */
+    mask = ((size_t)1 << type_ptr->hash_bits) - 1;
+    for(u = H5I_HASH(type_ptr, id_ptr->id); type_ptr->hash[u]; u = (u + 1) & mask)
+        HDassert(type_ptr->hash[u]->id != id_ptr->id);
+    type_ptr->hash[u] = id_ptr;
+    type_ptr->id_count++;
+
+    /* Link the ID into the list.  IDs are almost always handed out in
+     * increasing order, so this is normally an append.
+     */
+    id_ptr->removed = FALSE;
+    for(prev_ptr = type_ptr->last; prev_ptr && prev_ptr->id > id_ptr->id; prev_ptr = prev_ptr->prev)
+        ;
+    id_ptr->prev = prev_ptr;
+    id_ptr->next = prev_ptr ? prev_ptr->next : type_ptr->first;
+    if(id_ptr->next)
+        id_ptr->next->prev = id_ptr;
+    else
+        type_ptr->last = id_ptr;
+    if(prev_ptr)
+        prev_ptr->next = id_ptr;
+    else
+        type_ptr->first = id_ptr;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__insert_id() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__unhash_id
+ *
+ * Purpose:     Remove an ID from its type's hash table, so that it can no
+ *              longer be found.  The ID stays on the type's list.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5I__unhash_id(H5I_id_type_t *type_ptr, H5I_id_info_t *id_ptr)
+{
+    size_t      mask;                   /* Hash table index mask */
+    size_t      u, v;                   /* Hash table indices */
+    size_t      home;                   /* Home bucket of an entry */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(type_ptr);
+    HDassert(type_ptr->id_count > 0);
+    HDassert(id_ptr);
+
+    /* Locate the ID's bucket */
+    mask = ((size_t)1 << type_ptr->hash_bits) - 1;
+    for(u = H5I_HASH(type_ptr, id_ptr->id); type_ptr->hash[u] != id_ptr; u = (u + 1) & mask)
+        HDassert(type_ptr->hash[u]);
+
+    /* Empty the bucket, then move later entries of the probe run back into
+     * the hole when their home bucket isn't after it, so that lookups can
+     * stop at the first empty bucket.
+     */
+    type_ptr->hash[u] = NULL;
+    for(v = (u + 1) & mask; type_ptr->hash[v]; v = (v + 1) & mask) {
+        home = H5I_HASH(type_ptr, type_ptr->hash[v]->id);
+        if((u <= v) ? (u < home && home <= v) : (u < home || home <= v))
+            continue;
+        type_ptr->hash[u] = type_ptr->hash[v];
+        type_ptr->hash[v] = NULL;
+        u = v;
+    } /* end for */
+    type_ptr->id_count--;
+
+    /* Shrink the hash table once it is less than 1/8 full */
+    if(type_ptr->hash_bits > H5I_MIN_HASH_BITS && (type_ptr->id_count * 8) < ((uint64_t)1 << type_ptr->hash_bits))
+        (void)H5I__resize_hash(type_ptr, type_ptr->hash_bits - 1);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5I__unhash_id() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__unlink_id
+ *
+ * Purpose:     Remove an ID from its type's list of IDs.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5I__unlink_id(H5I_id_type_t *type_ptr, H5I_id_info_t *id_ptr)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(type_ptr);
+    HDassert(id_ptr);
+
+    if(id_ptr->prev)
+        id_ptr->prev->next = id_ptr->next;
+    else
+        type_ptr->first = id_ptr->next;
+    if(id_ptr->next)
+        id_ptr->next->prev = id_ptr->prev;
+    else
+        type_ptr->last = id_ptr->prev;
+    id_ptr->prev = id_ptr->next = NULL;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5I__unlink_id() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Iget_name
@@ -2122,10 +2370,8 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5I__debug_cb(void *_item, void H5_ATTR_UNUSED *_key, void *_udata)
+H5I__debug_cb(H5I_id_info_t *item, H5I_type_t type)
 {
-    H5I_id_info_t   *item = (H5I_id_info_t *)_item;     /* Pointer to the ID node */
-    H5I_type_t      type = *(H5I_type_t *)_udata;       /* User data */
     H5G_name_t      *path = NULL;
 
     FUNC_ENTER_STATIC_NOERR
@@ -2160,6 +2406,7 @@ H5I__debug_cb(void *_item, void H5_ATTR_UNUSED *_key, void *_udata)
         case H5I_ERROR_CLASS:
         case H5I_ERROR_MSG:
         case H5I_ERROR_STACK:
+        case H5I_EVENTSET:
         case H5I_NTYPES:
         default:
             break;   /* Other types of IDs are not stored in files */
@@ -2189,6 +2436,7 @@ static herr_t
 H5I__debug(H5I_type_t type)
 {
     H5I_id_type_t *type_ptr;
+    H5I_id_info_t *id_ptr;
 
     FUNC_ENTER_STATIC_NOERR
 
@@ -2203,7 +2451,9 @@ H5I__debug(H5I_type_t type)
 
     /* List */
     HDfprintf(stderr, "	 List:\n");
-    H5SL_iterate(type_ptr->ids, H5I__debug_cb, &type);
+    for(id_ptr = type_ptr->first; id_ptr; id_ptr = id_ptr->next)
+        if(!id_ptr->removed)
+            H5I__debug_cb(id_ptr, type);
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5I__debug() */
@@ -112,6 +112,9 @@ static herr_t H5L_link_cb(H5G_loc_t *grp_loc/*in*/, const char *name,
 static herr_t H5L_create_real(const H5G_loc_t *link_loc, const char *link_name,
     H5G_name_t *obj_path, H5F_t *obj_file, H5O_link_t *lnk, H5O_obj_create_t *ocrt_info,
     hid_t lcpl_id, hid_t lapl_id, hid_t dxpl_id);
+static herr_t H5L_create_many(const H5G_loc_t *grp_loc, size_t count,
+    const char *link_names[], const H5G_loc_t *obj_locs, hid_t lcpl_id,
+    hid_t dxpl_id);
 static herr_t H5L_get_val_real(const H5O_link_t *lnk, void *buf, size_t size);
 static herr_t H5L_get_val_cb(H5G_loc_t *grp_loc/*in*/, const char *name,
     const H5O_link_t *lnk, H5G_loc_t *obj_loc, void *_udata/*in,out*/,
@@ -512,6 +515,75 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Lcreate_hard() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Lcreate_many
+ *
+ * Purpose:	Creates COUNT hard links in the group GROUP_ID (a group or
+ *		file ID), named LINK_NAMES[i] and pointing to the objects
+ *		OBJ_IDS[i].
+ *
+ *		This is meant for building large groups, typically from
+ *		objects created with H5Dcreate_anon() and friends: the group
+ *		is located once and each link is inserted directly, without
+ *		traversing a path for it.  Each name must be a single path
+ *		component and the names must be sorted in strictly increasing
+ *		order (as by strcmp()).  No link is created if a name is
+ *		invalid or already exists in the group.
+ *
+ *		Objects that don't have a name yet take their link's path
+ *		as their name, as with H5Olink().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Lcreate_many(hid_t group_id, size_t count, const char *link_names[],
+    const hid_t obj_ids[], hid_t lcpl_id, hid_t lapl_id)
+{
+    H5G_loc_t	grp_loc;                /* Location of group to create links in */
+    H5G_loc_t   *obj_locs = NULL;       /* Locations of objects to link to */
+    hid_t       dxpl_id = H5AC_ind_read_dxpl_id;         /* dxpl used by library */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE6("e", "iz**s*iii", group_id, count, link_names, obj_ids, lcpl_id,
+             lapl_id);
+
+    /* Check arguments */
+    if(H5G_loc(group_id, &grp_loc) < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a location")
+    if(count > 0 && (!link_names || !obj_ids))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no link names or objects specified")
+    if(lcpl_id != H5P_DEFAULT && (TRUE != H5P_isa_class(lcpl_id, H5P_LINK_CREATE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a link creation property list")
+
+    /* Verify access property list and get correct dxpl */
+    if(H5P_verify_apl_and_dxpl(&lapl_id, H5P_CLS_LACC, &dxpl_id, group_id, TRUE) < 0)
+        HGOTO_ERROR(H5E_LINK, H5E_CANTSET, FAIL, "can't set access and transfer property lists")
+
+    /* Get the objects' locations */
+    if(count > 0 && NULL == (obj_locs = (H5G_loc_t *)H5MM_malloc(count * sizeof(H5G_loc_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for object locations")
+    for(u = 0; u < count; u++) {
+        if(!link_names[u] || !*link_names[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no link name specified")
+        if(H5G_loc(obj_ids[u], &obj_locs[u]) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a location")
+    } /* end for */
+
+    /* Create the links */
+    if(H5L_create_many(&grp_loc, count, link_names, obj_locs, lcpl_id, dxpl_id) < 0)
+        HGOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "unable to create links")
+
+done:
+    H5MM_xfree(obj_locs);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Lcreate_many() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5Lcreate_ud
@@ -1966,6 +2038,90 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5L_create_hard() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5L_create_many
+ *
+ * Purpose:	Creates a batch of hard links in the group at GRP_LOC.  See
+ *		H5Lcreate_many() for details.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5L_create_many(const H5G_loc_t *grp_loc, size_t count,
+    const char *link_names[], const H5G_loc_t *obj_locs, hid_t lcpl_id,
+    hid_t dxpl_id)
+{
+    H5O_link_t *lnks = NULL;            /* Links to insert */
+    H5T_cset_t cset = H5F_DEFAULT_CSET; /* Character encoding for links */
+    H5O_type_t obj_type;                /* Type of group location's object */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Check args */
+    HDassert(grp_loc);
+    HDassert(link_names || count == 0);
+    HDassert(obj_locs || count == 0);
+
+    /* Links can only be created in a group */
+    if(H5O_obj_type(grp_loc->oloc, &obj_type, dxpl_id) < 0)
+        HGOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get object type")
+    if(obj_type != H5O_TYPE_GROUP)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a group")
+
+    /* Get character encoding property */
+    if(lcpl_id != H5P_DEFAULT) {
+        H5P_genplist_t *lc_plist;       /* Link creation property list */
+
+        if(NULL == (lc_plist = (H5P_genplist_t *)H5I_object(lcpl_id)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a property list")
+        if(H5P_get(lc_plist, H5P_STRCRT_CHAR_ENCODING_NAME, &cset) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get property value for character encoding")
+    } /* end if */
+
+    if(count == 0)
+        HGOTO_DONE(SUCCEED)
+
+    /* Construct the links */
+    if(NULL == (lnks = (H5O_link_t *)H5MM_malloc(count * sizeof(H5O_link_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for links")
+    for(u = 0; u < count; u++) {
+        if(HDstrchr(link_names[u], '/') || !HDstrcmp(link_names[u], "."))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "link name is not a single path component")
+
+        /* Check that both objects are in same file */
+        if(!H5F_SAME_SHARED(grp_loc->oloc->file, obj_locs[u].oloc->file))
+            HGOTO_ERROR(H5E_SYM, H5E_BADVALUE, FAIL, "interfile hard links are not allowed")
+
+        lnks[u].type = H5L_TYPE_HARD;
+        lnks[u].corder = 0;             /* Will be re-written during group insertion, if the group is tracking creation order */
+        lnks[u].corder_valid = FALSE;
+        lnks[u].cset = cset;
+        /* Casting away const OK -QAK */
+        lnks[u].name = (char *)link_names[u];
+        lnks[u].u.hard.addr = obj_locs[u].oloc->addr;
+    } /* end for */
+
+    /* Insert the links into the group */
+    if(H5G_obj_insert_many(grp_loc->oloc, count, lnks, dxpl_id) < 0)
+        HGOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "unable to insert links")
+
+    /* Set the paths of objects that don't have one yet */
+    for(u = 0; u < count; u++)
+        if(obj_locs[u].path->user_path_r == NULL)
+            if(H5G_name_set(grp_loc->path, obj_locs[u].path, link_names[u]) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "cannot set name")
+
+done:
+    H5MM_xfree(lnks);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5L_create_many() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5L_create_soft
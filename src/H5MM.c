@@ -46,6 +46,13 @@
 #define H5MM_BLOCK_FROM_BUF(mem) ((H5MM_block_t *)((unsigned char *)mem - (offsetof(H5MM_block_t, b) + H5MM_HEAD_GUARD_SIZE)))
 #endif /* H5_MEMORY_ALLOC_SANITY_CHECK */
 
+/* A polled component is only asked to reclaim memory once it holds at
+ * least this fraction (1/N) of the budget, so that a cache checking the
+ * budget for each entry it adds doesn't run e.g. a full free list garbage
+ * collection every time.
+ */
+#define H5MM_BUDGET_RECLAIM_DIVISOR     16
+
 
 /******************/
 /* Local Typedefs */
@@ -69,6 +76,12 @@ typedef struct H5MM_block_t {
 } H5MM_block_t;
 #endif /* H5_MEMORY_ALLOC_SANITY_CHECK */
 
+/* Memory budget component whose usage is polled rather than counted */
+typedef struct H5MM_budget_poll_t {
+    H5MM_budget_usage_func_t usage;     /* Report the bytes in use */
+    H5MM_budget_reclaim_func_t reclaim; /* Release memory when over budget */
+} H5MM_budget_poll_t;
+
 
 /********************/
 /* Local Prototypes */
@@ -116,6 +129,14 @@ static size_t H5MM_curr_alloc_blocks_count_s = 0;
 static size_t H5MM_peak_alloc_blocks_count_s = 0;
 #endif /* H5_MEMORY_ALLOC_SANITY_CHECK */
 
+/* Library-wide memory budget (0 means no limit) and per-component usage */
+static size_t H5MM_budget_limit_s = 0;
+static size_t H5MM_budget_usage_s[H5_MEM_NCOMPONENTS];
+static H5MM_budget_poll_t H5MM_budget_poll_s[H5_MEM_NCOMPONENTS];
+
+/* Flag to avoid recursing while reclaiming memory */
+static hbool_t H5MM_budget_reclaiming_s = FALSE;
+
 
 #if defined H5_MEMORY_ALLOC_SANITY_CHECK
 
@@ -564,3 +585,270 @@ H5MM_xfree(void *mem)
     FUNC_LEAVE_NOAPI(NULL)
 } /* end H5MM_xfree() */
 
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MM_budget_set_limit
+ *
+ * Purpose:     Set the library-wide memory budget that the caches, the
+ *              metadata accumulator, sieve buffers and free lists are
+ *              measured against.  A limit of 0 removes the budget.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5MM_budget_set_limit(size_t limit)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    H5MM_budget_limit_s = limit;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5MM_budget_set_limit() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MM_budget_get_limit
+ *
+ * Purpose:     Retrieve the library-wide memory budget.
+ *
+ * Return:      The limit in bytes, or 0 when there is none
+ *
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5MM_budget_get_limit(void)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(H5MM_budget_limit_s)
+} /* end H5MM_budget_get_limit() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MM_budget_add
+ *
+ * Purpose:     Charge SIZE bytes held by component COMP to the budget.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5MM_budget_add(H5_mem_component_t comp, size_t size)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(comp >= 0 && comp < H5_MEM_NCOMPONENTS);
+
+    H5MM_budget_usage_s[comp] += size;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5MM_budget_add() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MM_budget_sub
+ *
+ * Purpose:     Return SIZE bytes released by component COMP to the
+ *              budget.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5MM_budget_sub(H5_mem_component_t comp, size_t size)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(comp >= 0 && comp < H5_MEM_NCOMPONENTS);
+    HDassert(H5MM_budget_usage_s[comp] >= size);
+
+    H5MM_budget_usage_s[comp] -= size;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5MM_budget_sub() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MM_budget_register
+ *
+ * Purpose:     Register a component whose usage is polled when the
+ *              budget is checked instead of being counted with
+ *              H5MM_budget_add/sub.  RECLAIM, if not NULL, is called to
+ *              release memory when the budget is exceeded.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5MM_budget_register(H5_mem_component_t comp, H5MM_budget_usage_func_t usage,
+    H5MM_budget_reclaim_func_t reclaim)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if(comp < 0 || comp >= H5_MEM_NCOMPONENTS)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid memory component")
+    if(NULL == usage)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no usage callback")
+
+    H5MM_budget_poll_s[comp].usage = usage;
+    H5MM_budget_poll_s[comp].reclaim = reclaim;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5MM_budget_register() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MM_budget_get_usage
+ *
+ * Purpose:     Retrieve the bytes held by each component of the budget
+ *              into USAGE, which must have H5_MEM_NCOMPONENTS entries, if
+ *              it is not NULL.
+ *
+ * Return:      Total bytes held by all components
+ *
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5MM_budget_get_usage(size_t usage[])
+{
+    unsigned u;                         /* Local index variable */
+    size_t ret_value = 0;               /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    for(u = 0; u < H5_MEM_NCOMPONENTS; u++) {
+        size_t comp_usage = H5MM_budget_usage_s[u];
+
+        if(H5MM_budget_poll_s[u].usage)
+            comp_usage += (H5MM_budget_poll_s[u].usage)();
+        if(usage)
+            usage[u] = comp_usage;
+        ret_value += comp_usage;
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5MM_budget_get_usage() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MM_budget_exceeded
+ *
+ * Purpose:     Check whether holding EXTRA more bytes would take the
+ *              library over its memory budget.  When it would, memory is
+ *              first reclaimed from the polled components that hold enough
+ *              to be worth it (e.g. the free lists are garbage collected)
+ *              and the budget rechecked, so callers only need to shrink
+ *              their own caches when that was not enough.
+ *
+ * Return:      TRUE if over budget, FALSE otherwise (or when there is no
+ *              limit)
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5MM_budget_exceeded(size_t extra)
+{
+    hbool_t ret_value = FALSE;          /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(H5MM_budget_limit_s > 0) {
+        ret_value = (H5MM_budget_get_usage(NULL) + extra) > H5MM_budget_limit_s;
+
+        if(ret_value && !H5MM_budget_reclaiming_s) {
+            hbool_t reclaimed = FALSE;
+            unsigned u;
+
+            H5MM_budget_reclaiming_s = TRUE;
+            for(u = 0; u < H5_MEM_NCOMPONENTS; u++)
+                if(H5MM_budget_poll_s[u].reclaim) {
+                    size_t comp_usage = (H5MM_budget_poll_s[u].usage)();
+
+                    if(comp_usage > 0 && comp_usage >= H5MM_budget_limit_s / H5MM_BUDGET_RECLAIM_DIVISOR)
+                        if((H5MM_budget_poll_s[u].reclaim)() >= 0)
+                            reclaimed = TRUE;
+                } /* end if */
+            H5MM_budget_reclaiming_s = FALSE;
+
+            if(reclaimed)
+                ret_value = (H5MM_budget_get_usage(NULL) + extra) > H5MM_budget_limit_s;
+        } /* end if */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5MM_budget_exceeded() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MM_budget_overage
+ *
+ * Purpose:     Compute how far the library, holding EXTRA more bytes,
+ *              would be over its memory budget, once the polled components
+ *              have reclaimed what they can (see H5MM_budget_exceeded).
+ *              This is how much a cache has to give back to bring the
+ *              library within its budget, if it holds that much.
+ *
+ * Return:      Bytes over the budget, or 0 when within it (or when there
+ *              is no limit)
+ *
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5MM_budget_overage(size_t extra)
+{
+    size_t ret_value = 0;               /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(H5MM_budget_exceeded(extra))
+        ret_value = (H5MM_budget_get_usage(NULL) + extra) - H5MM_budget_limit_s;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5MM_budget_overage() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MM_budget_excess
+ *
+ * Purpose:     Compute how far component COMP, holding EXTRA more bytes,
+ *              would be over the memory budget on its own.  Memory held
+ *              by other components is not counted, so a cache can use this
+ *              to find how much of its own memory to give back without
+ *              being emptied by usage it can't reduce.
+ *
+ * Return:      Bytes over the budget, or 0 when within it (or when there
+ *              is no limit)
+ *
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5MM_budget_excess(H5_mem_component_t comp, size_t extra)
+{
+    size_t comp_usage;                  /* Bytes held by component */
+    size_t ret_value = 0;               /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(comp >= 0 && comp < H5_MEM_NCOMPONENTS);
+
+    if(H5MM_budget_limit_s > 0) {
+        comp_usage = H5MM_budget_usage_s[comp] + extra;
+        if(H5MM_budget_poll_s[comp].usage)
+            comp_usage += (H5MM_budget_poll_s[comp].usage)();
+        if(comp_usage > H5MM_budget_limit_s)
+            ret_value = comp_usage - H5MM_budget_limit_s;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5MM_budget_excess() */
@@ -36,6 +36,10 @@
 #define H5MM_free(Z)	HDfree(Z)
 #endif /* H5_MEMORY_ALLOC_SANITY_CHECK */
 
+/* Callbacks for memory budget components whose usage is polled */
+typedef size_t (*H5MM_budget_usage_func_t)(void);
+typedef herr_t (*H5MM_budget_reclaim_func_t)(void);
+
 /*
  * Library prototypes...
  */
@@ -45,6 +49,18 @@ H5_DLL void *H5MM_realloc(void *mem, size_t size);
 H5_DLL char *H5MM_xstrdup(const char *s);
 H5_DLL char *H5MM_strdup(const char *s);
 H5_DLL void *H5MM_xfree(void *mem);
+
+/* Library-wide memory budget */
+H5_DLL void H5MM_budget_set_limit(size_t limit);
+H5_DLL size_t H5MM_budget_get_limit(void);
+H5_DLL void H5MM_budget_add(H5_mem_component_t comp, size_t size);
+H5_DLL void H5MM_budget_sub(H5_mem_component_t comp, size_t size);
+H5_DLL herr_t H5MM_budget_register(H5_mem_component_t comp,
+    H5MM_budget_usage_func_t usage, H5MM_budget_reclaim_func_t reclaim);
+H5_DLL size_t H5MM_budget_get_usage(size_t usage[]);
+H5_DLL hbool_t H5MM_budget_exceeded(size_t extra);
+H5_DLL size_t H5MM_budget_overage(size_t extra);
+H5_DLL size_t H5MM_budget_excess(H5_mem_component_t comp, size_t extra);
 #if defined H5_MEMORY_ALLOC_SANITY_CHECK
 H5_DLL void H5MM_sanity_check_all(void);
 H5_DLL void H5MM_final_sanity_check(void);
@@ -1314,6 +1314,9 @@ H5O_alloc(H5F_t *f, hid_t dxpl_id, H5O_t *oh, const H5O_msg_class_t *type,
         HGOTO_ERROR(H5E_OHDR, H5E_CANTINIT, FAIL, "object header message is too large")
     aligned_size = H5O_ALIGN_OH(oh, raw_size);
 
+    /* Messages may be added or moved around, drop the message indices */
+    H5O__msg_index_reset(oh);
+
     /* Find the smallest null message that could hold the new object header message */
     idx = oh->nmesgs;
     if(H5O__alloc_find_best_null(oh, aligned_size, &idx) < 0)
@@ -1401,6 +1404,9 @@ H5O_release_mesg(H5F_t *f, hid_t dxpl_id, H5O_t *oh, H5O_mesg_t *mesg,
     if(NULL == (chk_proxy = H5O_chunk_protect(f, dxpl_id, oh, mesg->chunkno)))
 	HGOTO_ERROR(H5E_OHDR, H5E_CANTPROTECT, FAIL, "unable to protect object header chunk")
 
+    /* Drop the message indices, they may refer to this message */
+    H5O__msg_index_reset(oh);
+
     /* Free any native information */
     H5O_msg_free_mesg(mesg);
 
@@ -2306,6 +2312,9 @@ H5O_condense_header(H5F_t *f, H5O_t *oh, hid_t dxpl_id)
     /* check args */
     HDassert(oh != NULL);
 
+    /* Messages may be moved around, drop the message indices */
+    H5O__msg_index_reset(oh);
+
     /* Loop until no changed to the object header messages & chunks */
     do {
         /* Reset 'rescan chunks' flag */
@@ -552,6 +552,123 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value, NULL)
 } /* end H5O_attr_open_by_name() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5O_attr_read_multi
+ *
+ * Purpose:	Read the values of several attributes of an object at once.
+ *		The attributes are gathered in a single pass over the
+ *		object's attribute storage (protecting the object header
+ *		once), then each requested value is converted into its
+ *		buffer.  If NAMES is NULL, all COUNT attributes of the
+ *		object are read, in increasing name order.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5O_attr_read_multi(const H5O_loc_t *loc, size_t count, const char *names[],
+    const H5T_t *mem_types[], void *bufs[], hid_t dxpl_id)
+{
+    H5O_t *oh = NULL;                   /* Pointer to actual object header */
+    H5O_ainfo_t ainfo;                  /* Attribute information for object */
+    H5A_attr_table_t atable = {0, NULL};        /* Table of attributes */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_TAG(dxpl_id, loc->addr, FAIL)
+
+    /* Check arguments */
+    HDassert(loc);
+    HDassert(loc->file);
+    HDassert(H5F_addr_defined(loc->addr));
+    HDassert(mem_types || count == 0);
+    HDassert(bufs || count == 0);
+
+    /* Protect the object header to read from */
+    if(NULL == (oh = H5O_protect(loc, dxpl_id, H5AC__READ_ONLY_FLAG, FALSE)))
+	HGOTO_ERROR(H5E_ATTR, H5E_CANTPROTECT, FAIL, "unable to load object header")
+
+    /* Check for attribute info stored */
+    ainfo.fheap_addr = HADDR_UNDEF;
+    if(oh->version > H5O_VERSION_1) {
+        /* Check for (& retrieve if available) attribute info */
+        if(H5A_get_ainfo(loc->file, dxpl_id, oh, &ainfo) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't check for attribute info message")
+    } /* end if */
+
+    /* Build table of the attributes, sorted by name */
+    if(H5F_addr_defined(ainfo.fheap_addr)) {
+        /* Release the object header */
+        if(H5O_unprotect(loc, dxpl_id, oh, H5AC__NO_FLAGS_SET) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTUNPROTECT, FAIL, "unable to release object header")
+        oh = NULL;
+
+        if(H5A_dense_build_table(loc->file, dxpl_id, &ainfo, H5_INDEX_NAME, H5_ITER_INC, &atable) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "error building attribute table")
+    } /* end if */
+    else {
+        if(H5A_compact_build_table(loc->file, dxpl_id, oh, H5_INDEX_NAME, H5_ITER_INC, &atable) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "error building attribute table")
+
+        /* Release the object header */
+        if(H5O_unprotect(loc, dxpl_id, oh, H5AC__NO_FLAGS_SET) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTUNPROTECT, FAIL, "unable to release object header")
+        oh = NULL;
+    } /* end else */
+
+    /* When reading all attributes, the caller must have a buffer for each */
+    if(NULL == names && count != atable.nattrs)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "count doesn't match number of attributes")
+
+    /* Read each attribute */
+    for(u = 0; u < count; u++) {
+        H5A_t *attr;                    /* Attribute to read */
+
+        if(names) {
+            size_t lo = 0, hi = atable.nattrs;  /* Bounds of binary search */
+            int cmp = -1;               /* Comparison value */
+
+            /* Find the attribute in the (sorted) table */
+            attr = NULL;
+            while(lo < hi) {
+                size_t mid = (lo + hi) / 2;
+
+                if(0 == (cmp = HDstrcmp(names[u], atable.attrs[mid]->shared->name))) {
+                    attr = atable.attrs[mid];
+                    break;
+                } /* end if */
+                if(cmp < 0)
+                    hi = mid;
+                else
+                    lo = mid + 1;
+            } /* end while */
+            if(NULL == attr)
+                HGOTO_ERROR(H5E_ATTR, H5E_NOTFOUND, FAIL, "can't locate attribute: '%s'", names[u])
+        } /* end if */
+        else
+            attr = atable.attrs[u];
+
+        /* Mark datatype as being on disk now */
+        if(H5T_set_loc(attr->shared->dt, loc->file, H5T_LOC_DISK) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "invalid datatype location")
+
+        /* Convert the attribute's value into the caller's buffer */
+        if(H5A__read(attr, mem_types[u], bufs[u], dxpl_id) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_READERROR, FAIL, "unable to read attribute")
+    } /* end for */
+
+done:
+    /* Release resources */
+    if(oh && H5O_unprotect(loc, dxpl_id, oh, H5AC__NO_FLAGS_SET) < 0)
+        HDONE_ERROR(H5E_ATTR, H5E_CANTUNPROTECT, FAIL, "unable to release object header")
+    if(atable.attrs && H5A_attr_release_table(&atable) < 0)
+        HDONE_ERROR(H5E_ATTR, H5E_CANTFREE, FAIL, "unable to release attribute table")
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
+} /* end H5O_attr_read_multi() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5O_attr_open_by_idx_cb
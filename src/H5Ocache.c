@@ -67,6 +67,9 @@ static htri_t H5O__cache_verify_chksum(const void *image_ptr, size_t len, void *
 static void *H5O__cache_deserialize(const void *image, size_t len,
     void *udata, hbool_t *dirty); 
 static herr_t H5O__cache_image_len(const void *thing, size_t *image_len);
+static herr_t H5O__cache_pre_serialize(H5F_t *f, hid_t dxpl_id, void *thing,
+    haddr_t addr, size_t len, haddr_t *new_addr, size_t *new_len,
+    unsigned *flags);
 static herr_t H5O__cache_serialize(const H5F_t *f, void *image, size_t len,
     void *thing); 
 static herr_t H5O__cache_notify(H5AC_notify_action_t action, void *_thing);
@@ -77,6 +80,9 @@ static htri_t H5O__cache_chk_verify_chksum(const void *image_ptr, size_t len, vo
 static void *H5O__cache_chk_deserialize(const void *image, size_t len,
     void *udata, hbool_t *dirty); 
 static herr_t H5O__cache_chk_image_len(const void *thing, size_t *image_len);
+static herr_t H5O__cache_chk_pre_serialize(H5F_t *f, hid_t dxpl_id,
+    void *thing, haddr_t addr, size_t len, haddr_t *new_addr, size_t *new_len,
+    unsigned *flags);
 static herr_t H5O__cache_chk_serialize(const H5F_t *f, void *image, size_t len,
     void *thing);
 static herr_t H5O__cache_chk_notify(H5AC_notify_action_t action, void *_thing);
@@ -89,6 +95,7 @@ static herr_t H5O__prefix_deserialize(const uint8_t *image,
 /* Chunk routines */
 static herr_t H5O__chunk_deserialize(H5O_t *oh, haddr_t addr, size_t len,
     const uint8_t *image, H5O_common_cache_ud_t *udata, hbool_t *dirty);
+static herr_t H5O__chunk_flush_msgs(H5F_t *f, H5O_t *oh, unsigned chunkno);
 static herr_t H5O__chunk_serialize(const H5F_t *f, H5O_t *oh, unsigned chunkno);
 
 /* Misc. routines */
@@ -105,13 +112,13 @@ const H5AC_class_t H5AC_OHDR[1] = {{
     H5AC_OHDR_ID,                       /* Metadata client ID */
     "object header",                    /* Metadata client name (for debugging) */
     H5FD_MEM_OHDR,                      /* File space memory type for client */
-    H5AC__CLASS_SPECULATIVE_LOAD_FLAG,  /* Client class behavior flags */
+    H5AC__CLASS_SPECULATIVE_LOAD_FLAG | H5AC__CLASS_PARALLEL_SERIALIZE_FLAG, /* Client class behavior flags */
     H5O__cache_get_initial_load_size,   /* 'get_initial_load_size' callback */
     H5O__cache_get_final_load_size,     /* 'get_final_load_size' callback */
     H5O__cache_verify_chksum, 		/* 'verify_chksum' callback */
     H5O__cache_deserialize,             /* 'deserialize' callback */
     H5O__cache_image_len,               /* 'image_len' callback */
-    NULL,                               /* 'pre_serialize' callback */
+    H5O__cache_pre_serialize,           /* 'pre_serialize' callback */
     H5O__cache_serialize,               /* 'serialize' callback */
     H5O__cache_notify,                  /* 'notify' callback */
     H5O__cache_free_icr,                /* 'free_icr' callback */
@@ -123,13 +130,13 @@ const H5AC_class_t H5AC_OHDR_CHK[1] = {{
     H5AC_OHDR_CHK_ID,                   /* Metadata client ID */
     "object header continuation chunk", /* Metadata client name (for debugging) */
     H5FD_MEM_OHDR,                      /* File space memory type for client */
-    H5AC__CLASS_NO_FLAGS_SET,           /* Client class behavior flags */
+    H5AC__CLASS_PARALLEL_SERIALIZE_FLAG, /* Client class behavior flags */
     H5O__cache_chk_get_initial_load_size, /* 'get_initial_load_size' callback */
     NULL,				/* 'get_final_load_size' callback */
     H5O__cache_chk_verify_chksum,	/* 'verify_chksum' callback */
     H5O__cache_chk_deserialize,         /* 'deserialize' callback */
     H5O__cache_chk_image_len,           /* 'image_len' callback */
-    NULL,                               /* 'pre_serialize' callback */
+    H5O__cache_chk_pre_serialize,       /* 'pre_serialize' callback */
     H5O__cache_chk_serialize,           /* 'serialize' callback */
     H5O__cache_chk_notify,              /* 'notify' callback */
     H5O__cache_chk_free_icr,            /* 'free_icr' callback */
@@ -395,6 +402,51 @@ H5O__cache_image_len(const void *_thing, size_t *image_len)
 } /* end H5O__cache_image_len() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5O__cache_pre_serialize
+ *
+ * Purpose:	Encode the dirty messages in the first chunk of the object
+ *		header, so that the serialize callback only has to fill in
+ *		the prefix and checksum.  Encoding a message may touch the
+ *		metadata cache (e.g. a virtual dataset's layout message
+ *		inserts its mappings into the global heap), which the
+ *		serialize callback must not do.
+ *
+ * Return:      Success:        SUCCEED
+ *              Failure:        FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__cache_pre_serialize(H5F_t *f, hid_t H5_ATTR_UNUSED dxpl_id, void *_thing,
+    haddr_t H5_ATTR_UNUSED addr, size_t H5_ATTR_UNUSED len,
+    haddr_t H5_ATTR_UNUSED *new_addr, size_t H5_ATTR_UNUSED *new_len,
+    unsigned *flags)
+{
+    H5O_t      *oh = (H5O_t *)_thing;   /* Object header to encode */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check arguments */
+    HDassert(f);
+    HDassert(oh);
+    HDassert(oh->cache_info.magic == H5C__H5C_CACHE_ENTRY_T_MAGIC);
+    HDassert(oh->cache_info.type == H5AC_OHDR);
+    HDassert(oh->chunk[0].size == len);
+    HDassert(flags);
+
+    /* Encode the dirty messages in the first chunk */
+    if(H5O__chunk_flush_msgs(f, oh, (unsigned)0) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTENCODE, FAIL, "unable to encode messages in first object header chunk")
+
+    *flags = H5C__SERIALIZE_NO_FLAGS_SET;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__cache_pre_serialize() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5O__cache_serialize
  *
@@ -849,6 +901,49 @@ H5O__cache_chk_image_len(const void *_thing, size_t *image_len)
 } /* end H5O__cache_chk_image_len() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5O__cache_chk_pre_serialize
+ *
+ * Purpose:	Encode the dirty messages in an object header continuation
+ *		chunk, as H5O__cache_pre_serialize() does for the first
+ *		chunk.
+ *
+ * Return:      Success:        SUCCEED
+ *              Failure:        FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__cache_chk_pre_serialize(H5F_t *f, hid_t H5_ATTR_UNUSED dxpl_id,
+    void *_thing, haddr_t H5_ATTR_UNUSED addr, size_t H5_ATTR_UNUSED len,
+    haddr_t H5_ATTR_UNUSED *new_addr, size_t H5_ATTR_UNUSED *new_len,
+    unsigned *flags)
+{
+    H5O_chunk_proxy_t * chk_proxy = (H5O_chunk_proxy_t *)_thing;        /* Object header chunk to encode */
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check arguments */
+    HDassert(f);
+    HDassert(chk_proxy);
+    HDassert(chk_proxy->cache_info.magic == H5C__H5C_CACHE_ENTRY_T_MAGIC);
+    HDassert(chk_proxy->cache_info.type == H5AC_OHDR_CHK);
+    HDassert(chk_proxy->oh);
+    HDassert(chk_proxy->oh->chunk[chk_proxy->chunkno].size == len);
+    HDassert(flags);
+
+    /* Encode the dirty messages in this chunk */
+    if(H5O__chunk_flush_msgs(f, chk_proxy->oh, chk_proxy->chunkno) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTENCODE, FAIL, "unable to encode messages in object header continuation chunk")
+
+    *flags = H5C__SERIALIZE_NO_FLAGS_SET;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__cache_chk_pre_serialize() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5O__cache_chk_serialize
  *
@@ -1606,21 +1701,18 @@ done:
 
 
 /*-------------------------------------------------------------------------
- * Function:	H5O__chunk_serialize
+ * Function:	H5O__chunk_flush_msgs
  *
- * Purpose:	Serialize a chunk for an object header
+ * Purpose:	Encode the dirty messages of a chunk of an object header
+ *		into the chunk's image
  *
  * Return:	Success: SUCCEED
  *              Failure: FAIL
  *
- * Programmer:	Quincey Koziol
- *              koziol@hdfgroup.org
- *              July 12, 2008
- *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5O__chunk_serialize(const H5F_t *f, H5O_t *oh, unsigned chunkno)
+H5O__chunk_flush_msgs(H5F_t *f, H5O_t *oh, unsigned chunkno)
 {
     H5O_mesg_t *curr_msg;       /* Pointer to current message being operated on */
     unsigned	u;              /* Local index variable */
@@ -1635,10 +1727,50 @@ H5O__chunk_serialize(const H5F_t *f, H5O_t *oh, unsigned chunkno)
     /* Encode any dirty messages in this chunk */
     for(u = 0, curr_msg = &oh->mesg[0]; u < oh->nmesgs; u++, curr_msg++)
         if(curr_msg->dirty && curr_msg->chunkno == chunkno)
-            /* Casting away const OK -QAK */
-            if(H5O_msg_flush((H5F_t *)f, oh, curr_msg) < 0)
+            if(H5O_msg_flush(f, oh, curr_msg) < 0)
                 HGOTO_ERROR(H5E_OHDR, H5E_CANTENCODE, FAIL, "unable to encode object header message")
 
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5O__chunk_flush_msgs() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5O__chunk_serialize
+ *
+ * Purpose:	Serialize a chunk for an object header, whose messages have
+ *		already been encoded by H5O__chunk_flush_msgs().  Only the
+ *		chunk's own image is modified, so different chunks of a
+ *		header may be serialized concurrently.
+ *
+ * Return:	Success: SUCCEED
+ *              Failure: FAIL
+ *
+ * Programmer:	Quincey Koziol
+ *              koziol@hdfgroup.org
+ *              July 12, 2008
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__chunk_serialize(const H5F_t *f, H5O_t *oh, unsigned chunkno)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Check arguments */
+    HDassert(f);
+    HDassert(oh);
+
+#ifndef NDEBUG
+{
+    unsigned	u;              /* Local index variable */
+
+    /* The messages in this chunk must have been encoded already */
+    for(u = 0; u < oh->nmesgs; u++)
+        HDassert(oh->mesg[u].chunkno != chunkno || !oh->mesg[u].dirty);
+}
+#endif /* NDEBUG */
+
     /* Sanity checks */
     if(oh->version > H5O_VERSION_1)
         /* Make certain the magic # is present */
@@ -1665,7 +1797,6 @@ H5O__chunk_serialize(const H5F_t *f, H5O_t *oh, unsigned chunkno)
         UINT32ENCODE(chunk_image, metadata_chksum);
     } /* end if */
 
-done:
-    FUNC_LEAVE_NOAPI(ret_value)
+    FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5O__chunk_serialize() */
 
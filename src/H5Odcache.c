@@ -0,0 +1,276 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:		H5Odcache.c
+ *
+ * Purpose:		The decoded message cache: a per-file table of decoded
+ *			datatype and dataspace messages, keyed on the message's
+ *			encoded bytes.
+ *
+ *			Many objects in a file usually share a handful of
+ *			datatypes and dataspaces, so decoding a message whose
+ *			bytes match a cached one just copies the cached native
+ *			message instead of parsing the bytes again.  Since the
+ *			native form only depends on the bytes (and the file's
+ *			address & length sizes), entries never go stale and
+ *			the cache is always on.  The table is direct-mapped,
+ *			with one entry per slot, so a new entry simply replaces
+ *			whatever hashed to the same slot.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5Omodule.h"          /* This source code file is part of the H5O module */
+
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5Fprivate.h"		/* File access				*/
+#include "H5FLprivate.h"	/* Free Lists                           */
+#include "H5MMprivate.h"	/* Memory management			*/
+#include "H5Opkg.h"             /* Object headers			*/
+
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Number of slots in a file's decoded message cache (a power of two) */
+#define H5O_DCACHE_NSLOTS       64
+
+/* Map a message hash to a slot in the cache */
+#define H5O_DCACHE_SLOT(HASH)   ((size_t)((HASH) & (H5O_DCACHE_NSLOTS - 1)))
+
+/* Whether a message can be cached */
+#define H5O_DCACHE_CACHEABLE(TYPE, MESG_FLAGS)                                \
+    (((TYPE)->id == H5O_DTYPE_ID || (TYPE)->id == H5O_SDSPACE_ID)             \
+        && !((MESG_FLAGS) & H5O_MSG_FLAG_SHARED))
+
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* An entry in the decoded message cache */
+typedef struct H5O_dcache_ent_t {
+    const H5O_msg_class_t *type;        /* Class of the message */
+    uint32_t    hash;                   /* Hash of the encoded message */
+    size_t      size;                   /* Size of the encoded message */
+    uint8_t     *raw;                   /* Copy of the encoded message */
+    void        *native;                /* The decoded message */
+} H5O_dcache_ent_t;
+
+/* The decoded message cache for a file */
+struct H5O_dcache_t {
+    H5O_dcache_ent_t *slot[H5O_DCACHE_NSLOTS];  /* The slots */
+};
+
+
+/********************/
+/* Package Typedefs */
+/********************/
+
+
+/********************/
+/* Local Prototypes */
+/********************/
+static void H5O__dcache_free_ent(H5O_dcache_ent_t *ent);
+
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Declare free lists to manage the cache & its entries */
+H5FL_DEFINE_STATIC(H5O_dcache_t);
+H5FL_DEFINE_STATIC(H5O_dcache_ent_t);
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5O__dcache_free_ent
+ *
+ * Purpose:	Release an entry of the cache.
+ *
+ * Return:	None
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5O__dcache_free_ent(H5O_dcache_ent_t *ent)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(ent);
+
+    if(ent->native)
+        ent->native = H5O_msg_free_real(ent->type, ent->native);
+    ent->raw = (uint8_t *)H5MM_xfree(ent->raw);
+    ent = H5FL_FREE(H5O_dcache_ent_t, ent);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5O__dcache_free_ent() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5O__dcache_decode
+ *
+ * Purpose:	Decode the SIZE bytes of an encoded message at P, like the
+ *              message class's 'decode' callback.  Datatype and dataspace
+ *              messages stored in the object header are looked up in the
+ *              file's decoded message cache first, and a copy of the
+ *              cached message is returned if the bytes match.  Otherwise
+ *              the message is decoded and, if decoding it didn't need to
+ *              modify it, a copy is added to the cache.
+ *
+ * Return:	Success:	Pointer to the native message
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+void *
+H5O__dcache_decode(H5F_t *f, hid_t dxpl_id, H5O_t *open_oh,
+    const H5O_msg_class_t *type, unsigned mesg_flags, unsigned *ioflags,
+    const uint8_t *p, size_t size)
+{
+    H5O_dcache_t *dcache;               /* File's decoded message cache */
+    H5O_dcache_ent_t *cached;           /* Cached entry in message's slot */
+    H5O_dcache_ent_t *ent = NULL;       /* New cache entry for message */
+    void *native = NULL;                /* Decoded message */
+    unsigned orig_ioflags;              /* I/O flags before decoding */
+    uint32_t hash;                      /* Hash of encoded message */
+    size_t u;                           /* Slot for message */
+    void *ret_value = NULL;             /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments */
+    HDassert(f);
+    HDassert(type && type->decode);
+    HDassert(ioflags);
+    HDassert(p);
+
+    /* Decode messages that can't be cached directly */
+    if(!H5O_DCACHE_CACHEABLE(type, mesg_flags) || 0 == size) {
+        if(NULL == (ret_value = (type->decode)(f, dxpl_id, open_oh, mesg_flags, ioflags, p)))
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTDECODE, NULL, "unable to decode message")
+        HGOTO_DONE(ret_value)
+    } /* end if */
+
+    /* Check for the message in the cache */
+    hash = H5_checksum_lookup3(p, size, (uint32_t)type->id);
+    u = H5O_DCACHE_SLOT(hash);
+    if(NULL != (dcache = H5F_DECODE_CACHE(f)) && NULL != (cached = dcache->slot[u])
+            && cached->type == type && cached->hash == hash && cached->size == size
+            && !HDmemcmp(cached->raw, p, size)) {
+        if(NULL == (ret_value = (type->copy)(cached->native, NULL)))
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTCOPY, NULL, "unable to copy cached message")
+        HGOTO_DONE(ret_value)
+    } /* end if */
+
+    /* Decode the message */
+    orig_ioflags = *ioflags;
+    if(NULL == (native = (type->decode)(f, dxpl_id, open_oh, mesg_flags, ioflags, p)))
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTDECODE, NULL, "unable to decode message")
+
+    /* Don't cache messages that decoding had to change */
+    if(*ioflags != orig_ioflags)
+        HGOTO_DONE(native)
+
+    /* Create the cache, if necessary */
+    if(NULL == dcache) {
+        if(NULL == (dcache = H5FL_CALLOC(H5O_dcache_t)))
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTALLOC, NULL, "can't allocate decoded message cache")
+        H5F_SET_DECODE_CACHE(f, dcache);
+    } /* end if */
+
+    /* Keep a copy of the message & its encoding */
+    if(NULL == (ent = H5FL_CALLOC(H5O_dcache_ent_t)))
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTALLOC, NULL, "can't allocate decoded message cache entry")
+    ent->type = type;
+    ent->hash = hash;
+    ent->size = size;
+    if(NULL == (ent->raw = (uint8_t *)H5MM_malloc(size)))
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTALLOC, NULL, "can't allocate encoded message copy")
+    HDmemcpy(ent->raw, p, size);
+    if(NULL == (ent->native = (type->copy)(native, NULL)))
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTCOPY, NULL, "unable to copy message")
+
+    /* Replace whatever was in the message's slot */
+    if(dcache->slot[u])
+        H5O__dcache_free_ent(dcache->slot[u]);
+    dcache->slot[u] = ent;
+    ent = NULL;
+
+    /* Set return value */
+    ret_value = native;
+
+done:
+    if(ent)
+        H5O__dcache_free_ent(ent);
+    if(NULL == ret_value && native)
+        native = H5O_msg_free_real(type, native);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__dcache_decode() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5O_dcache_dest
+ *
+ * Purpose:	Release a file's decoded message cache, when the file is
+ *              closed.
+ *
+ * Return:	None
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5O_dcache_dest(H5F_t *f)
+{
+    H5O_dcache_t *dcache;               /* File's decoded message cache */
+    size_t u;                           /* Local index variable */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+
+    if(NULL != (dcache = H5F_DECODE_CACHE(f))) {
+        for(u = 0; u < H5O_DCACHE_NSLOTS; u++)
+            if(dcache->slot[u])
+                H5O__dcache_free_ent(dcache->slot[u]);
+        dcache = H5FL_FREE(H5O_dcache_t, dcache);
+        H5F_SET_DECODE_CACHE(f, NULL);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5O_dcache_dest() */
+
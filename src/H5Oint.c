@@ -63,6 +63,7 @@ typedef struct {
     H5SL_t     *visited;        /* Skip list for tracking visited nodes */
     H5O_iterate_t op;           /* Application callback */
     void       *op_data;        /* Application's op data */
+    unsigned    fields;         /* Object info fields to retrieve */
 } H5O_iter_visit_ud_t;
 
 
@@ -79,6 +80,7 @@ static herr_t H5O_delete_oh(H5F_t *f, hid_t dxpl_id, H5O_t *oh);
 static herr_t H5O_obj_type_real(H5O_t *oh, H5O_type_t *obj_type);
 static herr_t H5O_get_hdr_info_real(const H5O_t *oh, H5O_hdr_info_t *hdr);
 static const H5O_obj_class_t *H5O_obj_class_real(H5O_t *oh);
+static int H5O_cmp_addr(const void *_addr1, const void *_addr2);
 
 
 /*********************/
@@ -1386,6 +1388,7 @@ H5O_delete(H5F_t *f, hid_t dxpl_id, haddr_t addr)
     H5O_t *oh = NULL;           /* Object header information */
     H5O_loc_t loc;              /* Object location for object to delete */
     unsigned oh_flags = H5AC__NO_FLAGS_SET; /* Flags for unprotecting object header */
+    H5O_type_t obj_type;        /* Type of object to delete */
     hbool_t corked;
     herr_t ret_value = SUCCEED; /* Return value */
 
@@ -1404,6 +1407,14 @@ H5O_delete(H5F_t *f, hid_t dxpl_id, haddr_t addr)
     if(NULL == (oh = H5O_protect(&loc, dxpl_id, H5AC__NO_FLAGS_SET, FALSE)))
         HGOTO_ERROR(H5E_OHDR, H5E_CANTPROTECT, FAIL, "unable to load object header")
 
+    /* A group's address may be reused once it's deleted, so drop the links
+     *  in the path lookup cache, which are keyed on it
+     */
+    if(H5O_obj_type_real(oh, &obj_type) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "unable to determine object type")
+    if(obj_type == H5O_TYPE_GROUP)
+        H5G_pcache_clear(f);
+
     /* Delete object */
     if(H5O_delete_oh(f, dxpl_id, oh) < 0)
         HGOTO_ERROR(H5E_OHDR, H5E_CANTDELETE, FAIL, "can't delete object from file")
@@ -1676,6 +1687,7 @@ H5O_get_loc(hid_t object_id)
         case H5I_ERROR_CLASS:
         case H5I_ERROR_MSG:
         case H5I_ERROR_STACK:
+        case H5I_EVENTSET:
         case H5I_NTYPES:
         default:
             HGOTO_ERROR(H5E_OHDR, H5E_BADTYPE, NULL, "invalid object type")
@@ -1969,6 +1981,12 @@ H5O_get_hdr_info_real(const H5O_t *oh, H5O_hdr_info_t *hdr)
  *
  * Purpose:	Retrieve the information for an object
  *
+ *              FIELDS selects the parts of the information to retrieve
+ *              (a combination of the H5O_INFO_* flags); the others are
+ *              zeroed.  Only the object header itself is loaded unless
+ *              the attribute count or the index & heap storage sizes
+ *              are requested.
+ *
  * Return:	Success:	Non-negative
  *		Failure:	Negative
  *
@@ -1978,10 +1996,10 @@ H5O_get_hdr_info_real(const H5O_t *oh, H5O_hdr_info_t *hdr)
  *-------------------------------------------------------------------------
  */
 herr_t
-H5O_get_info(const H5O_loc_t *loc, hid_t dxpl_id, hbool_t want_ih_info,
+H5O_get_info(const H5O_loc_t *loc, hid_t dxpl_id, unsigned fields,
     H5O_info_t *oinfo)
 {
-    const H5O_obj_class_t *obj_class;   /* Class of object for header */
+    const H5O_obj_class_t *obj_class = NULL;    /* Class of object for header */
     H5O_t *oh = NULL;                   /* Object header */
     herr_t ret_value = SUCCEED;         /* Return value */
 
@@ -1998,84 +2016,99 @@ H5O_get_info(const H5O_loc_t *loc, hid_t dxpl_id, hbool_t want_ih_info,
     /* Reset the object info structure */
     HDmemset(oinfo, 0, sizeof(*oinfo));
 
-    /* Retrieve the file's fileno */
-    H5F_GET_FILENO(loc->file, oinfo->fileno);
-
-    /* Set the object's address */
-    oinfo->addr = loc->addr;
-
-    /* Get class for object */
-    if(NULL == (obj_class = H5O_obj_class_real(oh)))
-        HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "unable to determine object class")
+    /* Get the information for the object's class & links */
+    if(fields & (H5O_INFO_BASIC | H5O_INFO_META_SIZE)) {
+        /* Get class for object */
+        if(NULL == (obj_class = H5O_obj_class_real(oh)))
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "unable to determine object class")
+    } /* end if */
+    if(fields & H5O_INFO_BASIC) {
+        /* Retrieve the file's fileno */
+        H5F_GET_FILENO(loc->file, oinfo->fileno);
 
-    /* Retrieve the type of the object */
-    oinfo->type = obj_class->type;
+        /* Set the object's address */
+        oinfo->addr = loc->addr;
 
-    /* Set the object's reference count */
-    oinfo->rc = oh->nlink;
+        /* Retrieve the type of the object */
+        oinfo->type = obj_class->type;
 
-    /* Get modification time for object */
-    if(oh->version > H5O_VERSION_1) {
-        oinfo->atime = oh->atime;
-        oinfo->mtime = oh->mtime;
-        oinfo->ctime = oh->ctime;
-        oinfo->btime = oh->btime;
+        /* Set the object's reference count */
+        oinfo->rc = oh->nlink;
     } /* end if */
-    else {
-        htri_t	exists;                 /* Flag if header message of interest exists */
 
-        /* No information for access & modification fields */
-        /* (we stopped updating the "modification time" header message for
-         *      raw data changes, so the "modification time" header message
-         *      is closest to the 'change time', in POSIX terms - QAK)
-         */
-        oinfo->atime = 0;
-        oinfo->mtime = 0;
-        oinfo->btime = 0;
-
-        /* Might be information for modification time */
-        if((exists = H5O_msg_exists_oh(oh, H5O_MTIME_ID)) < 0)
-            HGOTO_ERROR(H5E_OHDR, H5E_NOTFOUND, FAIL, "unable to check for MTIME message")
-        if(exists > 0) {
-            /* Get "old style" modification time info */
-            if(NULL == H5O_msg_read_oh(loc->file, dxpl_id, oh, H5O_MTIME_ID, &oinfo->ctime))
-                HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "can't read MTIME message")
+    /* Get modification time for object, if requested */
+    if(fields & H5O_INFO_TIME) {
+        if(oh->version > H5O_VERSION_1) {
+            oinfo->atime = oh->atime;
+            oinfo->mtime = oh->mtime;
+            oinfo->ctime = oh->ctime;
+            oinfo->btime = oh->btime;
         } /* end if */
         else {
-            /* Check for "new style" modification time info */
-            if((exists = H5O_msg_exists_oh(oh, H5O_MTIME_NEW_ID)) < 0)
-                HGOTO_ERROR(H5E_OHDR, H5E_NOTFOUND, FAIL, "unable to check for MTIME_NEW message")
+            htri_t	exists;                 /* Flag if header message of interest exists */
+
+            /* No information for access & modification fields */
+            /* (we stopped updating the "modification time" header message for
+             *      raw data changes, so the "modification time" header message
+             *      is closest to the 'change time', in POSIX terms - QAK)
+             */
+            oinfo->atime = 0;
+            oinfo->mtime = 0;
+            oinfo->btime = 0;
+
+            /* Might be information for modification time */
+            if((exists = H5O_msg_exists_oh(oh, H5O_MTIME_ID)) < 0)
+                HGOTO_ERROR(H5E_OHDR, H5E_NOTFOUND, FAIL, "unable to check for MTIME message")
             if(exists > 0) {
-                /* Get "new style" modification time info */
-                if(NULL == H5O_msg_read_oh(loc->file, dxpl_id, oh, H5O_MTIME_NEW_ID, &oinfo->ctime))
-                    HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "can't read MTIME_NEW message")
+                /* Get "old style" modification time info */
+                if(NULL == H5O_msg_read_oh(loc->file, dxpl_id, oh, H5O_MTIME_ID, &oinfo->ctime))
+                    HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "can't read MTIME message")
             } /* end if */
-            else
-                oinfo->ctime = 0;
+            else {
+                /* Check for "new style" modification time info */
+                if((exists = H5O_msg_exists_oh(oh, H5O_MTIME_NEW_ID)) < 0)
+                    HGOTO_ERROR(H5E_OHDR, H5E_NOTFOUND, FAIL, "unable to check for MTIME_NEW message")
+                if(exists > 0) {
+                    /* Get "new style" modification time info */
+                    if(NULL == H5O_msg_read_oh(loc->file, dxpl_id, oh, H5O_MTIME_NEW_ID, &oinfo->ctime))
+                        HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "can't read MTIME_NEW message")
+                } /* end if */
+                else
+                    oinfo->ctime = 0;
+            } /* end else */
         } /* end else */
-    } /* end else */
+    } /* end if */
 
-    /* Get the information for the object header */
-    if(H5O_get_hdr_info_real(oh, &oinfo->hdr) < 0)
-        HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "can't retrieve object header info")
+    /* Get the information for the object header, if requested */
+    if(fields & H5O_INFO_HDR)
+        if(H5O_get_hdr_info_real(oh, &oinfo->hdr) < 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "can't retrieve object header info")
 
-    /* Retrieve # of attributes */
-    if(H5O_attr_count_real(loc->file, dxpl_id, oh, &oinfo->num_attrs) < 0)
-        HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "can't retrieve attribute count")
-
-    /* Get B-tree & heap metadata storage size, if requested */
-    if(want_ih_info) {
-        /* Check for 'bh_info' callback for this type of object */
-        if(obj_class->bh_info) {
-            /* Call the object's class 'bh_info' routine */
-            if((obj_class->bh_info)(loc, dxpl_id, oh, &oinfo->meta_size.obj) < 0)
-                HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "can't retrieve object's btree & heap info")
-        } /* end if */
+    /* Retrieve # of attributes, if requested (also needed for the
+     *  attributes' storage sizes)
+     */
+    if(fields & (H5O_INFO_NUM_ATTRS | H5O_INFO_META_SIZE)) {
+        hsize_t num_attrs;              /* Number of attributes on object */
+
+        if(H5O_attr_count_real(loc->file, dxpl_id, oh, &num_attrs) < 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "can't retrieve attribute count")
+        if(fields & H5O_INFO_NUM_ATTRS)
+            oinfo->num_attrs = num_attrs;
+
+        /* Get B-tree & heap metadata storage size, if requested */
+        if(fields & H5O_INFO_META_SIZE) {
+            /* Check for 'bh_info' callback for this type of object */
+            if(obj_class->bh_info) {
+                /* Call the object's class 'bh_info' routine */
+                if((obj_class->bh_info)(loc, dxpl_id, oh, &oinfo->meta_size.obj) < 0)
+                    HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "can't retrieve object's btree & heap info")
+            } /* end if */
 
-        /* Get B-tree & heap info for any attributes */
-        if(oinfo->num_attrs > 0) {
-            if(H5O_attr_bh_info(loc->file, dxpl_id, oh, &oinfo->meta_size.attr) < 0)
-                HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "can't retrieve attribute btree & heap info")
+            /* Get B-tree & heap info for any attributes */
+            if(num_attrs > 0) {
+                if(H5O_attr_bh_info(loc->file, dxpl_id, oh, &oinfo->meta_size.attr) < 0)
+                    HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "can't retrieve attribute btree & heap info")
+            } /* end if */
         } /* end if */
     } /* end if */
 
@@ -2304,6 +2337,101 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5O_get_rc_and_type() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O_cmp_addr
+ *
+ * Purpose:     Callback for qsort() to compare object header addresses
+ *
+ * Return:      -1, 0, 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5O_cmp_addr(const void *_addr1, const void *_addr2)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(H5F_addr_cmp(*(const haddr_t *)_addr1, *(const haddr_t *)_addr2))
+} /* end H5O_cmp_addr() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O_prefetch_hdrs
+ *
+ * Purpose:     Load the object headers at a set of addresses (with their
+ *              continuation chunks) into the metadata cache, so that the
+ *              caller's later accesses to them are cache hits.  The headers
+ *              are read in ascending address order and the ones already
+ *              cached are skipped.  Undefined addresses are ignored.
+ *
+ *              Prefetching is only a hint: a header that can't be loaded
+ *              is skipped, and the error is left for the caller to hit
+ *              when it accesses the object.
+ *
+ * Note:        The address array is sorted in place.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5O_prefetch_hdrs(H5F_t *f, hid_t dxpl_id, haddr_t *addrs, size_t naddrs)
+{
+    H5O_loc_t loc;                      /* Location of object header to load */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check args */
+    HDassert(f);
+    HDassert(addrs || naddrs == 0);
+
+    /* Issue the reads in file order */
+    HDqsort(addrs, naddrs, sizeof(haddr_t), H5O_cmp_addr);
+
+    H5O_loc_reset(&loc);
+    loc.file = f;
+    for(u = 0; u < naddrs; u++) {
+        H5O_t *oh;                      /* Object header loaded */
+        unsigned status = 0;            /* Cache status of object header */
+
+        /* Undefined addresses sort last */
+        if(!H5F_addr_defined(addrs[u]))
+            break;
+
+        /* Skip duplicates & headers already in the cache */
+        if(u > 0 && H5F_addr_eq(addrs[u], addrs[u - 1]))
+            continue;
+        if(H5AC_get_entry_status(f, addrs[u], &status) < 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "unable to check metadata cache status")
+        if(status & H5AC_ES__IN_CACHE)
+            continue;
+
+        /* Set the metadata tag to the object's address, so the header
+         *  isn't tagged with the caller's object
+         */
+        H5_BEGIN_TAG(dxpl_id, addrs[u], FAIL);
+
+        /* Bring the header into the cache (a failure is left for the
+         *  caller to hit later)
+         */
+        loc.addr = addrs[u];
+        H5E_BEGIN_TRY {
+            oh = H5O_protect(&loc, dxpl_id, H5AC__READ_ONLY_FLAG, FALSE);
+        } H5E_END_TRY;
+        if(oh && H5O_unprotect(&loc, dxpl_id, oh, H5AC__NO_FLAGS_SET) < 0)
+            HGOTO_ERROR_TAG(H5E_OHDR, H5E_CANTUNPROTECT, FAIL, "unable to release object header")
+
+        /* Reset metadata tag */
+        H5_END_TAG(FAIL);
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O_prefetch_hdrs() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5O_free_visit_visited
@@ -2382,8 +2510,10 @@ H5O_visit_cb(hid_t H5_ATTR_UNUSED group, const char *name, const H5L_info_t *lin
         if(NULL == H5SL_search(udata->visited, &obj_pos)) {
             H5O_info_t oinfo;           /* Object info */
 
-            /* Get the object's info */
-            if(H5O_get_info(&obj_oloc, udata->dxpl_id, TRUE, &oinfo) < 0)
+            /* Get the object's info (the basic info is needed for the
+             *  traversal itself)
+             */
+            if(H5O_get_info(&obj_oloc, udata->dxpl_id, udata->fields | H5O_INFO_BASIC, &oinfo) < 0)
                 HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, H5_ITER_ERROR, "unable to get object info")
 
             /* Make the application callback */
@@ -2439,6 +2569,9 @@ done:
  *              iteration index and iteration order given) will be used to in
  *              the callback about the object.
  *
+ *              FIELDS selects the object information passed to the
+ *              callback, as for H5O_get_info().
+ *
  * Return:	Success:	The return value of the first operator that
  *				returns non-zero, or zero if all members were
  *				processed with no operator returning non-zero.
@@ -2454,8 +2587,8 @@ done:
  */
 herr_t
 H5O_visit(hid_t loc_id, const char *obj_name, H5_index_t idx_type,
-    H5_iter_order_t order, H5O_iterate_t op, void *op_data, hid_t lapl_id,
-    hid_t dxpl_id)
+    H5_iter_order_t order, H5O_iterate_t op, void *op_data, unsigned fields,
+    hid_t lapl_id, hid_t dxpl_id)
 {
     H5O_iter_visit_ud_t udata;  /* User data for callback */
     H5G_loc_t	loc;            /* Location of reference object */
@@ -2487,7 +2620,7 @@ H5O_visit(hid_t loc_id, const char *obj_name, H5_index_t idx_type,
     loc_found = TRUE;
 
     /* Get the object's info */
-    if(H5O_get_info(&obj_oloc, dxpl_id, TRUE, &oinfo) < 0)
+    if(H5O_get_info(&obj_oloc, dxpl_id, fields | H5O_INFO_BASIC, &oinfo) < 0)
         HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "unable to get object info")
 
     /* Open the object */
@@ -2518,6 +2651,7 @@ H5O_visit(hid_t loc_id, const char *obj_name, H5_index_t idx_type,
         udata.dxpl_id = dxpl_id;
         udata.op = op;
         udata.op_data = op_data;
+        udata.fields = fields;
 
         /* Create skip list to store visited object information */
         if((udata.visited = H5SL_create(H5SL_TYPE_OBJ, NULL)) == NULL)
@@ -2753,6 +2887,9 @@ H5O__free(H5O_t *oh)
         oh->mesg = (H5O_mesg_t *)H5FL_SEQ_FREE(H5O_mesg_t, oh->mesg);
     } /* end if */
 
+    /* Destroy the message indices */
+    H5O__msg_index_dest(oh);
+
     /* Destroy the proxy */
     if(oh->proxy)
         if(H5AC_proxy_entry_dest(oh->proxy) < 0)
@@ -32,6 +32,7 @@
 #include "H5FLprivate.h"	/* Free lists                           */
 #include "H5Gpkg.h"		/* Groups		  		*/
 #include "H5Lpkg.h"             /* Links                                */
+#include "H5MMprivate.h"	/* Memory management			*/
 #include "H5Opkg.h"             /* Object headers			*/
 
 
@@ -92,6 +93,9 @@ typedef struct {
     H5O_linfo_t *dst_linfo;             /* Destination object's link info message */
     hid_t dxpl_id;                      /* DXPL for operation */
     H5O_copy_t  *cpy_info;              /* Information for copy operation */
+    size_t nlinks;                      /* # of destination links collected */
+    size_t alloc_links;                 /* # of slots allocated in 'dst_lnks' */
+    H5O_link_t *dst_lnks;               /* Destination links to insert */
 } H5O_linfo_postcopy_ud_t;
 
 /* Declare a free list to manage the H5O_linfo_t struct */
@@ -451,8 +455,6 @@ static herr_t
 H5O_linfo_post_copy_file_cb(const H5O_link_t *src_lnk, void *_udata)
 {
     H5O_linfo_postcopy_ud_t *udata = (H5O_linfo_postcopy_ud_t *)_udata;     /* 'User data' passed in */
-    H5O_link_t dst_lnk;                 /* Destination link to insert */
-    hbool_t dst_lnk_init = FALSE;       /* Whether the destination link is initialized */
     herr_t ret_value = H5_ITER_CONT;  /* Return value */
 
     FUNC_ENTER_NOAPI_NOINIT
@@ -461,28 +463,27 @@ H5O_linfo_post_copy_file_cb(const H5O_link_t *src_lnk, void *_udata)
     HDassert(src_lnk);
     HDassert(udata);
 
+    /* Make room for the destination link */
+    if(udata->nlinks == udata->alloc_links) {
+        size_t new_alloc = MAX(16, udata->alloc_links * 2);    /* New # of slots */
+        H5O_link_t *new_lnks;           /* New array of links */
+
+        if(NULL == (new_lnks = (H5O_link_t *)H5MM_realloc(udata->dst_lnks, new_alloc * sizeof(H5O_link_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, H5_ITER_ERROR, "memory allocation failed")
+        udata->dst_lnks = new_lnks;
+        udata->alloc_links = new_alloc;
+    } /* end if */
+
     /* Copy the link (and the object it points to) */
+    /* (The links are inserted into the destination group all at once,
+     *  after the iteration)
+     */
     if(H5L_link_copy_file(udata->dst_oloc->file, udata->dxpl_id, src_lnk,
-            udata->src_oloc, &dst_lnk, udata->cpy_info) < 0)
+            udata->src_oloc, &udata->dst_lnks[udata->nlinks], udata->cpy_info) < 0)
         HGOTO_ERROR(H5E_OHDR, H5E_CANTCOPY, H5_ITER_ERROR, "unable to copy link")
-    dst_lnk_init = TRUE;
-
-    /* Set metadata tag in dxpl_id */
-    H5_BEGIN_TAG(udata->dxpl_id, H5AC__COPIED_TAG, FAIL);
-
-    /* Insert the new object in the destination file's group */
-    /* (Doesn't increment the link count - that's already been taken care of for hard links) */
-    if(H5G__dense_insert(udata->dst_oloc->file, udata->dxpl_id, udata->dst_linfo, &dst_lnk) < 0)
-        HGOTO_ERROR_TAG(H5E_OHDR, H5E_CANTINSERT, H5_ITER_ERROR, "unable to insert destination link")
-
-    /* Reset metadata tag in dxpl_id */
-    H5_END_TAG(FAIL);
+    udata->nlinks++;
 
 done:
-    /* Check if the destination link has been initialized */
-    if(dst_lnk_init)
-        H5O_msg_reset(H5O_LINK_ID, &dst_lnk);
-
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5O_linfo_post_copy_file_cb() */
 
@@ -506,6 +507,8 @@ H5O_linfo_post_copy_file(const H5O_loc_t *src_oloc, const void *mesg_src,
 {
     const H5O_linfo_t   *linfo_src = (const H5O_linfo_t *)mesg_src;
     H5O_linfo_t         *linfo_dst = (H5O_linfo_t *)mesg_dst;
+    H5O_linfo_postcopy_ud_t udata;      /* User data for iteration callback */
+    size_t u;                           /* Local index variable */
     herr_t ret_value = SUCCEED;   /* Return value */
 
     FUNC_ENTER_NOAPI_NOINIT
@@ -518,27 +521,44 @@ H5O_linfo_post_copy_file(const H5O_loc_t *src_oloc, const void *mesg_src,
     HDassert(linfo_dst);
     HDassert(cpy_info);
 
+    /* Set up dense link iteration user data */
+    udata.src_oloc = src_oloc;
+    udata.dst_oloc = dst_oloc;
+    udata.dst_linfo = linfo_dst;
+    udata.dxpl_id = dxpl_id;
+    udata.cpy_info = cpy_info;
+    udata.nlinks = 0;
+    udata.alloc_links = 0;
+    udata.dst_lnks = NULL;
+
     /* If we are performing a 'shallow hierarchy' copy, get out now */
     if(cpy_info->max_depth >= 0 && cpy_info->curr_depth >= cpy_info->max_depth)
         HGOTO_DONE(SUCCEED)
 
     /* Check for copying dense link storage */
     if(H5F_addr_defined(linfo_src->fheap_addr)) {
-        H5O_linfo_postcopy_ud_t udata;          /* User data for iteration callback */
-
-        /* Set up dense link iteration user data */
-        udata.src_oloc = src_oloc;
-        udata.dst_oloc = dst_oloc;
-        udata.dst_linfo = linfo_dst;
-        udata.dxpl_id = dxpl_id;
-        udata.cpy_info = cpy_info;
-
-        /* Iterate over the links in the group, building a table of the link messages */
+        /* Iterate over the links in the group, copying the objects they point to */
         if(H5G__dense_iterate(src_oloc->file, dxpl_id, linfo_src, H5_INDEX_NAME, H5_ITER_NATIVE, (hsize_t)0, NULL, H5O_linfo_post_copy_file_cb, &udata) < 0)
             HGOTO_ERROR(H5E_SYM, H5E_CANTNEXT, FAIL, "error iterating over links")
+
+        /* Set metadata tag in dxpl_id */
+        H5_BEGIN_TAG(dxpl_id, H5AC__COPIED_TAG, FAIL);
+
+        /* Build the destination group's dense link storage from all the links at once */
+        /* (Doesn't increment the link count - that's already been taken care of for hard links) */
+        if(H5G__dense_insert_many(dst_oloc->file, dxpl_id, linfo_dst, udata.nlinks, udata.dst_lnks) < 0)
+            HGOTO_ERROR_TAG(H5E_OHDR, H5E_CANTINSERT, FAIL, "unable to insert destination links")
+
+        /* Reset metadata tag in dxpl_id */
+        H5_END_TAG(FAIL);
     } /* end if */
 
 done:
+    /* Release the destination links */
+    for(u = 0; u < udata.nlinks; u++)
+        H5O_msg_reset(H5O_LINK_ID, &udata.dst_lnks[u]);
+    udata.dst_lnks = (H5O_link_t *)H5MM_xfree(udata.dst_lnks);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5O_linfo_post_copy_file() */
 
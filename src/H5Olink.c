@@ -55,6 +55,9 @@ static herr_t H5O_link_post_copy_file(const H5O_loc_t *src_oloc,
     unsigned *mesg_flags, hid_t dxpl_id, H5O_copy_t *cpy_info);
 static herr_t H5O_link_debug(H5F_t *f, hid_t dxpl_id, const void *_mesg,
     FILE * stream, int indent, int fwidth);
+static herr_t H5O__link_index_build(H5F_t *f, hid_t dxpl_id, H5O_t *oh);
+static herr_t H5O__link_index_find(H5F_t *f, hid_t dxpl_id, H5O_t *oh,
+    const char *name, H5O_mesg_t **found, hbool_t *stale);
 
 /* This message derives from H5O message class */
 const H5O_msg_class_t H5O_MSG_LINK[1] = {{
@@ -96,9 +99,16 @@ const H5O_msg_class_t H5O_MSG_LINK[1] = {{
 #define H5O_LINK_NAME_4                 0x02    /* Use 4-byte value for name length */
 #define H5O_LINK_NAME_8                 0x03    /* Use 8-byte value for name length */
 
+/* Minimum # of link messages in a header before a name index is built */
+#define H5O_LINK_INDEX_MIN_LINKS        8
+
 /* Declare a free list to manage the H5O_link_t struct */
 H5FL_DEFINE_STATIC(H5O_link_t);
 
+/* Declare free lists to manage the link message name index */
+H5FL_DEFINE_STATIC(H5O_link_index_t);
+H5FL_SEQ_DEFINE_STATIC(H5O_link_index_ent_t);
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5O_link_decode
@@ -668,6 +678,257 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5O_link_delete() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__link_index_build
+ *
+ * Purpose:     Build the in-memory name index for the link messages in an
+ *              object header.  Headers with only a few link messages are
+ *              left without an index, a linear scan is as fast for them.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__link_index_build(H5F_t *f, hid_t dxpl_id, H5O_t *oh)
+{
+    H5O_link_index_t *idx = NULL;       /* New name index */
+    size_t nlinks;                      /* # of link messages in header */
+    size_t mask;                        /* Mask for slot numbers */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(f);
+    HDassert(oh);
+    HDassert(NULL == oh->link_index);
+
+    /* Don't bother for headers with only a few links */
+    if((nlinks = H5O_msg_count_real(oh, H5O_MSG_LINK)) < H5O_LINK_INDEX_MIN_LINKS)
+        HGOTO_DONE(SUCCEED)
+
+    /* Allocate the index, keeping the table at most half full */
+    if(NULL == (idx = H5FL_MALLOC(H5O_link_index_t)))
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTALLOC, FAIL, "memory allocation failed for link name index")
+    idx->nslots = 1;
+    while(idx->nslots < 2 * nlinks)
+        idx->nslots <<= 1;
+    if(NULL == (idx->slot = H5FL_SEQ_CALLOC(H5O_link_index_ent_t, idx->nslots))) {
+        idx = H5FL_FREE(H5O_link_index_t, idx);
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTALLOC, FAIL, "memory allocation failed for link name index")
+    } /* end if */
+    mask = idx->nslots - 1;
+
+    /* Insert each link message */
+    for(u = 0; u < oh->nmesgs; u++) {
+        H5O_mesg_t *mesg = &oh->mesg[u];        /* Current message */
+        uint32_t hash;                          /* Hash of link's name */
+        size_t slotno;                          /* Slot for link */
+
+        if(mesg->type != H5O_MSG_LINK)
+            continue;
+
+        /* Decode the link, if it hasn't been already */
+        H5O_LOAD_NATIVE(f, dxpl_id, 0, oh, mesg, FAIL)
+
+        hash = H5_hash_string(((const H5O_link_t *)mesg->native)->name);
+        for(slotno = hash & mask; idx->slot[slotno].mesgno != 0; slotno = (slotno + 1) & mask)
+            ;
+        idx->slot[slotno].hash = hash;
+        idx->slot[slotno].mesgno = u + 1;
+    } /* end for */
+
+    /* Attach the index to the header */
+    oh->link_index = idx;
+    idx = NULL;
+
+done:
+    if(idx) {
+        idx->slot = H5FL_SEQ_FREE(H5O_link_index_ent_t, idx->slot);
+        idx = H5FL_FREE(H5O_link_index_t, idx);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__link_index_build() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__link_index_find
+ *
+ * Purpose:     Look up a link message by name in an object header's name
+ *              index.  If an indexed slot no longer refers to a link
+ *              message, the index is out of date and STALE is set.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__link_index_find(H5F_t *f, hid_t dxpl_id, H5O_t *oh, const char *name,
+    H5O_mesg_t **found, hbool_t *stale)
+{
+    H5O_link_index_t *idx = oh->link_index;     /* Name index */
+    uint32_t hash;                      /* Hash of name to look up */
+    size_t mask;                        /* Mask for slot numbers */
+    size_t slotno;                      /* Current slot */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(idx);
+    HDassert(name);
+    HDassert(found);
+    HDassert(stale);
+
+    *found = NULL;
+    *stale = FALSE;
+
+    hash = H5_hash_string(name);
+    mask = idx->nslots - 1;
+    for(slotno = hash & mask; idx->slot[slotno].mesgno != 0; slotno = (slotno + 1) & mask)
+        if(idx->slot[slotno].hash == hash) {
+            size_t mesgno = idx->slot[slotno].mesgno - 1;
+            H5O_mesg_t *mesg;
+
+            if(mesgno >= oh->nmesgs || oh->mesg[mesgno].type != H5O_MSG_LINK) {
+                *stale = TRUE;
+                break;
+            } /* end if */
+
+            mesg = &oh->mesg[mesgno];
+            H5O_LOAD_NATIVE(f, dxpl_id, 0, oh, mesg, FAIL)
+            if(0 == HDstrcmp(((const H5O_link_t *)mesg->native)->name, name)) {
+                *found = mesg;
+                break;
+            } /* end if */
+        } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__link_index_find() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__link_index_reset
+ *
+ * Purpose:     Discard an object header's link name index.  Called
+ *              whenever messages are added, removed or moved around in
+ *              the header, the index is rebuilt on the next lookup.
+ *
+ * Return:      None
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5O__link_index_reset(H5O_t *oh)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(oh);
+
+    if(oh->link_index) {
+        oh->link_index->slot = H5FL_SEQ_FREE(H5O_link_index_ent_t, oh->link_index->slot);
+        oh->link_index = H5FL_FREE(H5O_link_index_t, oh->link_index);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5O__link_index_reset() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O_link_lookup
+ *
+ * Purpose:     Look up a link message by name in a compact group's object
+ *              header, copying it into LNK (if non-NULL) when found.
+ *
+ *              Large headers are searched through an in-memory name index
+ *              kept with the cached header, so the cost doesn't grow with
+ *              the number of links in the group.
+ *
+ * Return:      Success:        TRUE if the link was found, FALSE if not
+ *
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5O_link_lookup(const H5O_loc_t *loc, const char *name, H5O_link_t *lnk,
+    hid_t dxpl_id)
+{
+    H5O_t *oh = NULL;                   /* Object header */
+    H5O_mesg_t *found = NULL;           /* Link message found */
+    htri_t ret_value = FALSE;           /* Return value */
+
+    FUNC_ENTER_NOAPI_TAG(dxpl_id, loc->addr, FAIL)
+
+    /* Check args */
+    HDassert(loc);
+    HDassert(loc->file);
+    HDassert(name && *name);
+
+    /* Protect the object header */
+    if(NULL == (oh = H5O_protect(loc, dxpl_id, H5AC__READ_ONLY_FLAG, FALSE)))
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTPROTECT, FAIL, "unable to load object header")
+
+    /* Build the name index, if it's not been built yet */
+    if(NULL == oh->link_index)
+        if(H5O__link_index_build(loc->file, dxpl_id, oh) < 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTINIT, FAIL, "can't build link name index")
+
+    if(oh->link_index) {
+        hbool_t stale;                  /* Whether the index is out of date */
+
+        if(H5O__link_index_find(loc->file, dxpl_id, oh, name, &found, &stale) < 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_NOTFOUND, FAIL, "can't search link name index")
+
+        /* Rebuild an out of date index and try again */
+        if(stale) {
+            H5O__link_index_reset(oh);
+            if(H5O__link_index_build(loc->file, dxpl_id, oh) < 0)
+                HGOTO_ERROR(H5E_OHDR, H5E_CANTINIT, FAIL, "can't build link name index")
+            if(oh->link_index) {
+                if(H5O__link_index_find(loc->file, dxpl_id, oh, name, &found, &stale) < 0)
+                    HGOTO_ERROR(H5E_OHDR, H5E_NOTFOUND, FAIL, "can't search link name index")
+                HDassert(!stale);
+            } /* end if */
+        } /* end if */
+    } /* end if */
+
+    /* Scan the messages directly when there's no index */
+    if(NULL == oh->link_index) {
+        size_t u;                       /* Local index variable */
+
+        for(u = 0; u < oh->nmesgs; u++)
+            if(oh->mesg[u].type == H5O_MSG_LINK) {
+                H5O_mesg_t *mesg = &oh->mesg[u];
+
+                H5O_LOAD_NATIVE(loc->file, dxpl_id, 0, oh, mesg, FAIL)
+                if(0 == HDstrcmp(((const H5O_link_t *)mesg->native)->name, name)) {
+                    found = mesg;
+                    break;
+                } /* end if */
+            } /* end if */
+    } /* end if */
+
+    if(found) {
+        /* Copy link information */
+        if(lnk && NULL == H5O_msg_copy(H5O_LINK_ID, found->native, lnk))
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTCOPY, FAIL, "can't copy link message")
+
+        ret_value = TRUE;
+    } /* end if */
+
+done:
+    if(oh && H5O_unprotect(loc, dxpl_id, oh, H5AC__NO_FLAGS_SET) < 0)
+        HDONE_ERROR(H5E_OHDR, H5E_CANTUNPROTECT, FAIL, "unable to release object header")
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
+} /* end H5O_link_lookup() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5O_link_pre_copy_file
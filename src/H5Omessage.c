@@ -36,6 +36,7 @@
 #include "H5Aprivate.h"		/* Attributes	  			*/
 #include "H5Eprivate.h"		/* Error handling		  	*/
 #include "H5Fprivate.h"		/* File access				*/
+#include "H5FLprivate.h"	/* Free lists                           */
 #include "H5Iprivate.h"		/* IDs			  		*/
 #include "H5MMprivate.h"	/* Memory management			*/
 #include "H5Opkg.h"             /* Object headers			*/
@@ -78,6 +79,9 @@ static herr_t H5O__msg_remove_cb(H5O_t *oh, H5O_mesg_t *mesg/*in,out*/,
 static herr_t H5O__copy_mesg(H5F_t *f, hid_t dxpl_id, H5O_t *oh, size_t idx,
     const H5O_msg_class_t *type, const void *mesg, unsigned mesg_flags,
     unsigned update_flags);
+static hbool_t H5O__msg_index_build(H5O_t *oh);
+static size_t H5O__msg_first(H5O_t *oh, const H5O_msg_class_t *type);
+static size_t H5O__msg_next(H5O_t *oh, const H5O_msg_class_t *type, size_t idx);
 
 
 /*********************/
@@ -94,6 +98,8 @@ static herr_t H5O__copy_mesg(H5F_t *f, hid_t dxpl_id, H5O_t *oh, size_t idx,
 /* Local Variables */
 /*******************/
 
+/* Declare a free list to manage the per-type message index chains */
+H5FL_SEQ_DEFINE_STATIC(size_t);
 
 
 /*-------------------------------------------------------------------------
@@ -377,11 +383,9 @@ H5O_msg_write_real(H5F_t *f, hid_t dxpl_id, H5O_t *oh, const H5O_msg_class_t *ty
     HDassert(0 == (mesg_flags & ~H5O_MSG_FLAG_BITS));
 
     /* Locate message of correct type */
-    for(idx = 0, idx_msg = &oh->mesg[0]; idx < oh->nmesgs; idx++, idx_msg++)
-	if(type == idx_msg->type)
-            break;
-    if(idx == oh->nmesgs)
+    if((idx = H5O__msg_first(oh, type)) == oh->nmesgs)
         HGOTO_ERROR(H5E_OHDR, H5E_NOTFOUND, FAIL, "message type not found")
+    idx_msg = &oh->mesg[idx];
 
     /* Check for modifying a constant message */
     if(!(update_flags & H5O_UPDATE_FORCE) && (idx_msg->flags & H5O_MSG_FLAG_CONSTANT))
@@ -518,7 +522,7 @@ H5O_msg_read_oh(H5F_t *f, hid_t dxpl_id, H5O_t *oh, unsigned type_id,
     void *mesg)
 {
     const H5O_msg_class_t *type;        /* Actual H5O class type for the ID */
-    unsigned       idx;                 /* Message's index in object header */
+    size_t         idx;                 /* Message's index in object header */
     void           *ret_value = NULL;
 
     FUNC_ENTER_NOAPI_NOINIT
@@ -530,11 +534,8 @@ H5O_msg_read_oh(H5F_t *f, hid_t dxpl_id, H5O_t *oh, unsigned type_id,
     type = H5O_msg_class_g[type_id];    /* map the type ID to the actual type object */
     HDassert(type);
 
-    /* Scan through the messages looking for the right one */
-    for(idx = 0; idx < oh->nmesgs; idx++)
-	if(type == oh->mesg[idx].type)
-            break;
-    if(idx == oh->nmesgs)
+    /* Look up the first message of the right type */
+    if((idx = H5O__msg_first(oh, type)) == oh->nmesgs)
         HGOTO_ERROR(H5E_OHDR, H5E_NOTFOUND, NULL, "message type not found")
 
     /*
@@ -832,9 +833,9 @@ done:
  *-------------------------------------------------------------------------
  */
 unsigned
-H5O_msg_count_real(const H5O_t *oh, const H5O_msg_class_t *type)
+H5O_msg_count_real(H5O_t *oh, const H5O_msg_class_t *type)
 {
-    unsigned u;                 /* Local index variable */
+    size_t u;                   /* Local index variable */
     unsigned ret_value = 0;     /* Return value */
 
     FUNC_ENTER_NOAPI_NOINIT_NOERR
@@ -843,10 +844,9 @@ H5O_msg_count_real(const H5O_t *oh, const H5O_msg_class_t *type)
     HDassert(oh);
     HDassert(type);
 
-    /* Loop over all messages, counting the ones of the type looked for */
-    for(u = ret_value = 0; u < oh->nmesgs; u++)
-	if(oh->mesg[u].type == type)
-            ret_value++;
+    /* Walk the messages of the type looked for, counting them */
+    for(u = H5O__msg_first(oh, type); u < oh->nmesgs; u = H5O__msg_next(oh, type, u))
+        ret_value++;
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5O_msg_count_real() */
@@ -917,10 +917,9 @@ done:
  *-------------------------------------------------------------------------
  */
 htri_t
-H5O_msg_exists_oh(const H5O_t *oh, unsigned type_id)
+H5O_msg_exists_oh(H5O_t *oh, unsigned type_id)
 {
     const H5O_msg_class_t *type;        /* Actual H5O class type for the ID */
-    unsigned	u;                      /* Local index variable */
     htri_t      ret_value = FALSE;      /* Return value */
 
     FUNC_ENTER_NOAPI_NOINIT_NOERR
@@ -930,12 +929,10 @@ H5O_msg_exists_oh(const H5O_t *oh, unsigned type_id)
     type = H5O_msg_class_g[type_id];    /* map the type ID to the actual type object */
     HDassert(type);
 
-    /* Scan through the messages looking for the right one */
-    for(u = 0; u < oh->nmesgs; u++)
-	if(type == oh->mesg[u].type)
-            HGOTO_DONE(TRUE)
+    /* Look up the first message of the right type */
+    if(H5O__msg_first(oh, type) < oh->nmesgs)
+        ret_value = TRUE;
 
-done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5O_msg_exists_oh() */
 
@@ -1274,7 +1271,7 @@ H5O_msg_iterate_real(H5F_t *f, H5O_t *oh, const H5O_msg_class_t *type,
     const H5O_mesg_operator_t *op, void *op_data, hid_t dxpl_id)
 {
     H5O_mesg_t         *idx_msg;        /* Pointer to current message */
-    unsigned		idx;            /* Absolute index of current message in all messages */
+    size_t		idx;            /* Absolute index of current message in all messages */
     unsigned		sequence;       /* Relative index of current message for messages of type */
     unsigned 		oh_modified = 0;    	/* Whether the callback modified the object header */
     herr_t              ret_value = H5_ITER_CONT;      /* Return value */
@@ -1289,24 +1286,25 @@ H5O_msg_iterate_real(H5F_t *f, H5O_t *oh, const H5O_msg_class_t *type,
     HDassert(op->u.app_op);
 
     /* Iterate over messages */
-    for(sequence = 0, idx = 0, idx_msg = &oh->mesg[0]; idx < oh->nmesgs && !ret_value; idx++, idx_msg++) {
-	if(type == idx_msg->type) {
-            /* Decode the message if necessary.  */
-            H5O_LOAD_NATIVE(f, dxpl_id, 0, oh, idx_msg, FAIL)
-
-            /* Check for making an "internal" (i.e. within the H5O package) callback */
-            if(op->op_type == H5O_MESG_OP_LIB)
-                ret_value = (op->u.lib_op)(oh, idx_msg, sequence, &oh_modified, op_data);
-            else
-                ret_value = (op->u.app_op)(idx_msg->native, sequence, op_data);
-
-            /* Check for iterator callback indicating to get out of loop */
-            if(ret_value != 0)
-                break;
-
-            /* Increment sequence value for message type */
-            sequence++;
-        } /* end if */
+    /* (The callback may modify the header, H5O__msg_next() copes with that) */
+    for(sequence = 0, idx = H5O__msg_first(oh, type); idx < oh->nmesgs && !ret_value; idx = H5O__msg_next(oh, type, idx)) {
+        idx_msg = &oh->mesg[idx];
+
+        /* Decode the message if necessary.  */
+        H5O_LOAD_NATIVE(f, dxpl_id, 0, oh, idx_msg, FAIL)
+
+        /* Check for making an "internal" (i.e. within the H5O package) callback */
+        if(op->op_type == H5O_MESG_OP_LIB)
+            ret_value = (op->u.lib_op)(oh, idx_msg, sequence, &oh_modified, op_data);
+        else
+            ret_value = (op->u.app_op)(idx_msg->native, sequence, op_data);
+
+        /* Check for iterator callback indicating to get out of loop */
+        if(ret_value != 0)
+            break;
+
+        /* Increment sequence value for message type */
+        sequence++;
     } /* end for */
 
     /* Check for error from iterator */
@@ -2269,7 +2267,7 @@ H5O_msg_get_flags(const H5O_loc_t *loc, unsigned type_id, hid_t dxpl_id, uint8_t
     H5O_t *oh = NULL;                   /* Object header to use */
     const H5O_msg_class_t *type;        /* Actual H5O class type for the ID */
     H5O_mesg_t *idx_msg;                /* Pointer to message to modify */
-    unsigned idx;                       /* Index of message to modify */
+    size_t idx;                         /* Index of message to modify */
     herr_t ret_value = SUCCEED;         /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
@@ -2287,12 +2285,9 @@ H5O_msg_get_flags(const H5O_loc_t *loc, unsigned type_id, hid_t dxpl_id, uint8_t
         HGOTO_ERROR(H5E_OHDR, H5E_CANTPROTECT, FAIL, "unable to protect object header")
 
     /* Locate message of correct type */
-    for(idx = 0, idx_msg = &oh->mesg[0]; idx < oh->nmesgs; idx++, idx_msg++)
-        if(type == idx_msg->type)
-            break;
-
-    if(idx == oh->nmesgs)
+    if((idx = H5O__msg_first(oh, type)) == oh->nmesgs)
         HGOTO_ERROR(H5E_OHDR, H5E_NOTFOUND, FAIL, "message type not found")
+    idx_msg = &oh->mesg[idx];
 
     /* Set return value */
     *flags = idx_msg->flags;
@@ -2303,3 +2298,186 @@ done:
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5O_msg_get_flags() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5O__msg_index_build
+ *
+ * Purpose:	Build the per-type message index for an object header, if
+ *		it's not up to date: the first message of each type and a
+ *		chain from each message to the next one of the same type.
+ *
+ * Return:	TRUE if the index can be used, FALSE if it couldn't be
+ *		built (the caller falls back to scanning the messages)
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5O__msg_index_build(H5O_t *oh)
+{
+    size_t u;                           /* Local index variable */
+    hbool_t ret_value = TRUE;           /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(oh);
+
+    /* Messages appended while loading chunks also invalidate the index */
+    if(oh->type_index_valid && oh->type_index_nmesgs == oh->nmesgs)
+        HGOTO_DONE(TRUE)
+
+    /* Make certain the chain array is large enough */
+    if(oh->nmesgs > oh->type_next_alloc) {
+        size_t *new_next;               /* New chain array */
+
+        if(NULL == (new_next = H5FL_SEQ_REALLOC(size_t, oh->type_next, oh->alloc_nmesgs)))
+            HGOTO_DONE(FALSE)
+        oh->type_next = new_next;
+        oh->type_next_alloc = oh->alloc_nmesgs;
+    } /* end if */
+
+    /* Chain the messages of each type, back to front to keep them in order */
+    HDmemset(oh->type_first, 0, sizeof(oh->type_first));
+    for(u = oh->nmesgs; u > 0; u--) {
+        unsigned id = oh->mesg[u - 1].type->id;
+
+        HDassert(id < H5O_MSG_TYPES);
+        oh->type_next[u - 1] = oh->type_first[id];
+        oh->type_first[id] = u;
+    } /* end for */
+    oh->type_index_nmesgs = oh->nmesgs;
+    oh->type_index_valid = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__msg_index_build() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5O__msg_first
+ *
+ * Purpose:	Find the first message of a given type in an object header.
+ *
+ * Return:	Index of the message, or the number of messages in the
+ *		header if there's none of that type
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5O__msg_first(H5O_t *oh, const H5O_msg_class_t *type)
+{
+    size_t u;                           /* Local index variable */
+    size_t ret_value = oh->nmesgs;      /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(oh);
+    HDassert(type);
+    HDassert(type->id < H5O_MSG_TYPES);
+
+    if(H5O__msg_index_build(oh)) {
+        if(0 != (u = oh->type_first[type->id])) {
+            HDassert(oh->mesg[u - 1].type == type);
+            ret_value = u - 1;
+        } /* end if */
+    } /* end if */
+    else
+        for(u = 0; u < oh->nmesgs; u++)
+            if(type == oh->mesg[u].type)
+                HGOTO_DONE(u)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__msg_first() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5O__msg_next
+ *
+ * Purpose:	Find the next message of a given type in an object header,
+ *		after message IDX.  The header may have been modified since
+ *		IDX was looked up (by an iteration callback, for instance),
+ *		so the index is only followed while it's still up to date.
+ *
+ * Return:	Index of the message, or the number of messages in the
+ *		header if there's no other message of that type
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5O__msg_next(H5O_t *oh, const H5O_msg_class_t *type, size_t idx)
+{
+    size_t u;                           /* Local index variable */
+    size_t ret_value = oh->nmesgs;      /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(oh);
+    HDassert(type);
+
+    if(oh->type_index_valid && oh->type_index_nmesgs == oh->nmesgs
+            && idx < oh->nmesgs && oh->mesg[idx].type == type) {
+        if(0 != (u = oh->type_next[idx])) {
+            HDassert(oh->mesg[u - 1].type == type);
+            ret_value = u - 1;
+        } /* end if */
+    } /* end if */
+    else
+        for(u = idx + 1; u < oh->nmesgs; u++)
+            if(type == oh->mesg[u].type)
+                HGOTO_DONE(u)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__msg_next() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5O__msg_index_reset
+ *
+ * Purpose:	Invalidate the in-memory message indices of an object header.
+ *		Called whenever messages are added, removed or moved around
+ *		in the header; the indices are rebuilt when next needed.
+ *
+ * Return:	None
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5O__msg_index_reset(H5O_t *oh)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(oh);
+
+    oh->type_index_valid = FALSE;
+    H5O__link_index_reset(oh);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5O__msg_index_reset() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5O__msg_index_dest
+ *
+ * Purpose:	Release the in-memory message indices of an object header.
+ *
+ * Return:	None
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5O__msg_index_dest(H5O_t *oh)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(oh);
+
+    H5O__msg_index_reset(oh);
+    if(oh->type_next) {
+        oh->type_next = H5FL_SEQ_FREE(size_t, oh->type_next);
+        oh->type_next_alloc = 0;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5O__msg_index_dest() */
@@ -186,7 +186,7 @@
                                                                               \
         /* Decode the message */                                              \
         HDassert(msg_type->decode);                                           \
-        if(NULL == ((MSG)->native = (msg_type->decode)((F), (DXPL), (OH), (MSG)->flags, &ioflags, (MSG)->raw))) \
+        if(NULL == ((MSG)->native = H5O__dcache_decode((F), (DXPL), (OH), msg_type, (MSG)->flags, &ioflags, (MSG)->raw, (MSG)->raw_size))) \
             HGOTO_ERROR(H5E_OHDR, H5E_CANTDECODE, ERR, "unable to decode message") \
                                                                               \
         /* Mark the message dirty if it was changed by decoding */            \
@@ -276,6 +276,17 @@ typedef struct H5O_chunk_t {
     struct H5O_chunk_proxy_t *chunk_proxy;    /* Pointer to a chunk's proxy when chunk protected */
 } H5O_chunk_t;
 
+/* In-memory name index for the link messages in a (compact) group's header */
+typedef struct H5O_link_index_ent_t {
+    uint32_t    hash;                   /* Hash of the link's name */
+    size_t      mesgno;                 /* Index of link message + 1 (0 = empty slot) */
+} H5O_link_index_ent_t;
+
+typedef struct H5O_link_index_t {
+    size_t      nslots;                 /* # of slots in table (power of two) */
+    H5O_link_index_ent_t *slot;         /* Open-addressed table of link messages */
+} H5O_link_index_t;
+
 struct H5O_t {
     H5AC_info_t cache_info; /* Information for metadata cache functions, _must_ be */
                             /* first field in structure */
@@ -321,6 +332,12 @@ struct H5O_t {
     H5O_mesg_t	*mesg;			/*array of messages		     */
     size_t      link_msgs_seen;         /* # of link messages seen when loading header */
     size_t      attr_msgs_seen;         /* # of attribute messages seen when loading header */
+    hbool_t     type_index_valid;       /* Whether the per-type index is up to date */
+    size_t      type_index_nmesgs;      /* # of messages when per-type index was built */
+    size_t      type_first[H5O_MSG_TYPES]; /* First message of each type + 1 (0 = none) */
+    size_t      *type_next;             /* Next message of same type + 1, for each message */
+    size_t      type_next_alloc;        /* # of entries allocated in type_next */
+    H5O_link_index_t *link_index;       /* Name index for link messages (not stored, built on demand) */
 
     /* Chunk management (not stored) */
     size_t	nchunks;		/*number of chunks		     */
@@ -579,12 +596,17 @@ H5_DLL herr_t H5O_msg_write_real(H5F_t *f, hid_t dxpl_id, H5O_t *oh,
     void *mesg);
 H5_DLL void *H5O_msg_free_real(const H5O_msg_class_t *type, void *mesg);
 H5_DLL herr_t H5O_msg_free_mesg(H5O_mesg_t *mesg);
-H5_DLL unsigned H5O_msg_count_real(const H5O_t *oh, const H5O_msg_class_t *type);
+H5_DLL unsigned H5O_msg_count_real(H5O_t *oh, const H5O_msg_class_t *type);
+H5_DLL void H5O__msg_index_reset(H5O_t *oh);
+H5_DLL void H5O__msg_index_dest(H5O_t *oh);
 H5_DLL herr_t H5O_msg_remove_real(H5F_t *f, H5O_t *oh, const H5O_msg_class_t *type,
     int sequence, H5O_operator_t op, void *op_data, hbool_t adj_link, hid_t dxpl_id);
 H5_DLL void *H5O_msg_copy_file(const H5O_msg_class_t *type, H5F_t *file_src,
     void *mesg_src, H5F_t *file_dst, hbool_t *recompute_size,
     unsigned *mesg_flags, H5O_copy_t *cpy_info, void *udata, hid_t dxpl_id);
+H5_DLL void *H5O__dcache_decode(H5F_t *f, hid_t dxpl_id, H5O_t *open_oh,
+    const H5O_msg_class_t *type, unsigned mesg_flags, unsigned *ioflags,
+    const uint8_t *p, size_t size);
 H5_DLL herr_t H5O_msg_iterate_real(H5F_t *f, H5O_t *oh, const H5O_msg_class_t *type,
     const H5O_mesg_operator_t *op, void *op_data, hid_t dxpl_id);
 
@@ -614,6 +636,9 @@ H5_DLL herr_t H5O_condense_header(H5F_t *f, H5O_t *oh, hid_t dxpl_id);
 H5_DLL herr_t H5O_release_mesg(H5F_t *f, hid_t dxpl_id, H5O_t *oh,
     H5O_mesg_t *mesg, hbool_t adj_link);
 
+/* Link message name index routines */
+H5_DLL void H5O__link_index_reset(H5O_t *oh);
+
 /* Shared object operators */
 H5_DLL void * H5O_shared_decode(H5F_t *f, hid_t dxpl_id, H5O_t *open_oh,
     unsigned *ioflags, const uint8_t *buf, const H5O_msg_class_t *type);
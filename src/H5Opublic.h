@@ -67,6 +67,17 @@
 #define H5O_HDR_STORE_TIMES             0x20    /* Store access, modification, change & birth times for object */
 #define H5O_HDR_ALL_FLAGS       (H5O_HDR_CHUNK0_SIZE | H5O_HDR_ATTR_CRT_ORDER_TRACKED | H5O_HDR_ATTR_CRT_ORDER_INDEXED | H5O_HDR_ATTR_STORE_PHASE_CHANGE | H5O_HDR_STORE_TIMES)
 
+/* Flags for H5Oget_info2/H5Oget_info_by_name2/H5Oget_info_by_idx2 and
+ * H5Ovisit2/H5Ovisit_by_name2, selecting the fields of H5O_info_t to
+ * retrieve.  Fields not selected are zeroed.
+ */
+#define H5O_INFO_BASIC          0x0001u         /* Fill in the fileno, addr, type, and rc fields */
+#define H5O_INFO_TIME           0x0002u         /* Fill in the atime, mtime, ctime, and btime fields */
+#define H5O_INFO_NUM_ATTRS      0x0004u         /* Fill in the num_attrs field */
+#define H5O_INFO_HDR            0x0008u         /* Fill in the hdr field */
+#define H5O_INFO_META_SIZE      0x0010u         /* Fill in the meta_size field */
+#define H5O_INFO_ALL            (H5O_INFO_BASIC | H5O_INFO_TIME | H5O_INFO_NUM_ATTRS | H5O_INFO_HDR | H5O_INFO_META_SIZE)
+
 /* Maximum shared message values.  Number of indexes is 8 to allow room to add
  * new types of messages.
  */
@@ -162,6 +173,12 @@ H5_DLL herr_t H5Oget_info_by_name(hid_t loc_id, const char *name, H5O_info_t *oi
 H5_DLL herr_t H5Oget_info_by_idx(hid_t loc_id, const char *group_name,
     H5_index_t idx_type, H5_iter_order_t order, hsize_t n, H5O_info_t *oinfo,
     hid_t lapl_id);
+H5_DLL herr_t H5Oget_info2(hid_t loc_id, H5O_info_t *oinfo, unsigned fields);
+H5_DLL herr_t H5Oget_info_by_name2(hid_t loc_id, const char *name,
+    H5O_info_t *oinfo, unsigned fields, hid_t lapl_id);
+H5_DLL herr_t H5Oget_info_by_idx2(hid_t loc_id, const char *group_name,
+    H5_index_t idx_type, H5_iter_order_t order, hsize_t n, H5O_info_t *oinfo,
+    unsigned fields, hid_t lapl_id);
 H5_DLL herr_t H5Olink(hid_t obj_id, hid_t new_loc_id, const char *new_name,
     hid_t lcpl_id, hid_t lapl_id);
 H5_DLL herr_t H5Oincr_refcount(hid_t object_id);
@@ -179,6 +196,11 @@ H5_DLL herr_t H5Ovisit(hid_t obj_id, H5_index_t idx_type, H5_iter_order_t order,
 H5_DLL herr_t H5Ovisit_by_name(hid_t loc_id, const char *obj_name,
     H5_index_t idx_type, H5_iter_order_t order, H5O_iterate_t op,
     void *op_data, hid_t lapl_id);
+H5_DLL herr_t H5Ovisit2(hid_t obj_id, H5_index_t idx_type, H5_iter_order_t order,
+    H5O_iterate_t op, void *op_data, unsigned fields);
+H5_DLL herr_t H5Ovisit_by_name2(hid_t loc_id, const char *obj_name,
+    H5_index_t idx_type, H5_iter_order_t order, H5O_iterate_t op,
+    void *op_data, unsigned fields, hid_t lapl_id);
 H5_DLL herr_t H5Oclose(hid_t object_id);
 H5_DLL herr_t H5Oflush(hid_t obj_id);
 H5_DLL herr_t H5Orefresh(hid_t oid);
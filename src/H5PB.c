@@ -36,6 +36,7 @@
 #include "H5Fpkg.h"		/* Files				*/
 #include "H5FDprivate.h"	/* File drivers				*/
 #include "H5Iprivate.h"		/* IDs			  		*/
+#include "H5MMprivate.h"	/* Memory management			*/
 #include "H5PBpkg.h"            /* File access				*/
 #include "H5SLprivate.h"	/* Skip List				*/
 
@@ -124,6 +125,7 @@ typedef struct {
 /********************/
 static herr_t H5PB__insert_entry(H5PB_t *page_buf, H5PB_entry_t *page_entry);
 static htri_t H5PB__make_space(const H5F_io_info2_t *fio_info, H5PB_t *page_buf, H5FD_mem_t inserted_type);
+static herr_t H5PB__budget_evict(H5PB_t *page_buf);
 static herr_t H5PB__write_entry(const H5F_io_info2_t *fio_info, H5PB_entry_t *page_entry);
 
 
@@ -454,6 +456,7 @@ H5PB__dest_cb(void *item, void H5_ATTR_UNUSED *key, void *_op_data)
     if(op_data->actual_slist) {
         H5PB__REMOVE_LRU(op_data->page_buf, page_entry)
         page_entry->page_buf_ptr = H5FL_FAC_FREE(op_data->page_buf->page_fac, page_entry->page_buf_ptr);
+        H5MM_budget_sub(H5_MEM_PAGE_BUFFER, op_data->page_buf->page_size);
     } /* end if */
 
     /* Free page entry */
@@ -672,6 +675,7 @@ H5PB_remove_entry(const H5F_t *f, haddr_t addr)
         page_buf->meta_count--;
 
         page_entry->page_buf_ptr = H5FL_FAC_FREE(page_buf->page_fac, page_entry->page_buf_ptr);
+        H5MM_budget_sub(H5_MEM_PAGE_BUFFER, page_buf->page_size);
         page_entry = H5FL_FREE(H5PB_entry_t, page_entry);
     } /* end if */
 
@@ -901,6 +905,10 @@ H5PB_read(const H5F_io_info2_t *fio_info, H5FD_mem_t type, haddr_t addr,
                 size_t page_size = page_buf->page_size;
                 haddr_t eoa;
 
+                /* Give clean pages back if the library is over its memory budget */
+                if(H5PB__budget_evict(page_buf) < 0)
+                    HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTFREE, FAIL, "can't evict pages for the memory budget")
+
                 /* make space for new entry */
                 if((H5SL_count(page_buf->slist_ptr) * page_buf->page_size) >= page_buf->max_size) {
                     htri_t can_make_space;
@@ -1159,6 +1167,7 @@ H5PB_write(const H5F_io_info2_t *fio_info, H5FD_mem_t type, haddr_t addr,
 
                     /* Free page info */
                     page_entry->page_buf_ptr = H5FL_FAC_FREE(page_buf->page_fac, page_entry->page_buf_ptr);
+                    H5MM_budget_sub(H5_MEM_PAGE_BUFFER, page_buf->page_size);
                     page_entry = H5FL_FREE(H5PB_entry_t, page_entry);
                 } /* end if */
             } /* end else */
@@ -1205,6 +1214,10 @@ H5PB_write(const H5F_io_info2_t *fio_info, H5FD_mem_t type, haddr_t addr,
                 void *new_page_buf;
                 size_t page_size = page_buf->page_size;
 
+                /* Give clean pages back if the library is over its memory budget */
+                if(H5PB__budget_evict(page_buf) < 0)
+                    HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTFREE, FAIL, "can't evict pages for the memory budget")
+
                 /* Make space for new entry */
                 if((H5SL_count(page_buf->slist_ptr) * page_buf->page_size) >= page_buf->max_size) {
                     htri_t can_make_space;
@@ -1356,6 +1369,7 @@ H5PB__insert_entry(H5PB_t *page_buf, H5PB_entry_t *page_entry)
     if(H5SL_insert(page_buf->slist_ptr, page_entry, &(page_entry->addr)) < 0)
         HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTINSERT, FAIL, "can't insert entry in skip list")
     HDassert(H5SL_count(page_buf->slist_ptr) * page_buf->page_size <= page_buf->max_size);
+    H5MM_budget_add(H5_MEM_PAGE_BUFFER, page_buf->page_size);
 
     /* Increment appropriate page count */
     if(H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type)
@@ -1470,12 +1484,84 @@ H5PB__make_space(const H5F_io_info2_t *fio_info, H5PB_t *page_buf,
 
     /* Release page */
     page_entry->page_buf_ptr = H5FL_FAC_FREE(page_buf->page_fac, page_entry->page_buf_ptr);
+    H5MM_budget_sub(H5_MEM_PAGE_BUFFER, page_buf->page_size);
     page_entry = H5FL_FREE(H5PB_entry_t, page_entry);
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5PB__make_space() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__budget_evict()
+ *
+ * Purpose:	If the library would be over its memory budget (see
+ *              H5set_memory_limit) with one more page in the page buffer,
+ *              evict clean pages, least recently used first, until the
+ *              page buffer has given back as much as the library is over.
+ *              Dirty pages are left to H5PB__make_space, as are the pages
+ *              of a type at or below its minimum count.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PB__budget_evict(H5PB_t *page_buf)
+{
+    H5PB_entry_t *page_entry;   /* Pointer to page eviction candidate */
+    H5PB_entry_t *prev_entry;   /* Pointer to next page to look at */
+    size_t overage;             /* Bytes still to give back */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(page_buf);
+
+    overage = H5MM_budget_overage(page_buf->page_size);
+
+    page_entry = page_buf->LRU_tail_ptr;
+    while(overage > 0 && page_entry) {
+        hbool_t is_raw = (H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type);
+
+        prev_entry = page_entry->prev;
+
+        if(!page_entry->is_dirty && (is_raw ? page_buf->raw_count > page_buf->min_raw_count
+                    : page_buf->meta_count > page_buf->min_meta_count)) {
+            /* Remove from page index */
+            if(NULL == H5SL_remove(page_buf->slist_ptr, &(page_entry->addr)))
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_BADVALUE, FAIL, "Page Entry is not in skip list")
+
+            /* Remove entry from LRU list */
+            H5PB__REMOVE_LRU(page_buf, page_entry)
+            HDassert(H5SL_count(page_buf->slist_ptr) == page_buf->LRU_list_len);
+
+            /* Decrement appropriate page type counter & update statistics */
+            if(is_raw) {
+                page_buf->raw_count--;
+                page_buf->evictions[1]++;
+            } /* end if */
+            else {
+                page_buf->meta_count--;
+                page_buf->evictions[0]++;
+            } /* end else */
+
+            /* Release page */
+            page_entry->page_buf_ptr = H5FL_FAC_FREE(page_buf->page_fac, page_entry->page_buf_ptr);
+            H5MM_budget_sub(H5_MEM_PAGE_BUFFER, page_buf->page_size);
+            page_entry = H5FL_FREE(H5PB_entry_t, page_entry);
+
+            overage = overage > page_buf->page_size ? overage - page_buf->page_size : 0;
+        } /* end if */
+
+        page_entry = prev_entry;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__budget_evict() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5PB__write_entry()
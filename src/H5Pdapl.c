@@ -96,6 +96,11 @@
 #define H5D_ACS_EFILE_PREFIX_COPY               H5P__dapl_efile_pref_copy
 #define H5D_ACS_EFILE_PREFIX_CMP                H5P__dapl_efile_pref_cmp
 #define H5D_ACS_EFILE_PREFIX_CLOSE              H5P__dapl_efile_pref_close
+/* Definitions for lazy dataset open */
+#define H5D_ACS_LAZY_OPEN_SIZE                  sizeof(hbool_t)
+#define H5D_ACS_LAZY_OPEN_DEF                   FALSE
+#define H5D_ACS_LAZY_OPEN_ENC                   H5P__encode_hbool_t
+#define H5D_ACS_LAZY_OPEN_DEC                   H5P__decode_hbool_t
 
 /******************/
 /* Local Typedefs */
@@ -199,6 +204,7 @@ H5P__dacc_reg_prop(H5P_genclass_t *pclass)
     double rdcc_w0 = H5D_ACS_PREEMPT_READ_CHUNKS_DEF;           /* Default raw data chunk cache dirty ratio */
     H5D_vds_view_t virtual_view = H5D_ACS_VDS_VIEW_DEF;         /* Default VDS view option */
     hsize_t printf_gap = H5D_ACS_VDS_PRINTF_GAP_DEF;            /* Default VDS printf gap */
+    hbool_t lazy_open = H5D_ACS_LAZY_OPEN_DEF;                  /* Default lazy open flag */
     herr_t ret_value = SUCCEED;         /* Return value */
 
     FUNC_ENTER_STATIC
@@ -248,6 +254,12 @@ H5P__dacc_reg_prop(H5P_genclass_t *pclass)
             H5D_ACS_EFILE_PREFIX_DEL, H5D_ACS_EFILE_PREFIX_COPY, H5D_ACS_EFILE_PREFIX_CMP, H5D_ACS_EFILE_PREFIX_CLOSE) < 0)
          HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the lazy open flag */
+    if(H5P_register_real(pclass, H5D_ACS_LAZY_OPEN_NAME, H5D_ACS_LAZY_OPEN_SIZE, &lazy_open,
+            NULL, NULL, NULL, H5D_ACS_LAZY_OPEN_ENC, H5D_ACS_LAZY_OPEN_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__dacc_reg_prop() */
@@ -1586,3 +1598,75 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_virtual_prefix() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_lazy_open
+ *
+ * Purpose:     Sets whether datasets opened with the access property
+ *              list, plist_id, are opened lazily.  A lazily opened
+ *              dataset only reads its datatype and dataspace when it is
+ *              opened; its storage layout, filter pipeline, fill value
+ *              and external file list are read, and its raw data chunk
+ *              cache set up, the first time they are needed (by I/O, or
+ *              by querying the dataset's creation property list or
+ *              storage, for example).  This makes opening many datasets
+ *              only to query their shapes or attributes cheaper.
+ *
+ *              The default is FALSE.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_lazy_open(hid_t plist_id, hbool_t lazy)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ib", plist_id, lazy);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if(H5P_set(plist, H5D_ACS_LAZY_OPEN_NAME, &lazy) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_lazy_open() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_lazy_open
+ *
+ * Purpose:     Gets whether datasets opened with the access property
+ *              list, plist_id, are opened lazily.  See H5Pset_lazy_open.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_lazy_open(hid_t plist_id, hbool_t *lazy)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*b", plist_id, lazy);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get value from property list */
+    if(lazy)
+        if(H5P_get(plist, H5D_ACS_LAZY_OPEN_NAME, lazy) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_lazy_open() */
+
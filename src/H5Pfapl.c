@@ -250,6 +250,21 @@
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEF            0
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_ENC            H5P__encode_unsigned
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEC            H5P__decode_unsigned
+/* Definition for the write-behind dirty ratio */
+#define H5F_ACS_WRITE_BEHIND_RATIO_SIZE         sizeof(double)
+#define H5F_ACS_WRITE_BEHIND_RATIO_DEF          0.0
+#define H5F_ACS_WRITE_BEHIND_RATIO_ENC          H5P__encode_double
+#define H5F_ACS_WRITE_BEHIND_RATIO_DEC          H5P__decode_double
+/* Definition for the number of metadata cache flush threads */
+#define H5F_ACS_MDC_FLUSH_THREADS_SIZE          sizeof(unsigned)
+#define H5F_ACS_MDC_FLUSH_THREADS_DEF           0
+#define H5F_ACS_MDC_FLUSH_THREADS_ENC           H5P__encode_unsigned
+#define H5F_ACS_MDC_FLUSH_THREADS_DEC           H5P__decode_unsigned
+/* Definition for the number of path lookup cache entries */
+#define H5F_ACS_PATH_CACHE_NENTRIES_SIZE        sizeof(size_t)
+#define H5F_ACS_PATH_CACHE_NENTRIES_DEF         0
+#define H5F_ACS_PATH_CACHE_NENTRIES_ENC         H5P__encode_size_t
+#define H5F_ACS_PATH_CACHE_NENTRIES_DEC         H5P__decode_size_t
 
 
 /******************/
@@ -386,6 +401,9 @@ static const H5AC_cache_image_config_t H5F_def_mdc_initCacheImageCfg_g = H5F_ACS
 static const size_t H5F_def_page_buf_size_g = H5F_ACS_PAGE_BUFFER_SIZE_DEF;      /* Default page buffer size */
 static const unsigned H5F_def_page_buf_min_meta_perc_g = H5F_ACS_PAGE_BUFFER_MIN_META_PERC_DEF;      /* Default page buffer minimum metadata size */
 static const unsigned H5F_def_page_buf_min_raw_perc_g = H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEF;      /* Default page buffer minumum raw data size */
+static const double H5F_def_write_behind_ratio_g = H5F_ACS_WRITE_BEHIND_RATIO_DEF;      /* Default write-behind dirty ratio */
+static const unsigned H5F_def_mdc_flush_threads_g = H5F_ACS_MDC_FLUSH_THREADS_DEF;    /* Default number of metadata cache flush threads */
+static const size_t H5F_def_path_cache_nentries_g = H5F_ACS_PATH_CACHE_NENTRIES_DEF;    /* Default number of path lookup cache entries */
 
 
 /*-------------------------------------------------------------------------
@@ -623,6 +641,24 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
             NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the write-behind dirty ratio */
+    if(H5P_register_real(pclass, H5F_ACS_WRITE_BEHIND_RATIO_NAME, H5F_ACS_WRITE_BEHIND_RATIO_SIZE, &H5F_def_write_behind_ratio_g,
+            NULL, NULL, NULL, H5F_ACS_WRITE_BEHIND_RATIO_ENC, H5F_ACS_WRITE_BEHIND_RATIO_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the number of metadata cache flush threads */
+    if(H5P_register_real(pclass, H5F_ACS_MDC_FLUSH_THREADS_NAME, H5F_ACS_MDC_FLUSH_THREADS_SIZE, &H5F_def_mdc_flush_threads_g,
+            NULL, NULL, NULL, H5F_ACS_MDC_FLUSH_THREADS_ENC, H5F_ACS_MDC_FLUSH_THREADS_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the number of path lookup cache entries */
+    if(H5P_register_real(pclass, H5F_ACS_PATH_CACHE_NENTRIES_NAME, H5F_ACS_PATH_CACHE_NENTRIES_SIZE, &H5F_def_path_cache_nentries_g,
+            NULL, NULL, NULL, H5F_ACS_PATH_CACHE_NENTRIES_ENC, H5F_ACS_PATH_CACHE_NENTRIES_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__facc_reg_prop() */
@@ -1722,6 +1758,7 @@ herr_t
 H5Pset_mdc_config(hid_t plist_id, H5AC_cache_config_t *config_ptr)
 {
     H5P_genplist_t *plist;      /* Property list pointer */
+    H5AC_cache_config_t config = H5AC__DEFAULT_CACHE_CONFIG;  /* Current version of the config */
     herr_t ret_value = SUCCEED;   /* return value */
 
     FUNC_ENTER_API(FAIL)
@@ -1735,13 +1772,17 @@ H5Pset_mdc_config(hid_t plist_id, H5AC_cache_config_t *config_ptr)
     if(H5AC_validate_config(config_ptr) < 0)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid metadata cache configuration")
 
-    /* set the modified config */
-
-    /* If we ever support multiple versions of H5AC_cache_config_t, we
-     * will have to test the version and do translation here.
+    /* set the modified config, translating version 1 configurations
+     * (which lack the replacement policy fields) to the current version.
      */
+    if(config_ptr->version == H5AC__CACHE_CONFIG_VERSION_1) {
+        HDmemcpy(&config, config_ptr, H5AC__CACHE_CONFIG_VERSION_1_SIZE);
+        config.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+    } /* end if */
+    else
+        config = *config_ptr;
 
-    if(H5P_set(plist, H5F_ACS_META_CACHE_INIT_CONFIG_NAME, config_ptr) < 0)
+    if(H5P_set(plist, H5F_ACS_META_CACHE_INIT_CONFIG_NAME, &config) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set metadata cache initial config")
 
 done:
@@ -1770,6 +1811,7 @@ herr_t
 H5Pget_mdc_config(hid_t plist_id, H5AC_cache_config_t *config_ptr)
 {
     H5P_genplist_t *plist;      /* Property list pointer */
+    H5AC_cache_config_t config;   /* Current version of the config */
     herr_t ret_value = SUCCEED;   /* return value */
 
     FUNC_ENTER_API(FAIL)
@@ -1783,18 +1825,21 @@ H5Pget_mdc_config(hid_t plist_id, H5AC_cache_config_t *config_ptr)
     if(config_ptr == NULL)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "NULL config_ptr on entry.")
 
-    if(config_ptr->version != H5AC__CURR_CACHE_CONFIG_VERSION)
+    if(!H5AC__CACHE_CONFIG_VERSION_OK(config_ptr->version))
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Unknown config version.")
 
-    /* If we ever support multiple versions of H5AC_cache_config_t, we
-     * will have to get the cannonical version here, and then translate
-     * to the version of the structure supplied.
-     */
-
     /* Get the current initial metadata cache resize configuration */
-    if(H5P_get(plist, H5F_ACS_META_CACHE_INIT_CONFIG_NAME, config_ptr) < 0)
+    if(H5P_get(plist, H5F_ACS_META_CACHE_INIT_CONFIG_NAME, &config) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET,FAIL, "can't get metadata cache initial resize config")
 
+    /* Translate to the version of the structure supplied */
+    if(config_ptr->version == H5AC__CACHE_CONFIG_VERSION_1) {
+        HDmemcpy(config_ptr, &config, H5AC__CACHE_CONFIG_VERSION_1_SIZE);
+        config_ptr->version = H5AC__CACHE_CONFIG_VERSION_1;
+    } /* end if */
+    else
+        *config_ptr = config;
+
 done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Pget_mdc_config() */
@@ -3403,6 +3448,12 @@ H5P__facc_cache_config_cmp(const void *_config1, const void *_config2, size_t H5
     if(config1->metadata_write_strategy < config2->metadata_write_strategy) HGOTO_DONE(-1);
     if(config1->metadata_write_strategy > config2->metadata_write_strategy) HGOTO_DONE(1);
 
+    if(config1->rp_policy < config2->rp_policy) HGOTO_DONE(-1);
+    if(config1->rp_policy > config2->rp_policy) HGOTO_DONE(1);
+
+    if(config1->rp_hot_fraction < config2->rp_hot_fraction) HGOTO_DONE(-1);
+    if(config1->rp_hot_fraction > config2->rp_hot_fraction) HGOTO_DONE(1);
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__facc_cache_config_cmp() */
@@ -3530,6 +3581,11 @@ H5P__facc_cache_config_enc(const void *value, void **_pp, size_t *size)
 
         /* int */
         INT32ENCODE(*pp, (int32_t)config->metadata_write_strategy);
+
+        /* enum */
+        *(*pp)++ = (uint8_t)config->rp_policy;
+
+        H5_ENCODE_DOUBLE(*pp, config->rp_hot_fraction);
     } /* end if */
 
     /* Compute encoded size of variably-encoded values */
@@ -3545,7 +3601,7 @@ H5P__facc_cache_config_enc(const void *value, void **_pp, size_t *size)
     *size += 1 + H5VM_limit_enc_size(enc_value);
 
     /* Compute encoded size of fixed-size values */
-    *size += (5 + (sizeof(unsigned) * 8) + (sizeof(double) * 8) +
+    *size += (6 + (sizeof(unsigned) * 8) + (sizeof(double) * 9) +
             (sizeof(int32_t) * 4) + sizeof(int64_t) +
             H5AC__MAX_TRACE_FILE_NAME_LEN + 1);
 
@@ -3683,6 +3739,18 @@ H5P__facc_cache_config_dec(const void **_pp, void *_value)
     /* int */
     INT32DECODE(*pp, config->metadata_write_strategy);
 
+    /* Version 1 configurations end here; the replacement policy fields
+     * keep their default values.
+     */
+    if(config->version >= 2) {
+        /* enum */
+        config->rp_policy = (enum H5C_cache_rp_policy)*(*pp)++;
+
+        H5_DECODE_DOUBLE(*pp, config->rp_hot_fraction);
+    } /* end if */
+    else
+        config->version = H5AC__CURR_CACHE_CONFIG_VERSION;
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__facc_cache_config_dec() */
@@ -4918,3 +4986,225 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_page_buffer_size() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_write_behind
+ *
+ * Purpose:     Enables writing dirty metadata cache entries and raw data
+ *              chunks to disk ahead of eviction.  Once more than
+ *              DIRTY_RATIO of a file's metadata cache, or of a dataset's
+ *              chunk cache, is dirty, dataset writes start trickling the
+ *              least recently used dirty entries to disk until half that
+ *              much is dirty.  In threadsafe builds this is done by the
+ *              library's background thread, between API calls.
+ *
+ *              A DIRTY_RATIO of 0 (the default) disables write-behind.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_write_behind(hid_t plist_id, double dirty_ratio)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "id", plist_id, dirty_ratio);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    if(dirty_ratio < 0.0 || dirty_ratio > 1.0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dirty ratio must be between 0 and 1 inclusive")
+
+    if(H5P_set(plist, H5F_ACS_WRITE_BEHIND_RATIO_NAME, &dirty_ratio) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set write-behind dirty ratio")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_write_behind() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_write_behind
+ *
+ * Purpose:     Retrieves the write-behind dirty ratio.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_write_behind(hid_t plist_id, double *dirty_ratio)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*d", plist_id, dirty_ratio);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    if(dirty_ratio)
+        if(H5P_get(plist, H5F_ACS_WRITE_BEHIND_RATIO_NAME, dirty_ratio) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get write-behind dirty ratio")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_write_behind() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_mdc_flush_threads
+ *
+ * Purpose:     Sets the number of threads that serialize (and checksum)
+ *              dirty metadata cache entries when a file's metadata cache
+ *              is flushed, e.g. by H5Fflush or H5Fclose.
+ *
+ *              With NTHREADS greater than 0, entries of object headers,
+ *              version 2 B-trees, extensible and fixed arrays and symbol
+ *              table nodes that have no dirty flush dependency children
+ *              are serialized in batches by NTHREADS threads (the calling
+ *              thread and NTHREADS - 1 helpers), and each batch is then
+ *              written in address order, with adjacent entries combined
+ *              into single writes.  The remaining entries are flushed as
+ *              usual.  Unless the library is built threadsafe, the calling
+ *              thread does all the serialization.
+ *
+ *              An NTHREADS of 0 (the default) flushes each entry on its
+ *              own, as it is serialized.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_mdc_flush_threads(hid_t plist_id, unsigned nthreads)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", plist_id, nthreads);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    if(nthreads > H5C__MAX_FLUSH_THREADS)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "number of flush threads is too large")
+
+    if(H5P_set(plist, H5F_ACS_MDC_FLUSH_THREADS_NAME, &nthreads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set number of metadata cache flush threads")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_mdc_flush_threads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_mdc_flush_threads
+ *
+ * Purpose:     Retrieves the number of metadata cache flush threads.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_mdc_flush_threads(hid_t plist_id, unsigned *nthreads)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*Iu", plist_id, nthreads);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    if(nthreads)
+        if(H5P_get(plist, H5F_ACS_MDC_FLUSH_THREADS_NAME, nthreads) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get number of metadata cache flush threads")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_mdc_flush_threads() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_path_cache
+ *
+ * Purpose:     Sets the number of entries in the file's path lookup
+ *              cache.  The cache remembers the links found when path names
+ *              are resolved, keyed on the group holding the link and the
+ *              link's name, so that opening objects by the same (deep)
+ *              paths again doesn't search each group's link storage.
+ *              Entries for a link are dropped when the link is removed
+ *              from its group.  The cache is not used for files opened
+ *              for SWMR reading, since another process can change them.
+ *
+ *              An NENTRIES of 0 (the default) disables the cache.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_path_cache(hid_t plist_id, size_t nentries)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", plist_id, nentries);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    if(H5P_set(plist, H5F_ACS_PATH_CACHE_NENTRIES_NAME, &nentries) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set number of path lookup cache entries")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_path_cache() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_path_cache
+ *
+ * Purpose:     Retrieves the number of entries in the path lookup cache.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_path_cache(hid_t plist_id, size_t *nentries)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*z", plist_id, nentries);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    if(nentries)
+        if(H5P_get(plist, H5F_ACS_PATH_CACHE_NENTRIES_NAME, nentries) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get number of path lookup cache entries")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_path_cache() */
+
@@ -42,6 +42,16 @@
 /* Local Macros */
 /****************/
 
+/* Slot in a property list's resolved property cache for a name pointer */
+#define H5P_PROP_CACHE_SLOT(N)                                              \
+    ((((size_t)(N)) ^ (((size_t)(N)) >> 5)) & (H5P_PROP_CACHE_SIZE - 1))
+
+/* Forget all the resolved properties of a property list (called whenever
+ * the list's changed or deleted properties are modified)
+ */
+#define H5P_PROP_CACHE_RESET(P)                                             \
+    HDmemset((P)->cache, 0, sizeof((P)->cache))
+
 
 /******************/
 /* Local Typedefs */
@@ -105,6 +115,10 @@ static herr_t H5P_free_prop(H5P_genprop_t *prop);
 static int H5P_cmp_prop(const H5P_genprop_t *prop1, const H5P_genprop_t *prop2);
 static herr_t H5P__do_prop(H5P_genplist_t *plist, const char *name, H5P_do_plist_op_t plist_op, 
     H5P_do_pclass_op_t pclass_op, void *udata);
+static H5P_genprop_t *H5P__search_prop(const H5P_genplist_t *plist, const char *name);
+static H5P_genprop_t *H5P__resolve_prop(H5P_genplist_t *plist, const char *name);
+static hbool_t H5P__class_prop_hidden(const H5P_genplist_t *plist,
+    const H5P_genclass_t *pclass, const char *name);
 
 
 /*********************/
@@ -754,9 +768,6 @@ H5P_copy_plist(const H5P_genplist_t *old_plist, hbool_t app_ref)
     H5P_genprop_t *new_prop;    /* New property created for copy */
     hid_t new_plist_id;         /* Property list ID of new list created */
     H5SL_node_t *curr_node;     /* Current node in skip list */
-    H5SL_t *seen=NULL;          /* Skip list containing properties already seen */
-    size_t nseen;               /* Number of items 'seen' */
-    hbool_t has_parent_class;   /* Flag to indicate that this property list's class has a parent */
     hid_t ret_value=FAIL;       /* return value */
 
     FUNC_ENTER_NOAPI(FAIL)
@@ -780,21 +791,12 @@ H5P_copy_plist(const H5P_genplist_t *old_plist, hbool_t app_ref)
     if((new_plist->props = H5SL_create(H5SL_TYPE_STR, NULL)) == NULL)
         HGOTO_ERROR(H5E_PLIST,H5E_CANTCREATE,FAIL,"can't create skip list for changed properties")
 
-    /* Create the skip list for deleted properties */
-    if((new_plist->del = H5SL_create(H5SL_TYPE_STR, NULL)) == NULL)
-        HGOTO_ERROR(H5E_PLIST,H5E_CANTCREATE,FAIL,"can't create skip list for deleted properties")
-
-    /* Create the skip list to hold names of properties already seen
-     * (This prevents a property in the class hierarchy from having it's
-     * 'create' callback called, if a property in the class hierarchy has
-     * already been seen)
-     */
-    if((seen = H5SL_create(H5SL_TYPE_STR, NULL))== NULL)
-        HGOTO_ERROR(H5E_PLIST,H5E_CANTCREATE,FAIL,"can't create skip list for seen properties")
-    nseen = 0;
-
     /* Cycle through the deleted properties & copy them into the new list's deleted section */
-    if(H5SL_count(old_plist->del)>0) {
+    if(old_plist->del && H5SL_count(old_plist->del)>0) {
+        /* Create the skip list for deleted properties */
+        if((new_plist->del = H5SL_create(H5SL_TYPE_STR, NULL)) == NULL)
+            HGOTO_ERROR(H5E_PLIST,H5E_CANTCREATE,FAIL,"can't create skip list for deleted properties")
+
         curr_node=H5SL_first(old_plist->del);
         while(curr_node) {
             char *new_name;   /* Pointer to new name */
@@ -804,13 +806,10 @@ H5P_copy_plist(const H5P_genplist_t *old_plist, hbool_t app_ref)
                 HGOTO_ERROR(H5E_RESOURCE,H5E_NOSPACE,FAIL,"memory allocation failed")
 
             /* Insert property name into deleted list */
-            if(H5SL_insert(new_plist->del,new_name,new_name) < 0)
+            if(H5SL_insert(new_plist->del,new_name,new_name) < 0) {
+                H5MM_xfree(new_name);
                 HGOTO_ERROR(H5E_PLIST,H5E_CANTINSERT,FAIL,"can't insert property into deleted skip list")
-
-            /* Add property name to "seen" list */
-            if(H5SL_insert(seen,new_name,new_name) < 0)
-                HGOTO_ERROR(H5E_PLIST,H5E_CANTINSERT,FAIL,"can't insert property into seen skip list")
-            nseen++;
+            } /* end if */
 
             /* Get the next property node in the skip list */
             curr_node=H5SL_next(curr_node);
@@ -842,11 +841,6 @@ H5P_copy_plist(const H5P_genplist_t *old_plist, hbool_t app_ref)
                 HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL,"Can't insert property into list")
             } /* end if */
 
-            /* Add property name to "seen" list */
-            if(H5SL_insert(seen,new_prop->name,new_prop->name) < 0)
-                HGOTO_ERROR(H5E_PLIST,H5E_CANTINSERT,FAIL,"can't insert property into seen skip list")
-            nseen++;
-
             /* Increment the number of properties in list */
             new_plist->nprops++;
 
@@ -860,7 +854,6 @@ H5P_copy_plist(const H5P_genplist_t *old_plist, hbool_t app_ref)
      * initialize each with default value & make property 'copy' callback.
      */
     tclass=old_plist->pclass;
-    has_parent_class = (hbool_t)(tclass != NULL && tclass->parent != NULL && tclass->parent->nprops > 0);
     while(tclass!=NULL) {
         if(tclass->nprops>0) {
             /* Walk through the properties in the old class */
@@ -869,8 +862,11 @@ H5P_copy_plist(const H5P_genplist_t *old_plist, hbool_t app_ref)
                 /* Get pointer to property from node */
                 tmp = (H5P_genprop_t *)H5SL_item(curr_node);
 
-                /* Only "copy" properties we haven't seen before */
-                if(nseen==0 || H5SL_search(seen,tmp->name) == NULL) {
+                /* Only "copy" properties that aren't hidden from the list */
+                /* (Check the old list, whose changed properties aren't
+                 *  modified by the 'copy' callbacks)
+                 */
+                if(!H5P__class_prop_hidden(old_plist, tclass, tmp->name)) {
                     /* Call property copy callback, if it exists */
                     if(tmp->copy) {
                         /* Call the callback & insert changed value into skip list (if necessary) */
@@ -878,13 +874,6 @@ H5P_copy_plist(const H5P_genplist_t *old_plist, hbool_t app_ref)
                             HGOTO_ERROR(H5E_PLIST, H5E_CANTCOPY, FAIL,"Can't create property")
                     } /* end if */
 
-                    /* Add property name to "seen" list, if we have other classes to work on */
-                    if(has_parent_class) {
-                        if(H5SL_insert(seen,tmp->name,tmp->name) < 0)
-                            HGOTO_ERROR(H5E_PLIST,H5E_CANTINSERT,FAIL,"can't insert property into seen skip list")
-                        nseen++;
-                    } /* end if */
-
                     /* Increment the number of properties in list */
                     new_plist->nprops++;
                 } /* end if */
@@ -933,10 +922,6 @@ H5P_copy_plist(const H5P_genplist_t *old_plist, hbool_t app_ref)
     ret_value=new_plist_id;
 
 done:
-    /* Release the list of 'seen' properties */
-    if(seen!=NULL)
-        H5SL_close(seen);
-
     if(ret_value<0 && new_plist)
         H5P_close(new_plist);
 
@@ -1211,36 +1196,193 @@ H5P__find_prop_plist(const H5P_genplist_t *plist, const char *name)
     HDassert(plist);
     HDassert(name);
 
+    /* Search the list and its class hierarchy */
+    if(NULL == (ret_value = H5P__search_prop(plist, name)))
+        HGOTO_ERROR(H5E_PLIST,H5E_NOTFOUND,NULL,"can't find property in skip list")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* H5P__find_prop_plist() */
+
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5P__search_prop
+ PURPOSE
+    Internal routine to search for a property in a property list and its
+    class hierarchy
+ USAGE
+    H5P_genprop_t *H5P__search_prop(plist, name)
+        const H5P_genplist_t *plist;  IN: Pointer to plist to check
+        const char *name;       IN: Name of property to check for
+ RETURNS
+    Returns pointer to property on success, NULL if the property doesn't
+    exist or was deleted from the list.
+ DESCRIPTION
+    Looks for a property in the list's deleted and changed properties, then
+    in its class and the class's parents.  No error is pushed when the
+    property isn't found.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static H5P_genprop_t *
+H5P__search_prop(const H5P_genplist_t *plist, const char *name)
+{
+    H5P_genclass_t *tclass;             /* Temporary class pointer */
+    H5P_genprop_t *ret_value = NULL;    /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(plist);
+    HDassert(name);
+
     /* Check if the property has been deleted from list */
-    if(H5SL_search(plist->del,name) != NULL) {
-        HGOTO_ERROR(H5E_PLIST, H5E_NOTFOUND, NULL, "property deleted from skip list")
+    if(plist->del && H5SL_search(plist->del, name) != NULL)
+        HGOTO_DONE(NULL)
+
+    /* Get the property data from the skip list */
+    if(NULL != (ret_value = (H5P_genprop_t *)H5SL_search(plist->props, name)))
+        HGOTO_DONE(ret_value)
+
+    /* Couldn't find property in list itself, start searching through class info */
+    tclass = plist->pclass;
+    while(tclass != NULL) {
+        /* Find the property in the class */
+        if(tclass->nprops > 0 && NULL != (ret_value = (H5P_genprop_t *)H5SL_search(tclass->props, name)))
+            /* Got pointer to property - leave now */
+            break;
+
+        /* Go up to parent class */
+        tclass = tclass->parent;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* H5P__search_prop() */
+
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5P__resolve_prop
+ PURPOSE
+    Internal routine to look up a property in a property list, through the
+    list's cache of resolved properties
+ USAGE
+    H5P_genprop_t *H5P__resolve_prop(plist, name)
+        H5P_genplist_t *plist;  IN: Pointer to plist to check
+        const char *name;       IN: Name of property to check for
+ RETURNS
+    Returns pointer to property on success, NULL if the property doesn't
+    exist or was deleted from the list.
+ DESCRIPTION
+        Property names are almost always passed as string constants, so the
+    address of the name is used to index a small cache in the property list.
+    On a hit, the property costs a pointer comparison and a string compare
+    to find, instead of searches of the deleted and changed property skip
+    lists and of every class up the hierarchy.  Misses fall back to
+    H5P__search_prop() and remember the result.
+
+        The cache holds pointers to properties in the list's skip list or in
+    its classes, so it is emptied when the list's changed or deleted
+    properties are modified, and whenever any class is modified (detected
+    by the global class revision counter moving on).
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static H5P_genprop_t *
+H5P__resolve_prop(H5P_genplist_t *plist, const char *name)
+{
+    H5P_prop_cache_ent_t *ent;          /* Cache entry for name */
+    H5P_genprop_t *ret_value = NULL;    /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(plist);
+    HDassert(name);
+
+    /* Drop the cached properties if any class was modified since they were found */
+    if(plist->cache_rev != H5P_next_rev) {
+        H5P_PROP_CACHE_RESET(plist);
+        plist->cache_rev = H5P_next_rev;
     } /* end if */
-    else {
-        /* Get the property data from the skip list */
-        if(NULL == (ret_value = (H5P_genprop_t *)H5SL_search(plist->props, name))) {
-            H5P_genclass_t *tclass;     /* Temporary class pointer */
 
-            /* Couldn't find property in list itself, start searching through class info */
-            tclass = plist->pclass;
-            while(tclass != NULL) {
-                /* Find the property in the class */
-                if(NULL != (ret_value = (H5P_genprop_t *)H5SL_search(tclass->props, name)))
-                    /* Got pointer to property - leave now */
-                    break;
+    /* Check the cache */
+    /* (The string compare guards against a caller's buffer being reused for
+     *  a different name)
+     */
+    ent = &plist->cache[H5P_PROP_CACHE_SLOT(name)];
+    if(ent->name == name && !HDstrcmp(name, ent->prop->name))
+        HGOTO_DONE(ent->prop)
+
+    /* Search for the property and remember it */
+    if(NULL != (ret_value = H5P__search_prop(plist, name))) {
+        ent->name = name;
+        ent->prop = ret_value;
+    } /* end if */
 
-                /* Go up to parent class */
-                tclass = tclass->parent;
-            } /* end while */
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* H5P__resolve_prop() */
 
-            /* Check if we haven't found the property */
-            if(ret_value == NULL)
-                HGOTO_ERROR(H5E_PLIST,H5E_NOTFOUND,NULL,"can't find property in skip list")
-        } /* end else */
-    } /* end else */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5P__class_prop_hidden
+ PURPOSE
+    Internal routine to check if a class's property is hidden from a
+    property list
+ USAGE
+    hbool_t H5P__class_prop_hidden(plist, pclass, name)
+        const H5P_genplist_t *plist;  IN: Pointer to plist to check
+        const H5P_genclass_t *pclass; IN: Class in the list's class hierarchy
+                                        that the property belongs to
+        const char *name;       IN: Name of property to check for
+ RETURNS
+    Returns TRUE if the property is hidden, FALSE if the list uses the class's
+    property.
+ DESCRIPTION
+    A property of one of the classes in a property list's class hierarchy is
+    hidden when the list holds its own (changed) copy of the property, when
+    the property was deleted from the list, or when a class between the
+    list's class and 'pclass' registers a property with the same name.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    Used instead of building a skip list of the property names already
+    "seen" when creating, copying and closing property lists.
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static hbool_t
+H5P__class_prop_hidden(const H5P_genplist_t *plist, const H5P_genclass_t *pclass,
+    const char *name)
+{
+    const H5P_genclass_t *tclass;       /* Temporary class pointer */
+    hbool_t ret_value = FALSE;          /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(plist);
+    HDassert(pclass);
+    HDassert(name);
+
+    /* Check the list's changed and deleted properties */
+    if(H5SL_count(plist->props) > 0 && NULL != H5SL_search(plist->props, name))
+        HGOTO_DONE(TRUE)
+    if(plist->del && NULL != H5SL_search(plist->del, name))
+        HGOTO_DONE(TRUE)
+
+    /* Check the classes derived from the property's class */
+    for(tclass = plist->pclass; tclass && tclass != pclass; tclass = tclass->parent)
+        if(tclass->nprops > 0 && NULL != H5SL_search(tclass->props, name))
+            HGOTO_DONE(TRUE)
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-}   /* H5P__find_prop_plist() */
+}   /* H5P__class_prop_hidden() */
 
 
 /*--------------------------------------------------------------------------
@@ -1671,7 +1813,6 @@ H5P_create(H5P_genclass_t *pclass)
     H5P_genclass_t *tclass;         /* Temporary class pointer */
     H5P_genplist_t *plist = NULL;   /* New property list created */
     H5P_genprop_t *tmp;             /* Temporary pointer to parent class properties */
-    H5SL_t *seen = NULL;            /* Skip list to hold names of properties already seen */
     H5P_genplist_t *ret_value = NULL;   /* Return value */
 
     FUNC_ENTER_NOAPI_NOINIT
@@ -1695,17 +1836,7 @@ H5P_create(H5P_genclass_t *pclass)
     if((plist->props = H5SL_create(H5SL_TYPE_STR, NULL)) == NULL)
         HGOTO_ERROR(H5E_PLIST,H5E_CANTCREATE,NULL,"can't create skip list for changed properties")
 
-    /* Create the skip list for deleted properties */
-    if((plist->del = H5SL_create(H5SL_TYPE_STR, NULL)) == NULL)
-        HGOTO_ERROR(H5E_PLIST,H5E_CANTCREATE,NULL,"can't create skip list for deleted properties")
-
-    /* Create the skip list to hold names of properties already seen
-     * (This prevents a property in the class hierarchy from having it's
-     * 'create' callback called, if a property in the class hierarchy has
-     * already been seen)
-     */
-    if((seen = H5SL_create(H5SL_TYPE_STR, NULL)) == NULL)
-        HGOTO_ERROR(H5E_PLIST,H5E_CANTCREATE,NULL,"can't create skip list for seen properties")
+    /* (The skip list for deleted properties is created on the first delete) */
 
     /*
      * Check if we should copy class properties (up through list of parent classes also),
@@ -1722,8 +1853,8 @@ H5P_create(H5P_genclass_t *pclass)
                 /* Get pointer to property from node */
                 tmp = (H5P_genprop_t *)H5SL_item(curr_node);
 
-                /* Only "create" properties we haven't seen before */
-                if(H5SL_search(seen,tmp->name) == NULL) {
+                /* Only "create" properties that a derived class doesn't override */
+                if(tclass == pclass || !H5P__class_prop_hidden(plist, tclass, tmp->name)) {
                     /* Call property creation callback, if it exists */
                     if(tmp->create) {
                         /* Call the callback & insert changed value into skip list (if necessary) */
@@ -1731,10 +1862,6 @@ H5P_create(H5P_genclass_t *pclass)
                             HGOTO_ERROR(H5E_PLIST, H5E_CANTCOPY, NULL,"Can't create property")
                     } /* end if */
 
-                    /* Add property name to "seen" list */
-                    if(H5SL_insert(seen,tmp->name,tmp->name) < 0)
-                        HGOTO_ERROR(H5E_PLIST,H5E_CANTINSERT,NULL,"can't insert property into seen skip list")
-
                     /* Increment the number of properties in list */
                     plist->nprops++;
                 } /* end if */
@@ -1756,10 +1883,6 @@ H5P_create(H5P_genclass_t *pclass)
     ret_value=plist;
 
 done:
-    /* Release the skip list of 'seen' properties */
-    if(seen!=NULL)
-        H5SL_close(seen);
-
     /* Release resources allocated on failure */
     if(ret_value==NULL) {
         if(plist!=NULL) {
@@ -2541,7 +2664,7 @@ H5P_insert(H5P_genplist_t *plist, const char *name, size_t size,
         HGOTO_ERROR(H5E_PLIST, H5E_EXISTS, FAIL, "property already exists")
 
     /* Check if the property has been deleted */
-    if(NULL != H5SL_search(plist->del, name)) {
+    if(plist->del && NULL != H5SL_search(plist->del, name)) {
         char *temp_name = NULL;
 
         /* Remove the property name from the deleted property skip list */
@@ -2583,6 +2706,9 @@ H5P_insert(H5P_genplist_t *plist, const char *name, size_t size,
     /* Increment property count for class */
     plist->nprops++;
 
+    /* Forget resolved properties */
+    H5P_PROP_CACHE_RESET(plist);
+
 done:
     if(ret_value < 0)
         if(new_prop && H5P_free_prop(new_prop) < 0)
@@ -2619,7 +2745,6 @@ static herr_t
 H5P__do_prop(H5P_genplist_t *plist, const char *name, H5P_do_plist_op_t plist_op, 
     H5P_do_pclass_op_t pclass_op, void *udata)
 {
-    H5P_genclass_t *tclass;     /* Temporary class pointer */
     H5P_genprop_t *prop;        /* Temporary property pointer */
     herr_t ret_value = SUCCEED; /* Return value */
 
@@ -2631,44 +2756,21 @@ H5P__do_prop(H5P_genplist_t *plist, const char *name, H5P_do_plist_op_t plist_op
     HDassert(plist_op);
     HDassert(pclass_op);
 
-    /* Check if the property has been deleted */
-    if(NULL != H5SL_search(plist->del, name))
+    /* Find the property, in the list's changed properties or in its class
+     * hierarchy
+     */
+    if(NULL == (prop = H5P__resolve_prop(plist, name)))
         HGOTO_ERROR(H5E_PLIST, H5E_NOTFOUND, FAIL, "property doesn't exist")
 
-    /* Find property in changed list */
-    if(NULL != (prop = (H5P_genprop_t *)H5SL_search(plist->props, name))) {
-        /* Call the 'found in propery list' callback */
+    /* Call the 'found in propery list' or 'found in class' callback */
+    if(prop->type == H5P_PROP_WITHIN_LIST) {
         if((*plist_op)(plist, name, prop, udata) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTOPERATE, FAIL, "can't operate on property")
     } /* end if */
     else {
-        /*
-         * Check if we should set class properties (up through list of parent classes also),
-         * & make property 'set' callback.
-         */
-        tclass = plist->pclass;
-        while(NULL != tclass) {
-            if(tclass->nprops > 0) {
-                /* Find the property in the class */
-                if(NULL != (prop = (H5P_genprop_t *)H5SL_search(tclass->props, name))) {
-                    /* Call the 'found in class' callback */
-                    if((*pclass_op)(plist, name, prop, udata) < 0)
-                        HGOTO_ERROR(H5E_PLIST, H5E_CANTOPERATE, FAIL, "can't operate on property")
-
-                    /* Leave */
-                    break;
-                } /* end if */
-            } /* end if */
-
-            /* Go up to parent class */
-            tclass = tclass->parent;
-        } /* end while */
-
-        /* If we get this far, then it wasn't in the list of changed properties,
-         * nor in the properties in the class hierarchy, indicate an error
-         */
-        if(NULL == tclass)
-            HGOTO_ERROR(H5E_PLIST, H5E_NOTFOUND, FAIL, "can't find property in skip list")
+        HDassert(prop->type == H5P_PROP_WITHIN_CLASS);
+        if((*pclass_op)(plist, name, prop, udata) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTOPERATE, FAIL, "can't operate on property")
     } /* end else */
 
 done:
@@ -2774,6 +2876,9 @@ H5P__poke_pclass_cb(H5P_genplist_t *plist, const char *name, H5P_genprop_t *prop
     if(H5P_add_prop(plist->props, pcopy) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL,"Can't insert changed property into skip list")
 
+    /* The list's copy now hides the class's property */
+    H5P_PROP_CACHE_RESET(plist);
+
 done:
     /* Cleanup on failure */
     if(ret_value < 0)
@@ -2972,6 +3077,9 @@ H5P__set_pclass_cb(H5P_genplist_t *plist, const char *name, H5P_genprop_t *prop,
     if(H5P_add_prop(plist->props, pcopy) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL,"Can't insert changed property into skip list")
 
+    /* The list's copy now hides the class's property */
+    H5P_PROP_CACHE_RESET(plist);
+
 done:
     /* Free the temporary value buffer */
     if(tmp_value != NULL && tmp_value != udata->value)
@@ -3071,31 +3179,9 @@ H5P_exist_plist(const H5P_genplist_t *plist, const char *name)
     HDassert(plist);
     HDassert(name);
 
-    /* Check for property in deleted property list */
-    if(H5SL_search(plist->del, name) != NULL)
-        ret_value = FALSE;
-    else {
-        /* Check for property in changed property list */
-        if(H5SL_search(plist->props, name) != NULL)
-            ret_value = TRUE;
-        else {
-            H5P_genclass_t *tclass;     /* Temporary class pointer */
-
-            tclass = plist->pclass;
-            while(tclass != NULL) {
-                if(H5SL_search(tclass->props, name) != NULL)
-                    HGOTO_DONE(TRUE)
-
-                /* Go up to parent class */
-                tclass = tclass->parent;
-            } /* end while */
-
-            /* If we've reached here, we couldn't find the property */
-            ret_value = FALSE;
-        } /* end else */
-    } /* end else */
+    /* Search the list and its class hierarchy */
+    ret_value = (H5P__search_prop(plist, name) != NULL);
 
-done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* H5P_exist_plist() */
 
@@ -3915,7 +4001,7 @@ H5P__iterate_plist_pclass_cb(void *_item, void *_key, void *_udata)
      * before and that haven't been deleted.
      */
     if(NULL == H5SL_search(udata->seen, key) &&
-            NULL == H5SL_search(udata->plist->del, key))
+            (NULL == udata->plist->del || NULL == H5SL_search(udata->plist->del, key)))
         ret_value = H5P__iterate_plist_cb(item, key, udata);
 
     FUNC_LEAVE_NOAPI(ret_value)
@@ -4430,6 +4516,10 @@ H5P__del_plist_cb(H5P_genplist_t *plist, const char *name, H5P_genprop_t *prop,
             HGOTO_ERROR(H5E_PLIST, H5E_CANTFREE, FAIL, "can't release property value")
     } /* end if */
 
+    /* Create the skip list for deleted properties, on the first delete */
+    if(NULL == plist->del && NULL == (plist->del = H5SL_create(H5SL_TYPE_STR, NULL)))
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTCREATE, FAIL, "can't create skip list for deleted properties")
+
     /* Duplicate string for insertion into new deleted property skip list */
     if(NULL == (del_name = H5MM_xstrdup(name)))
         HGOTO_ERROR(H5E_PLIST, H5E_CANTALLOC, FAIL, "memory allocation failed")
@@ -4438,6 +4528,9 @@ H5P__del_plist_cb(H5P_genplist_t *plist, const char *name, H5P_genprop_t *prop,
     if(H5SL_insert(plist->del, del_name, del_name) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into deleted skip list")
 
+    /* Forget resolved properties */
+    H5P_PROP_CACHE_RESET(plist);
+
     /* Remove the property from the skip list */
     if(NULL == H5SL_remove(plist->props, prop->name))
         HGOTO_ERROR(H5E_PLIST, H5E_CANTDELETE, FAIL, "can't remove property from skip list")
@@ -4506,6 +4599,10 @@ H5P__del_pclass_cb(H5P_genplist_t *plist, const char *name, H5P_genprop_t *prop,
             HGOTO_ERROR(H5E_PLIST, H5E_CANTINIT, FAIL, "can't close property value")
     } /* end if */
 
+    /* Create the skip list for deleted properties, on the first delete */
+    if(NULL == plist->del && NULL == (plist->del = H5SL_create(H5SL_TYPE_STR, NULL)))
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTCREATE, FAIL, "can't create skip list for deleted properties")
+
     /* Duplicate string for insertion into new deleted property skip list */
     if(NULL == (del_name = H5MM_xstrdup(name)))
         HGOTO_ERROR(H5E_PLIST, H5E_CANTALLOC, FAIL, "memory allocation failed")
@@ -4514,6 +4611,9 @@ H5P__del_pclass_cb(H5P_genplist_t *plist, const char *name, H5P_genprop_t *prop,
     if(H5SL_insert(plist->del, del_name, del_name) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into deleted skip list")
 
+    /* Forget resolved properties */
+    H5P_PROP_CACHE_RESET(plist);
+
     /* Decrement the number of properties in list */
     plist->nprops--;
 
@@ -4650,6 +4750,9 @@ H5P_copy_prop_plist(hid_t dst_id, hid_t src_id, const char *name)
 
         /* Increment the number of properties in list */
         dst_plist->nprops++;
+
+        /* Forget resolved properties */
+        H5P_PROP_CACHE_RESET(dst_plist);
     } /* end if */
     /* If not, get the information required to do an H5Pinsert2 with the property into the destination list */
     else {
@@ -4674,6 +4777,9 @@ H5P_copy_prop_plist(hid_t dst_id, hid_t src_id, const char *name)
 
         /* Increment property count for class */
         dst_plist->nprops++;
+
+        /* Forget resolved properties */
+        H5P_PROP_CACHE_RESET(dst_plist);
     } /* end else */
 
 done:
@@ -4857,10 +4963,6 @@ H5P_close(void *_plist)
 {
     H5P_genclass_t *tclass;         /* Temporary class pointer */
     H5P_genplist_t *plist=(H5P_genplist_t *)_plist;
-    H5SL_t *seen=NULL;              /* Skip list to hold names of properties already seen */
-    size_t nseen;                   /* Number of items 'seen' */
-    hbool_t has_parent_class;       /* Flag to indicate that this property list's class has a parent */
-    size_t ndel;                    /* Number of items deleted */
     H5SL_node_t *curr_node;         /* Current node in skip list */
     H5P_genprop_t *tmp;             /* Temporary pointer to properties */
     unsigned make_cb=0;             /* Operator data for property free callback */
@@ -4886,15 +4988,6 @@ H5P_close(void *_plist)
         } /* end while */
     } /* end if */
 
-    /* Create the skip list to hold names of properties already seen
-     * (This prevents a property in the class hierarchy from having it's
-     * 'close' callback called, if a property in the class hierarchy has
-     * already been seen)
-     */
-    if((seen = H5SL_create(H5SL_TYPE_STR, NULL)) == NULL)
-        HGOTO_ERROR(H5E_PLIST,H5E_CANTCREATE,FAIL,"can't create skip list for seen properties")
-    nseen = 0;
-
     /* Walk through the changed properties in the list */
     if(H5SL_count(plist->props)>0) {
         curr_node=H5SL_first(plist->props);
@@ -4908,25 +5001,16 @@ H5P_close(void *_plist)
                 (tmp->close)(tmp->name,tmp->size,tmp->value);
             } /* end if */
 
-            /* Add property name to "seen" list */
-            if(H5SL_insert(seen,tmp->name,tmp->name) < 0)
-                HGOTO_ERROR(H5E_PLIST,H5E_CANTINSERT,FAIL,"can't insert property into seen skip list")
-            nseen++;
-
             /* Get the next property node in the skip list */
             curr_node=H5SL_next(curr_node);
         } /* end while */
     } /* end if */
 
-    /* Determine number of deleted items from property list */
-    ndel=H5SL_count(plist->del);
-
     /*
      * Check if we should remove class properties (up through list of parent classes also),
      * initialize each with default value & make property 'remove' callback.
      */
     tclass=plist->pclass;
-    has_parent_class = (hbool_t)(tclass != NULL && tclass->parent != NULL && tclass->parent->nprops > 0);
     while(tclass!=NULL) {
         if(tclass->nprops>0) {
             /* Walk through the properties in the class */
@@ -4935,11 +5019,10 @@ H5P_close(void *_plist)
                 /* Get pointer to property from node */
                 tmp = (H5P_genprop_t *)H5SL_item(curr_node);
 
-                /* Only "delete" properties we haven't seen before
-                 * and that haven't already been deleted
+                /* Only "delete" properties that aren't hidden from the list
+                 * (changed, overridden or already deleted)
                  */
-                if((nseen==0 || H5SL_search(seen,tmp->name) == NULL) &&
-                        (ndel==0 || H5SL_search(plist->del,tmp->name) == NULL)) {
+                if(!H5P__class_prop_hidden(plist, tclass, tmp->name)) {
 
                     /* Call property close callback, if it exists */
                     if(tmp->close) {
@@ -4956,13 +5039,6 @@ H5P_close(void *_plist)
                         /* Release the temporary value buffer */
                         H5MM_xfree(tmp_value);
                     } /* end if */
-
-                    /* Add property name to "seen" list, if we have other classes to work on */
-                    if(has_parent_class) {
-                        if(H5SL_insert(seen,tmp->name,tmp->name) < 0)
-                            HGOTO_ERROR(H5E_PLIST,H5E_CANTINSERT,FAIL,"can't insert property into seen skip list")
-                        nseen++;
-                    } /* end if */
                 } /* end if */
 
                 /* Get the next property node in the skip list */
@@ -4978,12 +5054,9 @@ H5P_close(void *_plist)
     if(H5P_access_class(plist->pclass,H5P_MOD_DEC_LST) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINIT, FAIL, "Can't decrement class ref count")
 
-    /* Free the list of 'seen' properties */
-    H5SL_close(seen);
-    seen=NULL;
-
     /* Free the list of deleted property names */
-    H5SL_destroy(plist->del,H5P_free_del_name_cb,NULL);
+    if(plist->del)
+        H5SL_destroy(plist->del,H5P_free_del_name_cb,NULL);
 
     /* Free the properties */
     H5SL_destroy(plist->props,H5P_free_prop_cb,&make_cb);
@@ -4992,10 +5065,6 @@ H5P_close(void *_plist)
     plist = H5FL_FREE(H5P_genplist_t, plist);
 
 done:
-    /* Release the skip list of 'seen' properties */
-    if(seen != NULL)
-        H5SL_close(seen);
-
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* H5P_close() */
 
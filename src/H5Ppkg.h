@@ -36,6 +36,11 @@
 /* Package Private Macros */
 /**************************/
 
+/* Number of entries in a property list's cache of resolved properties
+ * (must be a power of two)
+ */
+#define H5P_PROP_CACHE_SIZE     32
+
 
 /****************************/
 /* Package Private Typedefs */
@@ -103,14 +108,29 @@ struct H5P_genclass_t {
     void *close_data;      /* Pointer to user data to pass along to close callback */
 };
 
+/* Entry in a property list's cache of resolved properties */
+typedef struct H5P_prop_cache_ent_t {
+    const char *name;   /* Name pointer the property was looked up with */
+    H5P_genprop_t *prop; /* Property found, in the list or in a class */
+} H5P_prop_cache_ent_t;
+
 /* Define structure to hold property list information */
 struct H5P_genplist_t {
     H5P_genclass_t *pclass; /* Pointer to class info */
     hid_t   plist_id;   /* Copy of the property list ID (for use in close callback) */
     size_t  nprops;     /* Number of properties in class */
     hbool_t class_init; /* Whether the class initialization callback finished successfully */
-    H5SL_t *del;        /* Skip list containing names of deleted properties */
+    H5SL_t *del;        /* Skip list containing names of deleted properties (created on first delete) */
     H5SL_t *props;      /* Skip list containing properties */
+
+    /* Cache of properties already resolved by name, so that repeated
+     * lookups skip the skip list and class hierarchy searches.  Entries
+     * are indexed by the address of the name string they were looked up
+     * with and are only valid while 'cache_rev' matches the current class
+     * revision counter.
+     */
+    unsigned cache_rev; /* Class revision counter when cache was filled */
+    H5P_prop_cache_ent_t cache[H5P_PROP_CACHE_SIZE]; /* Resolved properties */
 };
 
 /* Property list/class iterator callback function pointer */
@@ -369,6 +369,12 @@ H5_DLL herr_t H5Pset_mdc_image_config(hid_t plist_id, H5AC_cache_image_config_t
 H5_DLL herr_t H5Pget_mdc_image_config(hid_t plist_id, H5AC_cache_image_config_t *config_ptr /*out*/);
 H5_DLL herr_t H5Pset_page_buffer_size(hid_t plist_id, size_t buf_size, unsigned min_meta_per, unsigned min_raw_per);
 H5_DLL herr_t H5Pget_page_buffer_size(hid_t plist_id, size_t *buf_size, unsigned *min_meta_per, unsigned *min_raw_per);
+H5_DLL herr_t H5Pset_write_behind(hid_t plist_id, double dirty_ratio);
+H5_DLL herr_t H5Pget_write_behind(hid_t plist_id, double *dirty_ratio);
+H5_DLL herr_t H5Pset_mdc_flush_threads(hid_t plist_id, unsigned nthreads);
+H5_DLL herr_t H5Pget_mdc_flush_threads(hid_t plist_id, unsigned *nthreads);
+H5_DLL herr_t H5Pset_path_cache(hid_t plist_id, size_t nentries);
+H5_DLL herr_t H5Pget_path_cache(hid_t plist_id, size_t *nentries);
 
 /* Dataset creation property list (DCPL) routines */
 H5_DLL herr_t H5Pset_layout(hid_t plist_id, H5D_layout_t layout);
@@ -428,6 +434,8 @@ H5_DLL herr_t H5Pget_append_flush(hid_t plist_id, unsigned dims,
     hsize_t boundary[], H5D_append_cb_t *func, void **udata);
 H5_DLL herr_t H5Pset_efile_prefix(hid_t dapl_id, const char* prefix);
 H5_DLL ssize_t H5Pget_efile_prefix(hid_t dapl_id, char* prefix /*out*/, size_t size);
+H5_DLL herr_t H5Pset_lazy_open(hid_t plist_id, hbool_t lazy);
+H5_DLL herr_t H5Pget_lazy_open(hid_t plist_id, hbool_t *lazy);
 
 /* Dataset xfer property list (DXPL) routines */
 H5_DLL herr_t H5Pset_data_transform(hid_t plist_id, const char* expression);
@@ -1687,6 +1687,7 @@ H5Tcopy(hid_t type_id)
         case H5I_ERROR_CLASS:
         case H5I_ERROR_MSG:
         case H5I_ERROR_STACK:
+        case H5I_EVENTSET:
         case H5I_NTYPES:
         default:
             HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype or dataset")
@@ -3256,7 +3257,10 @@ H5T_copy(H5T_t *old_dt, H5T_copy_t method)
                         /* Apply the accumulated size change to the offset of the field */
                         new_dt->shared->u.compnd.memb[i].offset += (size_t) accum_change;
 
-                        if(old_dt->shared->u.compnd.sorted != H5T_SORT_VALUE) {
+                        /* The members are copied in order, so check the
+                         * same member first before searching for it */
+                        if(old_dt->shared->u.compnd.sorted != H5T_SORT_VALUE
+                                && HDstrcmp(new_dt->shared->u.compnd.memb[i].name, old_dt->shared->u.compnd.memb[i].name)) {
                             for(old_match = -1, j = 0; j < old_dt->shared->u.compnd.nmembs; j++) {
                                 if(!HDstrcmp(new_dt->shared->u.compnd.memb[i].name, old_dt->shared->u.compnd.memb[j].name)) {
                                     old_match = (int) j;
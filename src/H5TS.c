@@ -26,6 +26,17 @@ typedef struct H5TS_cancel_struct {
     unsigned int cancel_count;
 } H5TS_cancel_t;
 
+/* Per-thread state for the global API lock */
+typedef struct H5TS_api_ctx_t {
+    unsigned depth;             /* Nesting depth of API calls */
+    hbool_t shared;             /* Whether the outermost API call is shared */
+    unsigned excl_depth;        /* Depth of the outermost exclusive API call, 0 if none */
+    unsigned reyield_depth;     /* Depth at which to release the lock again, 0 if none */
+    hbool_t yielded;            /* Whether the lock is released around I/O */
+    hbool_t yield_ok;           /* Whether the caller allows releasing the lock */
+    unsigned int saved_count;   /* Lock count to restore when resuming */
+} H5TS_api_ctx_t;
+
 /* Global variable definitions */
 #ifdef H5_HAVE_WIN_THREADS
 H5TS_once_t H5TS_first_init_g;
@@ -35,6 +46,14 @@ H5TS_once_t H5TS_first_init_g = PTHREAD_ONCE_INIT;
 H5TS_key_t H5TS_errstk_key_g;
 H5TS_key_t H5TS_funcstk_key_g;
 H5TS_key_t H5TS_cancel_key_g;
+#ifndef H5_HAVE_WIN_THREADS
+static H5TS_key_t H5TS_tid_key_g;
+static H5TS_key_t H5TS_api_key_g;
+
+/* Mutex & counter for handing out thread identifiers */
+static pthread_mutex_t H5TS_tid_mutex_g;
+static uint64_t H5TS_tid_next_g = 0;
+#endif /* H5_HAVE_WIN_THREADS */
 
 
 /*--------------------------------------------------------------------------
@@ -102,6 +121,12 @@ H5TS_pthread_first_thread_init(void)
     pthread_mutex_init(&H5_g.init_lock.atomic_lock, NULL);
     pthread_cond_init(&H5_g.init_lock.cond_var, NULL);
     H5_g.init_lock.lock_count = 0;
+    pthread_cond_init(&H5_g.init_lock.yield_cond, NULL);
+    H5_g.init_lock.nyielded = 0;
+    pthread_cond_init(&H5_g.init_lock.api_cond, NULL);
+    H5_g.init_lock.nshared = 0;
+    H5_g.init_lock.nexcl_waiting = 0;
+    H5_g.init_lock.excl = FALSE;
 
     /* initialize key for thread-specific error stacks */
     pthread_key_create(&H5TS_errstk_key_g, H5TS_key_destructor);
@@ -111,6 +136,13 @@ H5TS_pthread_first_thread_init(void)
 
     /* initialize key for thread cancellability mechanism */
     pthread_key_create(&H5TS_cancel_key_g, H5TS_key_destructor);
+
+    /* initialize key & counter for thread identifiers */
+    pthread_key_create(&H5TS_tid_key_g, H5TS_key_destructor);
+    pthread_mutex_init(&H5TS_tid_mutex_g, NULL);
+
+    /* initialize key for thread-specific API lock state */
+    pthread_key_create(&H5TS_api_key_g, H5TS_key_destructor);
 }
 #endif /* H5_HAVE_WIN_THREADS */
 
@@ -214,7 +246,436 @@ H5TS_mutex_unlock(H5TS_mutex_t *mutex)
 #endif /* H5_HAVE_WIN_THREADS */
 } /* H5TS_mutex_unlock */
 
+#ifndef H5_HAVE_WIN_THREADS
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS__api_ctx
+ *
+ * RETURNS
+ *    The calling thread's API lock state, or NULL if it couldn't be
+ *    allocated.
+ *
+ *--------------------------------------------------------------------------
+ */
+static H5TS_api_ctx_t *
+H5TS__api_ctx(void)
+{
+    H5TS_api_ctx_t *ctx;
+
+    ctx = (H5TS_api_ctx_t *)H5TS_get_thread_local_value(H5TS_api_key_g);
+
+    if(!ctx) {
+        /* Don't use H5MM calls here since the destructor has to use HDfree in
+         * order to avoid codestack calls.
+         */
+        if(NULL == (ctx = (H5TS_api_ctx_t *)HDcalloc(1, sizeof(H5TS_api_ctx_t))))
+            return NULL;
+
+        if(pthread_setspecific(H5TS_api_key_g, (void *)ctx)) {
+            HDfree(ctx);
+            return NULL;
+        } /* end if */
+    } /* end if */
+
+    return ctx;
+} /* end H5TS__api_ctx() */
+
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS__api_release
+ *
+ * DESCRIPTION
+ *    Releases every level of the calling thread's hold on the API mutex,
+ *    counting the thread as yielded until H5TS__api_reacquire is called.
+ *
+ *--------------------------------------------------------------------------
+ */
+static void
+H5TS__api_release(H5TS_mutex_t *mutex, H5TS_api_ctx_t *ctx)
+{
+    pthread_mutex_lock(&mutex->atomic_lock);
+    ctx->saved_count = mutex->lock_count;
+    mutex->lock_count = 0;
+    mutex->nyielded++;
+    pthread_mutex_unlock(&mutex->atomic_lock);
+    pthread_cond_signal(&mutex->cond_var);
+
+    ctx->yielded = TRUE;
+} /* end H5TS__api_release() */
+
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS__api_reacquire
+ *
+ * DESCRIPTION
+ *    Takes the API mutex back after H5TS__api_release, restoring the
+ *    thread's lock count.  The thread stops counting as yielded before it
+ *    waits, so that an exclusive caller holding the mutex and waiting for
+ *    yielded threads to drain can't deadlock with it.
+ *
+ *--------------------------------------------------------------------------
+ */
+static void
+H5TS__api_reacquire(H5TS_mutex_t *mutex, H5TS_api_ctx_t *ctx)
+{
+    pthread_mutex_lock(&mutex->atomic_lock);
+    if(0 == --mutex->nyielded)
+        pthread_cond_broadcast(&mutex->yield_cond);
+    while(mutex->lock_count)
+        pthread_cond_wait(&mutex->cond_var, &mutex->atomic_lock);
+    mutex->owner_thread = HDpthread_self();
+    mutex->lock_count = ctx->saved_count;
+    pthread_mutex_unlock(&mutex->atomic_lock);
+
+    ctx->yielded = FALSE;
+} /* end H5TS__api_reacquire() */
+#endif /* H5_HAVE_WIN_THREADS */
+
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_api_lock
+ *
+ * USAGE
+ *    H5TS_api_lock(shared)
+ *
+ * RETURNS
+ *    0 on success and non-zero on error.
+ *
+ * DESCRIPTION
+ *    Takes the global API lock on entry to an API routine.
+ *
+ *    The outermost API call on a thread's stack is either SHARED, for
+ *    routines that only read library state, or exclusive.  Any number of
+ *    threads may be in shared calls at once, but an exclusive call waits
+ *    for all of them to finish, and new shared calls wait for waiting
+ *    exclusive ones.  Every call also holds the recursive API mutex, which
+ *    threads in shared calls release only around raw data I/O (see
+ *    H5TS_api_yield).
+ *
+ *    An exclusive call nested in a shared one (e.g. from a callback) stops
+ *    the thread from yielding and waits for other threads' yielded I/O to
+ *    finish.  A thread that re-enters the library while yielded (e.g. from
+ *    a user-defined filter) takes the mutex back first and releases it
+ *    again when the nested call returns.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_api_lock(hbool_t shared)
+{
+#ifdef H5_HAVE_WIN_THREADS
+    return H5TS_mutex_lock(&H5_g.init_lock);
+#else /* H5_HAVE_WIN_THREADS */
+    H5TS_mutex_t *mutex = &H5_g.init_lock;
+    H5TS_api_ctx_t *ctx = H5TS__api_ctx();
+    herr_t ret_value;
+
+    if(!ctx)
+        return H5TS_mutex_lock(mutex);
+
+    if(ctx->yielded) {
+        H5TS__api_reacquire(mutex, ctx);
+        ctx->reyield_depth = ctx->depth;
+    } /* end if */
+
+    /* Outermost call: wait for our turn as a shared or exclusive caller */
+    if(0 == ctx->depth) {
+        pthread_mutex_lock(&mutex->atomic_lock);
+        if(shared) {
+            while(mutex->excl || mutex->nexcl_waiting)
+                pthread_cond_wait(&mutex->api_cond, &mutex->atomic_lock);
+            mutex->nshared++;
+        } /* end if */
+        else {
+            mutex->nexcl_waiting++;
+            while(mutex->excl || mutex->nshared)
+                pthread_cond_wait(&mutex->api_cond, &mutex->atomic_lock);
+            mutex->nexcl_waiting--;
+            mutex->excl = TRUE;
+        } /* end else */
+        pthread_mutex_unlock(&mutex->atomic_lock);
+        ctx->shared = shared;
+    } /* end if */
+
+    if(0 != (ret_value = H5TS_mutex_lock(mutex)))
+        return ret_value;
+
+    ctx->depth++;
+    if(!shared && 0 == ctx->excl_depth) {
+        ctx->excl_depth = ctx->depth;
+
+        /* An exclusive call nested in a shared one must wait for other
+         * threads' I/O without the lock.  Holding the mutex keeps new
+         * threads from yielding, so this only waits for those already
+         * doing so.
+         */
+        if(ctx->shared) {
+            pthread_mutex_lock(&mutex->atomic_lock);
+            while(mutex->nyielded)
+                pthread_cond_wait(&mutex->yield_cond, &mutex->atomic_lock);
+            pthread_mutex_unlock(&mutex->atomic_lock);
+        } /* end if */
+    } /* end if */
+
+    return ret_value;
+#endif /* H5_HAVE_WIN_THREADS */
+} /* end H5TS_api_lock() */
+
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_api_unlock
+ *
+ * USAGE
+ *    H5TS_api_unlock()
+ *
+ * RETURNS
+ *    0 on success and non-zero on error.
+ *
+ * DESCRIPTION
+ *    Releases the global API lock on exit from an API routine.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_api_unlock(void)
+{
+#ifdef H5_HAVE_WIN_THREADS
+    return H5TS_mutex_unlock(&H5_g.init_lock);
+#else /* H5_HAVE_WIN_THREADS */
+    H5TS_mutex_t *mutex = &H5_g.init_lock;
+    H5TS_api_ctx_t *ctx;
+    herr_t ret_value;
+
+    ctx = (H5TS_api_ctx_t *)H5TS_get_thread_local_value(H5TS_api_key_g);
+    if(!ctx || 0 == ctx->depth)
+        return H5TS_mutex_unlock(mutex);
+
+    if(ctx->excl_depth == ctx->depth)
+        ctx->excl_depth = 0;
+    ctx->depth--;
+
+    ret_value = H5TS_mutex_unlock(mutex);
+
+    if(0 == ctx->depth) {
+        /* Let waiting callers in */
+        pthread_mutex_lock(&mutex->atomic_lock);
+        if(ctx->shared)
+            mutex->nshared--;
+        else
+            mutex->excl = FALSE;
+        pthread_mutex_unlock(&mutex->atomic_lock);
+        pthread_cond_broadcast(&mutex->api_cond);
+    } /* end if */
+    else if(ctx->reyield_depth && ctx->reyield_depth == ctx->depth) {
+        /* Back in the region the thread re-entered the library from */
+        ctx->reyield_depth = 0;
+        H5TS__api_release(mutex, ctx);
+    } /* end if */
+
+    return ret_value;
+#endif /* H5_HAVE_WIN_THREADS */
+} /* end H5TS_api_unlock() */
+
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_api_allow_yield
+ *
+ * USAGE
+ *    prev = H5TS_api_allow_yield(allow)
+ *
+ * RETURNS
+ *    The previous setting.
+ *
+ * DESCRIPTION
+ *    Sets whether the calling thread may release the global API lock in
+ *    H5TS_api_yield, for the file driver's raw data reads and the filter
+ *    pipeline's filter calls below the caller.  Callers set this around
+ *    reading and unfiltering data into buffers no other thread can see.
+ *
+ *--------------------------------------------------------------------------
+ */
+hbool_t
+H5TS_api_allow_yield(hbool_t allow)
+{
+#ifdef H5_HAVE_WIN_THREADS
+    return FALSE;
+#else /* H5_HAVE_WIN_THREADS */
+    H5TS_api_ctx_t *ctx;
+    hbool_t prev;
+
+    ctx = (H5TS_api_ctx_t *)H5TS_get_thread_local_value(H5TS_api_key_g);
+    if(!ctx)
+        return FALSE;
+
+    prev = ctx->yield_ok;
+    ctx->yield_ok = allow;
+
+    return prev;
+#endif /* H5_HAVE_WIN_THREADS */
+} /* end H5TS_api_allow_yield() */
+
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_api_yield
+ *
+ * USAGE
+ *    yielded = H5TS_api_yield()
+ *
+ * RETURNS
+ *    TRUE if the global API lock was released, FALSE otherwise.
+ *
+ * DESCRIPTION
+ *    Lets other threads use the library while the caller works on
+ *    private buffers (reading raw data or running a filter).  The lock is
+ *    only released when allowed by H5TS_api_allow_yield and every API
+ *    routine on the calling thread's stack was entered shared.  The caller
+ *    must not touch any shared library state until it calls
+ *    H5TS_api_resume; pushing errors onto the thread's error stack is
+ *    allowed.
+ *
+ *--------------------------------------------------------------------------
+ */
+hbool_t
+H5TS_api_yield(void)
+{
+#ifdef H5_HAVE_WIN_THREADS
+    return FALSE;
+#else /* H5_HAVE_WIN_THREADS */
+    H5TS_api_ctx_t *ctx;
+
+    ctx = (H5TS_api_ctx_t *)H5TS_get_thread_local_value(H5TS_api_key_g);
+    if(!ctx || !ctx->yield_ok || ctx->yielded || 0 == ctx->depth || !ctx->shared || ctx->excl_depth)
+        return FALSE;
+
+    H5TS__api_release(&H5_g.init_lock, ctx);
+
+    return TRUE;
+#endif /* H5_HAVE_WIN_THREADS */
+} /* end H5TS_api_yield() */
+
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_api_resume
+ *
+ * USAGE
+ *    resumed = H5TS_api_resume()
+ *
+ * RETURNS
+ *    TRUE if the calling thread had yielded and took the global API lock
+ *    back, FALSE if it was not yielded.
+ *
+ *--------------------------------------------------------------------------
+ */
+hbool_t
+H5TS_api_resume(void)
+{
+#ifdef H5_HAVE_WIN_THREADS
+    return FALSE;
+#else /* H5_HAVE_WIN_THREADS */
+    H5TS_api_ctx_t *ctx;
+
+    ctx = (H5TS_api_ctx_t *)H5TS_get_thread_local_value(H5TS_api_key_g);
+    if(!ctx || !ctx->yielded)
+        return FALSE;
+
+    H5TS__api_reacquire(&H5_g.init_lock, ctx);
+
+    return TRUE;
+#endif /* H5_HAVE_WIN_THREADS */
+} /* end H5TS_api_resume() */
+
 
+#ifndef H5_HAVE_WIN_THREADS
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_api_cond_wait
+ *
+ * USAGE
+ *    H5TS_api_cond_wait(cond, cond_mutex)
+ *
+ * RETURNS
+ *    0 on success and non-zero on error.
+ *
+ * DESCRIPTION
+ *    Waits on COND, as pthread_cond_wait does, for a thread holding the
+ *    global API lock.  The lock is released entirely while waiting, so
+ *    that other threads can take it, and taken back afterward at the same
+ *    depth and in the same mode.  COND_MUTEX must be held by the caller
+ *    and is held again on return.  It is released before the API lock is
+ *    taken back, so it must never be held while taking the API lock.
+ *
+ *    Other threads' API calls may run while the caller waits, so this may
+ *    only be called where the library's state is consistent.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_api_cond_wait(pthread_cond_t *cond, pthread_mutex_t *cond_mutex)
+{
+    H5TS_mutex_t *mutex = &H5_g.init_lock;
+    H5TS_api_ctx_t *ctx;
+    hbool_t in_api;
+    unsigned int saved_count;
+    herr_t ret_value;
+
+    ctx = (H5TS_api_ctx_t *)H5TS_get_thread_local_value(H5TS_api_key_g);
+    in_api = (hbool_t)(ctx && ctx->depth > 0);
+
+    /* Release every level of the lock, and let waiting API calls in */
+    pthread_mutex_lock(&mutex->atomic_lock);
+    saved_count = mutex->lock_count;
+    mutex->lock_count = 0;
+    if(in_api) {
+        if(ctx->shared)
+            mutex->nshared--;
+        else
+            mutex->excl = FALSE;
+    } /* end if */
+    pthread_mutex_unlock(&mutex->atomic_lock);
+    pthread_cond_signal(&mutex->cond_var);
+    pthread_cond_broadcast(&mutex->api_cond);
+
+    ret_value = pthread_cond_wait(cond, cond_mutex);
+    pthread_mutex_unlock(cond_mutex);
+
+    /* Take the lock back, as H5TS_api_lock would */
+    pthread_mutex_lock(&mutex->atomic_lock);
+    if(in_api) {
+        if(ctx->shared) {
+            while(mutex->excl || mutex->nexcl_waiting)
+                pthread_cond_wait(&mutex->api_cond, &mutex->atomic_lock);
+            mutex->nshared++;
+        } /* end if */
+        else {
+            mutex->nexcl_waiting++;
+            while(mutex->excl || mutex->nshared)
+                pthread_cond_wait(&mutex->api_cond, &mutex->atomic_lock);
+            mutex->nexcl_waiting--;
+            mutex->excl = TRUE;
+        } /* end else */
+    } /* end if */
+    while(mutex->lock_count)
+        pthread_cond_wait(&mutex->cond_var, &mutex->atomic_lock);
+    mutex->owner_thread = HDpthread_self();
+    mutex->lock_count = saved_count;
+    pthread_mutex_unlock(&mutex->atomic_lock);
+
+    pthread_mutex_lock(cond_mutex);
+
+    return ret_value;
+} /* end H5TS_api_cond_wait() */
+#endif /* H5_HAVE_WIN_THREADS */
+
+
 /*--------------------------------------------------------------------------
  * NAME
  *    H5TS_cancel_count_inc
@@ -282,6 +743,60 @@ H5TS_cancel_count_inc(void)
 }
 
 
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_thread_id
+ *
+ * USAGE
+ *    H5TS_thread_id()
+ *
+ * RETURNS
+ *    An identifier for the calling thread, or 0 if one couldn't be
+ *    assigned.
+ *
+ * DESCRIPTION
+ *    With pthreads, each thread is given a small integer (starting at 1)
+ *    the first time it calls this routine, in the order threads call it.
+ *    With Win32 threads, the system's thread identifier is returned.
+ *
+ *--------------------------------------------------------------------------
+ */
+uint64_t
+H5TS_thread_id(void)
+{
+#ifdef  H5_HAVE_WIN_THREADS
+    return (uint64_t)GetCurrentThreadId();
+#else /* H5_HAVE_WIN_THREADS */
+    uint64_t *tid;
+
+    tid = (uint64_t *)H5TS_get_thread_local_value(H5TS_tid_key_g);
+
+    if(!tid) {
+        /*
+         * First time thread asks for its ID - assign the next one and
+         * associate it with key.
+         *
+         * Don't use H5MM calls here since the destructor has to use HDfree in
+         * order to avoid codestack calls.
+         */
+        if(NULL == (tid = (uint64_t *)HDmalloc(sizeof(uint64_t))))
+            return 0;
+
+        pthread_mutex_lock(&H5TS_tid_mutex_g);
+        *tid = ++H5TS_tid_next_g;
+        pthread_mutex_unlock(&H5TS_tid_mutex_g);
+
+        if(pthread_setspecific(H5TS_tid_key_g, (void *)tid)) {
+            HDfree(tid);
+            return 0;
+        } /* end if */
+    } /* end if */
+
+    return *tid;
+#endif /* H5_HAVE_WIN_THREADS */
+} /* end H5TS_thread_id() */
+
+
 /*--------------------------------------------------------------------------
  * NAME
  *    H5TS_cancel_count_dec
@@ -80,6 +80,12 @@ typedef struct H5TS_mutex_struct {
     pthread_mutex_t atomic_lock;	/* lock for atomicity of new mechanism */
     pthread_cond_t cond_var;		/* condition variable */
     unsigned int lock_count;
+    unsigned int nyielded;		/* # of threads that released the lock around I/O */
+    pthread_cond_t yield_cond;		/* signalled when no thread is yielded */
+    unsigned int nshared;		/* # of threads in shared API calls */
+    unsigned int nexcl_waiting;		/* # of threads waiting to make exclusive API calls */
+    hbool_t excl;			/* Whether a thread is in an exclusive API call */
+    pthread_cond_t api_cond;		/* signalled when API calls finish */
 } H5TS_mutex_t;
 typedef pthread_t      H5TS_thread_t;
 typedef pthread_attr_t H5TS_attr_t;
@@ -118,8 +124,17 @@ extern      "C"
 H5_DLL void   H5TS_pthread_first_thread_init(void);
 H5_DLL herr_t H5TS_mutex_lock(H5TS_mutex_t *mutex);
 H5_DLL herr_t H5TS_mutex_unlock(H5TS_mutex_t *mutex);
+H5_DLL herr_t H5TS_api_lock(hbool_t shared);
+H5_DLL herr_t H5TS_api_unlock(void);
+H5_DLL hbool_t H5TS_api_allow_yield(hbool_t allow);
+H5_DLL hbool_t H5TS_api_yield(void);
+H5_DLL hbool_t H5TS_api_resume(void);
+#ifndef H5_HAVE_WIN_THREADS
+H5_DLL herr_t H5TS_api_cond_wait(pthread_cond_t *cond, pthread_mutex_t *cond_mutex);
+#endif /* H5_HAVE_WIN_THREADS */
 H5_DLL herr_t H5TS_cancel_count_inc(void);
 H5_DLL herr_t H5TS_cancel_count_dec(void);
+H5_DLL uint64_t H5TS_thread_id(void);
 H5_DLL H5TS_thread_t H5TS_create_thread(void *(*func)(void *), H5TS_attr_t * attr, void *udata);
 
 #if defined c_plusplus || defined __cplusplus
@@ -1264,8 +1264,22 @@ H5Z_pipeline(const H5O_pline_t *pline, unsigned flags,
 #endif
             tmp_flags = flags | (pline->filter[idx].flags);
             tmp_flags |= (edc_read== H5Z_DISABLE_EDC) ? H5Z_FLAG_SKIP_EDC : 0;
+#if defined(H5_HAVE_THREADSAFE) && !defined(H5Z_DEBUG)
+            {
+                H5Z_func_t filter = fclass->filter;     /* The filter table may move while unlocked */
+                hbool_t yielded;                        /* Whether the API lock was released for the filter */
+
+                /* Let other shared API calls into the library while the filter runs, if the caller allowed it */
+                yielded = H5TS_api_yield();
+                new_nbytes = (filter)(tmp_flags, pline->filter[idx].cd_nelmts,
+                                        pline->filter[idx].cd_values, *nbytes, buf_size, buf);
+                if(yielded)
+                    H5TS_api_resume();
+            }
+#else /* defined(H5_HAVE_THREADSAFE) && !defined(H5Z_DEBUG) */
             new_nbytes = (fclass->filter)(tmp_flags, pline->filter[idx].cd_nelmts,
                                         pline->filter[idx].cd_values, *nbytes, buf_size, buf);
+#endif /* defined(H5_HAVE_THREADSAFE) && !defined(H5Z_DEBUG) */
 
 #ifdef H5Z_DEBUG
             H5_timer_end (&(fstats->stats[1].timer), &timer);
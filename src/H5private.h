@@ -587,6 +587,7 @@ H5_DLL void H5_timer_end (H5_timer_t *sum/*in,out*/,
          H5_timer_t *timer/*in,out*/);
 H5_DLL void H5_bandwidth(char *buf/*out*/, double nbytes, double nseconds);
 H5_DLL time_t H5_now(void);
+H5_DLL uint64_t H5_now_usec(void);
 
 /* Depth of object copy */
 typedef enum {
@@ -702,6 +703,9 @@ typedef struct {
 #ifndef HDclock
     #define HDclock()    clock()
 #endif /* HDclock */
+#ifndef HDclock_gettime
+    #define HDclock_gettime(C,T)  clock_gettime(C,T)
+#endif /* HDclock_gettime */
 #ifndef HDclose
     #define HDclose(F)    close(F)
 #endif /* HDclose */
@@ -1148,6 +1152,9 @@ typedef off_t               h5_stat_size_t;
 #ifndef HDpowf
     #define HDpowf(X,Y)   powf(X,Y)
 #endif /* HDpowf */
+#ifndef HDpread
+    #define HDpread(F,M,Z,O)    pread(F,M,Z,O)
+#endif /* HDpread */
 #ifndef HDprintf
     #define HDprintf(...)   HDfprintf(stdout, __VA_ARGS__)
 #endif /* HDprintf */
@@ -1717,6 +1724,8 @@ typedef struct H5_debug_t {
     FILE    *trace;    /*API trace output stream  */
     hbool_t             ttop;           /*Show only top-level calls?    */
     hbool_t             ttimes;         /*Show trace event times?       */
+    hbool_t             apistats;       /*Collect API call statistics?  */
+    FILE                *apistats_out;  /*Stream to dump them to at close */
     struct {
   const char  *name;    /*package name      */
   FILE    *stream;  /*output stream  or NULL    */
@@ -1908,9 +1917,11 @@ typedef struct H5_api_struct {
 
 /* Macros for threadsafe HDF-5 Phase I locks */
 #define H5_API_LOCK                                                           \
-     H5TS_mutex_lock(&H5_g.init_lock);
+     H5TS_api_lock(FALSE);
+#define H5_API_LOCK_SHARED                                                    \
+     H5TS_api_lock(TRUE);
 #define H5_API_UNLOCK                                                         \
-     H5TS_mutex_unlock(&H5_g.init_lock);
+     H5TS_api_unlock();
 
 /* Macros for thread cancellation-safe mechanism */
 #define H5_API_UNSET_CANCEL                                                   \
@@ -1928,6 +1939,7 @@ extern H5_api_t H5_g;
 
 /* disable locks (sequential version) */
 #define H5_API_LOCK
+#define H5_API_LOCK_SHARED
 #define H5_API_UNLOCK
 
 /* disable cancelability (sequential version) */
@@ -2021,11 +2033,56 @@ extern hbool_t H5_MPEinit_g;   /* Has the MPE Library been initialized? */
                                                                               \
    /* Grab the mutex for the library */                                       \
    H5_API_UNSET_CANCEL                                                        \
-   H5_API_LOCK
+   H5_API_LOCK                                                                \
+                                                                              \
+   /* Start timing the call */                                                \
+   H5_API_STATS_BEGIN
+
+/* Threadsafety initialization code for API routines that only read library state */
+#define FUNC_ENTER_API_THREADSAFE_SHARED                                      \
+   /* Initialize the thread-safe code */                                      \
+   H5_FIRST_THREAD_INIT                                                       \
+                                                                              \
+   /* Grab the mutex for the library, in shared mode */                       \
+   H5_API_UNSET_CANCEL                                                        \
+   H5_API_LOCK_SHARED                                                         \
+                                                                              \
+   /* Start timing the call */                                                \
+   H5_API_STATS_BEGIN
+
+/* Call statistics for an API routine (see H5set_api_stats) */
+typedef struct H5_api_stat_t {
+    H5_api_stats_t stats;               /* Statistics reported */
+    struct H5_api_stat_t *next;         /* Next routine in the list of those called */
+} H5_api_stat_t;
+
+H5_DLL void H5_api_stats_update(H5_api_stat_t **statp, const char *func,
+    uint64_t start_usec);
+
+/*
+ * Time API calls while statistics are being collected.  Each routine keeps
+ * a pointer to its statistics, which are allocated on its first timed call.
+ * The statistics are updated while the API lock is held.
+ */
+#define H5_API_STATS_VARS                                                     \
+    static H5_api_stat_t *H5_api_stat = NULL;                                 \
+    hbool_t H5_api_stats_timed = FALSE;                                       \
+    uint64_t H5_api_stats_start = 0;
+
+#define H5_API_STATS_BEGIN                                                    \
+    if(H5_debug_g.apistats) {                                                 \
+        H5_api_stats_timed = TRUE;                                            \
+        H5_api_stats_start = H5_now_usec();                                   \
+    } /* end if */
+
+#define H5_API_STATS_END                                                      \
+    if(H5_api_stats_timed)                                                    \
+        H5_api_stats_update(&H5_api_stat, FUNC, H5_api_stats_start);
 
 /* Local variables for API routines */
 #define FUNC_ENTER_API_VARS                                                   \
     MPE_LOG_VARS                                                              \
+    H5_API_STATS_VARS                                                         \
     H5TRACE_DECL
 
 #define FUNC_ENTER_API_COMMON                                                 \
@@ -2057,6 +2114,20 @@ extern hbool_t H5_MPEinit_g;   /* Has the MPE Library been initialized? */
     H5E_clear_stack(NULL);                                                    \
     {
 
+/*
+ * Use this macro for API functions that only read the library's state, so
+ *      that (in the thread-safe library) other such calls may run while they
+ *      read and unfilter raw data, like H5Dread and H5Oget_info.
+ */
+#define FUNC_ENTER_API_SHARED(err) {{                                         \
+    FUNC_ENTER_API_VARS                                                       \
+    FUNC_ENTER_COMMON(H5_IS_API(FUNC));                                       \
+    FUNC_ENTER_API_THREADSAFE_SHARED;                                         \
+    FUNC_ENTER_API_INIT(err);                                                 \
+    /* Clear thread error stack entering public functions */                  \
+    H5E_clear_stack(NULL);                                                    \
+    {
+
 /*
  * Use this macro for API functions that shouldn't clear the error stack
  *      like H5Eprint and H5Ewalk.
@@ -2253,6 +2324,7 @@ extern hbool_t H5_MPEinit_g;   /* Has the MPE Library been initialized? */
  */
 /* Threadsafety termination code for API routines */
 #define FUNC_LEAVE_API_THREADSAFE                                             \
+    H5_API_STATS_END                                                          \
     H5_API_UNLOCK                                                             \
     H5_API_SET_CANCEL
 
@@ -2595,6 +2667,7 @@ H5_DLL int H5AC_term_package(void);
 H5_DLL int H5D_term_package(void);
 H5_DLL int H5D_top_term_package(void);
 H5_DLL int H5E_term_package(void);
+H5_DLL int H5ES_term_package(void);
 H5_DLL int H5F_term_package(void);
 H5_DLL int H5FD_term_package(void);
 H5_DLL int H5FL_term_package(void);
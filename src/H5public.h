@@ -325,6 +325,55 @@ typedef struct H5_ih_info_t {
     hsize_t     heap_size;
 } H5_ih_info_t;
 
+/*
+ * Kinds of free lists the library keeps, in the order of the limits
+ * passed to H5set_free_list_limits()
+ */
+typedef enum H5_free_list_type_t {
+    H5_FREE_LIST_REG,		/* Lists of fixed-size objects		*/
+    H5_FREE_LIST_ARR,		/* Lists of arrays			*/
+    H5_FREE_LIST_BLK,		/* Lists of blocks and sequences	*/
+    H5_FREE_LIST_FAC		/* Factory lists of fixed-size blocks	*/
+} H5_free_list_type_t;
+
+/* Components of the library's memory budget (see H5set_memory_limit) */
+typedef enum H5_mem_component_t {
+    H5_MEM_METADATA_CACHE,	/* Metadata cache entries		*/
+    H5_MEM_CHUNK_CACHE,		/* Raw data chunk cache entries		*/
+    H5_MEM_PAGE_BUFFER,		/* Page buffer pages			*/
+    H5_MEM_ACCUMULATOR,		/* Metadata accumulator buffers		*/
+    H5_MEM_SIEVE_BUFFER,	/* Contiguous dataset sieve buffers	*/
+    H5_MEM_FREE_LISTS,		/* Memory held on the free lists	*/
+    H5_MEM_NCOMPONENTS		/* Number of components (must be last)	*/
+} H5_mem_component_t;
+
+/*
+ * Usage statistics for one free list, returned by H5get_free_list_stats()
+ */
+typedef struct H5_free_list_stats_t {
+    const char  *name;          /* Name of the list, or NULL for factories */
+    H5_free_list_type_t type;   /* Kind of free list */
+    size_t      size;           /* Size of the blocks, or 0 if they vary */
+    size_t      mem_held;       /* Bytes held on the list for reuse */
+    unsigned    allocated;      /* Blocks allocated and not yet released */
+    unsigned    onlist;         /* Blocks held on the list for reuse */
+    hsize_t     nrequests;      /* Allocation requests made of the list */
+    hsize_t     nhits;          /* Requests served from blocks held */
+} H5_free_list_stats_t;
+
+/*
+ * Call statistics for one API routine, returned by H5get_api_stats()
+ */
+#define H5_API_STATS_NBUCKETS   24
+typedef struct H5_api_stats_t {
+    const char  *name;          /* Name of the API routine */
+    hsize_t     ncalls;         /* Number of calls made */
+    hsize_t     total_usec;     /* Total latency of the calls, in microseconds */
+    hsize_t     max_usec;       /* Latency of the slowest call, in microseconds */
+    hsize_t     latency[H5_API_STATS_NBUCKETS]; /* Latency histogram, with the */
+                                /* same buckets as H5F_io_op_stats_t */
+} H5_api_stats_t;
+
 /* Functions in H5.c */
 H5_DLL herr_t H5open(void);
 H5_DLL herr_t H5close(void);
@@ -333,6 +382,13 @@ H5_DLL herr_t H5garbage_collect(void);
 H5_DLL herr_t H5set_free_list_limits (int reg_global_lim, int reg_list_lim,
                 int arr_global_lim, int arr_list_lim, int blk_global_lim,
                 int blk_list_lim);
+H5_DLL herr_t H5get_free_list_stats(H5_free_list_stats_t stats[], size_t *nlists);
+H5_DLL herr_t H5set_api_stats(hbool_t enable);
+H5_DLL herr_t H5get_api_stats(H5_api_stats_t stats[], size_t *nfuncs);
+H5_DLL herr_t H5reset_api_stats(void);
+H5_DLL herr_t H5set_memory_limit(size_t limit);
+H5_DLL herr_t H5get_memory_limit(size_t *limit);
+H5_DLL herr_t H5get_memory_usage(size_t usage[], size_t *total);
 H5_DLL herr_t H5get_libversion(unsigned *majnum, unsigned *minnum,
 				unsigned *relnum);
 H5_DLL herr_t H5check_version(unsigned majnum, unsigned minnum,
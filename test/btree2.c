@@ -39,6 +39,7 @@ const char *FILENAME[] = {
 #define INSERT_MANY_REC         (2700 * 1000)
 #define FIND_MANY               (INSERT_MANY / 100)
 #define FIND_MANY_REC           (INSERT_MANY_REC / 100)
+#define BULK_LOAD_MANY          (100 * 1000)
 #define FIND_NEIGHBOR           2000
 #define DELETE_SMALL            20
 #define DELETE_MEDIUM           200
@@ -3190,6 +3191,205 @@ error:
 } /* test_insert_lots() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:	test_bulk_load
+ *
+ * Purpose:	Tests for building a v2 B-tree from sorted records at once,
+ *		then modifying it with the regular insert & remove routines.
+ *
+ * Return:	Success:	0
+ *		Failure:	1
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_bulk_load(hid_t fapl, const H5B2_create_t *cparam,
+    const bt2_test_param_t *tparam)
+{
+    hid_t	file = -1;              /* File ID */
+    char	filename[1024];         /* Filename to use */
+    H5F_t	*f = NULL;              /* Internal file object pointer */
+    hid_t       dxpl = H5AC_ind_read_dxpl_id;        /* DXPL to use */
+    H5B2_t      *bt2 = NULL;            /* v2 B-tree wrapper */
+    haddr_t     bt2_addr;               /* Address of B-tree created */
+    hsize_t     record;                 /* Record to insert into tree */
+    hsize_t     idx;                    /* Index within B-tree, for iterator */
+    hsize_t     *records = NULL;        /* Sorted records to load */
+    hsize_t     nrec;                   /* Number of records in B-tree */
+    H5B2_stat_t bt2_stat;               /* Statistics about B-tree created */
+    unsigned    u;                      /* Local index variable */
+    herr_t      ret;                    /* Generic error return value */
+
+    /*
+     * Test bulk loading records into v2 B-tree
+     */
+    TESTING("B-tree bulk load: build B-tree from sorted records");
+
+    /* Allocate & initialize the records */
+    if(NULL == (records = (hsize_t *)HDmalloc(sizeof(hsize_t) * BULK_LOAD_MANY)))
+        TEST_ERROR
+    for(u = 0; u < BULK_LOAD_MANY; u++)
+        records[u] = u;
+
+    /* Set the filename to use for this test (dependent on fapl) */
+    h5_fixname(FILENAME[0], fapl, filename, sizeof(filename));
+
+    /* Create the file to work on */
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR
+
+    /* Get a pointer to the internal file object */
+    if(NULL == (f = (H5F_t *)H5I_object(file)))
+        STACK_ERROR
+
+    /* Ignore metadata tags in the file's cache */
+    if(H5AC_ignore_tags(f) < 0)
+        STACK_ERROR
+
+    /* A few records fit in the root leaf */
+    if(create_btree(f, dxpl, cparam, &bt2, &bt2_addr) < 0)
+        TEST_ERROR
+    if(H5B2_bulk_load(bt2, dxpl, (size_t)5, records) < 0)
+        FAIL_STACK_ERROR
+    if(reopen_btree(f, dxpl, &bt2, bt2_addr, tparam) < 0)
+        TEST_ERROR
+    bt2_stat.depth = 0;
+    bt2_stat.nrecords = 5;
+    if(check_stats(bt2, &bt2_stat) < 0)
+        TEST_ERROR
+    idx = 0;
+    if(H5B2_iterate(bt2, dxpl, iter_cb, &idx) < 0)
+        FAIL_STACK_ERROR
+    if(idx != 5)
+        TEST_ERROR
+
+    /* Only empty B-trees can be bulk loaded */
+    H5E_BEGIN_TRY {
+        ret = H5B2_bulk_load(bt2, dxpl, (size_t)BULK_LOAD_MANY, records);
+    } H5E_END_TRY;
+    if(ret != FAIL)
+        TEST_ERROR
+    if(H5B2_close(bt2, dxpl) < 0)
+        FAIL_STACK_ERROR
+    bt2 = NULL;
+
+    /* Load enough records for several levels */
+    if(create_btree(f, dxpl, cparam, &bt2, &bt2_addr) < 0)
+        TEST_ERROR
+    if(H5B2_bulk_load(bt2, dxpl, (size_t)BULK_LOAD_MANY, records) < 0)
+        FAIL_STACK_ERROR
+
+    /* Close & re-open the file */
+    if(H5B2_close(bt2, dxpl) < 0)
+        FAIL_STACK_ERROR
+    bt2 = NULL;
+    if(H5Fclose(file) < 0)
+        STACK_ERROR
+    if((file = H5Fopen(filename, H5F_ACC_RDWR, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if(NULL == (f = (H5F_t *)H5I_object(file)))
+        FAIL_STACK_ERROR
+    if(H5AC_ignore_tags(f) < 0)
+        STACK_ERROR
+    if(NULL == (bt2 = H5B2_open(f, dxpl, bt2_addr, f)))
+        FAIL_STACK_ERROR
+
+    /* Check the records, in order and by index */
+    if(H5B2_get_nrec(bt2, &nrec) < 0)
+        FAIL_STACK_ERROR
+    if(nrec != BULK_LOAD_MANY)
+        TEST_ERROR
+    idx = 0;
+    if(H5B2_iterate(bt2, dxpl, iter_cb, &idx) < 0)
+        FAIL_STACK_ERROR
+    if(idx != BULK_LOAD_MANY)
+        TEST_ERROR
+    for(u = 0; u < BULK_LOAD_MANY; u += 97) {
+        idx = u;
+        if(H5B2_find(bt2, dxpl, &idx, find_cb, &idx) != TRUE)
+            FAIL_STACK_ERROR
+        if(H5B2_index(bt2, dxpl, H5_ITER_INC, (hsize_t)u, remove_cb, &record) < 0)
+            FAIL_STACK_ERROR
+        if(record != u)
+            TEST_ERROR
+        if(H5B2_index(bt2, dxpl, H5_ITER_DEC, (hsize_t)u, remove_cb, &record) < 0)
+            FAIL_STACK_ERROR
+        if(record != BULK_LOAD_MANY - (u + 1))
+            TEST_ERROR
+    } /* end for */
+    idx = BULK_LOAD_MANY;
+    if(H5B2_find(bt2, dxpl, &idx, find_cb, &idx) != FALSE)
+        TEST_ERROR
+
+    PASSED();
+
+    TESTING("B-tree bulk load: modify bulk loaded B-tree");
+
+    /* Check for closing & re-opening the B-tree */
+    if(reopen_btree(f, dxpl, &bt2, bt2_addr, tparam) < 0)
+        TEST_ERROR
+
+    /* Add records after the loaded ones, splitting the packed nodes */
+    for(u = 0; u < BULK_LOAD_MANY / 4; u++) {
+        record = BULK_LOAD_MANY + u;
+        if(H5B2_insert(bt2, dxpl, &record) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    /* A record that was bulk loaded can't be inserted again */
+    record = BULK_LOAD_MANY / 2;
+    H5E_BEGIN_TRY {
+        ret = H5B2_insert(bt2, dxpl, &record);
+    } H5E_END_TRY;
+    if(ret != FAIL)
+        TEST_ERROR
+
+    /* Remove the first records, merging the packed nodes */
+    for(u = 0; u < BULK_LOAD_MANY / 4; u++) {
+        record = u;
+        if(H5B2_remove(bt2, dxpl, &record, NULL, NULL) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Check the records again */
+    if(reopen_btree(f, dxpl, &bt2, bt2_addr, tparam) < 0)
+        TEST_ERROR
+    if(H5B2_get_nrec(bt2, &nrec) < 0)
+        FAIL_STACK_ERROR
+    if(nrec != BULK_LOAD_MANY)
+        TEST_ERROR
+    idx = BULK_LOAD_MANY / 4;
+    if(H5B2_iterate(bt2, dxpl, iter_cb, &idx) < 0)
+        FAIL_STACK_ERROR
+    if(idx != BULK_LOAD_MANY + (BULK_LOAD_MANY / 4))
+        TEST_ERROR
+
+    /* Close the v2 B-tree */
+    if(H5B2_close(bt2, dxpl) < 0)
+        FAIL_STACK_ERROR
+    bt2 = NULL;
+
+    /* Close file */
+    if(H5Fclose(file) < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    HDfree(records);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        if(bt2)
+            H5B2_close(bt2, dxpl);
+	H5Fclose(file);
+    } H5E_END_TRY;
+    HDfree(records);
+    return 1;
+} /* test_bulk_load() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	test_update_basic
  *
@@ -10040,6 +10240,9 @@ main(void)
         else
             nerrors += test_insert_lots(fapl, &cparam, &tparam);
 
+        /* Test building B-trees from sorted records */
+        nerrors += test_bulk_load(fapl, &cparam, &tparam);
+
         /* Test B-tree record update (ie. insert/modify) */
         /* (Iteration, find & index routines exercised in these routines as well) */
         nerrors += test_update_basic(fapl, &cparam2, &tparam);
@@ -200,6 +200,8 @@ static void cedds__H5C_make_space_in_cache(H5F_t * file_ptr);
 static void cedds__H5C__autoadjust__ageout__evict_aged_out_entries(H5F_t * file_ptr);
 static void cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr);
 static unsigned check_stats(unsigned paged);
+static unsigned check_index_resize(unsigned paged);
+static unsigned check_2q_scan_resistance(unsigned paged);
 #if H5C_COLLECT_CACHE_STATS
 static void check_stats__smoke_check_1(H5F_t * file_ptr);
 #endif /* H5C_COLLECT_CACHE_STATS */
@@ -35547,17 +35549,14 @@ cedds__H5C__autoadjust__ageout__evict_aged_out_entries(H5F_t * file_ptr)
  *
  *		!!!!!!!!!!WARNING !!!!!!!!!!
  *
- *		This test may fail to function correctly if the hash 
- *		table size or hash function is altered.  
- *
  *		To setup the test, this function depends on the fact that 
  *		H5C_flush_invalidate_cache() does alternating scans of the
  *		slist and the index.  If this changes, the test will likely
  *		also cease to function correctly.
  *
- *		The test relies on a known hash function and hash table 
- *		size to select a set of test entries that will all hash 
- *		to the same hash bucket -- call it the test hash bucket.  
+ *		The test searches the monster entries for a set of test 
+ *		entries that all hash to the same hash bucket under the
+ *		current hash table size -- call it the test hash bucket.  
  *		It also relies on known behavior of the cache to place 
  *		the entries in the test bucket in a known order.
  *
@@ -35615,8 +35614,10 @@ static void
 cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
 {
     H5C_t *                    cache_ptr = file_ptr->shared->cache;
-    int		               i;
+    int		               i, j;
     int		               expected_hash_bucket = 0;
+    int		               bucket_idx[4];
+    int		               dirty_idx = -1;
     herr_t	               result;
     haddr_t                    entry_addr;
     test_entry_t *             entry_ptr;
@@ -35678,6 +35679,42 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
 	H5C_stats__reset(cache_ptr);
 
 
+        /* find three more entries that hash to the same bucket as
+         * (MET, 0), and a later entry that hashes to another bucket.
+         * The bucket depends on the hash function and current hash
+         * table size, so the entries are searched for rather than
+         * fixed.
+         */
+        base_addr = entries[MONSTER_ENTRY_TYPE];
+        entry_addr = base_addr[0].addr;
+        expected_hash_bucket = H5C__HASH_FCN(cache_ptr, entry_addr);
+
+        bucket_idx[0] = 0;
+        j = 1;
+        for (i = 1; (i < NUM_MONSTER_ENTRIES) && (j < 4); i++)
+            if(expected_hash_bucket == H5C__HASH_FCN(cache_ptr, base_addr[i].addr))
+                bucket_idx[j++] = i;
+
+        dirty_idx = -1;
+        for ( ; (i < NUM_MONSTER_ENTRIES) && (j == 4) && (dirty_idx < 0); i++)
+            if(expected_hash_bucket != H5C__HASH_FCN(cache_ptr, base_addr[i].addr))
+                dirty_idx = i;
+
+        if(dirty_idx < 0) {
+
+            pass = FALSE;
+            failure_mssg = "Can't find test entries that map to the same bucket.";
+
+        } else {
+
+            for (j = 1; j < 4; j++)
+                expected[j].entry_index = bucket_idx[j];
+            expected[4].entry_index = dirty_idx;
+        }
+    }
+
+    if(pass) {
+
 	/* load one dirty and three clean entries that should hash to the 
          * same hash bucket.  
          */
@@ -35685,33 +35722,29 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
         protect_entry(file_ptr, MONSTER_ENTRY_TYPE, 0);
         unprotect_entry(file_ptr, MONSTER_ENTRY_TYPE, 0, H5C__DIRTIED_FLAG);
 
-	for (i = 8; i <= 24; i += 8)
+	for (j = 1; j < 4; j++)
 	{
-	    protect_entry(file_ptr, MONSTER_ENTRY_TYPE, i);
-            unprotect_entry(file_ptr, MONSTER_ENTRY_TYPE, i, H5C__NO_FLAGS_SET);
+	    protect_entry(file_ptr, MONSTER_ENTRY_TYPE, bucket_idx[j]);
+            unprotect_entry(file_ptr, MONSTER_ENTRY_TYPE, bucket_idx[j], H5C__NO_FLAGS_SET);
 	}
     }
 
     if(pass) {
 
-        /* verify that the above entries hash to the same bucket */
-        base_addr = entries[MONSTER_ENTRY_TYPE];
-        entry_ptr = &(base_addr[0]);
-        entry_addr = entry_ptr->header.addr;
-
-        HDassert(entry_addr == entry_ptr->addr);
-
-        expected_hash_bucket = H5C__HASH_FCN(entry_addr);
-
-        for (i = 8; i <= 24; i += 8) {
+        /* verify that the above entries still hash to the same bucket --
+         * i.e. that the hash table wasn't resized.
+         */
+        for (j = 0; j < 4; j++) {
         
-            entry_ptr = &(base_addr[i]);
+            entry_ptr = &(base_addr[bucket_idx[j]]);
             entry_addr = entry_ptr->header.addr;
 
-            if(expected_hash_bucket != H5C__HASH_FCN(entry_addr)) {
+            HDassert(entry_addr == entry_ptr->addr);
+
+            if(expected_hash_bucket != H5C__HASH_FCN(cache_ptr, entry_addr)) {
 
                 pass = FALSE;
-                failure_mssg = "Test entries don't map to same bucket -- hash table size or hash fcn change?";
+                failure_mssg = "Test entries don't map to same bucket -- hash table resized?";
             }
         }
     }
@@ -35720,11 +35753,11 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
 
        /* setup the expunge flush operation:
 	 *
-	 *     (MET, 0) expunges (MET, 8)
+	 *     (MET, 0) expunges (MET, bucket_idx[1])
 	 *
 	 */
         add_flush_op(MONSTER_ENTRY_TYPE, 0, FLUSH_OP__EXPUNGE,
-                     MONSTER_ENTRY_TYPE, 8, FALSE, (size_t)0, NULL);
+                     MONSTER_ENTRY_TYPE, bucket_idx[1], FALSE, (size_t)0, NULL);
     }
 
     if(pass) {
@@ -35734,8 +35767,8 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
          * the skip list. 
          */
 
-	protect_entry(file_ptr, MONSTER_ENTRY_TYPE, 31);
-	unprotect_entry(file_ptr, MONSTER_ENTRY_TYPE, 31, H5C__DIRTIED_FLAG);
+	protect_entry(file_ptr, MONSTER_ENTRY_TYPE, dirty_idx);
+	unprotect_entry(file_ptr, MONSTER_ENTRY_TYPE, dirty_idx, H5C__DIRTIED_FLAG);
     }
 
     if(pass) {
@@ -35744,10 +35777,10 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
          * hash bucket as the clean entries.
          */
 
-        entry_ptr = &(base_addr[31]);
+        entry_ptr = &(base_addr[dirty_idx]);
         entry_addr = entry_ptr->header.addr;
 
-        if(expected_hash_bucket == H5C__HASH_FCN(entry_addr)) {
+        if(expected_hash_bucket == H5C__HASH_FCN(cache_ptr, entry_addr)) {
 
             pass = FALSE;
             failure_mssg = "Dirty entry maps to same hash bucket as clean entries?!?!";
@@ -35756,12 +35789,12 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
 
     if(pass) {
 
-	/* Next, create the flush dependency requiring (MET, 31) to 
+	/* Next, create the flush dependency requiring (MET, dirty_idx) to 
          * be flushed prior to (MET, 0).
 	 */
 
         protect_entry(file_ptr, MONSTER_ENTRY_TYPE, 0);
-        create_flush_dependency(MONSTER_ENTRY_TYPE, 0, MONSTER_ENTRY_TYPE, 31);
+        create_flush_dependency(MONSTER_ENTRY_TYPE, 0, MONSTER_ENTRY_TYPE, dirty_idx);
         unprotect_entry(file_ptr, MONSTER_ENTRY_TYPE, 0, H5C__DIRTIED_FLAG);
 
     }
@@ -35769,12 +35802,12 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
     if(pass) {
 
         /* Then, setup the flush operation to take down the flush 
-         * dependency when (MET, 31) is flushed.
+         * dependency when (MET, dirty_idx) is flushed.
 	 *
-	 *     (MET, 31) destroys flush dependency with (MET, 8)
+	 *     (MET, dirty_idx) destroys flush dependency with (MET, 0)
 	 *
          */
-        add_flush_op(MONSTER_ENTRY_TYPE, 31, FLUSH_OP__DEST_FLUSH_DEP,
+        add_flush_op(MONSTER_ENTRY_TYPE, dirty_idx, FLUSH_OP__DEST_FLUSH_DEP,
                      MONSTER_ENTRY_TYPE, 0, FALSE, (size_t)0, NULL);
 
     }
@@ -35793,10 +35826,10 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
          * hash bucket list on lookup.
          */
 
-	for (i = 24; i >= 0; i -= 8)
+	for (j = 3; j >= 0; j--)
 	{
-	    protect_entry(file_ptr, MONSTER_ENTRY_TYPE, i);
-            unprotect_entry(file_ptr, MONSTER_ENTRY_TYPE, i, H5C__NO_FLAGS_SET);
+	    protect_entry(file_ptr, MONSTER_ENTRY_TYPE, bucket_idx[j]);
+            unprotect_entry(file_ptr, MONSTER_ENTRY_TYPE, bucket_idx[j], H5C__NO_FLAGS_SET);
 	}
     }
 
@@ -35807,11 +35840,11 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
          */
         scan_ptr = cache_ptr->index[expected_hash_bucket];
 
-        i = 0;
+        j = 0;
 
-        while(pass && (i <= 24))
+        while(pass && (j < 4))
 	{
-            entry_ptr = &(base_addr[i]);
+            entry_ptr = &(base_addr[bucket_idx[j]]);
 
             if(scan_ptr == NULL) {
 
@@ -35828,7 +35861,7 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
             if(pass) {
 
                 scan_ptr = scan_ptr->ht_next;
-                i += 8;
+                j++;
             }
 	}
     }
@@ -35985,6 +36018,248 @@ check_stats(unsigned paged)
 
 } /* check_stats() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	check_index_resize()
+ *
+ * Purpose:	Verify that the hash table used to index the cache grows
+ *		as entries are inserted, that all entries can still be
+ *		found after it has been resized, and that it shrinks back
+ *		to its minimum size as the entries are removed.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+
+static unsigned
+check_index_resize(unsigned paged)
+{
+    H5F_t * file_ptr = NULL;
+    H5C_t * cache_ptr = NULL;
+    int32_t i;
+    int32_t num_entries = 3 * 1024;
+
+    if(paged)
+        TESTING("metadata cache index resize (paged aggregation)")
+    else
+        TESTING("metadata cache index resize")
+
+    pass = TRUE;
+
+    reset_entries();
+
+    file_ptr = setup_cache((size_t)(2 * 1024 * 1024), (size_t)(1 * 1024 * 1024), paged);
+
+    if(pass) {
+
+        cache_ptr = file_ptr->shared->cache;
+
+        if(cache_ptr->ht_len != ((uint32_t)1 << H5C__HASH_TABLE_MIN_BITS)) {
+
+            pass = FALSE;
+            failure_mssg = "unexpected initial hash table size.";
+        }
+    }
+
+    /* insert enough entries to make the hash table grow */
+    for(i = 0; pass && (i < num_entries); i++)
+        insert_entry(file_ptr, PICO_ENTRY_TYPE, i, H5C__NO_FLAGS_SET);
+
+    if(pass && ((cache_ptr->index_len != (uint32_t)num_entries) ||
+                (cache_ptr->ht_len < (uint32_t)num_entries))) {
+
+        pass = FALSE;
+        failure_mssg = "hash table didn't grow with the index.";
+    }
+
+    /* every entry must still be found -- if one weren't, protecting it
+     * would load a second copy into the cache.
+     */
+    for(i = 0; pass && (i < num_entries); i++) {
+
+        protect_entry(file_ptr, PICO_ENTRY_TYPE, i);
+        unprotect_entry(file_ptr, PICO_ENTRY_TYPE, i, H5C__NO_FLAGS_SET);
+    }
+
+    if(pass && (cache_ptr->index_len != (uint32_t)num_entries)) {
+
+        pass = FALSE;
+        failure_mssg = "entries not found after hash table resize.";
+    }
+
+    /* removing the entries shrinks the hash table back to its minimum */
+    for(i = 0; pass && (i < num_entries); i++)
+        expunge_entry(file_ptr, PICO_ENTRY_TYPE, i);
+
+    if(pass && ((cache_ptr->index_len != 0) ||
+                (cache_ptr->ht_len != ((uint32_t)1 << H5C__HASH_TABLE_MIN_BITS)))) {
+
+        pass = FALSE;
+        failure_mssg = "hash table didn't shrink with the index.";
+    }
+
+    if(pass) {
+
+        takedown_cache(file_ptr, FALSE, FALSE);
+    }
+
+    if(pass) { PASSED(); } else { H5_FAILED(); }
+
+    if(!pass) {
+
+        HDfprintf(stdout, "%s(): failure_mssg = \"%s\".\n",
+                  FUNC, failure_mssg);
+    }
+
+    return (unsigned)!pass;
+
+} /* check_index_resize() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	check_2q_scan_resistance()
+ *
+ * Purpose:	Verify that under the 2Q replacement policy a small set of
+ *		repeatedly referenced entries survives a one-pass scan over
+ *		more entries than fit in the cache, that back-to-back
+ *		protects of a scanned entry don't mark it hot, and that
+ *		the same scan flushes the hot set out of the cache under
+ *		plain LRU.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+
+static unsigned
+check_2q_scan_resistance(unsigned paged)
+{
+    H5F_t * file_ptr = NULL;
+    H5C_t * cache_ptr = NULL;
+    int32_t i;
+    int32_t num_hot = 64;
+    int32_t scan_len = 1024;
+    hbool_t all_in_cache;
+
+    if(paged)
+        TESTING("metadata cache 2Q scan resistance (paged aggregation)")
+    else
+        TESTING("metadata cache 2Q scan resistance")
+
+    pass = TRUE;
+
+    reset_entries();
+
+    file_ptr = setup_cache((size_t)(2 * 1024 * 1024), (size_t)(1 * 1024 * 1024), paged);
+
+    if(pass) {
+
+        cache_ptr = file_ptr->shared->cache;
+
+        if(H5C_set_replacement_policy(cache_ptr, H5C_rp__2q, 0.5f) < 0) {
+
+            pass = FALSE;
+            failure_mssg = "H5C_set_replacement_policy() failed.";
+        }
+    }
+
+    /* load the hot set, then reference it again once the correlated
+     * reference period has passed so that it is promoted.
+     */
+    for(i = 0; pass && (i < num_hot); i++) {
+
+        protect_entry(file_ptr, LARGE_ENTRY_TYPE, i);
+        unprotect_entry(file_ptr, LARGE_ENTRY_TYPE, i, H5C__NO_FLAGS_SET);
+    }
+
+    for(i = 0; pass && (i < num_hot); i++) {
+
+        protect_entry(file_ptr, LARGE_ENTRY_TYPE, i);
+        unprotect_entry(file_ptr, LARGE_ENTRY_TYPE, i, H5C__NO_FLAGS_SET);
+    }
+
+    if(pass && (cache_ptr->rp_hot_size != (size_t)num_hot * LARGE_ENTRY_SIZE)) {
+
+        pass = FALSE;
+        failure_mssg = "hot set not promoted.";
+    }
+
+    /* scan twice the cache size worth of entries, protecting each one
+     * twice in a row -- correlated references that must not promote it.
+     */
+    for(i = num_hot; pass && (i < num_hot + scan_len); i++) {
+
+        protect_entry(file_ptr, LARGE_ENTRY_TYPE, i);
+        unprotect_entry(file_ptr, LARGE_ENTRY_TYPE, i, H5C__NO_FLAGS_SET);
+        protect_entry(file_ptr, LARGE_ENTRY_TYPE, i);
+        unprotect_entry(file_ptr, LARGE_ENTRY_TYPE, i, H5C__NO_FLAGS_SET);
+    }
+
+    if(pass && (cache_ptr->rp_hot_size != (size_t)num_hot * LARGE_ENTRY_SIZE)) {
+
+        pass = FALSE;
+        failure_mssg = "scan entries promoted by correlated references.";
+    }
+
+    if(pass) {
+
+        all_in_cache = TRUE;
+
+        for(i = 0; i < num_hot; i++)
+            if(!entry_in_cache(cache_ptr, LARGE_ENTRY_TYPE, i))
+                all_in_cache = FALSE;
+
+        if(!all_in_cache) {
+
+            pass = FALSE;
+            failure_mssg = "hot set evicted by scan under 2Q.";
+        }
+    }
+
+    /* under LRU the same kind of scan pushes the hot set out */
+    if(pass && (H5C_set_replacement_policy(cache_ptr, H5C_rp__lru, 0.5f) < 0)) {
+
+        pass = FALSE;
+        failure_mssg = "H5C_set_replacement_policy() failed.";
+    }
+
+    for(i = num_hot + scan_len; pass && (i < num_hot + (2 * scan_len)); i++) {
+
+        protect_entry(file_ptr, LARGE_ENTRY_TYPE, i);
+        unprotect_entry(file_ptr, LARGE_ENTRY_TYPE, i, H5C__NO_FLAGS_SET);
+    }
+
+    if(pass) {
+
+        for(i = 0; i < num_hot; i++) {
+
+            if(entry_in_cache(cache_ptr, LARGE_ENTRY_TYPE, i)) {
+
+                pass = FALSE;
+                failure_mssg = "hot set survived scan under LRU.";
+                break;
+            }
+        }
+    }
+
+    if(pass) {
+
+        takedown_cache(file_ptr, FALSE, FALSE);
+    }
+
+    if(pass) { PASSED(); } else { H5_FAILED(); }
+
+    if(!pass) {
+
+        HDfprintf(stdout, "%s(): failure_mssg = \"%s\".\n",
+                  FUNC, failure_mssg);
+    }
+
+    return (unsigned)!pass;
+
+} /* check_2q_scan_resistance() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	check_stats__smoke_check_1()
@@ -36088,7 +36363,9 @@ check_stats__smoke_check_1(H5F_t * file_ptr)
              (cache_ptr->successful_ht_searches != 0) ||
              (cache_ptr->total_successful_ht_search_depth != 0) ||
              (cache_ptr->failed_ht_searches != 32) ||
-             (cache_ptr->total_failed_ht_search_depth != 48) ||
+             (cache_ptr->total_failed_ht_search_depth != 0) ||
+             (cache_ptr->max_ht_search_depth != 0) ||
+             (cache_ptr->ht_resizes != 0) ||
              (cache_ptr->max_index_len != 32) ||
              (cache_ptr->max_index_size != 2 * 1024 * 1024) ||
              (cache_ptr->max_clean_index_size != 0) ||
@@ -36171,9 +36448,11 @@ check_stats__smoke_check_1(H5F_t * file_ptr)
         if((cache_ptr->total_ht_insertions != 32) ||
              (cache_ptr->total_ht_deletions != 0) ||
              (cache_ptr->successful_ht_searches != 32) ||
-             (cache_ptr->total_successful_ht_search_depth != 96) ||
+             (cache_ptr->total_successful_ht_search_depth != 0) ||
              (cache_ptr->failed_ht_searches != 32) ||
-             (cache_ptr->total_failed_ht_search_depth != 48) ||
+             (cache_ptr->total_failed_ht_search_depth != 0) ||
+             (cache_ptr->max_ht_search_depth != 0) ||
+             (cache_ptr->ht_resizes != 0) ||
              (cache_ptr->max_index_len != 32) ||
              (cache_ptr->max_index_size != 2 * 1024 * 1024) ||
              (cache_ptr->max_clean_index_size != 0) ||
@@ -36256,9 +36535,11 @@ check_stats__smoke_check_1(H5F_t * file_ptr)
         if((cache_ptr->total_ht_insertions != 33) ||
              (cache_ptr->total_ht_deletions != 1) ||
              (cache_ptr->successful_ht_searches != 32) ||
-             (cache_ptr->total_successful_ht_search_depth != 96) ||
+             (cache_ptr->total_successful_ht_search_depth != 0) ||
              (cache_ptr->failed_ht_searches != 33) ||
-             (cache_ptr->total_failed_ht_search_depth != 52) ||
+             (cache_ptr->total_failed_ht_search_depth != 0) ||
+             (cache_ptr->max_ht_search_depth != 0) ||
+             (cache_ptr->ht_resizes != 0) ||
              (cache_ptr->max_index_len != 32) ||
              (cache_ptr->max_index_size != 2 * 1024 * 1024) ||
              (cache_ptr->max_clean_index_size != 2 * 1024 * 1024) ||
@@ -36360,9 +36641,11 @@ check_stats__smoke_check_1(H5F_t * file_ptr)
         if((cache_ptr->total_ht_insertions != 33) ||
              (cache_ptr->total_ht_deletions != 33) ||
              (cache_ptr->successful_ht_searches != 33) ||
-             (cache_ptr->total_successful_ht_search_depth != 99) ||
+             (cache_ptr->total_successful_ht_search_depth != 0) ||
              (cache_ptr->failed_ht_searches != 33) ||
-             (cache_ptr->total_failed_ht_search_depth != 52) ||
+             (cache_ptr->total_failed_ht_search_depth != 0) ||
+             (cache_ptr->max_ht_search_depth != 0) ||
+             (cache_ptr->ht_resizes != 0) ||
              (cache_ptr->max_index_len != 32) ||
              (cache_ptr->max_index_size != 2 * 1024 * 1024) ||
              (cache_ptr->max_clean_index_size != 2 * 1024 * 1024) ||
@@ -36518,6 +36801,8 @@ main(void)
         nerrs += check_metadata_cork(FALSE, paged);
         nerrs += check_entry_deletions_during_scans(paged);
         nerrs += check_stats(paged);
+        nerrs += check_index_resize(paged);
+        nerrs += check_2q_scan_resistance(paged);
     } /* end for */
 
     /* can't fail, returns void */
@@ -26,6 +26,9 @@
 
 /* macro definitions */
 
+/* Number of groups created by create_flush_threads_file() */
+#define FLUSH_THREADS_NUM_GROUPS        2000
+
 /* private function declarations: */
 
 static hbool_t check_fapl_mdc_api_calls(unsigned paged, hid_t fcpl_id);
@@ -34,6 +37,9 @@ static hbool_t mdc_api_call_smoke_check(int express_test, unsigned paged, hid_t
 static H5AC_cache_config_t * init_invalid_configs(void);
 static hbool_t check_fapl_mdc_api_errs(void);
 static hbool_t check_file_mdc_api_errs(unsigned paged, hid_t fcpl_id);
+static void create_flush_threads_file(const char *filename, hid_t fcpl_id,
+    unsigned nthreads);
+static hbool_t check_mdc_flush_threads(unsigned paged, hid_t fcpl_id);
 
 
 
@@ -105,7 +111,9 @@ check_fapl_mdc_api_calls(unsigned paged, hid_t fcpl_id)
       /* double      empty_reserve          = */ 0.05f,
       /* int         dirty_bytes_threshold  = */ (256 * 1024),
       /* int	    metadata_write_strategy = */
-					H5AC__DEFAULT_METADATA_WRITE_STRATEGY
+					H5AC__DEFAULT_METADATA_WRITE_STRATEGY,
+      /* enum H5C_cache_rp_policy rp_policy = */ H5C_rp__lru,
+      /* double      rp_hot_fraction        = */ H5C__DEFAULT_RP_HOT_FRACTION
     };
     H5AC_cache_config_t scratch;
     H5C_auto_size_ctl_t default_auto_size_ctl;
@@ -138,7 +146,7 @@ check_fapl_mdc_api_calls(unsigned paged, hid_t fcpl_id)
 
     if ( pass ) {
 
-        scratch.version = H5C__CURR_AUTO_SIZE_CTL_VER;
+        scratch.version = H5AC__CURR_CACHE_CONFIG_VERSION;
 
         result = H5Pget_mdc_config(fapl_id, &scratch);
 
@@ -172,7 +180,7 @@ check_fapl_mdc_api_calls(unsigned paged, hid_t fcpl_id)
 
     if ( pass ) {
 
-        scratch.version = H5C__CURR_AUTO_SIZE_CTL_VER;
+        scratch.version = H5AC__CURR_CACHE_CONFIG_VERSION;
 
         result = H5Pget_mdc_config(fapl_id, &scratch);
 
@@ -283,7 +291,7 @@ check_fapl_mdc_api_calls(unsigned paged, hid_t fcpl_id)
      */
     if ( pass ) {
 
-        scratch.version = H5C__CURR_AUTO_SIZE_CTL_VER;
+        scratch.version = H5AC__CURR_CACHE_CONFIG_VERSION;
 
         result = H5Pget_mdc_config(fapl_id, &scratch);
 
@@ -431,7 +439,7 @@ check_fapl_mdc_api_calls(unsigned paged, hid_t fcpl_id)
      */
     if ( pass ) {
 
-        scratch.version = H5C__CURR_AUTO_SIZE_CTL_VER;
+        scratch.version = H5AC__CURR_CACHE_CONFIG_VERSION;
 
         result = H5Pget_mdc_config(test_fapl_id, &scratch);
 
@@ -530,7 +538,7 @@ check_file_mdc_api_calls(unsigned paged, hid_t fcpl_id)
     H5AC_cache_config_t default_config = H5AC__DEFAULT_CACHE_CONFIG;
     H5AC_cache_config_t mod_config_1 =
     {
-      /* int         version                = */ H5C__CURR_AUTO_SIZE_CTL_VER,
+      /* int         version                = */ H5AC__CURR_CACHE_CONFIG_VERSION,
       /* hbool_t     rpt_fcn_enabled        = */ FALSE,
       /* hbool_t     open_trace_file        = */ FALSE,
       /* hbool_t     close_trace_file       = */ FALSE,
@@ -561,11 +569,13 @@ check_file_mdc_api_calls(unsigned paged, hid_t fcpl_id)
       /* double      empty_reserve          = */ 0.05f,
       /* int         dirty_bytes_threshold  = */ (256 * 1024),
       /* int	    metadata_write_strategy = */
-					H5AC__DEFAULT_METADATA_WRITE_STRATEGY
+					H5AC__DEFAULT_METADATA_WRITE_STRATEGY,
+      /* enum H5C_cache_rp_policy rp_policy = */ H5C_rp__lru,
+      /* double      rp_hot_fraction        = */ H5C__DEFAULT_RP_HOT_FRACTION
     };
     H5AC_cache_config_t mod_config_2 =
     {
-      /* int         version                = */ H5C__CURR_AUTO_SIZE_CTL_VER,
+      /* int         version                = */ H5AC__CURR_CACHE_CONFIG_VERSION,
       /* hbool_t     rpt_fcn_enabled        = */ TRUE,
       /* hbool_t     open_trace_file        = */ FALSE,
       /* hbool_t     close_trace_file       = */ FALSE,
@@ -596,11 +606,13 @@ check_file_mdc_api_calls(unsigned paged, hid_t fcpl_id)
       /* double      empty_reserve          = */ 0.05f,
       /* int         dirty_bytes_threshold  = */ (256 * 1024),
       /* int	    metadata_write_strategy = */
-					H5AC__DEFAULT_METADATA_WRITE_STRATEGY
+					H5AC__DEFAULT_METADATA_WRITE_STRATEGY,
+      /* enum H5C_cache_rp_policy rp_policy = */ H5C_rp__lru,
+      /* double      rp_hot_fraction        = */ H5C__DEFAULT_RP_HOT_FRACTION
     };
     H5AC_cache_config_t mod_config_3 =
     {
-      /* int         version                = */ H5C__CURR_AUTO_SIZE_CTL_VER,
+      /* int         version                = */ H5AC__CURR_CACHE_CONFIG_VERSION,
       /* hbool_t     rpt_fcn_enabled        = */ FALSE,
       /* hbool_t     open_trace_file        = */ FALSE,
       /* hbool_t     close_trace_file       = */ FALSE,
@@ -631,11 +643,13 @@ check_file_mdc_api_calls(unsigned paged, hid_t fcpl_id)
       /* double      empty_reserve          = */ 0.05f,
       /* int         dirty_bytes_threshold  = */ (256 * 1024),
       /* int	    metadata_write_strategy = */
-				      H5AC__DEFAULT_METADATA_WRITE_STRATEGY
+				      H5AC__DEFAULT_METADATA_WRITE_STRATEGY,
+      /* enum H5C_cache_rp_policy rp_policy = */ H5C_rp__lru,
+      /* double      rp_hot_fraction        = */ H5C__DEFAULT_RP_HOT_FRACTION
     };
     H5AC_cache_config_t mod_config_4 =
     {
-      /* int         version                = */ H5C__CURR_AUTO_SIZE_CTL_VER,
+      /* int         version                = */ H5AC__CURR_CACHE_CONFIG_VERSION,
       /* hbool_t     rpt_fcn_enabled        = */ FALSE,
       /* hbool_t     open_trace_file        = */ FALSE,
       /* hbool_t     close_trace_file       = */ FALSE,
@@ -667,7 +681,9 @@ check_file_mdc_api_calls(unsigned paged, hid_t fcpl_id)
       /* double      empty_reserve          = */ 0.1f,
       /* int         dirty_bytes_threshold  = */ (256 * 1024),
       /* int	    metadata_write_strategy = */
-				      H5AC__DEFAULT_METADATA_WRITE_STRATEGY
+				      H5AC__DEFAULT_METADATA_WRITE_STRATEGY,
+      /* enum H5C_cache_rp_policy rp_policy = */ H5C_rp__2q,
+      /* double      rp_hot_fraction        = */ 0.5f
     };
 
     if(paged)
@@ -903,7 +919,7 @@ mdc_api_call_smoke_check(int express_test, unsigned paged, hid_t fcpl_id)
     H5AC_cache_config_t default_config = H5AC__DEFAULT_CACHE_CONFIG;
     H5AC_cache_config_t mod_config_1 =
     {
-      /* int         version                = */ H5C__CURR_AUTO_SIZE_CTL_VER,
+      /* int         version                = */ H5AC__CURR_CACHE_CONFIG_VERSION,
       /* hbool_t     rpt_fcn_enabled        = */ FALSE,
       /* hbool_t     open_trace_file        = */ FALSE,
       /* hbool_t     close_trace_file       = */ FALSE,
@@ -934,11 +950,13 @@ mdc_api_call_smoke_check(int express_test, unsigned paged, hid_t fcpl_id)
       /* double      empty_reserve          = */ 0.05f,
       /* int         dirty_bytes_threshold  = */ (256 * 1024),
       /* int	    metadata_write_strategy = */
-				      H5AC__DEFAULT_METADATA_WRITE_STRATEGY
+				      H5AC__DEFAULT_METADATA_WRITE_STRATEGY,
+      /* enum H5C_cache_rp_policy rp_policy = */ H5C_rp__lru,
+      /* double      rp_hot_fraction        = */ H5C__DEFAULT_RP_HOT_FRACTION
     };
     H5AC_cache_config_t mod_config_2 =
     {
-      /* int         version                = */ H5C__CURR_AUTO_SIZE_CTL_VER,
+      /* int         version                = */ H5AC__CURR_CACHE_CONFIG_VERSION,
       /* hbool_t     rpt_fcn_enabled        = */ FALSE,
       /* hbool_t     open_trace_file        = */ FALSE,
       /* hbool_t     close_trace_file       = */ FALSE,
@@ -969,11 +987,13 @@ mdc_api_call_smoke_check(int express_test, unsigned paged, hid_t fcpl_id)
       /* double      empty_reserve          = */ 0.05f,
       /* int         dirty_bytes_threshold  = */ (256 * 1024),
       /* int	    metadata_write_strategy = */
-				      H5AC__DEFAULT_METADATA_WRITE_STRATEGY
+				      H5AC__DEFAULT_METADATA_WRITE_STRATEGY,
+      /* enum H5C_cache_rp_policy rp_policy = */ H5C_rp__lru,
+      /* double      rp_hot_fraction        = */ H5C__DEFAULT_RP_HOT_FRACTION
     };
     H5AC_cache_config_t mod_config_3 =
     {
-      /* int         version                = */ H5C__CURR_AUTO_SIZE_CTL_VER,
+      /* int         version                = */ H5AC__CURR_CACHE_CONFIG_VERSION,
       /* hbool_t     rpt_fcn_enabled        = */ FALSE,
       /* hbool_t     open_trace_file        = */ FALSE,
       /* hbool_t     close_trace_file       = */ FALSE,
@@ -1004,7 +1024,9 @@ mdc_api_call_smoke_check(int express_test, unsigned paged, hid_t fcpl_id)
       /* double      empty_reserve          = */ 0.05f,
       /* int         dirty_bytes_threshold  = */ (256 * 1024),
       /* int	    metadata_write_strategy = */
-				      H5AC__DEFAULT_METADATA_WRITE_STRATEGY
+				      H5AC__DEFAULT_METADATA_WRITE_STRATEGY,
+      /* enum H5C_cache_rp_policy rp_policy = */ H5C_rp__lru,
+      /* double      rp_hot_fraction        = */ H5C__DEFAULT_RP_HOT_FRACTION
     };
 
     if(paged)
@@ -1561,7 +1583,7 @@ mdc_api_call_smoke_check(int express_test, unsigned paged, hid_t fcpl_id)
  *-------------------------------------------------------------------------
  */
 
-#define NUM_INVALID_CONFIGS	36
+#define NUM_INVALID_CONFIGS	38
 static H5AC_cache_config_t * invalid_configs = NULL;
 
 static H5AC_cache_config_t *
@@ -1580,7 +1602,7 @@ init_invalid_configs(void) {
     /* Set defaults for all configs */
     for ( i = 0; i < NUM_INVALID_CONFIGS; i++ ) {
 
-        configs[i].version                  = H5C__CURR_AUTO_SIZE_CTL_VER;
+        configs[i].version                  = H5AC__CURR_CACHE_CONFIG_VERSION;
         configs[i].rpt_fcn_enabled          = FALSE;
         configs[i].open_trace_file          = FALSE;
         configs[i].close_trace_file         = FALSE;
@@ -1610,6 +1632,8 @@ init_invalid_configs(void) {
         configs[i].empty_reserve            = 0.1F;
         configs[i].dirty_bytes_threshold    = (256 * 1024);
         configs[i].metadata_write_strategy  = H5AC__DEFAULT_METADATA_WRITE_STRATEGY;
+        configs[i].rp_policy                = H5C_rp__lru;
+        configs[i].rp_hot_fraction          = H5C__DEFAULT_RP_HOT_FRACTION;
     }
 
     /* Set badness for each config */
@@ -1733,6 +1757,13 @@ init_invalid_configs(void) {
     /* 35 -- unknown metadata write strategy */
     configs[35].metadata_write_strategy     = -1;
 
+    /* 36 -- unknown replacement policy */
+    configs[36].rp_policy                   = (enum H5C_cache_rp_policy)-1;
+
+    /* 37 -- 2Q with hot set taking the entire cache */
+    configs[37].rp_policy                   = H5C_rp__2q;
+    configs[37].rp_hot_fraction             = 1.0f;
+
     return configs;
 
 } /* initialize_invalid_configs() */
@@ -1768,7 +1799,7 @@ check_fapl_mdc_api_errs(void)
     /* first test H5Pget_mdc_config().
      */
 
-    scratch.version = H5C__CURR_AUTO_SIZE_CTL_VER;
+    scratch.version = H5AC__CURR_CACHE_CONFIG_VERSION;
     if  ( pass ) {
 
         H5E_BEGIN_TRY {
@@ -1797,7 +1828,7 @@ check_fapl_mdc_api_errs(void)
         }
     }
 
-    scratch.version = H5C__CURR_AUTO_SIZE_CTL_VER;
+    scratch.version = H5AC__CURR_CACHE_CONFIG_VERSION;
     if ( ( pass ) &&
          ( ( H5Pget_mdc_config(fapl_id, &scratch) < 0) ||
            ( !CACHE_CONFIGS_EQUAL(default_config, scratch, TRUE, TRUE) ) ) ) {
@@ -1839,7 +1870,7 @@ check_fapl_mdc_api_errs(void)
     /* now test H5Pset_mdc_config()
      */
 
-    scratch.version = H5C__CURR_AUTO_SIZE_CTL_VER;
+    scratch.version = H5AC__CURR_CACHE_CONFIG_VERSION;
     if ( pass ) {
 
         H5E_BEGIN_TRY {
@@ -1886,7 +1917,7 @@ check_fapl_mdc_api_errs(void)
     /* verify that none of the above calls to H5Pset_mdc_config() changed
      * the configuration in the FAPL.
      */
-    scratch.version = H5C__CURR_AUTO_SIZE_CTL_VER;
+    scratch.version = H5AC__CURR_CACHE_CONFIG_VERSION;
     if ( ( pass ) &&
          ( ( H5Pget_mdc_config(fapl_id, &scratch) < 0 ) ||
            ( !CACHE_CONFIGS_EQUAL(default_config, scratch, TRUE, TRUE) ) ) ) {
@@ -1992,7 +2023,7 @@ check_file_mdc_api_errs(unsigned paged, hid_t fcpl_id)
 
     /* test H5Fget_mdc_config().  */
 
-    scratch.version = H5C__CURR_AUTO_SIZE_CTL_VER;
+    scratch.version = H5AC__CURR_CACHE_CONFIG_VERSION;
     if  ( pass ) {
 
         if ( show_progress ) {
@@ -2051,7 +2082,7 @@ check_file_mdc_api_errs(unsigned paged, hid_t fcpl_id)
 
     /* test H5Fset_mdc_config() */
 
-    scratch.version = H5C__CURR_AUTO_SIZE_CTL_VER;
+    scratch.version = H5AC__CURR_CACHE_CONFIG_VERSION;
     if ( pass ) {
 
         if ( show_progress ) {
@@ -2259,6 +2290,282 @@ check_file_mdc_api_errs(unsigned paged, hid_t fcpl_id)
 
 } /* check_file_mdc_api_errs() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    create_flush_threads_file()
+ *
+ * Purpose:     Create a file holding a number of groups, each with an
+ *              attribute, using the latest file format and the given
+ *              number of metadata cache flush threads, and close it.
+ *
+ *              Object modification times are not stored, so that files
+ *              created with different numbers of flush threads should be
+ *              identical.
+ *
+ *              Do nothing if pass is FALSE on entry.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+create_flush_threads_file(const char *filename, hid_t fcpl_id, unsigned nthreads)
+{
+    char group_name[32];
+    hid_t fapl_id = -1;
+    hid_t my_fcpl_id = -1;
+    hid_t gcpl_id = -1;
+    hid_t file_id = -1;
+    hid_t group_id = -1;
+    hid_t space_id = -1;
+    hid_t attr_id = -1;
+    int i;
+
+    if ( pass ) {
+
+        if ( ( (fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0 ) ||
+             ( H5Pset_libver_bounds(fapl_id, H5F_LIBVER_LATEST,
+                                    H5F_LIBVER_LATEST) < 0 ) ||
+             ( H5Pset_mdc_flush_threads(fapl_id, nthreads) < 0 ) ||
+             ( (my_fcpl_id = H5Pcopy(fcpl_id)) < 0 ) ||
+             ( H5Pset_obj_track_times(my_fcpl_id, FALSE) < 0 ) ||
+             ( (gcpl_id = H5Pcreate(H5P_GROUP_CREATE)) < 0 ) ||
+             ( H5Pset_obj_track_times(gcpl_id, FALSE) < 0 ) ||
+             ( (space_id = H5Screate(H5S_SCALAR)) < 0 ) ) {
+
+            pass = FALSE;
+            failure_mssg = "can't set up property lists.\n";
+        }
+    }
+
+    if ( pass ) {
+
+        file_id = H5Fcreate(filename, H5F_ACC_TRUNC, my_fcpl_id, fapl_id);
+
+        if ( file_id < 0 ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fcreate() failed.\n";
+        }
+    }
+
+    for ( i = 0; pass && i < FLUSH_THREADS_NUM_GROUPS; i++ )
+    {
+        HDsnprintf(group_name, sizeof(group_name), "group_%04d", i);
+
+        if ( ( (group_id = H5Gcreate2(file_id, group_name, H5P_DEFAULT,
+                                      gcpl_id, H5P_DEFAULT)) < 0 ) ||
+             ( (attr_id = H5Acreate2(group_id, "index", H5T_NATIVE_INT,
+                                     space_id, H5P_DEFAULT,
+                                     H5P_DEFAULT)) < 0 ) ||
+             ( H5Awrite(attr_id, H5T_NATIVE_INT, &i) < 0 ) ||
+             ( H5Aclose(attr_id) < 0 ) ||
+             ( H5Gclose(group_id) < 0 ) ) {
+
+            pass = FALSE;
+            failure_mssg = "can't create group.\n";
+        }
+    }
+
+    if ( pass ) {
+
+        if ( H5Fclose(file_id) < 0 ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fclose() failed.\n";
+        }
+    }
+
+    if ( ( space_id >= 0 ) && ( H5Sclose(space_id) < 0 ) )
+        pass = FALSE;
+    if ( ( gcpl_id >= 0 ) && ( H5Pclose(gcpl_id) < 0 ) )
+        pass = FALSE;
+    if ( ( my_fcpl_id >= 0 ) && ( H5Pclose(my_fcpl_id) < 0 ) )
+        pass = FALSE;
+    if ( ( fapl_id >= 0 ) && ( H5Pclose(fapl_id) < 0 ) )
+        pass = FALSE;
+
+    return;
+
+} /* create_flush_threads_file() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    check_mdc_flush_threads()
+ *
+ * Purpose:     Verify that the number of metadata cache flush threads
+ *              set in a FAPL is retrieved unchanged, that out of range
+ *              values are rejected, and that a file closed with several
+ *              flush threads is byte for byte the same as one closed
+ *              without, and reads back correctly.
+ *
+ * Return:      Test pass status (TRUE/FALSE)
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+check_mdc_flush_threads(unsigned paged, hid_t fcpl_id)
+{
+    char filename[512];
+    char threads_filename[512];
+    char group_name[32];
+    unsigned nthreads = 0;
+    hid_t fapl_id = -1;
+    hid_t file_id = -1;
+    hid_t attr_id = -1;
+    herr_t result;
+    int value;
+    int i;
+    FILE *fp = NULL;
+    FILE *threads_fp = NULL;
+    size_t n;
+    size_t threads_n;
+    unsigned char buf[4096];
+    unsigned char threads_buf[4096];
+
+    if(paged)
+        TESTING("MDC flush threads (paged aggregation)")
+    else
+        TESTING("MDC flush threads")
+
+    pass = TRUE;
+
+    /* Check the FAPL property */
+    if ( pass ) {
+
+        if ( ( (fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0 ) ||
+             ( H5Pget_mdc_flush_threads(fapl_id, &nthreads) < 0 ) ||
+             ( nthreads != 0 ) ||
+             ( H5Pset_mdc_flush_threads(fapl_id, 4) < 0 ) ||
+             ( H5Pget_mdc_flush_threads(fapl_id, &nthreads) < 0 ) ||
+             ( nthreads != 4 ) ) {
+
+            pass = FALSE;
+            failure_mssg = "H5P[gs]et_mdc_flush_threads() failed.\n";
+        }
+    }
+
+    if ( pass ) {
+
+        H5E_BEGIN_TRY {
+            result = H5Pset_mdc_flush_threads(fapl_id, 1000);
+        } H5E_END_TRY;
+
+        if ( result >= 0 ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Pset_mdc_flush_threads() accepted 1000 threads.\n";
+        }
+    }
+
+    if ( ( fapl_id >= 0 ) && ( H5Pclose(fapl_id) < 0 ) ) {
+
+        pass = FALSE;
+        failure_mssg = "H5Pclose() failed.\n";
+    }
+
+    /* Create the same file without and with flush threads */
+    if ( pass ) {
+
+        if ( ( h5_fixname(FILENAME[1], H5P_DEFAULT, filename,
+                          sizeof(filename)) == NULL ) ||
+             ( h5_fixname(FILENAME[2], H5P_DEFAULT, threads_filename,
+                          sizeof(threads_filename)) == NULL ) ) {
+
+            pass = FALSE;
+            failure_mssg = "h5_fixname() failed.\n";
+        }
+    }
+
+    create_flush_threads_file(filename, fcpl_id, 0);
+    create_flush_threads_file(threads_filename, fcpl_id, 4);
+
+    /* Compare them.  Paged aggregation needs a superblock extension, whose
+     * object header always stores times, so the files can only be compared
+     * byte for byte without it.
+     */
+    if ( pass && !paged ) {
+
+        if ( ( NULL == (fp = HDfopen(filename, "rb")) ) ||
+             ( NULL == (threads_fp = HDfopen(threads_filename, "rb")) ) ) {
+
+            pass = FALSE;
+            failure_mssg = "can't open files to compare.\n";
+        }
+    }
+
+    while ( pass && fp && threads_fp ) {
+
+        n = HDfread(buf, 1, sizeof(buf), fp);
+        threads_n = HDfread(threads_buf, 1, sizeof(threads_buf), threads_fp);
+
+        if ( ( n != threads_n ) || ( HDmemcmp(buf, threads_buf, n) != 0 ) ) {
+
+            pass = FALSE;
+            failure_mssg = "files written with and without flush threads differ.\n";
+        }
+        else if ( n < sizeof(buf) ) {
+
+            break;
+        }
+    }
+
+    if ( fp )
+        HDfclose(fp);
+    if ( threads_fp )
+        HDfclose(threads_fp);
+
+    /* Read the attributes back */
+    if ( pass ) {
+
+        file_id = H5Fopen(threads_filename, H5F_ACC_RDONLY, H5P_DEFAULT);
+
+        if ( file_id < 0 ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fopen() failed.\n";
+        }
+    }
+
+    for ( i = 0; pass && i < FLUSH_THREADS_NUM_GROUPS; i++ )
+    {
+        HDsnprintf(group_name, sizeof(group_name), "group_%04d", i);
+
+        if ( ( (attr_id = H5Aopen_by_name(file_id, group_name, "index",
+                                          H5P_DEFAULT, H5P_DEFAULT)) < 0 ) ||
+             ( H5Aread(attr_id, H5T_NATIVE_INT, &value) < 0 ) ||
+             ( H5Aclose(attr_id) < 0 ) ||
+             ( value != i ) ) {
+
+            pass = FALSE;
+            failure_mssg = "can't read back attribute.\n";
+        }
+    }
+
+    if ( ( file_id >= 0 ) && ( H5Fclose(file_id) < 0 ) ) {
+
+        pass = FALSE;
+        failure_mssg = "H5Fclose() failed.\n";
+    }
+
+    if ( pass ) {
+
+        PASSED();
+
+    } else {
+
+        H5_FAILED();
+    }
+
+    if ( ! pass ) {
+
+        HDfprintf(stdout, "%s: failure_mssg = \"%s\".\n", FUNC, failure_mssg);
+    }
+
+    return pass;
+
+} /* check_mdc_flush_threads() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    main
@@ -2338,6 +2645,9 @@ main(void)
 
         if(!check_file_mdc_api_errs(paged, my_fcpl))
             nerrs += 1;
+
+        if(!check_mdc_flush_threads(paged, my_fcpl))
+            nerrs += 1;
     } /* end for paged */
 
     if(!check_fapl_mdc_api_errs())
@@ -27,6 +27,7 @@
 const char *FILENAME[] = {
     "cache_test",
     "cache_api_test",
+    "cache_flush_threads_test",
     NULL
 };
 
@@ -369,16 +369,14 @@ typedef struct test_entry_t
  * updated as necessary.
  */
 
-#define H5C__HASH_MASK          ((size_t)(H5C__HASH_TABLE_LEN - 1) << 3)
-
 #define H5C_TEST__PRE_HT_SEARCH_SC(cache_ptr, Addr)          \
 if ( ( (cache_ptr) == NULL ) ||                              \
      ( (cache_ptr)->magic != H5C__H5C_T_MAGIC ) ||           \
      ( (cache_ptr)->index_size !=                            \
        ((cache_ptr)->clean_index_size + (cache_ptr)->dirty_index_size) ) || \
      ( ! H5F_addr_defined(Addr) ) ||                         \
-     ( H5C__HASH_FCN(Addr) < 0 ) ||                          \
-     ( H5C__HASH_FCN(Addr) >= H5C__HASH_TABLE_LEN ) ) {      \
+     ( H5C__HASH_FCN(cache_ptr, Addr) < 0 ) ||               \
+     ( H5C__HASH_FCN(cache_ptr, Addr) >= (int)(cache_ptr)->ht_len ) ) { \
     HDfprintf(stdout, "Pre HT search SC failed.\n");         \
 }
 
@@ -414,7 +412,7 @@ if ( ( (cache_ptr) == NULL ) ||                                        \
 {                                                                       \
     int k;                                                              \
     H5C_TEST__PRE_HT_SEARCH_SC(cache_ptr, Addr)                         \
-    k = H5C__HASH_FCN(Addr);                                            \
+    k = H5C__HASH_FCN(cache_ptr, Addr);                                 \
     entry_ptr = ((cache_ptr)->index)[k];                                \
     while ( entry_ptr )                                                 \
     {                                                                   \
@@ -475,7 +473,10 @@ if ( ( (cache_ptr) == NULL ) ||                                        \
     ( (a).apply_empty_reserve     == (b).apply_empty_reserve ) &&     \
     ( H5_DBL_ABS_EQUAL((a).empty_reserve, (b).empty_reserve) ) && \
     ( (a).dirty_bytes_threshold   == (b).dirty_bytes_threshold ) &&   \
-    ( (a).metadata_write_strategy == (b).metadata_write_strategy ) )
+    ( (a).metadata_write_strategy == (b).metadata_write_strategy ) && \
+    ( ( (a).version < 2 ) ||                                          \
+      ( ( (a).rp_policy           == (b).rp_policy ) &&               \
+        ( H5_DBL_ABS_EQUAL((a).rp_hot_fraction, (b).rp_hot_fraction) ) ) ) )
 
 #define XLATE_EXT_TO_INT_MDC_CONFIG(i, e)                           \
 {                                                                   \
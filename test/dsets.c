@@ -83,6 +83,9 @@ const char *FILENAME[] = {
     "dls_01_strings",   /* 23 */
     "power2up",         /* 24 */
     "version_bounds",   /* 25 */
+    "async_io",         /* 26 */
+    "write_behind",     /* 27 */
+    "lazy_open",        /* 28 */
     NULL
 };
 
@@ -11458,6 +11461,487 @@ error:
 } /* end test_power2up() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    test_async_io
+ *
+ * Purpose:     Tests asynchronous dataset I/O, flush and close through an
+ *              event set, including counting a failed operation.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_async_io(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       did = -1;       /* Dataset ID */
+    hid_t       es_id = -1;     /* Event set ID */
+    hid_t       tid = -1;       /* Memory datatype ID */
+    hid_t       dxpl = -1;      /* Dataset transfer property list ID */
+    hsize_t     dims[2];        /* Dataset dimension sizes */
+    size_t      count;          /* # of operations in progress */
+    size_t      num_errs;       /* # of failed operations */
+    int         i, j, n;
+
+    TESTING("asynchronous I/O with event sets");
+
+    h5_fixname(FILENAME[26], fapl, filename, sizeof filename);
+
+    /* Initialize the data */
+    for(i = n = 0; i < DSET_DIM1; i++)
+        for(j = 0; j < DSET_DIM2; j++) {
+            points[i][j] = n++;
+            check[i][j] = -1;
+        } /* end for */
+
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    dims[0] = DSET_DIM1;
+    dims[1] = DSET_DIM2;
+    if((sid = H5Screate_simple(2, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((did = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+
+    if((es_id = H5EScreate()) < 0) FAIL_STACK_ERROR
+
+    /* An empty event set has nothing to wait for */
+    if(H5ESget_count(es_id, &count) < 0) FAIL_STACK_ERROR
+    if(count != 0) TEST_ERROR
+    if(H5ESwait(es_id) < 0) FAIL_STACK_ERROR
+
+    /* Write, flush and read back; the dataspace may be closed right away */
+    if(H5Dwrite_async(did, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, points, es_id) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    sid = -1;
+    if(H5Fflush_async(fid, H5F_SCOPE_LOCAL, es_id) < 0) FAIL_STACK_ERROR
+    if(H5Dread_async(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check, es_id) < 0) FAIL_STACK_ERROR
+    if(H5ESwait(es_id) < 0) FAIL_STACK_ERROR
+
+    if(H5ESget_count(es_id, &count) < 0) FAIL_STACK_ERROR
+    if(count != 0) TEST_ERROR
+    if(H5ESget_err_count(es_id, &num_errs) < 0) FAIL_STACK_ERROR
+    if(num_errs != 0) TEST_ERROR
+    for(i = 0; i < DSET_DIM1; i++)
+        for(j = 0; j < DSET_DIM2; j++)
+            if(points[i][j] != check[i][j]) {
+                H5_FAILED();
+                printf("    Read different values than written.\n");
+                printf("    At index %d,%d\n", i, j);
+                goto error;
+            } /* end if */
+
+    /* The memory datatype and transfer properties may be closed right away too */
+    for(i = 0; i < DSET_DIM1; i++)
+        for(j = 0; j < DSET_DIM2; j++)
+            check[i][j] = -1;
+    if((tid = H5Tcopy(H5T_NATIVE_INT)) < 0) FAIL_STACK_ERROR
+    if((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0) FAIL_STACK_ERROR
+    if(H5Dread_async(did, tid, H5S_ALL, H5S_ALL, dxpl, check, es_id) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(tid) < 0) FAIL_STACK_ERROR
+    tid = -1;
+    if(H5Pclose(dxpl) < 0) FAIL_STACK_ERROR
+    dxpl = -1;
+    if(H5ESwait(es_id) < 0) FAIL_STACK_ERROR
+    if(H5ESget_err_count(es_id, &num_errs) < 0) FAIL_STACK_ERROR
+    if(num_errs != 0) TEST_ERROR
+    for(i = 0; i < DSET_DIM1; i++)
+        for(j = 0; j < DSET_DIM2; j++)
+            if(points[i][j] != check[i][j]) TEST_ERROR
+
+    /* A read that can't convert the data fails when it is carried out and
+     * is counted, rather than failing the call that started it.
+     */
+    if(H5Dread_async(did, H5T_C_S1, H5S_ALL, H5S_ALL, H5P_DEFAULT, check, es_id) < 0) FAIL_STACK_ERROR
+    if(H5ESwait(es_id) < 0) FAIL_STACK_ERROR
+    if(H5ESget_err_count(es_id, &num_errs) < 0) FAIL_STACK_ERROR
+    if(num_errs != 1) TEST_ERROR
+
+    /* Bad arguments are still reported immediately */
+    H5E_BEGIN_TRY {
+        if(H5Dwrite_async(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points, fid) >= 0) TEST_ERROR
+        if(H5Dclose_async(fid, es_id) >= 0) TEST_ERROR
+    } H5E_END_TRY;
+
+    if(H5Dclose_async(did, es_id) < 0) FAIL_STACK_ERROR
+    did = -1;
+    if(H5ESwait(es_id) < 0) FAIL_STACK_ERROR
+    if(H5ESget_err_count(es_id, &num_errs) < 0) FAIL_STACK_ERROR
+    if(num_errs != 1) TEST_ERROR
+    if(H5ESclose(es_id) < 0) FAIL_STACK_ERROR
+    es_id = -1;
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5ESclose(es_id);
+        H5Pclose(dxpl);
+        H5Tclose(tid);
+        H5Dclose(did);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_async_io() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_write_behind
+ *
+ * Purpose:     Tests that with write-behind enabled, dirty chunks are
+ *              written out while the dataset is being written, and that
+ *              without it they stay in the chunk cache until flushed.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_write_behind(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       my_fapl = -1;   /* File access property list */
+    hid_t       fid = -1;       /* File ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list */
+    hid_t       dapl = -1;      /* Dataset access property list */
+    hid_t       did = -1;       /* Dataset ID */
+    hid_t       es_id = -1;     /* Event set ID */
+    hsize_t     dims[2];        /* Dataset dimension sizes */
+    hsize_t     chunk_dims[2];  /* Chunk dimension sizes */
+    H5F_io_stats_t stats;       /* File I/O statistics */
+    double      ratio;          /* Write-behind dirty ratio */
+    unsigned    use_wb;         /* Whether write-behind is enabled */
+    int         i, j, n;
+
+    TESTING("write-behind of dirty chunks");
+
+    h5_fixname(FILENAME[27], fapl, filename, sizeof filename);
+
+    for(i = n = 0; i < DSET_DIM1; i++)
+        for(j = 0; j < DSET_DIM2; j++)
+            points[i][j] = n++;
+
+    /* Property round-trip and bad values */
+    if((my_fapl = H5Pcopy(fapl)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_write_behind(my_fapl, &ratio) < 0) FAIL_STACK_ERROR
+    if(ratio != 0.0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        if(H5Pset_write_behind(my_fapl, -0.5) >= 0) TEST_ERROR
+        if(H5Pset_write_behind(my_fapl, 1.5) >= 0) TEST_ERROR
+    } H5E_END_TRY;
+
+    /* 100 chunks of 800 bytes, all fitting in the chunk cache */
+    dims[0] = DSET_DIM1;
+    dims[1] = DSET_DIM2;
+    chunk_dims[0] = 10;
+    chunk_dims[1] = 20;
+    if((sid = H5Screate_simple(2, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) FAIL_STACK_ERROR
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk_cache(dapl, (size_t)10007, (size_t)(1024 * 1024), 0.75) < 0) FAIL_STACK_ERROR
+
+    for(use_wb = 0; use_wb < 2; use_wb++) {
+        if(H5Pset_write_behind(my_fapl, use_wb ? 0.05 : 0.0) < 0) FAIL_STACK_ERROR
+        if(use_wb) {
+            if(H5Pget_write_behind(my_fapl, &ratio) < 0) FAIL_STACK_ERROR
+            if(ratio != 0.05) TEST_ERROR
+        } /* end if */
+
+        if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, my_fapl)) < 0) FAIL_STACK_ERROR
+        if((did = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0) FAIL_STACK_ERROR
+        if(H5Freset_io_stats(fid) < 0) FAIL_STACK_ERROR
+
+        if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0) FAIL_STACK_ERROR
+
+        /* Write-behind may run on the background thread; an event set
+         * operation queued after it completes after it.
+         */
+        if((es_id = H5EScreate()) < 0) FAIL_STACK_ERROR
+        if(H5Dread_async(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check, es_id) < 0) FAIL_STACK_ERROR
+        if(H5ESwait(es_id) < 0) FAIL_STACK_ERROR
+        if(H5ESclose(es_id) < 0) FAIL_STACK_ERROR
+        es_id = -1;
+
+        /* Only with write-behind have some, but not all, chunks been written */
+        if(H5Fget_io_stats(fid, &stats) < 0) FAIL_STACK_ERROR
+        if(use_wb) {
+            if(stats.write[H5FD_MEM_DRAW].count == 0) TEST_ERROR
+            if(stats.write[H5FD_MEM_DRAW].count >= 100) TEST_ERROR
+        } /* end if */
+        else if(stats.write[H5FD_MEM_DRAW].count != 0) TEST_ERROR
+
+        /* The data is all there after closing */
+        if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+        did = -1;
+        if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+        if((fid = H5Fopen(filename, H5F_ACC_RDONLY, my_fapl)) < 0) FAIL_STACK_ERROR
+        if((did = H5Dopen2(fid, "dset", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+        if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0) FAIL_STACK_ERROR
+        for(i = 0; i < DSET_DIM1; i++)
+            for(j = 0; j < DSET_DIM2; j++)
+                if(points[i][j] != check[i][j]) {
+                    H5_FAILED();
+                    printf("    Read different values than written.\n");
+                    printf("    At index %d,%d\n", i, j);
+                    goto error;
+                } /* end if */
+        if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+        did = -1;
+        if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+        fid = -1;
+    } /* end for */
+
+    /* A pending write-behind pass doesn't keep the dataset or file open */
+    if(H5Pset_fclose_degree(my_fapl, H5F_CLOSE_SEMI) < 0) FAIL_STACK_ERROR
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, my_fapl)) < 0) FAIL_STACK_ERROR
+    if((did = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+    did = -1;
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, my_fapl)) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+    fid = -1;
+
+    if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(my_fapl) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5ESclose(es_id);
+        H5Dclose(did);
+        H5Fclose(fid);
+        H5Pclose(dapl);
+        H5Pclose(dcpl);
+        H5Sclose(sid);
+        H5Pclose(my_fapl);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_write_behind() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_lazy_open
+ *
+ * Purpose:     Tests that a dataset opened with a lazy open DAPL only
+ *              loads its layout when it's needed, and behaves the same
+ *              as an eagerly opened dataset afterwards.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_lazy_open(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list */
+    hid_t       dapl = -1;      /* Dataset access property list */
+    hid_t       plist = -1;     /* Dataset's property list */
+    hid_t       did = -1;       /* Dataset ID */
+    hid_t       tid = -1;       /* Datatype ID */
+    hid_t       aid = -1;       /* Attribute ID */
+    hid_t       src_did = -1;   /* Source dataset ID */
+    hid_t       src_sid = -1;   /* Source dataspace ID */
+    hsize_t     dims[2];        /* Dataset dimension sizes */
+    hsize_t     max_dims[2];    /* Dataset max. dimension sizes */
+    hsize_t     start[2];       /* Hyperslab start */
+    hsize_t     count[2];       /* Hyperslab count */
+    hsize_t     chunk_dims[2];  /* Chunk dimension sizes */
+    size_t      nslots;         /* Chunk cache # of slots */
+    hbool_t     lazy;           /* Lazy open flag */
+    hbool_t     pending;        /* Whether the layout is yet to be loaded */
+    int         attr_val;       /* Attribute value */
+    int         i, j, n;
+
+    TESTING("lazy dataset open");
+
+    h5_fixname(FILENAME[28], fapl, filename, sizeof filename);
+
+    for(i = n = 0; i < DSET_DIM1; i++)
+        for(j = 0; j < DSET_DIM2; j++)
+            points[i][j] = n++;
+
+    /* Property round-trip */
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_lazy_open(dapl, &lazy) < 0) FAIL_STACK_ERROR
+    if(lazy) TEST_ERROR
+    if(H5Pset_lazy_open(dapl, TRUE) < 0) FAIL_STACK_ERROR
+    if(H5Pget_lazy_open(dapl, &lazy) < 0) FAIL_STACK_ERROR
+    if(!lazy) TEST_ERROR
+    if(H5Pset_chunk_cache(dapl, (size_t)101, (size_t)(64 * 1024), 0.5) < 0) FAIL_STACK_ERROR
+
+    /* Create a filtered, chunked dataset with an attribute */
+    dims[0] = DSET_DIM1;
+    dims[1] = DSET_DIM2;
+    chunk_dims[0] = 10;
+    chunk_dims[1] = 20;
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(2, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) FAIL_STACK_ERROR
+    if(H5Pset_shuffle(dcpl) < 0) FAIL_STACK_ERROR
+    if((did = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate(H5S_SCALAR)) < 0) FAIL_STACK_ERROR
+    if((aid = H5Acreate2(did, "attr", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    attr_val = 42;
+    if(H5Awrite(aid, H5T_NATIVE_INT, &attr_val) < 0) FAIL_STACK_ERROR
+    if(H5Aclose(aid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    if((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0) FAIL_STACK_ERROR
+
+    /* Opening eagerly loads the layout */
+    if((did = H5Dopen2(fid, "dset", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5D__layout_pending_test(did, &pending) < 0) FAIL_STACK_ERROR
+    if(pending) TEST_ERROR
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+
+    /* Querying the shape, type & attributes doesn't load the layout */
+    if((did = H5Dopen2(fid, "dset", dapl)) < 0) FAIL_STACK_ERROR
+    if(H5D__layout_pending_test(did, &pending) < 0) FAIL_STACK_ERROR
+    if(!pending) TEST_ERROR
+    if((sid = H5Dget_space(did)) < 0) FAIL_STACK_ERROR
+    if(H5Sget_simple_extent_dims(sid, dims, NULL) != 2) FAIL_STACK_ERROR
+    if(dims[0] != DSET_DIM1 || dims[1] != DSET_DIM2) TEST_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if((tid = H5Dget_type(did)) < 0) FAIL_STACK_ERROR
+    if(H5Tequal(tid, H5T_NATIVE_INT) != TRUE) TEST_ERROR
+    if(H5Tclose(tid) < 0) FAIL_STACK_ERROR
+    if((aid = H5Aopen(did, "attr", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    attr_val = 0;
+    if(H5Aread(aid, H5T_NATIVE_INT, &attr_val) < 0) FAIL_STACK_ERROR
+    if(attr_val != 42) TEST_ERROR
+    if(H5Aclose(aid) < 0) FAIL_STACK_ERROR
+    if(H5D__layout_pending_test(did, &pending) < 0) FAIL_STACK_ERROR
+    if(!pending) TEST_ERROR
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+
+    /* Reading loads the layout, with the DAPL's chunk cache settings */
+    if((did = H5Dopen2(fid, "dset", dapl)) < 0) FAIL_STACK_ERROR
+    HDmemset(check, 0, sizeof(check));
+    if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0) FAIL_STACK_ERROR
+    if(H5D__layout_pending_test(did, &pending) < 0) FAIL_STACK_ERROR
+    if(pending) TEST_ERROR
+    for(i = 0; i < DSET_DIM1; i++)
+        for(j = 0; j < DSET_DIM2; j++)
+            if(points[i][j] != check[i][j]) {
+                H5_FAILED();
+                printf("    Read different values than written.\n");
+                printf("    At index %d,%d\n", i, j);
+                goto error;
+            } /* end if */
+    if((plist = H5Dget_access_plist(did)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_cache(plist, &nslots, NULL, NULL) < 0) FAIL_STACK_ERROR
+    if(nslots != 101) TEST_ERROR
+    if(H5Pclose(plist) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+
+    /* Querying the creation properties & storage loads the layout */
+    if((did = H5Dopen2(fid, "dset", dapl)) < 0) FAIL_STACK_ERROR
+    if((plist = H5Dget_create_plist(did)) < 0) FAIL_STACK_ERROR
+    if(H5D__layout_pending_test(did, &pending) < 0) FAIL_STACK_ERROR
+    if(pending) TEST_ERROR
+    if(H5Pget_layout(plist) != H5D_CHUNKED) TEST_ERROR
+    if(H5Pget_nfilters(plist) != 1) TEST_ERROR
+    if(H5Pclose(plist) < 0) FAIL_STACK_ERROR
+    if(H5Dget_storage_size(did) == 0) TEST_ERROR
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+
+    /* Create a virtual dataset with an unlimited mapping to a source
+     *  dataset in the same file
+     */
+    if((fid = H5Fopen(filename, H5F_ACC_RDWR, fapl)) < 0) FAIL_STACK_ERROR
+    dims[0] = 10;
+    dims[1] = 10;
+    max_dims[0] = 10;
+    max_dims[1] = H5S_UNLIMITED;
+    if((src_sid = H5Screate_simple(2, dims, max_dims)) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 2, dims) < 0) FAIL_STACK_ERROR
+    if((src_did = H5Dcreate2(fid, "src", H5T_NATIVE_INT, src_sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    start[0] = start[1] = 0;
+    count[0] = 10;
+    count[1] = H5S_UNLIMITED;
+    if(H5Sselect_hyperslab(src_sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(2, dims, max_dims)) < 0) FAIL_STACK_ERROR
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_virtual(dcpl, sid, ".", "src", src_sid) < 0) FAIL_STACK_ERROR
+    if((did = H5Dcreate2(fid, "vds", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(src_sid) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+
+    /* Extend the source dataset after the virtual dataset was created */
+    dims[1] = 20;
+    if(H5Dset_extent(src_did, dims) < 0) FAIL_STACK_ERROR
+
+    /* Querying the shape of an unlimited virtual dataset loads the layout
+     *  and picks up the source dataset's new extent
+     */
+    if((did = H5Dopen2(fid, "vds", dapl)) < 0) FAIL_STACK_ERROR
+    if(H5D__layout_pending_test(did, &pending) < 0) FAIL_STACK_ERROR
+    if(!pending) TEST_ERROR
+    if((sid = H5Dget_space(did)) < 0) FAIL_STACK_ERROR
+    if(H5Sget_simple_extent_dims(sid, dims, NULL) != 2) FAIL_STACK_ERROR
+    if(dims[0] != 10 || dims[1] != 20) TEST_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5D__layout_pending_test(did, &pending) < 0) FAIL_STACK_ERROR
+    if(pending) TEST_ERROR
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(src_did) < 0) FAIL_STACK_ERROR
+
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Aclose(aid);
+        H5Tclose(tid);
+        H5Pclose(plist);
+        H5Dclose(did);
+        H5Dclose(src_did);
+        H5Sclose(sid);
+        H5Sclose(src_sid);
+        H5Fclose(fid);
+        H5Pclose(dcpl);
+        H5Pclose(dapl);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_lazy_open() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    test_scatter
  *
@@ -13195,6 +13679,9 @@ main(void)
             nerrors += (test_zero_dim_dset(my_fapl) < 0             ? 1 : 0);
             nerrors += (test_storage_size(my_fapl) < 0              ? 1 : 0);
             nerrors += (test_power2up(my_fapl) < 0                  ? 1 : 0);
+            nerrors += (test_async_io(my_fapl) < 0                  ? 1 : 0);
+            nerrors += (test_write_behind(my_fapl) < 0              ? 1 : 0);
+            nerrors += (test_lazy_open(my_fapl) < 0                 ? 1 : 0);
 
             nerrors += (test_swmr_non_latest(envval, my_fapl) < 0   ? 1 : 0);
             nerrors += (test_earray_hdr_fd(envval, my_fapl) < 0     ? 1 : 0);
@@ -6478,6 +6478,135 @@ error:
     return 1;
 } /* end test_set_order_compound() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    test_decode_cache
+ *
+ * Purpose:     Tests opening many datasets & attributes that share the
+ *              same datatype, which are decoded through the file's
+ *              decoded message cache, and that each object still gets
+ *              its own datatype & dataspace.
+ *
+ * Return:      Success:        0
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+#define DECODE_CACHE_NMEMBS     40
+#define DECODE_CACHE_NDSETS     20
+static int
+test_decode_cache(hid_t fapl)
+{
+    typedef struct {
+        int     v[DECODE_CACHE_NMEMBS];
+        char    *name;
+    } dc_t;
+    dc_t        wdata[DECODE_CACHE_NDSETS], rdata[DECODE_CACHE_NDSETS];
+    hid_t       file = -1, dset = -1, attr = -1;
+    hid_t       cmpd = -1, str = -1, type = -1;
+    hid_t       space = -1, scalar = -1;
+    hsize_t     dims[1];
+    char        filename[1024], name[32];
+    unsigned    u, v;
+
+    TESTING("decoding many objects that share a datatype");
+
+    /* Build a compound type with a variable-length string member */
+    if((str = H5Tcopy(H5T_C_S1)) < 0) TEST_ERROR
+    if(H5Tset_size(str, H5T_VARIABLE) < 0) TEST_ERROR
+    if((cmpd = H5Tcreate(H5T_COMPOUND, sizeof(dc_t))) < 0) TEST_ERROR
+    for(u = 0; u < DECODE_CACHE_NMEMBS; u++) {
+        HDsprintf(name, "m%02u", u);
+        if(H5Tinsert(cmpd, name, HOFFSET(dc_t, v) + u * sizeof(int), H5T_NATIVE_INT) < 0) TEST_ERROR
+    } /* end for */
+    if(H5Tinsert(cmpd, "name", HOFFSET(dc_t, name), str) < 0) TEST_ERROR
+
+    for(u = 0; u < DECODE_CACHE_NDSETS; u++) {
+        for(v = 0; v < DECODE_CACHE_NMEMBS; v++)
+            wdata[u].v[v] = (int)(u * 100 + v);
+        wdata[u].name = (char *)HDmalloc(32);
+        HDsprintf(wdata[u].name, "object %u", u);
+    } /* end for */
+
+    /* Create datasets of different sizes with the same datatype, each
+     * with an attribute that also uses it */
+    h5_fixname(FILENAME[7], fapl, filename, sizeof filename);
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((scalar = H5Screate(H5S_SCALAR)) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < DECODE_CACHE_NDSETS; u++) {
+        dims[0] = u + 1;
+        if((space = H5Screate_simple(1, dims, NULL)) < 0) FAIL_STACK_ERROR
+        HDsprintf(name, "dset%02u", u);
+        if((dset = H5Dcreate2(file, name, cmpd, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+        if(H5Dwrite(dset, cmpd, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata) < 0) FAIL_STACK_ERROR
+        if((attr = H5Acreate2(dset, "attr", cmpd, scalar, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+        if(H5Awrite(attr, cmpd, &wdata[u]) < 0) FAIL_STACK_ERROR
+        if(H5Aclose(attr) < 0) FAIL_STACK_ERROR
+        if(H5Dclose(dset) < 0) FAIL_STACK_ERROR
+        if(H5Sclose(space) < 0) FAIL_STACK_ERROR
+    } /* end for */
+    if(H5Fclose(file) < 0) FAIL_STACK_ERROR
+
+    /* Re-open the objects & check their datatypes, dataspaces and data */
+    if((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < DECODE_CACHE_NDSETS; u++) {
+        HDsprintf(name, "dset%02u", u);
+        if((dset = H5Dopen2(file, name, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+
+        if((type = H5Dget_type(dset)) < 0) FAIL_STACK_ERROR
+        if(H5Tequal(type, cmpd) <= 0) TEST_ERROR
+        if(H5Tclose(type) < 0) FAIL_STACK_ERROR
+
+        if((space = H5Dget_space(dset)) < 0) FAIL_STACK_ERROR
+        if(H5Sget_simple_extent_dims(space, dims, NULL) != 1) TEST_ERROR
+        if(dims[0] != u + 1) TEST_ERROR
+
+        HDmemset(rdata, 0, sizeof(rdata));
+        if(H5Dread(dset, cmpd, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata) < 0) FAIL_STACK_ERROR
+        for(v = 0; v <= u; v++)
+            if(HDmemcmp(rdata[v].v, wdata[v].v, sizeof(rdata[v].v)) || HDstrcmp(rdata[v].name, wdata[v].name))
+                TEST_ERROR
+        if(H5Dvlen_reclaim(cmpd, space, H5P_DEFAULT, rdata) < 0) FAIL_STACK_ERROR
+        if(H5Sclose(space) < 0) FAIL_STACK_ERROR
+
+        if((attr = H5Aopen(dset, "attr", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+        if((type = H5Aget_type(attr)) < 0) FAIL_STACK_ERROR
+        if(H5Tequal(type, cmpd) <= 0) TEST_ERROR
+        if(H5Tclose(type) < 0) FAIL_STACK_ERROR
+        HDmemset(rdata, 0, sizeof(rdata));
+        if(H5Aread(attr, cmpd, rdata) < 0) FAIL_STACK_ERROR
+        if(HDmemcmp(rdata[0].v, wdata[u].v, sizeof(rdata[0].v)) || HDstrcmp(rdata[0].name, wdata[u].name))
+            TEST_ERROR
+        if(H5Dvlen_reclaim(cmpd, scalar, H5P_DEFAULT, rdata) < 0) FAIL_STACK_ERROR
+        if(H5Aclose(attr) < 0) FAIL_STACK_ERROR
+
+        if(H5Dclose(dset) < 0) FAIL_STACK_ERROR
+    } /* end for */
+    if(H5Fclose(file) < 0) FAIL_STACK_ERROR
+
+    for(u = 0; u < DECODE_CACHE_NDSETS; u++)
+        HDfree(wdata[u].name);
+    if(H5Sclose(scalar) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(cmpd) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(str) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Aclose(attr);
+        H5Dclose(dset);
+        H5Tclose(type);
+        H5Tclose(cmpd);
+        H5Tclose(str);
+        H5Sclose(space);
+        H5Sclose(scalar);
+        H5Fclose(file);
+    } H5E_END_TRY;
+    return 1;
+} /* end test_decode_cache() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	test_named_indirect_reopen
@@ -7438,6 +7567,7 @@ main(void)
     nerrors += test_delete_obj_named(fapl);
     nerrors += test_delete_obj_named_fileid(fapl);
     nerrors += test_set_order_compound(fapl);
+    nerrors += test_decode_cache(fapl);
     nerrors += test_str_create();
 #ifndef H5_NO_DEPRECATED_SYMBOLS
     nerrors += test_deprec(fapl);
@@ -570,6 +570,128 @@ error:
     return -1;
 } /* end test_copy() */
 
+
+/* First record of an error stack, for test_quiet() */
+typedef struct quiet_rec_t {
+    hid_t cls_id, maj_num, min_num;
+    char func_name[MSG_SIZE];
+    char file_name[MSG_SIZE];
+} quiet_rec_t;
+
+
+/*-------------------------------------------------------------------------
+ * Function:    quiet_walk_cb
+ *
+ * Purpose:     Callback function to check and save the first record of an
+ *              error stack.
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+quiet_walk_cb(unsigned n, const H5E_error2_t *err_desc, void *client_data)
+{
+    quiet_rec_t *first = (quiet_rec_t *)client_data;
+
+    if (err_desc->func_name == NULL || err_desc->file_name == NULL || err_desc->desc == NULL)
+        return -1;
+    if (err_desc->line == 0)
+        return -1;
+
+    if (n == 0) {
+        first->cls_id = err_desc->cls_id;
+        first->maj_num = err_desc->maj_num;
+        first->min_num = err_desc->min_num;
+        HDstrncpy(first->func_name, err_desc->func_name, MSG_SIZE - 1);
+        HDstrncpy(first->file_name, err_desc->file_name, MSG_SIZE - 1);
+    } /* end if */
+
+    return 0;
+} /* end quiet_walk_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_quiet
+ *
+ * Purpose:     Test recording library errors in quiet mode
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_quiet(hid_t file)
+{
+    quiet_rec_t full, quiet;                    /* First error record in each mode */
+    ssize_t     full_num, quiet_num;            /* Number of errors on stack */
+    hid_t       estack_id = -1;                 /* Error stack ID */
+    hbool_t     is_quiet = TRUE;                /* Whether quiet mode is on */
+    hid_t       gid;                            /* Group ID */
+
+    /* Quiet mode is off by default */
+    if (H5Eget_quiet(&is_quiet) < 0)
+        TEST_ERROR
+    if (is_quiet)
+        TEST_ERROR
+
+    /* Fail to open a group the regular way */
+    H5E_BEGIN_TRY {
+        gid = H5Gopen2(file, "/no_such_group", H5P_DEFAULT);
+    } H5E_END_TRY
+    if (gid >= 0)
+        TEST_ERROR
+    if ((full_num = H5Eget_num(H5E_DEFAULT)) <= 0)
+        TEST_ERROR
+    HDmemset(&full, 0, sizeof(full));
+    if (H5Ewalk2(H5E_DEFAULT, H5E_WALK_UPWARD, quiet_walk_cb, &full) < 0)
+        TEST_ERROR
+
+    /* Fail the same way in quiet mode */
+    H5E_BEGIN_QUIET {
+        gid = H5Gopen2(file, "/no_such_group", H5P_DEFAULT);
+    } H5E_END_QUIET
+    if (gid >= 0)
+        TEST_ERROR
+
+    /* The records are the same, except for the unformatted descriptions */
+    if ((quiet_num = H5Eget_num(H5E_DEFAULT)) != full_num)
+        TEST_ERROR
+    HDmemset(&quiet, 0, sizeof(quiet));
+    if (H5Ewalk2(H5E_DEFAULT, H5E_WALK_UPWARD, quiet_walk_cb, &quiet) < 0)
+        TEST_ERROR
+    if (quiet.cls_id != full.cls_id || quiet.maj_num != full.maj_num
+            || quiet.min_num != full.min_num)
+        TEST_ERROR
+    if (HDstrcmp(quiet.func_name, full.func_name) || HDstrcmp(quiet.file_name, full.file_name))
+        TEST_ERROR
+
+    /* The setting is restored */
+    if (H5Eget_quiet(&is_quiet) < 0)
+        TEST_ERROR
+    if (is_quiet)
+        TEST_ERROR
+
+    /* Copying the stack, putting it back and clearing it all work */
+    if ((estack_id = H5Eget_current_stack()) < 0)
+        TEST_ERROR
+    if (H5Eget_num(estack_id) != quiet_num)
+        TEST_ERROR
+    if (H5Eset_current_stack(estack_id) < 0)
+        TEST_ERROR
+    if (H5Eget_num(H5E_DEFAULT) != quiet_num)
+        TEST_ERROR
+    if (H5Eclear2(H5E_DEFAULT) < 0)
+        TEST_ERROR
+
+    return 0;
+
+error:
+    return -1;
+} /* end test_quiet() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    close_error
@@ -729,6 +851,10 @@ main(void)
     if (test_copy() < 0)
         TEST_ERROR;
 
+    /* Test recording errors in quiet mode */
+    if (test_quiet(file) < 0)
+        TEST_ERROR;
+
     if (H5Fclose(file) < 0)
         TEST_ERROR;
 
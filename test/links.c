@@ -1615,6 +1615,357 @@ error:
     return 1;
 } /* end test_move_preserves() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    test_path_cache
+ *
+ * Purpose:     Tests that paths resolve correctly with the path lookup
+ *              cache enabled, when the links they go through are moved,
+ *              deleted and recreated.
+ *
+ * Return:      Success:        0
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_path_cache(hid_t fapl, hbool_t new_format)
+{
+    hid_t file_id = -1;
+    hid_t group_id = -1;
+    hid_t my_fapl = -1;
+    H5O_info_t oinfo;
+    haddr_t addr;
+    size_t nentries;
+    char filename[1024];
+
+    if(new_format)
+        TESTING("path lookup cache (w/new group format)")
+    else
+        TESTING("path lookup cache")
+
+    /* Enable the cache */
+    if((my_fapl = H5Pcopy(fapl)) < 0) TEST_ERROR
+    if(H5Pget_path_cache(my_fapl, &nentries) < 0) TEST_ERROR
+    if(nentries != 0) TEST_ERROR
+    if(H5Pset_path_cache(my_fapl, (size_t)64) < 0) TEST_ERROR
+    if(H5Pget_path_cache(my_fapl, &nentries) < 0) TEST_ERROR
+    if(nentries != 64) TEST_ERROR
+
+    /* Create file with a few levels of groups */
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+    if((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, my_fapl)) < 0) TEST_ERROR
+    if((group_id = H5Gcreate2(file_id, "/a", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Gclose(group_id) < 0) TEST_ERROR
+    if((group_id = H5Gcreate2(file_id, "/a/b", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Gclose(group_id) < 0) TEST_ERROR
+    if((group_id = H5Gcreate2(file_id, "/a/b/c", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Oget_info(group_id, &oinfo) < 0) TEST_ERROR
+    addr = oinfo.addr;
+    if(H5Gclose(group_id) < 0) TEST_ERROR
+
+    /* Resolve the path twice */
+    if(H5Oget_info_by_name(file_id, "/a/b/c", &oinfo, H5P_DEFAULT) < 0) TEST_ERROR
+    if(oinfo.addr != addr) TEST_ERROR
+    if(H5Oget_info_by_name(file_id, "/a/b/c", &oinfo, H5P_DEFAULT) < 0) TEST_ERROR
+    if(oinfo.addr != addr) TEST_ERROR
+
+    /* Move the link: the old path must not resolve any more */
+    if(H5Lmove(file_id, "/a/b/c", file_id, "/a/b/d", H5P_DEFAULT, H5P_DEFAULT) < 0) TEST_ERROR
+    if(H5Lexists(file_id, "/a/b/c", H5P_DEFAULT) != FALSE) TEST_ERROR
+    if(H5Oget_info_by_name(file_id, "/a/b/d", &oinfo, H5P_DEFAULT) < 0) TEST_ERROR
+    if(oinfo.addr != addr) TEST_ERROR
+
+    /* Delete the link & create a new group in its place */
+    if(H5Ldelete(file_id, "/a/b/d", H5P_DEFAULT) < 0) TEST_ERROR
+    if(H5Lexists(file_id, "/a/b/d", H5P_DEFAULT) != FALSE) TEST_ERROR
+    if(H5Lcreate_soft("/a", file_id, "/a/b/d", H5P_DEFAULT, H5P_DEFAULT) < 0) TEST_ERROR
+    if(H5Oget_info_by_name(file_id, "/a/b/d/b", &oinfo, H5P_DEFAULT) < 0) TEST_ERROR
+    if(oinfo.type != H5O_TYPE_GROUP) TEST_ERROR
+
+    /* Delete the group holding the links & create a new, empty one */
+    if(H5Ldelete(file_id, "/a/b", H5P_DEFAULT) < 0) TEST_ERROR
+    if((group_id = H5Gcreate2(file_id, "/a/b", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Gclose(group_id) < 0) TEST_ERROR
+    if(H5Lexists(file_id, "/a/b/d", H5P_DEFAULT) != FALSE) TEST_ERROR
+
+    /* Delete a link by index */
+    if((group_id = H5Gcreate2(file_id, "/a/b/e", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Gclose(group_id) < 0) TEST_ERROR
+    if(H5Lexists(file_id, "/a/b/e", H5P_DEFAULT) != TRUE) TEST_ERROR
+    if(H5Ldelete_by_idx(file_id, "/a/b", H5_INDEX_NAME, H5_ITER_INC, (hsize_t)0, H5P_DEFAULT) < 0) TEST_ERROR
+    if(H5Lexists(file_id, "/a/b/e", H5P_DEFAULT) != FALSE) TEST_ERROR
+
+    /* Close everything */
+    if(H5Fclose(file_id) < 0) TEST_ERROR
+    if(H5Pclose(my_fapl) < 0) TEST_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Gclose(group_id);
+        H5Fclose(file_id);
+        H5Pclose(my_fapl);
+    } H5E_END_TRY;
+    return 1;
+} /* end test_path_cache() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_compact_lookup
+ *
+ * Purpose:     Look up links by name in a large compact group, while links
+ *              are removed and renamed and other messages are added to the
+ *              group's object header.
+ *
+ * Return:      Success:        0
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+#define COMPACT_LOOKUP_NLINKS   200
+static int
+test_compact_lookup(hid_t fapl, hbool_t new_format)
+{
+    hid_t file_id = -1;
+    hid_t group_id = -1;
+    hid_t gcpl_id = -1;
+    hid_t space_id = -1;
+    hid_t attr_id = -1;
+    H5L_info_t linfo;
+    char filename[1024];
+    char name[NAME_BUF_SIZE];
+    char target[NAME_BUF_SIZE];
+    unsigned u;
+
+    if(new_format)
+        TESTING("link lookup in large compact group (w/new group format)")
+    else
+        TESTING("link lookup in large compact group")
+
+    /* Keep the group's links in its object header */
+    if((gcpl_id = H5Pcreate(H5P_GROUP_CREATE)) < 0) TEST_ERROR
+    if(H5Pset_link_phase_change(gcpl_id, COMPACT_LOOKUP_NLINKS + 1, COMPACT_LOOKUP_NLINKS) < 0) TEST_ERROR
+
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+    if((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) TEST_ERROR
+    if((group_id = H5Gcreate2(file_id, "group", H5P_DEFAULT, gcpl_id, H5P_DEFAULT)) < 0) TEST_ERROR
+
+    /* Create the links, looking each up as it's added */
+    for(u = 0; u < COMPACT_LOOKUP_NLINKS; u++) {
+        HDsprintf(name, "link %u", u);
+        HDsprintf(target, "/target %u", u);
+        if(H5Lexists(group_id, name, H5P_DEFAULT) != FALSE) TEST_ERROR
+        if(H5Lcreate_soft(target, group_id, name, H5P_DEFAULT, H5P_DEFAULT) < 0) TEST_ERROR
+        if(H5Lexists(group_id, name, H5P_DEFAULT) != TRUE) TEST_ERROR
+    } /* end for */
+
+    /* Remove every third link and rename every fifth */
+    for(u = 0; u < COMPACT_LOOKUP_NLINKS; u++) {
+        HDsprintf(name, "link %u", u);
+        if(u % 3 == 0) {
+            if(H5Ldelete(group_id, name, H5P_DEFAULT) < 0) TEST_ERROR
+        } /* end if */
+        else if(u % 5 == 0) {
+            HDsprintf(target, "renamed %u", u);
+            if(H5Lmove(group_id, name, group_id, target, H5P_DEFAULT, H5P_DEFAULT) < 0) TEST_ERROR
+        } /* end if */
+    } /* end for */
+
+    /* Add a few attributes, to shuffle the messages in the header */
+    if((space_id = H5Screate(H5S_SCALAR)) < 0) TEST_ERROR
+    for(u = 0; u < 8; u++) {
+        HDsprintf(name, "attr %u", u);
+        if((attr_id = H5Acreate2(group_id, name, H5T_NATIVE_INT, space_id, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+        if(H5Aclose(attr_id) < 0) TEST_ERROR
+    } /* end for */
+    if(H5Sclose(space_id) < 0) TEST_ERROR
+
+    /* Check the links, before and after reopening the file */
+    for(;;) {
+        for(u = 0; u < COMPACT_LOOKUP_NLINKS; u++) {
+            HDsprintf(name, "link %u", u);
+            if(H5Lexists(group_id, name, H5P_DEFAULT) != (u % 3 != 0 && u % 5 != 0)) TEST_ERROR
+            HDsprintf(name, "renamed %u", u);
+            if(H5Lexists(group_id, name, H5P_DEFAULT) != (u % 3 != 0 && u % 5 == 0)) TEST_ERROR
+            if(u % 3 != 0) {
+                if(u % 5 != 0)
+                    HDsprintf(name, "link %u", u);
+                if(H5Lget_info(group_id, name, &linfo, H5P_DEFAULT) < 0) TEST_ERROR
+                if(linfo.type != H5L_TYPE_SOFT) TEST_ERROR
+                if(H5Lget_val(group_id, name, target, sizeof(target), H5P_DEFAULT) < 0) TEST_ERROR
+                HDsprintf(name, "/target %u", u);
+                if(HDstrcmp(name, target)) TEST_ERROR
+            } /* end if */
+        } /* end for */
+
+        if(file_id < 0)
+            break;
+        if(H5Gclose(group_id) < 0) TEST_ERROR
+        if(H5Fclose(file_id) < 0) TEST_ERROR
+        if((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0) TEST_ERROR
+        if((group_id = H5Gopen2(file_id, "group", H5P_DEFAULT)) < 0) TEST_ERROR
+        if(H5Fclose(file_id) < 0) TEST_ERROR
+        file_id = -1;
+    } /* end for */
+
+    if(H5Gclose(group_id) < 0) TEST_ERROR
+    if(H5Pclose(gcpl_id) < 0) TEST_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Aclose(attr_id);
+        H5Sclose(space_id);
+        H5Gclose(group_id);
+        H5Pclose(gcpl_id);
+        H5Fclose(file_id);
+    } H5E_END_TRY;
+    return 1;
+} /* end test_compact_lookup() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_create_many
+ *
+ * Purpose:     Create a batch of links to anonymous objects with
+ *              H5Lcreate_many().
+ *
+ * Return:      Success:        0
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+#define CREATE_MANY_NLINKS      100
+static int
+test_create_many(hid_t fapl, hbool_t new_format)
+{
+    hid_t file_id = -1;
+    hid_t group_id = -1, group2_id = -1;
+    hid_t gcpl_id = -1;
+    hid_t obj_ids[CREATE_MANY_NLINKS];
+    char *names[CREATE_MANY_NLINKS];
+    const char *bad_names[2];
+    char filename[1024];
+    char name[NAME_BUF_SIZE];
+    H5O_info_t oinfo;
+    H5G_info_t ginfo;
+    herr_t ret;
+    unsigned u;
+
+    if(new_format)
+        TESTING("creating many links at once (w/new group format)")
+    else
+        TESTING("creating many links at once")
+
+    for(u = 0; u < CREATE_MANY_NLINKS; u++) {
+        obj_ids[u] = -1;
+        names[u] = NULL;
+    } /* end for */
+
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+    if((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) TEST_ERROR
+    if((group_id = H5Gcreate2(file_id, "group", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Lcreate_soft("/", group_id, "existing", H5P_DEFAULT, H5P_DEFAULT) < 0) TEST_ERROR
+
+    /* Create anonymous groups & sorted names for them */
+    for(u = 0; u < CREATE_MANY_NLINKS; u++) {
+        if((obj_ids[u] = H5Gcreate_anon(file_id, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+        HDsprintf(name, "member %03u", u);
+        if(NULL == (names[u] = HDstrdup(name))) TEST_ERROR
+    } /* end for */
+
+    /* Unsorted names, bad names & existing names are rejected */
+    bad_names[0] = names[1];
+    bad_names[1] = names[0];
+    H5E_BEGIN_TRY {
+        ret = H5Lcreate_many(group_id, (size_t)2, bad_names, obj_ids, H5P_DEFAULT, H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    bad_names[0] = "a/b";
+    H5E_BEGIN_TRY {
+        ret = H5Lcreate_many(group_id, (size_t)1, bad_names, obj_ids, H5P_DEFAULT, H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    bad_names[0] = "existing";
+    bad_names[1] = "zzz";
+    H5E_BEGIN_TRY {
+        ret = H5Lcreate_many(group_id, (size_t)2, bad_names, obj_ids, H5P_DEFAULT, H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    if(H5Lexists(group_id, "zzz", H5P_DEFAULT) != FALSE) TEST_ERROR
+
+    /* Create the links */
+    if(H5Lcreate_many(group_id, (size_t)CREATE_MANY_NLINKS, (const char **)names, obj_ids, H5P_DEFAULT, H5P_DEFAULT) < 0) TEST_ERROR
+    if(H5Gget_info(group_id, &ginfo) < 0) TEST_ERROR
+    if(ginfo.nlinks != CREATE_MANY_NLINKS + 1) TEST_ERROR
+    if(new_format && ginfo.storage_type != H5G_STORAGE_TYPE_DENSE) TEST_ERROR
+
+    /* Link the objects into an empty group with indexed creation order too,
+     *  which builds its dense storage from all the links at once
+     */
+    if((gcpl_id = H5Pcreate(H5P_GROUP_CREATE)) < 0) TEST_ERROR
+    if(H5Pset_link_creation_order(gcpl_id, H5P_CRT_ORDER_TRACKED | H5P_CRT_ORDER_INDEXED) < 0) TEST_ERROR
+    if((group2_id = H5Gcreate2(file_id, "indexed", H5P_DEFAULT, gcpl_id, H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Pclose(gcpl_id) < 0) TEST_ERROR
+    gcpl_id = -1;
+    if(H5Lcreate_many(group2_id, (size_t)CREATE_MANY_NLINKS, (const char **)names, obj_ids, H5P_DEFAULT, H5P_DEFAULT) < 0) TEST_ERROR
+    if(H5Gget_info(group2_id, &ginfo) < 0) TEST_ERROR
+    if(ginfo.nlinks != CREATE_MANY_NLINKS) TEST_ERROR
+    if(ginfo.storage_type != H5G_STORAGE_TYPE_DENSE) TEST_ERROR
+    for(u = 0; u < CREATE_MANY_NLINKS; u++) {
+        if(H5Lget_name_by_idx(group2_id, ".", H5_INDEX_CRT_ORDER, H5_ITER_INC, (hsize_t)u, name, (size_t)NAME_BUF_SIZE, H5P_DEFAULT) < 0) TEST_ERROR
+        if(HDstrcmp(name, names[u])) TEST_ERROR
+        if(H5Lexists(group2_id, names[u], H5P_DEFAULT) != TRUE) TEST_ERROR
+    } /* end for */
+    if(H5Gclose(group2_id) < 0) TEST_ERROR
+    group2_id = -1;
+
+    /* Check the links & the objects' names */
+    for(u = 0; u < CREATE_MANY_NLINKS; u++) {
+        if(H5Oget_info(obj_ids[u], &oinfo) < 0) TEST_ERROR
+        if(oinfo.rc != 2) TEST_ERROR
+        if(H5Iget_name(obj_ids[u], name, (size_t)NAME_BUF_SIZE) < 0) TEST_ERROR
+        if(HDstrncmp(name, "/group/", (size_t)7) || HDstrcmp(name + 7, names[u])) TEST_ERROR
+        if(H5Gclose(obj_ids[u]) < 0) TEST_ERROR
+        obj_ids[u] = -1;
+    } /* end for */
+
+    /* Re-open the file & check the links again */
+    if(H5Gclose(group_id) < 0) TEST_ERROR
+    if(H5Fclose(file_id) < 0) TEST_ERROR
+    if((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0) TEST_ERROR
+    for(u = 0; u < CREATE_MANY_NLINKS; u++) {
+        HDsprintf(name, "/group/%s", names[u]);
+        if(H5Oget_info_by_name(file_id, name, &oinfo, H5P_DEFAULT) < 0) TEST_ERROR
+        if(oinfo.type != H5O_TYPE_GROUP) TEST_ERROR
+    } /* end for */
+    if(H5Fclose(file_id) < 0) TEST_ERROR
+
+    for(u = 0; u < CREATE_MANY_NLINKS; u++)
+        HDfree(names[u]);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        for(u = 0; u < CREATE_MANY_NLINKS; u++) {
+            H5Gclose(obj_ids[u]);
+            HDfree(names[u]);
+        } /* end for */
+        H5Pclose(gcpl_id);
+        H5Gclose(group2_id);
+        H5Gclose(group_id);
+        H5Fclose(file_id);
+    } H5E_END_TRY;
+    return 1;
+} /* end test_create_many() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    test_deprec
@@ -14925,6 +15276,9 @@ main(void)
         nerrors += test_move(my_fapl, new_format);
         nerrors += test_copy(my_fapl, new_format);
         nerrors += test_move_preserves(my_fapl, new_format);
+        nerrors += test_path_cache(my_fapl, new_format);
+        nerrors += test_compact_lookup(my_fapl, new_format);
+        nerrors += test_create_many(my_fapl, new_format);
 #ifndef H5_NO_DEPRECATED_SYMBOLS
         nerrors += test_deprec(my_fapl, new_format);
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
@@ -963,6 +963,41 @@ main(void)
         } /* end for */
         PASSED();
 
+        /*
+         * Look up messages by type after removing one from the middle
+         * and adding a message of a new type.
+         */
+        TESTING("message lookup by type");
+        if(H5O_msg_count(&oh_loc, H5O_MTIME_ID, H5AC_ind_read_dxpl_id) != 40)
+            TEST_ERROR
+        if(H5O_msg_count(&oh_loc, H5O_MTIME_NEW_ID, H5AC_ind_read_dxpl_id) != 11)
+            TEST_ERROR
+        if(H5O_msg_remove(&oh_loc, H5O_MTIME_ID, 5, TRUE, H5AC_ind_read_dxpl_id) < 0)
+            FAIL_STACK_ERROR
+        if(H5O_msg_count(&oh_loc, H5O_MTIME_ID, H5AC_ind_read_dxpl_id) != 39)
+            TEST_ERROR
+        if(H5O_msg_exists(&oh_loc, H5O_NAME_ID, H5AC_ind_read_dxpl_id) != FALSE)
+            TEST_ERROR
+        {
+            H5O_name_t name_msg;        /* Name message */
+
+            name_msg.s = msg;
+            HDstrcpy(msg, "message lookup");
+            if(H5O_msg_create(&oh_loc, H5O_NAME_ID, 0, 0, &name_msg, H5AC_ind_read_dxpl_id) < 0)
+                FAIL_STACK_ERROR
+        }
+        if(H5O_msg_exists(&oh_loc, H5O_NAME_ID, H5AC_ind_read_dxpl_id) != TRUE)
+            TEST_ERROR
+        if(NULL == H5O_msg_read(&oh_loc, H5O_MTIME_ID, &ro, H5AC_ind_read_dxpl_id))
+            FAIL_STACK_ERROR
+        if(ro != 1000 + 1000000)
+            TEST_ERROR
+        if(H5O_msg_remove(&oh_loc, H5O_NAME_ID, H5O_ALL, TRUE, H5AC_ind_read_dxpl_id) < 0)
+            FAIL_STACK_ERROR
+        if(H5O_msg_count(&oh_loc, H5O_MTIME_NEW_ID, H5AC_ind_read_dxpl_id) != 11)
+            TEST_ERROR
+        PASSED();
+
         /*
          * Delete all time messages.
          */
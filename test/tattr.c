@@ -128,6 +128,7 @@ float attr_data5=-5.123F;        /* Test data for 5th attribute */
 
 #define NATTR_MANY_OLD  350
 #define NATTR_MANY_NEW  35000
+#define NATTR_READ_MULTI 40
 
 #define BUG2_NATTR  100
 #define BUG2_NATTR2 16
@@ -4257,6 +4258,139 @@ test_attr_many(hbool_t new_format, hid_t fcpl, hid_t fapl)
 }   /* test_attr_many() */
 
 
+/****************************************************************
+**
+**  test_attr_read_multi(): Test basic H5A (attribute) code.
+**      Tests reading many attributes with one call
+**
+****************************************************************/
+static void
+test_attr_read_multi(hbool_t new_format, hid_t fcpl, hid_t fapl)
+{
+    hid_t    fid;        /* HDF5 File ID            */
+    hid_t    gid;            /* Group ID            */
+    hid_t    sid;            /* Dataspace ID            */
+    hid_t    aid;            /* Attribute ID            */
+    char    attrname[NATTR_READ_MULTI][NAME_BUF_SIZE];  /* Names of attributes */
+    const char *names[NATTR_READ_MULTI];    /* Names to read */
+    hid_t    types[NATTR_READ_MULTI];       /* Memory datatypes */
+    void    *bufs[NATTR_READ_MULTI];        /* Read buffers */
+    unsigned    uvalues[NATTR_READ_MULTI];  /* Attribute values read */
+    double      dvalue;         /* Attribute value read with conversion */
+    unsigned    u;              /* Local index variable */
+    herr_t    ret;        /* Generic return value        */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing Reading Many Attributes At Once\n"));
+
+    /* Create file */
+    fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, fcpl, fapl);
+    CHECK(fid, FAIL, "H5Fcreate");
+
+    /* Create dataspace for attribute */
+    sid = H5Screate(H5S_SCALAR);
+    CHECK(sid, FAIL, "H5Screate");
+
+    /* Create group for attributes */
+    gid = H5Gcreate2(fid, GROUP1_NAME, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(gid, FAIL, "H5Gcreate2");
+
+    /* Create attributes (enough to use dense storage with the new format) */
+    for(u = 0; u < NATTR_READ_MULTI; u++) {
+        unsigned value = u * 3;
+
+        sprintf(attrname[u], "r-%03u", u);
+        aid = H5Acreate2(gid, attrname[u], H5T_NATIVE_UINT, sid, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(aid, FAIL, "H5Acreate2");
+
+        ret = H5Awrite(aid, H5T_NATIVE_UINT, &value);
+        CHECK(ret, FAIL, "H5Awrite");
+
+        ret = H5Aclose(aid);
+        CHECK(ret, FAIL, "H5Aclose");
+    } /* end for */
+
+    /* Read a few attributes, out of name order, with a conversion */
+    names[0] = attrname[NATTR_READ_MULTI - 1];
+    names[1] = attrname[0];
+    names[2] = attrname[NATTR_READ_MULTI / 2];
+    types[0] = H5T_NATIVE_UINT;
+    types[1] = H5T_NATIVE_DOUBLE;
+    types[2] = H5T_NATIVE_UINT;
+    bufs[0] = &uvalues[0];
+    bufs[1] = &dvalue;
+    bufs[2] = &uvalues[1];
+    dvalue = -1.0;
+    ret = H5Aread_multi(gid, (size_t)3, names, types, bufs);
+    CHECK(ret, FAIL, "H5Aread_multi");
+    VERIFY(uvalues[0], (NATTR_READ_MULTI - 1) * 3, "H5Aread_multi");
+    VERIFY(dvalue, 0.0, "H5Aread_multi");
+    VERIFY(uvalues[1], (NATTR_READ_MULTI / 2) * 3, "H5Aread_multi");
+
+    /* Read a missing attribute along with existing ones */
+    names[1] = "missing";
+    H5E_BEGIN_TRY {
+        ret = H5Aread_multi(gid, (size_t)3, names, types, bufs);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Aread_multi");
+
+    /* Reading all attributes requires one buffer per attribute */
+    for(u = 0; u < NATTR_READ_MULTI; u++) {
+        types[u] = H5T_NATIVE_UINT;
+        bufs[u] = &uvalues[u];
+    } /* end for */
+    H5E_BEGIN_TRY {
+        ret = H5Aread_multi(gid, (size_t)(NATTR_READ_MULTI - 1), NULL, types, bufs);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Aread_multi");
+
+    /* Close group */
+    ret = H5Gclose(gid);
+    CHECK(ret, FAIL, "H5Gclose");
+
+    /* Close file */
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+
+    /* Re-open the file and read all the attributes */
+
+    /* Re-open file */
+    fid = H5Fopen(FILENAME, H5F_ACC_RDONLY, fapl);
+    CHECK(fid, FAIL, "H5Fopen");
+
+    /* The root group has no attributes to read */
+    H5E_BEGIN_TRY {
+        ret = H5Aread_multi(fid, (size_t)NATTR_READ_MULTI, NULL, types, bufs);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Aread_multi");
+
+    /* Re-open group */
+    gid = H5Gopen2(fid, GROUP1_NAME, H5P_DEFAULT);
+    CHECK(gid, FAIL, "H5Gopen2");
+
+    /* Read all attributes, in name order */
+    HDmemset(uvalues, 0, sizeof(uvalues));
+    ret = H5Aread_multi(gid, (size_t)NATTR_READ_MULTI, NULL, types, bufs);
+    CHECK(ret, FAIL, "H5Aread_multi");
+    for(u = 0; u < NATTR_READ_MULTI; u++)
+        VERIFY(uvalues[u], u * 3, "H5Aread_multi");
+
+    /* Close group */
+    ret = H5Gclose(gid);
+    CHECK(ret, FAIL, "H5Gclose");
+
+    /* Close file */
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+
+    /* Close dataspaces */
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+}   /* test_attr_read_multi() */
+
+
 /****************************************************************
 **
 **  test_attr_corder_create_empty(): Test basic H5A (attribute) code.
@@ -10799,6 +10933,7 @@ test_attr(void)
                 test_attr_iterate2(new_format, my_fcpl, my_fapl);       /* Test iterating over attributes by index */
                 test_attr_open_by_idx(new_format, my_fcpl, my_fapl);    /* Test opening attributes by index */
                 test_attr_open_by_name(new_format, my_fcpl, my_fapl);   /* Test opening attributes by name */
+                test_attr_read_multi(new_format, my_fcpl, my_fapl);     /* Test reading many attributes at once */
                 test_attr_create_by_name(new_format, my_fcpl, my_fapl); /* Test creating attributes by name */
 
                 /* More complex tests with both "new format" and "shared" attributes */
@@ -10834,6 +10969,7 @@ test_attr(void)
             test_attr_iterate2(new_format, fcpl, my_fapl);      /* Test iterating over attributes by index */
             test_attr_open_by_idx(new_format, fcpl, my_fapl);   /* Test opening attributes by index */
             test_attr_open_by_name(new_format, fcpl, my_fapl);  /* Test opening attributes by name */
+            test_attr_read_multi(new_format, fcpl, my_fapl);    /* Test reading many attributes at once */
             test_attr_create_by_name(new_format, fcpl, my_fapl); /* Test creating attributes by name */
 
             /* Tests that address specific bugs */
@@ -6924,6 +6924,126 @@ test_libver_macros2(void)
 
 } /* test_libver_macros2() */
 
+/****************************************************************
+**
+**  test_file_io_stats():
+**    Verify that the I/O statistics collected for the file
+**      driver account for the reads & writes performed.
+**
+****************************************************************/
+static void
+test_file_io_stats(void)
+{
+    hid_t    file;                  /* File ID */
+    hid_t    sid;                   /* Dataspace ID */
+    hid_t    did;                   /* Dataset ID */
+    hsize_t  dims[1] = {1000};      /* Dataset dimensions */
+    int      buf[1000];             /* Data buffer */
+    H5F_io_stats_t stats;           /* I/O statistics */
+    hsize_t  nops;                  /* Number of operations summed */
+    unsigned u;                     /* Local index variable */
+    herr_t   ret;                   /* Return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing I/O statistics for files\n"));
+
+    for(u = 0; u < 1000; u++)
+        buf[u] = (int)u;
+
+    /* Create a file with a dataset */
+    file = H5Fcreate(FILE1, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(file, FAIL, "H5Fcreate");
+
+    sid = H5Screate_simple(1, dims, NULL);
+    CHECK(sid, FAIL, "H5Screate_simple");
+
+    did = H5Dcreate2(file, DSET1, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(did, FAIL, "H5Dcreate2");
+
+    /* Statistics start out empty for raw data */
+    ret = H5Fget_io_stats(file, &stats);
+    CHECK(ret, FAIL, "H5Fget_io_stats");
+    VERIFY(stats.write[H5FD_MEM_DRAW].count, 0, "H5Fget_io_stats");
+    VERIFY(stats.read[H5FD_MEM_DRAW].count, 0, "H5Fget_io_stats");
+
+    ret = H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf);
+    CHECK(ret, FAIL, "H5Dwrite");
+
+    ret = H5Fflush(file, H5F_SCOPE_GLOBAL);
+    CHECK(ret, FAIL, "H5Fflush");
+
+    /* Check the writes were accounted for */
+    ret = H5Fget_io_stats(file, &stats);
+    CHECK(ret, FAIL, "H5Fget_io_stats");
+    if(stats.write[H5FD_MEM_DRAW].count < 1)
+        TestErrPrintf("no raw data writes recorded\n");
+    if(stats.write[H5FD_MEM_DRAW].bytes < sizeof(buf))
+        TestErrPrintf("too few raw data bytes written: %llu\n", (unsigned long long)stats.write[H5FD_MEM_DRAW].bytes);
+    if(stats.meta_write.count < 1)
+        TestErrPrintf("no metadata writes recorded\n");
+    if(stats.meta_write.max_usec > stats.meta_write.total_usec)
+        TestErrPrintf("maximum latency larger than total latency\n");
+    for(u = 0, nops = 0; u < H5F_IO_STATS_NBUCKETS; u++)
+        nops += stats.meta_write.latency[u];
+    VERIFY(nops, stats.meta_write.count, "H5Fget_io_stats");
+    nops = stats.write[H5FD_MEM_DEFAULT].count + stats.write[H5FD_MEM_SUPER].count
+            + stats.write[H5FD_MEM_BTREE].count + stats.write[H5FD_MEM_GHEAP].count
+            + stats.write[H5FD_MEM_LHEAP].count + stats.write[H5FD_MEM_OHDR].count;
+    VERIFY(stats.meta_write.count, nops, "H5Fget_io_stats");
+
+    /* Reset the statistics */
+    ret = H5Freset_io_stats(file);
+    CHECK(ret, FAIL, "H5Freset_io_stats");
+    ret = H5Fget_io_stats(file, &stats);
+    CHECK(ret, FAIL, "H5Fget_io_stats");
+    VERIFY(stats.write[H5FD_MEM_DRAW].count, 0, "H5Fget_io_stats");
+    VERIFY(stats.meta_write.count, 0, "H5Fget_io_stats");
+
+    ret = H5Dclose(did);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Fclose(file);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Re-open the file and read the data back */
+    file = H5Fopen(FILE1, H5F_ACC_RDONLY, H5P_DEFAULT);
+    CHECK(file, FAIL, "H5Fopen");
+
+    did = H5Dopen2(file, DSET1, H5P_DEFAULT);
+    CHECK(did, FAIL, "H5Dopen2");
+
+    ret = H5Fget_io_stats(file, &stats);
+    CHECK(ret, FAIL, "H5Fget_io_stats");
+    if(stats.meta_read.count < 1)
+        TestErrPrintf("no metadata reads recorded\n");
+    VERIFY(stats.read[H5FD_MEM_DRAW].count, 0, "H5Fget_io_stats");
+
+    ret = H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf);
+    CHECK(ret, FAIL, "H5Dread");
+
+    ret = H5Fget_io_stats(file, &stats);
+    CHECK(ret, FAIL, "H5Fget_io_stats");
+    if(stats.read[H5FD_MEM_DRAW].bytes < sizeof(buf))
+        TestErrPrintf("too few raw data bytes read: %llu\n", (unsigned long long)stats.read[H5FD_MEM_DRAW].bytes);
+    VERIFY(stats.write[H5FD_MEM_DRAW].count, 0, "H5Fget_io_stats");
+
+    /* Invalid arguments */
+    H5E_BEGIN_TRY {
+        ret = H5Fget_io_stats(file, NULL);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Fget_io_stats");
+    H5E_BEGIN_TRY {
+        ret = H5Fget_io_stats(did, &stats);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Fget_io_stats");
+
+    ret = H5Dclose(did);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Fclose(file);
+    CHECK(ret, FAIL, "H5Fclose");
+} /* test_file_io_stats() */
+
 /****************************************************************
 **
 **  test_deprec():
@@ -7210,6 +7330,7 @@ test_file(void)
     test_libver_bounds_low_high();
     test_libver_macros();                       /* Test the macros for library version comparison */
     test_libver_macros2();                      /* Test the macros for library version comparison */
+    test_file_io_stats();                       /* Test H5Fget_io_stats & H5Freset_io_stats */
 #ifndef H5_NO_DEPRECATED_SYMBOLS
     test_deprec();                              /* Test deprecated routines */
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
@@ -1598,6 +1598,121 @@ test_genprop_list_add_remove_prop(void)
 
 } /* end test_genprop_list_add_remove_prop() */
 
+/****************************************************************
+**
+**  test_genprop_resolve(): Test that properties looked up repeatedly
+**      in a property list stay correct while the list, its class and
+**      the caller's name buffer change underneath them.
+**
+****************************************************************/
+static void
+test_genprop_resolve(void)
+{
+    hid_t cid1, cid2;   /* Generic Property class IDs */
+    hid_t lid1, lid2;   /* Generic Property list IDs */
+    char name[32];      /* Buffer for property names */
+    int prop1_override = 20;    /* Property 1 default value in class 2 */
+    int prop1_value;    /* Value of property 1 */
+    float prop2_value;  /* Value of property 2 */
+    htri_t exists;      /* Whether a property exists */
+    herr_t ret;         /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing Repeated Property Lookups\n"));
+
+    /* Create a class with two properties, and a derived class overriding one */
+    cid1 = H5Pcreate_class(H5P_ROOT, CLASS1_NAME, NULL, NULL, NULL, NULL, NULL, NULL);
+    CHECK_I(cid1, "H5Pcreate_class");
+    ret = H5Pregister2(cid1, PROP1_NAME, PROP1_SIZE, PROP1_DEF_VALUE, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+    CHECK_I(ret, "H5Pregister2");
+    ret = H5Pregister2(cid1, PROP2_NAME, PROP2_SIZE, PROP2_DEF_VALUE, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+    CHECK_I(ret, "H5Pregister2");
+    cid2 = H5Pcreate_class(cid1, CLASS2_NAME, NULL, NULL, NULL, NULL, NULL, NULL);
+    CHECK_I(cid2, "H5Pcreate_class");
+    ret = H5Pregister2(cid2, PROP1_NAME, PROP1_SIZE, &prop1_override, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+    CHECK_I(ret, "H5Pregister2");
+
+    lid1 = H5Pcreate(cid2);
+    CHECK_I(lid1, "H5Pcreate");
+
+    /* The derived class's default hides its parent's */
+    ret = H5Pget(lid1, PROP1_NAME, &prop1_value);
+    CHECK_I(ret, "H5Pget");
+    VERIFY(prop1_value, prop1_override, "H5Pget");
+
+    /* Reuse one name buffer for different properties */
+    HDstrcpy(name, PROP1_NAME);
+    ret = H5Pget(lid1, name, &prop1_value);
+    CHECK_I(ret, "H5Pget");
+    VERIFY(prop1_value, prop1_override, "H5Pget");
+    HDstrcpy(name, PROP2_NAME);
+    ret = H5Pget(lid1, name, &prop2_value);
+    CHECK_I(ret, "H5Pget");
+    if(!H5_FLT_ABS_EQUAL(prop2_value, *PROP2_DEF_VALUE))
+        TestErrPrintf("Property #2 doesn't match!, line=%d\n", __LINE__);
+
+    /* Changing a class default's value moves it into the list */
+    prop1_value = 30;
+    ret = H5Pset(lid1, PROP1_NAME, &prop1_value);
+    CHECK_I(ret, "H5Pset");
+    prop1_value = 0;
+    ret = H5Pget(lid1, PROP1_NAME, &prop1_value);
+    CHECK_I(ret, "H5Pget");
+    VERIFY(prop1_value, 30, "H5Pget");
+
+    /* A copy sees the changed value, the original keeps it after the copy changes */
+    lid2 = H5Pcopy(lid1);
+    CHECK_I(lid2, "H5Pcopy");
+    ret = H5Pget(lid2, PROP1_NAME, &prop1_value);
+    CHECK_I(ret, "H5Pget");
+    VERIFY(prop1_value, 30, "H5Pget");
+    prop1_value = 40;
+    ret = H5Pset(lid2, PROP1_NAME, &prop1_value);
+    CHECK_I(ret, "H5Pset");
+    ret = H5Pget(lid1, PROP1_NAME, &prop1_value);
+    CHECK_I(ret, "H5Pget");
+    VERIFY(prop1_value, 30, "H5Pget");
+
+    /* Removed properties can't be found, until they are inserted again */
+    ret = H5Premove(lid1, PROP1_NAME);
+    CHECK_I(ret, "H5Premove");
+    exists = H5Pexist(lid1, PROP1_NAME);
+    VERIFY(exists, FALSE, "H5Pexist");
+    H5E_BEGIN_TRY {
+        ret = H5Pget(lid1, PROP1_NAME, &prop1_value);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Pget");
+    prop1_value = 50;
+    ret = H5Pinsert2(lid1, PROP1_NAME, PROP1_SIZE, &prop1_value, NULL, NULL, NULL, NULL, NULL, NULL);
+    CHECK_I(ret, "H5Pinsert2");
+    prop1_value = 0;
+    ret = H5Pget(lid1, PROP1_NAME, &prop1_value);
+    CHECK_I(ret, "H5Pget");
+    VERIFY(prop1_value, 50, "H5Pget");
+
+    /* Removing a property from the parent class drops it from the lists */
+    ret = H5Pget(lid1, PROP2_NAME, &prop2_value);
+    CHECK_I(ret, "H5Pget");
+    ret = H5Punregister(cid1, PROP2_NAME);
+    CHECK_I(ret, "H5Punregister");
+    exists = H5Pexist(lid1, PROP2_NAME);
+    VERIFY(exists, FALSE, "H5Pexist");
+    H5E_BEGIN_TRY {
+        ret = H5Pget(lid2, PROP2_NAME, &prop2_value);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Pget");
+
+    /* Close everything */
+    ret = H5Pclose(lid2);
+    CHECK_I(ret, "H5Pclose");
+    ret = H5Pclose(lid1);
+    CHECK_I(ret, "H5Pclose");
+    ret = H5Pclose_class(cid2);
+    CHECK_I(ret, "H5Pclose_class");
+    ret = H5Pclose_class(cid1);
+    CHECK_I(ret, "H5Pclose_class");
+} /* end test_genprop_resolve() */
+
 /****************************************************************
 **
 **  test_genprop_equal(): Test basic generic property list code.
@@ -2118,6 +2233,7 @@ test_genprop(void)
     test_genprop_class_addprop();   /* Test adding properties to HDF5 property class */
 
     test_genprop_list_add_remove_prop();  /* Test adding and removing the same property several times to HDF5 property list */
+    test_genprop_resolve();     /* Test repeated property lookups */
 
     test_genprop_equal();       /* Tests for more H5Pequal verification */
     test_genprop_path();        /* Tests for class path verification */
@@ -30,6 +30,9 @@
 #define TEST6_DIM1 100
 #define TEST6_DIM2 100
 
+#define TEST_VISIT_NGROUPS 150
+#define TEST_VISIT_PAGE_SIZE 4096
+
 
 /****************************************************************
 **
@@ -1349,6 +1352,308 @@ test_h5o_getinfo_same_file(void)
 } /* test_h5o_getinfo_same_file() */
 
 
+/****************************************************************
+**
+**  test_h5o_getinfo_fields_visit(): H5Ovisit2 callback counting the
+**      objects visited and checking that only the basic info is set
+**
+****************************************************************/
+static herr_t
+test_h5o_getinfo_fields_visit(hid_t H5_ATTR_UNUSED obj, const char H5_ATTR_UNUSED *name,
+    const H5O_info_t *oinfo, void *_nvisited)
+{
+    unsigned *nvisited = (unsigned *)_nvisited;
+
+    if(oinfo->rc != 1 || oinfo->num_attrs != 0 || oinfo->hdr.space.total != 0)
+        return(-1);
+    (*nvisited)++;
+
+    return(0);
+} /* test_h5o_getinfo_fields_visit() */
+
+
+/****************************************************************
+**
+**  test_h5o_getinfo_fields():  Test that H5Oget_info2 & H5Ovisit2 only
+**      retrieve the fields requested
+**
+****************************************************************/
+static void
+test_h5o_getinfo_fields(void)
+{
+    hid_t       fid;                    /* HDF5 File ID */
+    hid_t       gid, sid, aid;          /* Group, dataspace & attribute IDs */
+    H5O_info_t	oinfo;                  /* Object info struct */
+    unsigned    nvisited = 0;           /* # of objects visited */
+    herr_t      ret;                    /* Value returned from API calls */
+
+    /* Create a new HDF5 file, with a group holding an attribute */
+    fid = H5Fcreate(TEST_FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(fid, FAIL, "H5Fcreate");
+    gid = H5Gcreate2(fid, "group1", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(gid, FAIL, "H5Gcreate2");
+    sid = H5Screate(H5S_SCALAR);
+    CHECK(sid, FAIL, "H5Screate");
+    aid = H5Acreate2(gid, "attr", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(aid, FAIL, "H5Acreate2");
+    ret = H5Aclose(aid);
+    CHECK(ret, FAIL, "H5Aclose");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+
+    /* Only the basic info */
+    ret = H5Oget_info2(gid, &oinfo, H5O_INFO_BASIC);
+    CHECK(ret, FAIL, "H5Oget_info2");
+    VERIFY(oinfo.type, H5O_TYPE_GROUP, "H5Oget_info2");
+    VERIFY(oinfo.rc, 1, "H5Oget_info2");
+    VERIFY(oinfo.num_attrs, 0, "H5Oget_info2");
+    VERIFY(oinfo.hdr.space.total, 0, "H5Oget_info2");
+    VERIFY(oinfo.meta_size.obj.index_size, 0, "H5Oget_info2");
+
+    /* Only the attribute count */
+    ret = H5Oget_info_by_name2(fid, "group1", &oinfo, H5O_INFO_NUM_ATTRS, H5P_DEFAULT);
+    CHECK(ret, FAIL, "H5Oget_info_by_name2");
+    VERIFY(oinfo.num_attrs, 1, "H5Oget_info_by_name2");
+    VERIFY(oinfo.rc, 0, "H5Oget_info_by_name2");
+    VERIFY(oinfo.addr, 0, "H5Oget_info_by_name2");
+
+    /* Everything, matching H5Oget_info */
+    ret = H5Oget_info_by_idx2(fid, ".", H5_INDEX_NAME, H5_ITER_INC, (hsize_t)0, &oinfo, H5O_INFO_ALL, H5P_DEFAULT);
+    CHECK(ret, FAIL, "H5Oget_info_by_idx2");
+    VERIFY(oinfo.type, H5O_TYPE_GROUP, "H5Oget_info_by_idx2");
+    VERIFY(oinfo.num_attrs, 1, "H5Oget_info_by_idx2");
+    if(oinfo.hdr.space.total == 0)
+        TestErrPrintf("%d: object header size not set\n", __LINE__);
+
+    /* Invalid field mask */
+    H5E_BEGIN_TRY {
+        ret = H5Oget_info2(gid, &oinfo, ~H5O_INFO_ALL);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Oget_info2");
+
+    /* Visit the file with the basic info only */
+    ret = H5Ovisit2(fid, H5_INDEX_NAME, H5_ITER_INC, test_h5o_getinfo_fields_visit, &nvisited, H5O_INFO_BASIC);
+    CHECK(ret, FAIL, "H5Ovisit2");
+    VERIFY(nvisited, 2, "H5Ovisit2");
+
+    /* Close everything */
+    ret = H5Gclose(gid);
+    CHECK(ret, FAIL, "H5Gclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+} /* test_h5o_getinfo_fields() */
+
+
+/* User data for test_h5o_visit_many() */
+typedef struct {
+    unsigned nobjs;                     /* # of objects visited */
+    unsigned nlinks;                    /* # of links visited */
+    char last[32];                      /* Last top-level link name visited */
+    hbool_t out_of_order;               /* Whether the top-level links were out of order */
+} test_h5o_visit_many_t;
+
+/****************************************************************
+**
+**  test_h5o_visit_many_obj(), test_h5o_visit_many_link(): H5Ovisit &
+**      H5Lvisit callbacks for test_h5o_visit_many()
+**
+****************************************************************/
+static herr_t
+test_h5o_visit_many_obj(hid_t H5_ATTR_UNUSED obj, const char H5_ATTR_UNUSED *name,
+    const H5O_info_t *oinfo, void *_udata)
+{
+    test_h5o_visit_many_t *udata = (test_h5o_visit_many_t *)_udata;
+
+    if(oinfo->type != H5O_TYPE_GROUP)
+        return(-1);
+    udata->nobjs++;
+
+    return(0);
+} /* test_h5o_visit_many_obj() */
+
+static herr_t
+test_h5o_visit_many_link(hid_t H5_ATTR_UNUSED group, const char *name,
+    const H5L_info_t H5_ATTR_UNUSED *linfo, void *_udata)
+{
+    test_h5o_visit_many_t *udata = (test_h5o_visit_many_t *)_udata;
+
+    if(NULL == HDstrchr(name, '/')) {
+        if(HDstrcmp(name, udata->last) <= 0)
+            udata->out_of_order = TRUE;
+        HDstrncpy(udata->last, name, sizeof(udata->last) - 1);
+    } /* end if */
+    udata->nlinks++;
+
+    return(0);
+} /* test_h5o_visit_many_link() */
+
+/****************************************************************
+**
+**  test_h5o_visit_many_info(): H5Literate callback for
+**      test_h5o_visit_many() that loads each link's object header
+**      itself, in link order, without prefetching
+**
+****************************************************************/
+static herr_t
+test_h5o_visit_many_info(hid_t group, const char *name,
+    const H5L_info_t H5_ATTR_UNUSED *linfo, void *_udata)
+{
+    test_h5o_visit_many_t *udata = (test_h5o_visit_many_t *)_udata;
+    H5O_info_t oinfo;
+
+    if(H5Oget_info_by_name(group, name, &oinfo, H5P_DEFAULT) < 0)
+        return(-1);
+    if(oinfo.type != H5O_TYPE_GROUP)
+        return(-1);
+    udata->nobjs++;
+
+    return(0);
+} /* test_h5o_visit_many_info() */
+
+
+/****************************************************************
+**
+**  test_h5o_visit_many():  Test visiting a group with more links than
+**      H5Ovisit & H5Lvisit prefetch object headers for at a time
+**
+****************************************************************/
+static void
+test_h5o_visit_many(void)
+{
+    hid_t       fid;                    /* HDF5 File ID */
+    hid_t       fcpl, fapl;             /* Property list IDs */
+    hid_t       gid, gid2;              /* Group IDs */
+    test_h5o_visit_many_t udata;        /* Visit callback data */
+    H5F_io_stats_t stats;               /* File I/O statistics */
+    hsize_t     iterate_reads;          /* Object header reads without prefetching */
+    hsize_t     visit_reads;            /* Object header reads with prefetching */
+    char        name[32];               /* Link name */
+    unsigned    u;                      /* Local index variable */
+    herr_t      ret;                    /* Value returned from API calls */
+
+    /* Create a file with groups holding a group each, and some soft links */
+    fid = H5Fcreate(TEST_FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(fid, FAIL, "H5Fcreate");
+    for(u = 0; u < TEST_VISIT_NGROUPS; u++) {
+        HDsprintf(name, "group%03u", u);
+        gid = H5Gcreate2(fid, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(gid, FAIL, "H5Gcreate2");
+        gid2 = H5Gcreate2(gid, "child", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(gid2, FAIL, "H5Gcreate2");
+        ret = H5Gclose(gid2);
+        CHECK(ret, FAIL, "H5Gclose");
+        ret = H5Gclose(gid);
+        CHECK(ret, FAIL, "H5Gclose");
+
+        if(u % 10 == 0) {
+            HDsprintf(name, "soft%03u", u);
+            ret = H5Lcreate_soft("/group000", fid, name, H5P_DEFAULT, H5P_DEFAULT);
+            CHECK(ret, FAIL, "H5Lcreate_soft");
+        } /* end if */
+    } /* end for */
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Reopen, so that the object headers have to be read back */
+    fid = H5Fopen(TEST_FILENAME, H5F_ACC_RDONLY, H5P_DEFAULT);
+    CHECK(fid, FAIL, "H5Fopen");
+
+    /* Visit the objects: the root group, the groups & their children */
+    HDmemset(&udata, 0, sizeof(udata));
+    ret = H5Ovisit(fid, H5_INDEX_NAME, H5_ITER_INC, test_h5o_visit_many_obj, &udata);
+    CHECK(ret, FAIL, "H5Ovisit");
+    VERIFY(udata.nobjs, 1 + 2 * TEST_VISIT_NGROUPS, "H5Ovisit");
+
+    /* Visit the links, checking the order of the top-level ones */
+    HDmemset(&udata, 0, sizeof(udata));
+    ret = H5Lvisit(fid, H5_INDEX_NAME, H5_ITER_INC, test_h5o_visit_many_link, &udata);
+    CHECK(ret, FAIL, "H5Lvisit");
+    VERIFY(udata.nlinks, 2 * TEST_VISIT_NGROUPS + TEST_VISIT_NGROUPS / 10, "H5Lvisit");
+    VERIFY(udata.out_of_order, FALSE, "H5Lvisit");
+
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Create a paged file with groups whose link names are in a different
+     * order than their object headers, so that loading the headers in link
+     * order jumps between pages
+     */
+    fcpl = H5Pcreate(H5P_FILE_CREATE);
+    CHECK(fcpl, FAIL, "H5Pcreate");
+    ret = H5Pset_file_space_strategy(fcpl, H5F_FSPACE_STRATEGY_PAGE, FALSE, (hsize_t)1);
+    CHECK(ret, FAIL, "H5Pset_file_space_strategy");
+    ret = H5Pset_file_space_page_size(fcpl, (hsize_t)TEST_VISIT_PAGE_SIZE);
+    CHECK(ret, FAIL, "H5Pset_file_space_page_size");
+    fapl = H5Pcreate(H5P_FILE_ACCESS);
+    CHECK(fapl, FAIL, "H5Pcreate");
+    ret = H5Pset_libver_bounds(fapl, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST);
+    CHECK(ret, FAIL, "H5Pset_libver_bounds");
+    fid = H5Fcreate(TEST_FILENAME, H5F_ACC_TRUNC, fcpl, fapl);
+    CHECK(fid, FAIL, "H5Fcreate");
+    for(u = 0; u < TEST_VISIT_NGROUPS; u++) {
+        HDsprintf(name, "group%03u", (u * 7) % TEST_VISIT_NGROUPS);
+        gid = H5Gcreate2(fid, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(gid, FAIL, "H5Gcreate2");
+        ret = H5Gclose(gid);
+        CHECK(ret, FAIL, "H5Gclose");
+    } /* end for */
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+    ret = H5Pclose(fcpl);
+    CHECK(ret, FAIL, "H5Pclose");
+
+    /* Read the file through a page buffer holding a single page, so that
+     * every page the object header reads move to is read from the file
+     */
+    ret = H5Pset_page_buffer_size(fapl, (size_t)TEST_VISIT_PAGE_SIZE, 0, 0);
+    CHECK(ret, FAIL, "H5Pset_page_buffer_size");
+
+    /* Load the object headers in link order, without prefetching */
+    fid = H5Fopen(TEST_FILENAME, H5F_ACC_RDONLY, fapl);
+    CHECK(fid, FAIL, "H5Fopen");
+    ret = H5Freset_io_stats(fid);
+    CHECK(ret, FAIL, "H5Freset_io_stats");
+    HDmemset(&udata, 0, sizeof(udata));
+    ret = H5Literate(fid, H5_INDEX_NAME, H5_ITER_INC, NULL, test_h5o_visit_many_info, &udata);
+    CHECK(ret, FAIL, "H5Literate");
+    VERIFY(udata.nobjs, TEST_VISIT_NGROUPS, "H5Literate");
+    ret = H5Fget_io_stats(fid, &stats);
+    CHECK(ret, FAIL, "H5Fget_io_stats");
+    iterate_reads = stats.read[H5FD_MEM_OHDR].count;
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* H5Ovisit loads the same object headers in address order, which
+     * takes fewer page reads
+     */
+    fid = H5Fopen(TEST_FILENAME, H5F_ACC_RDONLY, fapl);
+    CHECK(fid, FAIL, "H5Fopen");
+    ret = H5Freset_io_stats(fid);
+    CHECK(ret, FAIL, "H5Freset_io_stats");
+    HDmemset(&udata, 0, sizeof(udata));
+    ret = H5Ovisit(fid, H5_INDEX_NAME, H5_ITER_INC, test_h5o_visit_many_obj, &udata);
+    CHECK(ret, FAIL, "H5Ovisit");
+    VERIFY(udata.nobjs, 1 + TEST_VISIT_NGROUPS, "H5Ovisit");
+    ret = H5Fget_io_stats(fid, &stats);
+    CHECK(ret, FAIL, "H5Fget_io_stats");
+    visit_reads = stats.read[H5FD_MEM_OHDR].count;
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+    ret = H5Pclose(fapl);
+    CHECK(ret, FAIL, "H5Pclose");
+
+    if(iterate_reads == 0)
+        TestErrPrintf("%d: no object header reads reported\n", __LINE__);
+    if(visit_reads >= iterate_reads)
+        TestErrPrintf("%d: prefetching didn't reduce object header reads: %llu, %llu without\n",
+                __LINE__, (unsigned long long)visit_reads, (unsigned long long)iterate_reads);
+
+} /* test_h5o_visit_many() */
+
+
+
+
 
 /****************************************************************
 **
@@ -1370,6 +1675,8 @@ test_h5o(void)
     test_h5o_comment();         /* Test routines for comment */
     test_h5o_comment_by_name(); /* Test routines for comment by name */
     test_h5o_getinfo_same_file(); /* Test info for objects in the same file */
+    test_h5o_getinfo_fields();  /* Test retrieving selected object info fields */
+    test_h5o_visit_many();      /* Test visiting groups with many links */
 } /* test_h5o() */
 
 
@@ -727,6 +727,139 @@ out:
     return -1;
 } /* end test_remove_clear_type() */
 
+    /* Test the ID table with many IDs in a type */
+
+/* Macro definitions */
+#define TEST_MANY_NIDS 100000
+
+/* Structure for H5Isearch callback checking the iteration order */
+typedef struct {
+    hid_t last_id;              /* Last ID visited */
+    long nvisited;              /* Number of IDs visited */
+    hbool_t in_order;           /* Whether the IDs were visited in increasing order */
+} test_many_search_t;
+
+/* H5Isearch callback */
+static int test_many_search_func(void *obj, hid_t id, void *_key)
+{
+    test_many_search_t *key = (test_many_search_t *)_key;
+
+    if(id <= key->last_id || *(hid_t *)obj != id)
+        key->in_order = FALSE;
+    key->last_id = id;
+    key->nvisited++;
+
+    return 0;
+} /* end test_many_search_func() */
+
+/* Test function */
+static int test_many_ids(void)
+{
+    H5I_type_t obj_type;
+    hid_t *ids = NULL;
+    test_many_search_t key;
+    hsize_t nmembers;
+    void *obj;
+    long i;
+    herr_t  ret;        /* return value */
+
+    /* Register type */
+    obj_type = H5Iregister_type((size_t)64, 0, NULL);
+    CHECK(obj_type, H5I_BADID, "H5Iregister_type");
+    if(obj_type == H5I_BADID)
+        goto out;
+
+    /* Register the IDs, using each ID's slot in the array as its object */
+    ids = (hid_t *)HDmalloc(sizeof(hid_t) * TEST_MANY_NIDS);
+    CHECK(ids, NULL, "HDmalloc");
+    if(ids == NULL)
+        goto out;
+    for(i = 0; i < TEST_MANY_NIDS; i++) {
+        ids[i] = H5Iregister(obj_type, &ids[i]);
+        CHECK(ids[i], FAIL, "H5Iregister");
+        if(ids[i] == FAIL)
+            goto out;
+    } /* end for */
+
+    /* Look all of them up */
+    for(i = 0; i < TEST_MANY_NIDS; i++) {
+        obj = H5Iobject_verify(ids[i], obj_type);
+        VERIFY(obj, &ids[i], "H5Iobject_verify");
+        if(obj != &ids[i])
+            goto out;
+    } /* end for */
+
+    /* Remove every other ID */
+    for(i = 0; i < TEST_MANY_NIDS; i += 2) {
+        obj = H5Iremove_verify(ids[i], obj_type);
+        VERIFY(obj, &ids[i], "H5Iremove_verify");
+        if(obj != &ids[i])
+            goto out;
+    } /* end for */
+
+    /* Make sure only the remaining IDs can be found */
+    for(i = 0; i < TEST_MANY_NIDS; i++) {
+        H5E_BEGIN_TRY
+            obj = H5Iobject_verify(ids[i], obj_type);
+        H5E_END_TRY
+        VERIFY(obj, (i % 2) ? &ids[i] : NULL, "H5Iobject_verify");
+        if(obj != ((i % 2) ? &ids[i] : NULL))
+            goto out;
+    } /* end for */
+    ret = H5Inmembers(obj_type, &nmembers);
+    CHECK(ret, FAIL, "H5Inmembers");
+    if(ret == FAIL)
+        goto out;
+    VERIFY(nmembers, (hsize_t)(TEST_MANY_NIDS / 2), "H5Inmembers");
+    if(nmembers != (hsize_t)(TEST_MANY_NIDS / 2))
+        goto out;
+
+    /* Iteration must visit the remaining IDs in increasing order */
+    key.last_id = 0;
+    key.nvisited = 0;
+    key.in_order = TRUE;
+    obj = H5Isearch(obj_type, test_many_search_func, &key);
+    VERIFY(obj, NULL, "H5Isearch");
+    VERIFY(key.nvisited, (long)(TEST_MANY_NIDS / 2), "H5Isearch");
+    VERIFY(key.in_order, TRUE, "H5Isearch");
+    if(key.nvisited != (long)(TEST_MANY_NIDS / 2) || !key.in_order)
+        goto out;
+
+    /* Remove the rest */
+    for(i = 1; i < TEST_MANY_NIDS; i += 2) {
+        obj = H5Iremove_verify(ids[i], obj_type);
+        VERIFY(obj, &ids[i], "H5Iremove_verify");
+        if(obj != &ids[i])
+            goto out;
+    } /* end for */
+    ret = H5Inmembers(obj_type, &nmembers);
+    CHECK(ret, FAIL, "H5Inmembers");
+    if(ret == FAIL)
+        goto out;
+    VERIFY(nmembers, (hsize_t)0, "H5Inmembers");
+    if(nmembers != (hsize_t)0)
+        goto out;
+
+    /* Destroy type */
+    ret = H5Idestroy_type(obj_type);
+    CHECK(ret, FAIL, "H5Idestroy_type");
+    if(ret == FAIL)
+        goto out;
+
+    HDfree(ids);
+
+    return 0;
+
+out:
+    /* Cleanup.  For simplicity, just destroy the types and ignore errors. */
+    H5E_BEGIN_TRY
+        H5Idestroy_type(obj_type);
+    H5E_END_TRY
+    if(ids)
+        HDfree(ids);
+    return -1;
+} /* end test_many_ids() */
+
 void test_ids(void)
 {
     /* Set the random # seed */
@@ -738,5 +871,6 @@ void test_ids(void)
     if (test_get_type() < 0) TestErrPrintf("H5Iget_type test failed\n");
     if (test_id_type_list() < 0) TestErrPrintf("ID type list test failed\n");
     if (test_remove_clear_type() < 0) TestErrPrintf("ID remove during H5Iclear_type test failed\n");
+    if (test_many_ids() < 0) TestErrPrintf("Many IDs test failed\n");
 
 }
@@ -323,6 +323,18 @@ typedef struct
 /* and bad offset values are written to that file for testing */
 #define MISC33_FILE             "bad_offset.h5"
 
+/* Definitions for misc. test #35 */
+#define MISC35_FILE             "tmisc35.h5"
+#define MISC35_NDSETS           20
+#define MISC36_NCALLS           50
+#define MISC37_FILE             "tmisc37.h5"
+#define MISC37_NCHUNKS          10
+#define MISC37_CHUNK            1000
+#define MISC38_FILE             "tmisc38.h5"
+#define MISC38_NGROUPS          200
+#define MISC38_MIN_MDC_SIZE     (4 * 1024)
+#define MISC38_PAGE_SIZE        4096
+
 /****************************************************************
 **
 **  test_misc1(): test unlinking a dataset from a group and immediately
@@ -5585,6 +5597,495 @@ test_misc34(void)
 } /* end test_misc34() */
 
 
+/****************************************************************
+**
+**  test_misc35(): Check the free list statistics
+**
+****************************************************************/
+static void
+test_misc35(void)
+{
+    H5_free_list_stats_t *stats;    /* Free list statistics */
+    hid_t       fid;                /* File ID */
+    hid_t       sid;                /* Dataspace ID */
+    hid_t       did;                /* Dataset ID */
+    hsize_t     dims[1] = {10};     /* Dataspace dimensions */
+    char        name[32];           /* Dataset name */
+    size_t      nlists;             /* Number of free lists */
+    size_t      nfilled;            /* Number of free lists filled in */
+    hsize_t     nhits;              /* Hits on all free lists */
+    size_t      u;                  /* Local index variable */
+    herr_t      ret;                /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing free list statistics\n"));
+
+    /* Allocate and free some objects, repeatedly */
+    fid = H5Fcreate(MISC35_FILE, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(fid, FAIL, "H5Fcreate");
+    sid = H5Screate_simple(1, dims, NULL);
+    CHECK(sid, FAIL, "H5Screate_simple");
+    for(u = 0; u < MISC35_NDSETS; u++) {
+        HDsprintf(name, "dset%u", (unsigned)u);
+        did = H5Dcreate2(fid, name, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(did, FAIL, "H5Dcreate2");
+        ret = H5Dclose(did);
+        CHECK(ret, FAIL, "H5Dclose");
+    } /* end for */
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Get the number of free lists */
+    nlists = 0;
+    ret = H5get_free_list_stats(NULL, &nlists);
+    CHECK(ret, FAIL, "H5get_free_list_stats");
+#ifndef H5_NO_REG_FREE_LISTS
+    if(nlists == 0)
+        TestErrPrintf("%d: no free lists reported\n", __LINE__);
+#endif /* H5_NO_REG_FREE_LISTS */
+
+    /* Get the statistics, with room for more lists than needed */
+    stats = (H5_free_list_stats_t *)HDcalloc(nlists + 10, sizeof(H5_free_list_stats_t));
+    CHECK_PTR(stats, "HDcalloc");
+    nfilled = nlists + 10;
+    ret = H5get_free_list_stats(stats, &nfilled);
+    CHECK(ret, FAIL, "H5get_free_list_stats");
+    VERIFY(nfilled, nlists, "H5get_free_list_stats");
+
+    nhits = 0;
+    for(u = 0; u < nfilled; u++) {
+        if(stats[u].nhits > stats[u].nrequests)
+            TestErrPrintf("%d: list %u has more hits than requests\n", __LINE__, (unsigned)u);
+        if((stats[u].name == NULL) != (stats[u].type == H5_FREE_LIST_FAC))
+            TestErrPrintf("%d: list %u has wrong name\n", __LINE__, (unsigned)u);
+        if(stats[u].size > 0)
+            VERIFY(stats[u].mem_held, stats[u].onlist * stats[u].size, "H5get_free_list_stats");
+        nhits += stats[u].nhits;
+    } /* end for */
+#ifndef H5_NO_REG_FREE_LISTS
+    if(nhits == 0)
+        TestErrPrintf("%d: no free list hits reported\n", __LINE__);
+#endif /* H5_NO_REG_FREE_LISTS */
+
+    /* Garbage collection releases the blocks held on the lists */
+    ret = H5garbage_collect();
+    CHECK(ret, FAIL, "H5garbage_collect");
+    nfilled = nlists + 10;
+    ret = H5get_free_list_stats(stats, &nfilled);
+    CHECK(ret, FAIL, "H5get_free_list_stats");
+    for(u = 0; u < MIN(nfilled, nlists + 10); u++)
+        VERIFY(stats[u].mem_held, 0, "H5get_free_list_stats");
+
+    /* A buffer is required if its size is given */
+    nfilled = 1;
+    H5E_BEGIN_TRY {
+        ret = H5get_free_list_stats(NULL, &nfilled);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5get_free_list_stats");
+    H5E_BEGIN_TRY {
+        ret = H5get_free_list_stats(stats, NULL);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5get_free_list_stats");
+
+    HDfree(stats);
+} /* end test_misc35() */
+
+
+/****************************************************************
+**
+**  test_misc36_find(): Find the statistics for an API routine
+**
+****************************************************************/
+static const H5_api_stats_t *
+test_misc36_find(const H5_api_stats_t *stats, size_t nfuncs, const char *name)
+{
+    size_t u;
+
+    for(u = 0; u < nfuncs; u++)
+        if(!HDstrcmp(stats[u].name, name))
+            return &stats[u];
+
+    return NULL;
+} /* end test_misc36_find() */
+
+
+/****************************************************************
+**
+**  test_misc36(): Check the API call statistics
+**
+****************************************************************/
+static void
+test_misc36(void)
+{
+    H5_api_stats_t *stats;          /* API call statistics */
+    const H5_api_stats_t *create;   /* Statistics for H5Screate_simple */
+    hid_t       sid;                /* Dataspace ID */
+    hsize_t     dims[1] = {10};     /* Dataspace dimensions */
+    hsize_t     ncalls;             /* Calls counted in the histogram */
+    size_t      nfuncs;             /* Number of API routines */
+    size_t      u;                  /* Local index variable */
+    herr_t      ret;                /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing API call statistics\n"));
+
+    /* Start collecting from scratch */
+    ret = H5set_api_stats(TRUE);
+    CHECK(ret, FAIL, "H5set_api_stats");
+    ret = H5reset_api_stats();
+    CHECK(ret, FAIL, "H5reset_api_stats");
+
+    for(u = 0; u < MISC36_NCALLS; u++) {
+        sid = H5Screate_simple(1, dims, NULL);
+        CHECK(sid, FAIL, "H5Screate_simple");
+        ret = H5Sclose(sid);
+        CHECK(ret, FAIL, "H5Sclose");
+    } /* end for */
+
+    ret = H5set_api_stats(FALSE);
+    CHECK(ret, FAIL, "H5set_api_stats");
+
+    /* Calls made while not collecting aren't counted */
+    sid = H5Screate_simple(1, dims, NULL);
+    CHECK(sid, FAIL, "H5Screate_simple");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+
+    /* Get the statistics */
+    nfuncs = 0;
+    ret = H5get_api_stats(NULL, &nfuncs);
+    CHECK(ret, FAIL, "H5get_api_stats");
+    if(nfuncs < 2)
+        TestErrPrintf("%d: too few API routines reported\n", __LINE__);
+    stats = (H5_api_stats_t *)HDcalloc(nfuncs, sizeof(H5_api_stats_t));
+    CHECK_PTR(stats, "HDcalloc");
+    ret = H5get_api_stats(stats, &nfuncs);
+    CHECK(ret, FAIL, "H5get_api_stats");
+
+    create = test_misc36_find(stats, nfuncs, "H5Screate_simple");
+    CHECK_PTR(create, "test_misc36_find");
+    VERIFY(create->ncalls, MISC36_NCALLS, "H5get_api_stats");
+    if(create->max_usec > create->total_usec)
+        TestErrPrintf("%d: maximum latency larger than total\n", __LINE__);
+    ncalls = 0;
+    for(u = 0; u < H5_API_STATS_NBUCKETS; u++)
+        ncalls += create->latency[u];
+    VERIFY(ncalls, MISC36_NCALLS, "H5get_api_stats");
+    CHECK_PTR(test_misc36_find(stats, nfuncs, "H5Sclose"), "test_misc36_find");
+
+    /* Resetting clears the counts but keeps the routines */
+    ret = H5reset_api_stats();
+    CHECK(ret, FAIL, "H5reset_api_stats");
+    ret = H5get_api_stats(stats, &nfuncs);
+    CHECK(ret, FAIL, "H5get_api_stats");
+    create = test_misc36_find(stats, nfuncs, "H5Screate_simple");
+    CHECK_PTR(create, "test_misc36_find");
+    VERIFY(create->ncalls, 0, "H5get_api_stats");
+
+    /* A buffer is required if its size is given */
+    nfuncs = 1;
+    H5E_BEGIN_TRY {
+        ret = H5get_api_stats(NULL, &nfuncs);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5get_api_stats");
+    H5E_BEGIN_TRY {
+        ret = H5get_api_stats(stats, NULL);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5get_api_stats");
+
+    HDfree(stats);
+} /* end test_misc36() */
+
+
+/****************************************************************
+**
+**  test_misc37(): Check the library-wide memory budget
+**
+****************************************************************/
+static void
+test_misc37(void)
+{
+    hid_t       fid;                /* File ID */
+    hid_t       sid;                /* File dataspace ID */
+    hid_t       msid;               /* Memory dataspace ID */
+    hid_t       dcpl;               /* Dataset creation property list ID */
+    hid_t       did;                /* Chunked dataset ID */
+    hid_t       cdid;               /* Contiguous dataset ID */
+    hsize_t     dims[1] = {MISC37_NCHUNKS * MISC37_CHUNK};  /* Dataspace dimensions */
+    hsize_t     chunk_dims[1] = {MISC37_CHUNK}; /* Chunk dimensions */
+    hsize_t     one[1] = {1};       /* Single element */
+    hsize_t     start[1];           /* Selection start */
+    size_t      usage[H5_MEM_NCOMPONENTS];  /* Memory held by each component */
+    size_t      total;              /* Memory held by all components */
+    size_t      sum;                /* Sum of the components */
+    size_t      limit;              /* Memory budget */
+    int        *buf;                /* Data buffer */
+    int         val;                /* Element read */
+    unsigned    u;                  /* Local index variable */
+    herr_t      ret;                /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing the library-wide memory budget\n"));
+
+    /* No limit by default */
+    ret = H5get_memory_limit(&limit);
+    CHECK(ret, FAIL, "H5get_memory_limit");
+    VERIFY(limit, 0, "H5get_memory_limit");
+
+    buf = (int *)HDmalloc(sizeof(int) * MISC37_NCHUNKS * MISC37_CHUNK);
+    CHECK_PTR(buf, "HDmalloc");
+    for(u = 0; u < MISC37_NCHUNKS * MISC37_CHUNK; u++)
+        buf[u] = (int)u;
+
+    /* Create a chunked and a contiguous dataset */
+    fid = H5Fcreate(MISC37_FILE, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(fid, FAIL, "H5Fcreate");
+    sid = H5Screate_simple(1, dims, NULL);
+    CHECK(sid, FAIL, "H5Screate_simple");
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    CHECK(dcpl, FAIL, "H5Pcreate");
+    ret = H5Pset_chunk(dcpl, 1, chunk_dims);
+    CHECK(ret, FAIL, "H5Pset_chunk");
+    did = H5Dcreate2(fid, "chunked", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    CHECK(did, FAIL, "H5Dcreate2");
+    ret = H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf);
+    CHECK(ret, FAIL, "H5Dwrite");
+    cdid = H5Dcreate2(fid, "contig", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(cdid, FAIL, "H5Dcreate2");
+    ret = H5Dwrite(cdid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf);
+    CHECK(ret, FAIL, "H5Dwrite");
+    ret = H5Pclose(dcpl);
+    CHECK(ret, FAIL, "H5Pclose");
+    msid = H5Screate_simple(1, one, NULL);
+    CHECK(msid, FAIL, "H5Screate_simple");
+
+    /* Read a single element from the contiguous dataset, through the sieve buffer */
+    start[0] = 1;
+    ret = H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, one, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    ret = H5Dread(cdid, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, &val);
+    CHECK(ret, FAIL, "H5Dread");
+    VERIFY(val, 1, "H5Dread");
+
+    /* The chunks, sieve buffer and metadata are all accounted for */
+    ret = H5get_memory_usage(usage, &total);
+    CHECK(ret, FAIL, "H5get_memory_usage");
+    VERIFY(usage[H5_MEM_CHUNK_CACHE], MISC37_NCHUNKS * MISC37_CHUNK * sizeof(int), "H5get_memory_usage");
+    if(usage[H5_MEM_SIEVE_BUFFER] == 0)
+        TestErrPrintf("%d: no sieve buffer memory reported\n", __LINE__);
+    if(usage[H5_MEM_METADATA_CACHE] == 0)
+        TestErrPrintf("%d: no metadata cache memory reported\n", __LINE__);
+    for(u = 0, sum = 0; u < H5_MEM_NCOMPONENTS; u++)
+        sum += usage[u];
+    VERIFY(total, sum, "H5get_memory_usage");
+
+    /* Closing the dataset empties its chunk cache */
+    ret = H5Dclose(did);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5get_memory_usage(usage, NULL);
+    CHECK(ret, FAIL, "H5get_memory_usage");
+    VERIFY(usage[H5_MEM_CHUNK_CACHE], 0, "H5get_memory_usage");
+    did = H5Dopen2(fid, "chunked", H5P_DEFAULT);
+    CHECK(did, FAIL, "H5Dopen2");
+
+    /* With a tiny budget, the chunk cache keeps only the chunk in use */
+    ret = H5set_memory_limit((size_t)1);
+    CHECK(ret, FAIL, "H5set_memory_limit");
+    ret = H5get_memory_limit(&limit);
+    CHECK(ret, FAIL, "H5get_memory_limit");
+    VERIFY(limit, 1, "H5get_memory_limit");
+    for(u = 0; u < MISC37_NCHUNKS; u++) {
+        start[0] = u * MISC37_CHUNK + 1;
+        ret = H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, one, NULL);
+        CHECK(ret, FAIL, "H5Sselect_hyperslab");
+        ret = H5Dread(did, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, &val);
+        CHECK(ret, FAIL, "H5Dread");
+        VERIFY(val, (int)start[0], "H5Dread");
+        ret = H5get_memory_usage(usage, NULL);
+        CHECK(ret, FAIL, "H5get_memory_usage");
+        VERIFY(usage[H5_MEM_CHUNK_CACHE], MISC37_CHUNK * sizeof(int), "H5get_memory_usage");
+    } /* end for */
+
+    /* Without a budget the chunk cache fills up again */
+    ret = H5set_memory_limit((size_t)0);
+    CHECK(ret, FAIL, "H5set_memory_limit");
+    start[0] = 0;
+    ret = H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, one, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    ret = H5Dread(did, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, &val);
+    CHECK(ret, FAIL, "H5Dread");
+    VERIFY(val, 0, "H5Dread");
+    ret = H5get_memory_usage(usage, NULL);
+    CHECK(ret, FAIL, "H5get_memory_usage");
+    VERIFY(usage[H5_MEM_CHUNK_CACHE], 2 * MISC37_CHUNK * sizeof(int), "H5get_memory_usage");
+
+    /* Memory held by other components doesn't make the chunk cache give up
+     * chunks while the chunk caches themselves fit in the budget.
+     */
+    ret = H5set_memory_limit(MISC37_NCHUNKS * MISC37_CHUNK * sizeof(int));
+    CHECK(ret, FAIL, "H5set_memory_limit");
+    for(u = 0; u < MISC37_NCHUNKS; u++) {
+        start[0] = u * MISC37_CHUNK + 2;
+        ret = H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, one, NULL);
+        CHECK(ret, FAIL, "H5Sselect_hyperslab");
+        ret = H5Dread(did, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, &val);
+        CHECK(ret, FAIL, "H5Dread");
+        VERIFY(val, (int)start[0], "H5Dread");
+    } /* end for */
+    ret = H5get_memory_usage(usage, &total);
+    CHECK(ret, FAIL, "H5get_memory_usage");
+    if(total <= MISC37_NCHUNKS * MISC37_CHUNK * sizeof(int))
+        TestErrPrintf("%d: expected to be over the memory budget\n", __LINE__);
+    VERIFY(usage[H5_MEM_CHUNK_CACHE], MISC37_NCHUNKS * MISC37_CHUNK * sizeof(int), "H5get_memory_usage");
+    ret = H5set_memory_limit((size_t)0);
+    CHECK(ret, FAIL, "H5set_memory_limit");
+
+    ret = H5Sclose(msid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Dclose(cdid);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Dclose(did);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Everything is released when the file is closed */
+    ret = H5get_memory_usage(usage, NULL);
+    CHECK(ret, FAIL, "H5get_memory_usage");
+    VERIFY(usage[H5_MEM_CHUNK_CACHE], 0, "H5get_memory_usage");
+    VERIFY(usage[H5_MEM_SIEVE_BUFFER], 0, "H5get_memory_usage");
+    VERIFY(usage[H5_MEM_ACCUMULATOR], 0, "H5get_memory_usage");
+
+    /* At least one output buffer is required */
+    H5E_BEGIN_TRY {
+        ret = H5get_memory_usage(NULL, NULL);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5get_memory_usage");
+    H5E_BEGIN_TRY {
+        ret = H5get_memory_limit(NULL);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5get_memory_limit");
+
+    HDfree(buf);
+} /* end test_misc37() */
+
+
+/****************************************************************
+**
+**  test_misc38(): Check that the metadata cache and the page buffer
+**      give memory back when the library is over its memory budget
+**
+****************************************************************/
+static void
+test_misc38(void)
+{
+    H5AC_cache_config_t mdc_config; /* Metadata cache configuration */
+    hid_t       fcpl;               /* File creation property list ID */
+    hid_t       fapl;               /* File access property list ID */
+    hid_t       fid;                /* File ID */
+    hid_t       gid;                /* Group ID */
+    char        name[32];           /* Group name */
+    size_t      usage[H5_MEM_NCOMPONENTS];  /* Memory held by each component */
+    size_t      max_size;           /* Maximum metadata cache size */
+    size_t      cur_size;           /* Current metadata cache size */
+    size_t      budget_max_size;    /* Maximum metadata cache size within the budget */
+    size_t      budget_cur_size;    /* Current metadata cache size within the budget */
+    size_t      page_buf_usage;     /* Memory held by the page buffer */
+    unsigned    u;                  /* Local index variable */
+    herr_t      ret;                /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing the memory budget with the metadata cache and page buffer\n"));
+
+    /* Use paged aggregation and a page buffer */
+    fcpl = H5Pcreate(H5P_FILE_CREATE);
+    CHECK(fcpl, FAIL, "H5Pcreate");
+    ret = H5Pset_file_space_strategy(fcpl, H5F_FSPACE_STRATEGY_PAGE, FALSE, (hsize_t)1);
+    CHECK(ret, FAIL, "H5Pset_file_space_strategy");
+    ret = H5Pset_file_space_page_size(fcpl, (hsize_t)MISC38_PAGE_SIZE);
+    CHECK(ret, FAIL, "H5Pset_file_space_page_size");
+    fapl = H5Pcreate(H5P_FILE_ACCESS);
+    CHECK(fapl, FAIL, "H5Pcreate");
+    ret = H5Pset_page_buffer_size(fapl, (size_t)(8 * MISC38_PAGE_SIZE), 0, 0);
+    CHECK(ret, FAIL, "H5Pset_page_buffer_size");
+
+    /* Keep the metadata cache at a fixed size, with a small minimum */
+    mdc_config.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+    ret = H5Pget_mdc_config(fapl, &mdc_config);
+    CHECK(ret, FAIL, "H5Pget_mdc_config");
+    mdc_config.min_size = MISC38_MIN_MDC_SIZE;
+    mdc_config.incr_mode = H5C_incr__off;
+    mdc_config.flash_incr_mode = H5C_flash_incr__off;
+    mdc_config.decr_mode = H5C_decr__off;
+    ret = H5Pset_mdc_config(fapl, &mdc_config);
+    CHECK(ret, FAIL, "H5Pset_mdc_config");
+
+    /* Fill the metadata cache and the page buffer */
+    fid = H5Fcreate(MISC38_FILE, H5F_ACC_TRUNC, fcpl, fapl);
+    CHECK(fid, FAIL, "H5Fcreate");
+    for(u = 0; u < MISC38_NGROUPS; u++) {
+        HDsnprintf(name, sizeof(name), "group_%u", u);
+        gid = H5Gcreate2(fid, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(gid, FAIL, "H5Gcreate2");
+        ret = H5Gclose(gid);
+        CHECK(ret, FAIL, "H5Gclose");
+    } /* end for */
+    ret = H5Fflush(fid, H5F_SCOPE_GLOBAL);
+    CHECK(ret, FAIL, "H5Fflush");
+
+    ret = H5Fget_mdc_size(fid, &max_size, NULL, &cur_size, NULL);
+    CHECK(ret, FAIL, "H5Fget_mdc_size");
+    if(cur_size <= MISC38_MIN_MDC_SIZE)
+        TestErrPrintf("%d: metadata cache holds only %lu bytes\n", __LINE__, (unsigned long)cur_size);
+    ret = H5get_memory_usage(usage, NULL);
+    CHECK(ret, FAIL, "H5get_memory_usage");
+    page_buf_usage = usage[H5_MEM_PAGE_BUFFER];
+    if(page_buf_usage == 0)
+        TestErrPrintf("%d: no page buffer memory reported\n", __LINE__);
+
+    /* Over a tiny budget, the metadata cache shrinks to its minimum size
+     * and the page buffer gives up clean pages as metadata is added.
+     */
+    ret = H5set_memory_limit((size_t)1);
+    CHECK(ret, FAIL, "H5set_memory_limit");
+    gid = H5Gcreate2(fid, "budget", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(gid, FAIL, "H5Gcreate2");
+    ret = H5Gclose(gid);
+    CHECK(ret, FAIL, "H5Gclose");
+    for(u = 0; u < MISC38_NGROUPS; u++) {
+        HDsnprintf(name, sizeof(name), "group_%u", u);
+        gid = H5Gopen2(fid, name, H5P_DEFAULT);
+        CHECK(gid, FAIL, "H5Gopen2");
+        ret = H5Gclose(gid);
+        CHECK(ret, FAIL, "H5Gclose");
+    } /* end for */
+
+    ret = H5Fget_mdc_size(fid, &budget_max_size, NULL, &budget_cur_size, NULL);
+    CHECK(ret, FAIL, "H5Fget_mdc_size");
+    VERIFY(budget_max_size, MISC38_MIN_MDC_SIZE, "H5Fget_mdc_size");
+    if(budget_cur_size >= cur_size)
+        TestErrPrintf("%d: metadata cache didn't shrink: %lu bytes, was %lu\n", __LINE__, (unsigned long)budget_cur_size, (unsigned long)cur_size);
+    ret = H5get_memory_usage(usage, NULL);
+    CHECK(ret, FAIL, "H5get_memory_usage");
+    if(usage[H5_MEM_PAGE_BUFFER] >= page_buf_usage)
+        TestErrPrintf("%d: page buffer didn't shrink: %lu bytes, was %lu\n", __LINE__, (unsigned long)usage[H5_MEM_PAGE_BUFFER], (unsigned long)page_buf_usage);
+
+    ret = H5set_memory_limit((size_t)0);
+    CHECK(ret, FAIL, "H5set_memory_limit");
+
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+    ret = H5Pclose(fapl);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Pclose(fcpl);
+    CHECK(ret, FAIL, "H5Pclose");
+} /* end test_misc38() */
+
+
 /****************************************************************
 **
 **  test_misc(): Main misc. test routine.
@@ -5634,6 +6135,10 @@ test_misc(void)
     test_misc32();      /* Test filter memory allocation functions */
     test_misc33();      /* Test to verify that H5HL_offset_into() returns error if offset exceeds heap block */
     test_misc34();      /* Test behavior of 0 and NULL in H5MM API calls */
+    test_misc35();      /* Test free list statistics */
+    test_misc36();      /* Test API call statistics */
+    test_misc37();      /* Test the library-wide memory budget */
+    test_misc38();      /* Test the memory budget with the metadata cache and page buffer */
 
 } /* test_misc() */
 
@@ -5691,5 +6196,8 @@ cleanup_misc(void)
     HDremove(MISC29_COPY_FILE);
     HDremove(MISC30_FILE);
     HDremove(MISC31_FILE);
+    HDremove(MISC35_FILE);
+    HDremove(MISC37_FILE);
+    HDremove(MISC38_FILE);
 } /* end cleanup_misc() */
 
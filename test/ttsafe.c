@@ -117,6 +117,7 @@ int main(int argc, char *argv[])
     AddTest("cancel", tts_cancel, cleanup_cancel, "thread cancellation safety test", NULL);
 #endif /* H5_HAVE_PTHREAD_H */
     AddTest("acreate", tts_acreate, cleanup_acreate, "multi-attribute creation", NULL);
+    AddTest("rdonly", tts_rdonly, cleanup_rdonly, "concurrent read-only access", NULL);
 
 #else /* H5_HAVE_THREADSAFE */
 
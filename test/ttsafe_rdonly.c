@@ -0,0 +1,227 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/********************************************************************
+ *
+ * Testing thread safety of concurrent reads from a read-only file
+ * ---------------------------------------------------------------
+ *
+ * Several threads read a chunked, compressed dataset and an attribute
+ * of a file opened read-only, and query the object info, all at the
+ * same time.  H5Dread, H5Aread and H5Oget_info are shared API calls, so
+ * chunk reads and filters from different threads may overlap.  Half of
+ * the threads share one dataset ID to exercise the per-dataset chunk
+ * map state; the others open their own.
+ *
+ * Temporary files generated:
+ *   ttsafe_rdonly.h5
+ *
+ * HDF5 APIs exercised in thread:
+ * H5Dopen2, H5Dread, H5Dclose, H5Aread, H5Oget_info.
+ *
+ ********************************************************************/
+#include "ttsafe.h"
+
+#ifdef H5_HAVE_THREADSAFE
+
+#define FILENAME        "ttsafe_rdonly.h5"
+#define DSETNAME        "data"
+#define ATTRNAME        "attr"
+#define NUM_THREADS     8
+#define NUM_ITERS       20
+#define DIM0            64
+#define DIM1            256
+#define CHUNK0          8
+#define CHUNK1          32
+
+void *tts_rdonly_reader(void *);
+
+typedef struct rdonly_info_t {
+    int id;
+    hid_t file;
+    hid_t dset;                 /* Shared dataset ID, or negative */
+    int nerrors;
+} rdonly_info_t;
+
+static rdonly_info_t rdonly_info[NUM_THREADS];
+
+/*
+ **********************************************************************
+ * Thread safe test - concurrent reads from a read-only file
+ **********************************************************************
+ */
+void tts_rdonly(void)
+{
+    H5TS_thread_t threads[NUM_THREADS];
+    hid_t file, dset, space, dcpl, attr, aspace;
+    hsize_t dims[2] = {DIM0, DIM1};
+    hsize_t chunk_dims[2] = {CHUNK0, CHUNK1};
+    hsize_t adims[1] = {DIM1};
+    int *wbuf;
+    int i, j;
+    herr_t ret;
+
+    /* Create the file with a compressed, chunked dataset and an attribute */
+    wbuf = (int *)HDmalloc(sizeof(int) * DIM0 * DIM1);
+    assert(wbuf);
+    for(i = 0; i < DIM0; i++)
+        for(j = 0; j < DIM1; j++)
+            wbuf[i * DIM1 + j] = i * DIM1 + j;
+
+    file = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    assert(file >= 0);
+    space = H5Screate_simple(2, dims, NULL);
+    assert(space >= 0);
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    assert(dcpl >= 0);
+    ret = H5Pset_chunk(dcpl, 2, chunk_dims);
+    assert(ret >= 0);
+#ifdef H5_HAVE_FILTER_DEFLATE
+    ret = H5Pset_deflate(dcpl, 6);
+    assert(ret >= 0);
+#endif /* H5_HAVE_FILTER_DEFLATE */
+    ret = H5Pset_fletcher32(dcpl);
+    assert(ret >= 0);
+    dset = H5Dcreate2(file, DSETNAME, H5T_NATIVE_INT, space, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    assert(dset >= 0);
+    ret = H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf);
+    assert(ret >= 0);
+
+    aspace = H5Screate_simple(1, adims, NULL);
+    assert(aspace >= 0);
+    attr = H5Acreate2(dset, ATTRNAME, H5T_NATIVE_INT, aspace, H5P_DEFAULT, H5P_DEFAULT);
+    assert(attr >= 0);
+    ret = H5Awrite(attr, H5T_NATIVE_INT, wbuf);
+    assert(ret >= 0);
+
+    H5Aclose(attr);
+    H5Sclose(aspace);
+    H5Dclose(dset);
+    H5Pclose(dcpl);
+    H5Sclose(space);
+    H5Fclose(file);
+    HDfree(wbuf);
+
+    /* Reopen read-only and read from several threads at once */
+    file = H5Fopen(FILENAME, H5F_ACC_RDONLY, H5P_DEFAULT);
+    assert(file >= 0);
+    dset = H5Dopen2(file, DSETNAME, H5P_DEFAULT);
+    assert(dset >= 0);
+
+    for(i = 0; i < NUM_THREADS; i++) {
+        rdonly_info[i].id = i;
+        rdonly_info[i].file = file;
+        rdonly_info[i].dset = (i % 2) ? dset : -1;
+        rdonly_info[i].nerrors = 0;
+        threads[i] = H5TS_create_thread(tts_rdonly_reader, NULL, &rdonly_info[i]);
+    } /* end for */
+
+    for(i = 0; i < NUM_THREADS; i++)
+        H5TS_wait_for_thread(threads[i]);
+
+    for(i = 0; i < NUM_THREADS; i++)
+        if(rdonly_info[i].nerrors)
+            TestErrPrintf("thread %d: %d wrong reads - test failed\n", i, rdonly_info[i].nerrors);
+
+    ret = H5Dclose(dset);
+    assert(ret >= 0);
+    ret = H5Fclose(file);
+    assert(ret >= 0);
+} /* end tts_rdonly() */
+
+void *tts_rdonly_reader(void *_info)
+{
+    rdonly_info_t *info = (rdonly_info_t *)_info;
+    hid_t dset, mspace, fspace, attr;
+    hsize_t start[2], count[2];
+    H5O_info_t oinfo;
+    int *rbuf;
+    int iter, i, j;
+
+    rbuf = (int *)HDmalloc(sizeof(int) * DIM0 * DIM1);
+    assert(rbuf);
+
+    if(info->dset >= 0)
+        dset = info->dset;
+    else
+        dset = H5Dopen2(info->file, DSETNAME, H5P_DEFAULT);
+    if(dset < 0) {
+        info->nerrors++;
+        HDfree(rbuf);
+        return NULL;
+    } /* end if */
+
+    for(iter = 0; iter < NUM_ITERS; iter++) {
+        /* Whole dataset */
+        HDmemset(rbuf, 0, sizeof(int) * DIM0 * DIM1);
+        if(H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            info->nerrors++;
+        else
+            for(i = 0; i < DIM0 * DIM1; i++)
+                if(rbuf[i] != i) {
+                    info->nerrors++;
+                    break;
+                } /* end if */
+
+        /* A single chunk, different for each thread and iteration */
+        start[0] = (hsize_t)(((info->id + iter) % (DIM0 / CHUNK0)) * CHUNK0);
+        start[1] = (hsize_t)((iter % (DIM1 / CHUNK1)) * CHUNK1);
+        count[0] = CHUNK0;
+        count[1] = CHUNK1;
+        fspace = H5Dget_space(dset);
+        mspace = H5Screate_simple(2, count, NULL);
+        if(fspace < 0 || mspace < 0
+                || H5Sselect_hyperslab(fspace, H5S_SELECT_SET, start, NULL, count, NULL) < 0
+                || H5Dread(dset, H5T_NATIVE_INT, mspace, fspace, H5P_DEFAULT, rbuf) < 0)
+            info->nerrors++;
+        else
+            for(i = 0; i < CHUNK0; i++)
+                for(j = 0; j < CHUNK1; j++)
+                    if(rbuf[i * CHUNK1 + j] != (int)((start[0] + (hsize_t)i) * DIM1 + start[1] + (hsize_t)j)) {
+                        info->nerrors++;
+                        i = CHUNK0;
+                        break;
+                    } /* end if */
+        H5Sclose(mspace);
+        H5Sclose(fspace);
+
+        /* Attribute and object info */
+        HDmemset(rbuf, 0, sizeof(int) * DIM1);
+        if((attr = H5Aopen(dset, ATTRNAME, H5P_DEFAULT)) < 0
+                || H5Aread(attr, H5T_NATIVE_INT, rbuf) < 0)
+            info->nerrors++;
+        else
+            for(i = 0; i < DIM1; i++)
+                if(rbuf[i] != i) {
+                    info->nerrors++;
+                    break;
+                } /* end if */
+        H5Aclose(attr);
+
+        if(H5Oget_info(dset, &oinfo) < 0
+                || oinfo.type != H5O_TYPE_DATASET || oinfo.num_attrs != 1)
+            info->nerrors++;
+    } /* end for */
+
+    if(info->dset < 0)
+        H5Dclose(dset);
+    HDfree(rbuf);
+
+    return NULL;
+} /* end tts_rdonly_reader() */
+
+void cleanup_rdonly(void)
+{
+    HDunlink(FILENAME);
+}
+
+#endif /*H5_HAVE_THREADSAFE*/
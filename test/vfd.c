@@ -45,6 +45,7 @@
 #define THRESHOLD    1
 #define DSET2_NAME   "dset2"
 #define DSET2_DIM    4
+#define DIRECT_IO_SIZE  (16*FBSIZE)
 #endif /* H5_HAVE_DIRECT */
 
 const char *FILENAME[] = {
@@ -62,6 +63,7 @@ const char *FILENAME[] = {
 };
 
 #define LOG_FILENAME "log_vfd_out.log"
+#define LOG_TRACE_FILENAME "log_vfd_trace.bin"
 
 #define COMPAT_BASENAME "family_v16_"
 #define MULTI_COMPAT_BASENAME "multi_file_v16"
@@ -113,6 +115,9 @@ test_sec2(void)
     if(!(driver_flags & H5FD_FEAT_POSIX_COMPAT_HANDLE))     TEST_ERROR
     if(!(driver_flags & H5FD_FEAT_SUPPORTS_SWMR_IO))        TEST_ERROR
     if(!(driver_flags & H5FD_FEAT_DEFAULT_VFD_COMPATIBLE))  TEST_ERROR
+#ifdef H5_HAVE_PREAD
+    if(!(driver_flags & H5FD_FEAT_CONCURRENT_READ))         TEST_ERROR
+#endif /* H5_HAVE_PREAD */
     /* Check for extra flags not accounted for above */
     if(driver_flags != (H5FD_FEAT_AGGREGATE_METADATA
                         | H5FD_FEAT_ACCUMULATE_METADATA
@@ -120,7 +125,11 @@ test_sec2(void)
                         | H5FD_FEAT_AGGREGATE_SMALLDATA
                         | H5FD_FEAT_POSIX_COMPAT_HANDLE
                         | H5FD_FEAT_SUPPORTS_SWMR_IO
-                        | H5FD_FEAT_DEFAULT_VFD_COMPATIBLE))
+                        | H5FD_FEAT_DEFAULT_VFD_COMPATIBLE
+#ifdef H5_HAVE_PREAD
+                        | H5FD_FEAT_CONCURRENT_READ
+#endif /* H5_HAVE_PREAD */
+                        ))
         TEST_ERROR
 
     if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
@@ -754,6 +763,153 @@ error:
 #endif /*H5_HAVE_DIRECT*/
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:    test_direct_unaligned
+ *
+ * Purpose:     Tests raw I/O through the DIRECT I/O driver that isn't
+ *              aligned in the file, in size or in memory, with request
+ *              sizes that shrink and grow from one call to the next, so
+ *              that the driver's reusable copy buffer and the paths that
+ *              avoid copying are both exercised.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_direct_unaligned(void)
+{
+#ifdef H5_HAVE_DIRECT
+    /* Requests: file address, size & offset of the buffer from an aligned address */
+    static const struct {
+        haddr_t addr;
+        size_t  size;
+        size_t  mem_off;
+    } req[] = {
+        {0,                     4 * FBSIZE,             0},     /* Fully aligned */
+        {100,                   10,                     1},     /* Small & unaligned */
+        {FBSIZE,                FBSIZE + 100,           0},     /* Aligned start, unaligned size */
+        {2 * FBSIZE - 10,       3 * FBSIZE + 20,        MBOUNDARY - 10},   /* Aligned middle blocks */
+        {3 * FBSIZE + 7,        3 * CBSIZE + 5,         3},     /* Bigger than the copy buffer */
+        {5,                     17,                     0},     /* Shrink again */
+        {10 * FBSIZE,           2 * FBSIZE,             1},     /* Aligned in the file only */
+        {12 * FBSIZE + 1,       CBSIZE,                 0},     /* Grow to the copy buffer size */
+        {DIRECT_IO_SIZE - 3,    3,                      2}      /* End of the file */
+    };
+    hid_t       fapl = -1;
+    H5FD_t      *file = NULL;
+    char        filename[1024];
+    unsigned char *model = NULL;        /* Expected file contents */
+    unsigned char *wbuf = NULL, *rbuf = NULL;
+    size_t      u, v;
+#endif /*H5_HAVE_DIRECT*/
+
+    TESTING("DIRECT I/O driver with unaligned requests");
+
+#ifndef H5_HAVE_DIRECT
+    SKIPPED();
+    return 0;
+#else /*H5_HAVE_DIRECT*/
+
+    if((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if(H5Pset_fapl_direct(fapl, MBOUNDARY, FBSIZE, CBSIZE) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[5], fapl, filename, sizeof filename);
+
+    H5E_BEGIN_TRY {
+        file = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl, HADDR_UNDEF);
+    } H5E_END_TRY;
+    if(NULL == file) {
+        H5Pclose(fapl);
+        SKIPPED();
+        printf("  Probably the file system doesn't support Direct I/O\n");
+        return 0;
+    }
+    if(H5FDset_eoa(file, H5FD_MEM_DRAW, (haddr_t)DIRECT_IO_SIZE) < 0)
+        TEST_ERROR;
+
+    if(NULL == (model = (unsigned char *)HDcalloc((size_t)1, (size_t)DIRECT_IO_SIZE)))
+        TEST_ERROR;
+    if(0 != HDposix_memalign((void **)&wbuf, (size_t)FBSIZE, (size_t)(DIRECT_IO_SIZE + FBSIZE)))
+        TEST_ERROR;
+    if(0 != HDposix_memalign((void **)&rbuf, (size_t)FBSIZE, (size_t)(DIRECT_IO_SIZE + FBSIZE)))
+        TEST_ERROR;
+
+    /* Write each request, then read it back through a differently aligned buffer */
+    for(u = 0; u < NELMTS(req); u++) {
+        unsigned char *w = wbuf + req[u].mem_off;
+        unsigned char *r = rbuf + req[NELMTS(req) - 1 - u].mem_off;
+
+        for(v = 0; v < req[u].size; v++)
+            w[v] = (unsigned char)(u * 37 + v);
+        if(H5FDwrite(file, H5FD_MEM_DRAW, H5P_DEFAULT, req[u].addr, req[u].size, w) < 0)
+            TEST_ERROR;
+        HDmemcpy(model + req[u].addr, w, req[u].size);
+
+        HDmemset(r, 0xff, req[u].size);
+        if(H5FDread(file, H5FD_MEM_DRAW, H5P_DEFAULT, req[u].addr, req[u].size, r) < 0)
+            TEST_ERROR;
+        if(HDmemcmp(r, model + req[u].addr, req[u].size)) {
+            H5_FAILED();
+            printf("    Read different values than written by request %u.\n", (unsigned)u);
+            goto error;
+        } /* end if */
+    } /* end for */
+
+    /* Read all the requests back again, now that they overlap */
+    for(u = 0; u < NELMTS(req); u++) {
+        unsigned char *r = rbuf + req[u].mem_off;
+
+        if(H5FDread(file, H5FD_MEM_DRAW, H5P_DEFAULT, req[u].addr, req[u].size, r) < 0)
+            TEST_ERROR;
+        if(HDmemcmp(r, model + req[u].addr, req[u].size)) {
+            H5_FAILED();
+            printf("    Read different values than expected for request %u.\n", (unsigned)u);
+            goto error;
+        } /* end if */
+    } /* end for */
+
+    /* Check the whole file, with an aligned read */
+    if(H5FDread(file, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)0, (size_t)DIRECT_IO_SIZE, rbuf) < 0)
+        TEST_ERROR;
+    if(HDmemcmp(rbuf, model, (size_t)DIRECT_IO_SIZE))
+        TEST_ERROR;
+
+    if(H5FDclose(file) < 0)
+        TEST_ERROR;
+    file = NULL;
+    h5_delete_test_file(FILENAME[5], fapl);
+    if(H5Pclose(fapl) < 0)
+        TEST_ERROR;
+
+    HDfree(model);
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        if(file)
+            H5FDclose(file);
+        H5Pclose(fapl);
+    } H5E_END_TRY;
+
+    if(model)
+        HDfree(model);
+    if(wbuf)
+        HDfree(wbuf);
+    if(rbuf)
+        HDfree(rbuf);
+
+    return -1;
+#endif /*H5_HAVE_DIRECT*/
+} /* end test_direct_unaligned() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    test_family_opens
@@ -1661,6 +1817,131 @@ error:
     return -1;
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:    test_log_trace
+ *
+ * Purpose:     Tests the binary trace mode of the log driver
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_log_trace(void)
+{
+    hid_t        file            = -1;
+    hid_t        fapl            = -1;
+    hid_t        space           = -1;
+    hid_t        dset            = -1;
+    char         filename[1024];
+    FILE         *fp             = NULL;
+    unsigned char buf[H5FD_LOG_TRACE_REC_SIZE];
+    unsigned char *p;
+    uint32_t     version;
+    size_t       nrecs           = 0;
+    size_t       nwrites         = 0;
+    hsize_t      dims[1]         = {256};
+    int          data[256];
+    int          i;
+    herr_t       ret;
+
+    TESTING("LOG file driver binary trace");
+
+    /* Trace mode can't be combined with other flags or used without a log file */
+    if((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    H5E_BEGIN_TRY {
+        ret = H5Pset_fapl_log(fapl, LOG_TRACE_FILENAME, H5FD_LOG_TRACE | H5FD_LOG_LOC_IO, (size_t)0);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        TEST_ERROR;
+    H5E_BEGIN_TRY {
+        ret = H5Pset_fapl_log(fapl, NULL, H5FD_LOG_TRACE, (size_t)0);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        TEST_ERROR;
+
+    if(H5Pset_fapl_log(fapl, LOG_TRACE_FILENAME, H5FD_LOG_TRACE, (size_t)0) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[6], fapl, filename, sizeof filename);
+
+    /* Create a file with a dataset, to generate some I/O */
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR;
+    if((space = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR;
+    if((dset = H5Dcreate2(file, "dset", H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    for(i = 0; i < 256; i++)
+        data[i] = i;
+    if(H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) < 0)
+        TEST_ERROR;
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if(H5Sclose(space) < 0)
+        TEST_ERROR;
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+
+    /* Check the trace file's header */
+    if(NULL == (fp = HDfopen(LOG_TRACE_FILENAME, "rb")))
+        TEST_ERROR;
+    if(1 != HDfread(buf, (size_t)H5FD_LOG_TRACE_HDR_SIZE, (size_t)1, fp))
+        TEST_ERROR;
+    if(HDmemcmp(buf, H5FD_LOG_TRACE_MAGIC, (size_t)H5FD_LOG_TRACE_MAGIC_LEN))
+        TEST_ERROR;
+    p = buf + H5FD_LOG_TRACE_MAGIC_LEN;
+    version = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    if(H5FD_LOG_TRACE_VERSION != version)
+        TEST_ERROR;
+
+    /* Check the records */
+    while(1 == HDfread(buf, (size_t)H5FD_LOG_TRACE_REC_SIZE, (size_t)1, fp)) {
+        unsigned op = buf[32];
+        unsigned type = buf[33];
+
+        if(op > H5FD_LOG_TRACE_OP_TRUNCATE)
+            TEST_ERROR;
+        if(type >= (unsigned)H5FD_MEM_NTYPES)
+            TEST_ERROR;
+        if(H5FD_LOG_TRACE_OP_WRITE == op)
+            nwrites++;
+        nrecs++;
+    } /* end while */
+    if(!HDfeof(fp))
+        TEST_ERROR;
+    HDfclose(fp);
+    fp = NULL;
+
+    /* The raw data alone needs a write */
+    if(0 == nrecs || 0 == nwrites)
+        TEST_ERROR;
+
+    /* Close and delete the files */
+    HDremove(LOG_TRACE_FILENAME);
+    h5_delete_test_file(FILENAME[6], fapl);
+
+    /* Close the fapl */
+    if(H5Pclose(fapl) < 0)
+        TEST_ERROR;
+
+    PASSED();
+    return 0;
+
+error:
+    if(fp)
+        HDfclose(fp);
+    H5E_BEGIN_TRY {
+        H5Pclose(fapl);
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Fclose(file);
+    } H5E_END_TRY;
+    return -1;
+}
+
 
 /*-------------------------------------------------------------------------
  * Function:    test_stdio
@@ -1914,11 +2195,13 @@ main(void)
     nerrors += test_sec2() < 0           ? 1 : 0;
     nerrors += test_core() < 0           ? 1 : 0;
     nerrors += test_direct() < 0         ? 1 : 0;
+    nerrors += test_direct_unaligned() < 0 ? 1 : 0;
     nerrors += test_family() < 0         ? 1 : 0;
     nerrors += test_family_compat() < 0  ? 1 : 0;
     nerrors += test_multi() < 0          ? 1 : 0;
     nerrors += test_multi_compat() < 0   ? 1 : 0;
     nerrors += test_log() < 0            ? 1 : 0;
+    nerrors += test_log_trace() < 0      ? 1 : 0;
     nerrors += test_stdio() < 0          ? 1 : 0;
     nerrors += test_windows() < 0        ? 1 : 0;
 
@@ -667,21 +667,27 @@ open_file(const char *filename, hid_t fapl, int metadata_write_strategy,
     /* flush invalidate each ring, starting from the outermost ring and
      * working inward.
      */
-    for ( i = 0; i < H5C__HASH_TABLE_LEN; i++ ) {
+    {
         H5C_cache_entry_t * entry_ptr = NULL;
+        H5C_cache_entry_t * next_ptr = NULL;
 
-        entry_ptr = cache_ptr->index[i];
+        /* Walk the index list rather than the hash buckets, as expunging
+         * entries may resize the hash table.
+         */
+        entry_ptr = cache_ptr->il_head;
 
         while ( entry_ptr != NULL ) {
             HDassert(entry_ptr->magic == H5C__H5C_CACHE_ENTRY_T_MAGIC);
             HDassert(entry_ptr->is_dirty == FALSE);
 
+            next_ptr = entry_ptr->il_next;
+
             if(!entry_ptr->is_pinned && !entry_ptr->is_protected) {
                 ret = H5AC_expunge_entry(f, H5AC_ind_read_dxpl_id, entry_ptr->type, entry_ptr->addr, 0);
                 VRFY((ret == 0), "");
             }
 
-            entry_ptr = entry_ptr->ht_next;
+            entry_ptr = next_ptr;
         }
     }
     MPI_Barrier(MPI_COMM_WORLD);
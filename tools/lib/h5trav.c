@@ -35,6 +35,7 @@ typedef struct {
     h5trav_obj_func_t visit_obj;        /* Callback for visiting objects */
     h5trav_lnk_func_t visit_lnk;        /* Callback for visiting links */
     void *udata;                /* User data to pass to callbacks */
+    unsigned fields;            /* Object info fields needed by visit_obj */
 } trav_visitor_t;
 
 typedef struct {
@@ -201,7 +202,7 @@ traverse_cb(hid_t loc_id, const char *path, const H5L_info_t *linfo,
         H5O_info_t oinfo;
 
         /* Get information about the object */
-        if(H5Oget_info_by_name(loc_id, path, &oinfo, H5P_DEFAULT) < 0) {
+        if(H5Oget_info_by_name2(loc_id, path, &oinfo, udata->visitor->fields | H5O_INFO_BASIC, H5P_DEFAULT) < 0) {
             if(new_name)
                 HDfree(new_name);
             return(H5_ITER_ERROR);
@@ -257,8 +258,8 @@ traverse(hid_t file_id, const char *grp_name, hbool_t visit_start,
     int         ret_value = SUCCEED;
 
     /* Get info for starting object */
-    if(H5Oget_info_by_name(file_id, grp_name, &oinfo, H5P_DEFAULT) < 0)
-        HGOTO_ERROR(FAIL, H5E_tools_min_id_g, "H5Oget_info_by_name failed");
+    if(H5Oget_info_by_name2(file_id, grp_name, &oinfo, visitor->fields | H5O_INFO_BASIC, H5P_DEFAULT) < 0)
+        HGOTO_ERROR(FAIL, H5E_tools_min_id_g, "H5Oget_info_by_name2 failed");
 
     /* Visit the starting object */
     if(visit_start && visitor->visit_obj)
@@ -356,9 +357,9 @@ trav_fileinfo_add(trav_info_t *info, hid_t loc_id)
     size_t idx = info->nused - 1;
 
     if ( info->paths[idx].path && HDstrcmp(info->paths[idx].path, "."))
-      H5Oget_info_by_name(loc_id, info->paths[idx].path, &oinfo, H5P_DEFAULT);
+      H5Oget_info_by_name2(loc_id, info->paths[idx].path, &oinfo, H5O_INFO_BASIC, H5P_DEFAULT);
     else
-      H5Oget_info(loc_id, &oinfo);
+      H5Oget_info2(loc_id, &oinfo, H5O_INFO_BASIC);
 
     info->paths[idx].objno = oinfo.addr;
     info->paths[idx].fileno = oinfo.fileno;
@@ -434,6 +435,7 @@ h5trav_getinfo(hid_t file_id, trav_info_t *info)
     info_visitor.visit_obj = trav_info_visit_obj;
     info_visitor.visit_lnk = trav_info_visit_lnk;
     info_visitor.udata = info;
+    info_visitor.fields = H5O_INFO_BASIC;
 
     /* Traverse all objects in the file, visiting each object & link */
     if(traverse(file_id, "/", TRUE, TRUE, &info_visitor) < 0)
@@ -600,6 +602,7 @@ h5trav_gettable(hid_t fid, trav_table_t *table)
     table_visitor.visit_obj = trav_table_visit_obj;
     table_visitor.visit_lnk = trav_table_visit_lnk;
     table_visitor.udata = table;
+    table_visitor.fields = H5O_INFO_BASIC;
 
     /* Traverse all objects in the file, visiting each object & link */
     if(traverse(fid, "/", TRUE, TRUE, &table_visitor) < 0)
@@ -1025,6 +1028,7 @@ h5trav_print(hid_t fid)
     print_visitor.visit_obj = trav_print_visit_obj;
     print_visitor.visit_lnk = trav_print_visit_lnk;
     print_visitor.udata = &print_udata;
+    print_visitor.fields = H5O_INFO_BASIC;
 
     /* Traverse all objects in the file, visiting each object & link */
     if(traverse(fid, "/", TRUE, TRUE, &print_visitor) < 0)
@@ -1040,6 +1044,9 @@ done:
  *
  * Purpose: Generic traversal routine for visiting objects and links
  *
+ *          FIELDS selects the object information (H5O_INFO_* flags)
+ *          passed to VISIT_OBJ, in addition to the basic information.
+ *
  * Return:   0 on success,
  *          -1 on failure
  *-------------------------------------------------------------------------
@@ -1047,7 +1054,7 @@ done:
 int
 h5trav_visit(hid_t fid, const char *grp_name, hbool_t visit_start,
     hbool_t recurse, h5trav_obj_func_t visit_obj, h5trav_lnk_func_t visit_lnk,
-    void *udata)
+    void *udata, unsigned fields)
 {
     trav_visitor_t visitor;             /* Visitor structure for objects */
     int            ret_value = SUCCEED;
@@ -1056,6 +1063,7 @@ h5trav_visit(hid_t fid, const char *grp_name, hbool_t visit_start,
     visitor.visit_obj = visit_obj;
     visitor.visit_lnk = visit_lnk;
     visitor.udata = udata;
+    visitor.fields = fields;
 
     /* Traverse all objects in the file, visiting each object & link */
     if(traverse(fid, grp_name, visit_start, recurse, &visitor) < 0)
@@ -2413,8 +2413,10 @@ visit_obj(hid_t file, const char *oname, iter_t *iter)
          * displayed if it is a link or non-group object */
         iter->name_start = iter->base_len;
 
-        /* Specified name is a group. List the complete contents of the group. */
-        h5trav_visit(file, oname, (hbool_t) (display_root_g || iter->symlink_target), recursive_g, list_obj, list_lnk, iter);
+        /* Specified name is a group. List the complete contents of the group.
+         * (The modification time is only shown in verbose mode.) */
+        h5trav_visit(file, oname, (hbool_t) (display_root_g || iter->symlink_target), recursive_g, list_obj, list_lnk, iter,
+                (verbose_g > 0) ? H5O_INFO_TIME : 0);
 
         /* Close group */
         if(!iter->symlink_target)
@@ -50,6 +50,15 @@ add_test (
         zip_perf-h.txt.err
         zip_perf.txt
         zip_perf.txt.err
+        trace_replay-h.txt
+        trace_replay-h.txt.err
+        trace_replay.trace
+        trace_replay-r.txt
+        trace_replay-r.txt.err
+        trace_replay.txt
+        trace_replay.txt.err
+        id_perf.txt
+        id_perf.txt.err
 )
 
 if (HDF5_ENABLE_USING_MEMCHECKER)
@@ -169,6 +178,65 @@ else ()
 endif ()
 set_tests_properties (PERFORM_zip_perf PROPERTIES DEPENDS "PERFORM_zip_perf_help;PERFORM_h5perform-clearall-objects")
 
+if (HDF5_ENABLE_USING_MEMCHECKER)
+  add_test (NAME PERFORM_trace_replay_help COMMAND $<TARGET_FILE:trace_replay> "-h")
+else ()
+  add_test (NAME PERFORM_trace_replay_help COMMAND "${CMAKE_COMMAND}"
+      -D "TEST_PROGRAM=$<TARGET_FILE:trace_replay>"
+      -D "TEST_ARGS:STRING=-h"
+      -D "TEST_EXPECT=0"
+      -D "TEST_SKIP_COMPARE=TRUE"
+      -D "TEST_OUTPUT=trace_replay-h.txt"
+      -D "TEST_FOLDER=${PROJECT_BINARY_DIR}"
+      -P "${HDF_RESOURCES_EXT_DIR}/runTest.cmake"
+  )
+endif ()
+set_tests_properties (PERFORM_trace_replay_help PROPERTIES DEPENDS "PERFORM_h5perform-clearall-objects")
+
+# Record a trace with the log driver, then replay it and check the replay
+# issued the same operations as the recording
+if (HDF5_ENABLE_USING_MEMCHECKER)
+  add_test (NAME PERFORM_trace_replay_record COMMAND $<TARGET_FILE:trace_replay> "-r" "trace_replay.trace")
+  add_test (NAME PERFORM_trace_replay COMMAND $<TARGET_FILE:trace_replay> "trace_replay.trace")
+else ()
+  add_test (NAME PERFORM_trace_replay_record COMMAND "${CMAKE_COMMAND}"
+      -D "TEST_PROGRAM=$<TARGET_FILE:trace_replay>"
+      -D "TEST_ARGS:STRING=-r;trace_replay.trace"
+      -D "TEST_EXPECT=0"
+      -D "TEST_SKIP_COMPARE=TRUE"
+      -D "TEST_OUTPUT=trace_replay-r.txt"
+      -D "TEST_FOLDER=${PROJECT_BINARY_DIR}"
+      -P "${HDF_RESOURCES_EXT_DIR}/runTest.cmake"
+  )
+  add_test (NAME PERFORM_trace_replay COMMAND "${CMAKE_COMMAND}"
+      -D "TEST_PROGRAM=$<TARGET_FILE:trace_replay>"
+      -D "TEST_ARGS:STRING=trace_replay.trace"
+      -D "TEST_EXPECT=0"
+      -D "TEST_FILTER=(Driver|Replay)[^\n]*\n"
+      -D "TEST_OUTPUT=trace_replay.txt"
+      -D "TEST_REFERENCE=trace_replay-r.txt"
+      -D "TEST_FOLDER=${PROJECT_BINARY_DIR}"
+      -P "${HDF_RESOURCES_EXT_DIR}/runTest.cmake"
+  )
+endif ()
+set_tests_properties (PERFORM_trace_replay_record PROPERTIES DEPENDS "PERFORM_h5perform-clearall-objects")
+set_tests_properties (PERFORM_trace_replay PROPERTIES DEPENDS "PERFORM_trace_replay_record")
+
+if (HDF5_ENABLE_USING_MEMCHECKER)
+  add_test (NAME PERFORM_id_perf COMMAND $<TARGET_FILE:id_perf> "-n" "100000")
+else ()
+  add_test (NAME PERFORM_id_perf COMMAND "${CMAKE_COMMAND}"
+      -D "TEST_PROGRAM=$<TARGET_FILE:id_perf>"
+      -D "TEST_ARGS:STRING=-n;100000"
+      -D "TEST_EXPECT=0"
+      -D "TEST_SKIP_COMPARE=TRUE"
+      -D "TEST_OUTPUT=id_perf.txt"
+      -D "TEST_FOLDER=${PROJECT_BINARY_DIR}"
+      -P "${HDF_RESOURCES_EXT_DIR}/runTest.cmake"
+  )
+endif ()
+set_tests_properties (PERFORM_id_perf PROPERTIES DEPENDS "PERFORM_h5perform-clearall-objects")
+
 if (H5_HAVE_PARALLEL)
   add_test (NAME PERFORM_h5perf COMMAND ${MPIEXEC_EXECUTABLE} ${MPIEXEC_NUMPROC_FLAG} ${MPIEXEC_MAX_NUMPROCS} ${MPIEXEC_PREFLAGS} $<TARGET_FILE:h5perf> ${MPIEXEC_POSTFLAGS})
 
@@ -0,0 +1,212 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* ===========================================================================
+ * Usage:  id_perf [-n N] [-h]
+ *
+ * Micro-benchmark for the ID table: registers N IDs in an application ID
+ * type, looks each of them up in registration order and in random order,
+ * iterates over them and removes them in random order, and reports the
+ * time per operation for each phase.
+ */
+
+/* our header files */
+#include "h5test.h"
+#include "h5tools.h"
+#include "h5tools_utils.h"
+
+#define MICROSECOND         1000000.0F
+
+/* Default number of IDs */
+#define ID_PERF_NIDS        10000000
+
+static const char *prog = NULL;
+
+/* commandline options : long and short form */
+static const char *s_opts = "hn:";
+static struct long_options l_opts[] = {
+    { "help", no_arg, 'h' },
+    { "nids", require_arg, 'n' },
+    { NULL, 0, '\0' }
+};
+
+/*
+ * Function:    error
+ * Purpose:     Display error message and exit.
+ */
+static void
+error(const char *fmt, ...)
+{
+    va_list ap;
+
+    va_start(ap, fmt);
+    HDfprintf(stderr, "%s: error: ", prog);
+    HDvfprintf(stderr, fmt, ap);
+    HDfprintf(stderr, "\n");
+    va_end(ap);
+    HDexit(EXIT_FAILURE);
+}
+
+/*
+ * Function:    usage
+ * Purpose:     Print a usage message.
+ */
+static void
+usage(void)
+{
+    HDfprintf(stdout, "usage: %s [OPTIONS]\n", prog);
+    HDfprintf(stdout, "  OPTIONS\n");
+    HDfprintf(stdout, "     -h, --help                 Print this usage message and exit\n");
+    HDfprintf(stdout, "     -n N, --nids=N             Number of IDs to register [default: %d]\n", ID_PERF_NIDS);
+    HDfprintf(stdout, "\n");
+    HDfflush(stdout);
+}
+
+/*
+ * Function:    now_usec
+ * Purpose:     Current time of day, in microseconds.
+ */
+static uint64_t
+now_usec(void)
+{
+    struct timeval tv;
+
+    HDgettimeofday(&tv, NULL);
+    return ((uint64_t)tv.tv_sec * 1000000) + (uint64_t)tv.tv_usec;
+}
+
+/*
+ * Function:    report
+ * Purpose:     Print the time taken by NOPS operations of one phase.
+ */
+static void
+report(const char *phase, size_t nops, uint64_t start, uint64_t stop)
+{
+    double secs = (double)(stop - start) / (double)MICROSECOND;
+
+    HDfprintf(stdout, "%-18s %10.6fs  %8.1f ns/op\n", phase, secs,
+            nops ? (secs * 1.0e9) / (double)nops : 0.0);
+}
+
+/*
+ * Function:    count_cb
+ * Purpose:     H5Isearch callback counting the IDs visited.
+ */
+static int
+count_cb(void H5_ATTR_UNUSED *obj, hid_t H5_ATTR_UNUSED id, void *key)
+{
+    (*(size_t *)key)++;
+
+    return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+    size_t nids = ID_PERF_NIDS;
+    hid_t *ids;
+    size_t *order;
+    size_t nvisited = 0;
+    size_t u;
+    H5I_type_t type;
+    uint64_t start;
+    int opt;
+
+    prog = argv[0];
+
+    /* Initialize h5tools lib */
+    h5tools_init();
+
+    while ((opt = get_option(argc, (const char **)argv, s_opts, l_opts)) > 0) {
+        switch ((char)opt) {
+        case 'n':
+            nids = (size_t)HDstrtoul(opt_arg, NULL, 10);
+            if (nids < 1)
+                error("number of IDs must be at least 1");
+            break;
+        case '?':
+            usage();
+            HDexit(EXIT_FAILURE);
+            break;
+        case 'h':
+        default:
+            usage();
+            HDexit(EXIT_SUCCESS);
+            break;
+        }
+    }
+
+    if (opt_ind != argc) {
+        usage();
+        HDexit(EXIT_FAILURE);
+    }
+
+    if (NULL == (ids = (hid_t *)HDmalloc(nids * sizeof(hid_t))))
+        error("out of memory");
+    if (NULL == (order = (size_t *)HDmalloc(nids * sizeof(size_t))))
+        error("out of memory");
+
+    /* Random visiting order */
+    HDsrandom(42);
+    for (u = 0; u < nids; u++)
+        order[u] = u;
+    for (u = nids - 1; u > 0; u--) {
+        size_t v = (size_t)HDrandom() % (u + 1);
+        size_t tmp = order[u];
+
+        order[u] = order[v];
+        order[v] = tmp;
+    }
+
+    if ((type = H5Iregister_type((size_t)0, 0, NULL)) == H5I_BADID)
+        error("H5Iregister_type failed");
+
+    HDfprintf(stdout, "IDs: %lu\n", (unsigned long)nids);
+
+    start = now_usec();
+    for (u = 0; u < nids; u++)
+        if ((ids[u] = H5Iregister(type, &ids[u])) < 0)
+            error("H5Iregister failed");
+    report("Register:", nids, start, now_usec());
+
+    start = now_usec();
+    for (u = 0; u < nids; u++)
+        if (H5Iobject_verify(ids[u], type) != &ids[u])
+            error("H5Iobject_verify failed");
+    report("Lookup (in order):", nids, start, now_usec());
+
+    start = now_usec();
+    for (u = 0; u < nids; u++)
+        if (H5Iobject_verify(ids[order[u]], type) != &ids[order[u]])
+            error("H5Iobject_verify failed");
+    report("Lookup (random):", nids, start, now_usec());
+
+    start = now_usec();
+    H5Isearch(type, count_cb, &nvisited);
+    report("Iterate:", nids, start, now_usec());
+    if (nvisited != nids)
+        error("H5Isearch visited %lu IDs", (unsigned long)nvisited);
+
+    start = now_usec();
+    for (u = 0; u < nids; u++)
+        if (H5Iremove_verify(ids[order[u]], type) != &ids[order[u]])
+            error("H5Iremove_verify failed");
+    report("Remove (random):", nids, start, now_usec());
+
+    if (H5Idestroy_type(type) < 0)
+        error("H5Idestroy_type failed");
+
+    HDfree(order);
+    HDfree(ids);
+
+    return EXIT_SUCCESS;
+}
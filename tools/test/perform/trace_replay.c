@@ -0,0 +1,603 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* ===========================================================================
+ * Usage:  trace_replay [-c N] [-d DRIVER] [-o FILE] [-r] [-t] [-h] TRACE
+ *
+ * Re-issues the reads, writes and truncates in a binary I/O trace (captured
+ * with H5Pset_fapl_log(fapl, "trace", H5FD_LOG_TRACE, 0)) against a file
+ * opened with any of the built-in virtual file drivers, and reports the
+ * elapsed time and bandwidth.  With -c the trace is replayed by N processes
+ * at once: when the trace was taken from several threads, each thread's
+ * operations go to the same process, otherwise operations are dealt out
+ * round-robin.
+ *
+ * With -r a trace of a fixed pattern of reads, writes and truncates is
+ * recorded into TRACE instead, and the number of operations and bytes
+ * issued is reported in the same form as the replay reports them, so the
+ * two can be compared.
+ */
+
+/* our header files */
+#include "h5test.h"
+#include "h5tools.h"
+#include "h5tools_utils.h"
+
+#define ONE_MB              (1024 * 1024)
+
+#define MICROSECOND         1000000.0F
+
+/* report 0.0 in case t is zero too */
+#define MB_PER_SEC(bytes,t) ((fabs(t) < (double)0.0000000001F) ? (double)0.0F : ((((double)bytes) / (double)ONE_MB) / (t)))
+
+#define TRACE_REPLAY_FILE   "trace_replay.h5"
+
+/* The pattern recorded with -r */
+#define RECORD_NBLOCKS      64
+#define RECORD_BLOCK_SIZE   512
+
+/* A decoded trace record */
+typedef struct trace_rec_t {
+    uint64_t time;              /* Start time, in microseconds from file open */
+    haddr_t addr;               /* Address of operation */
+    hsize_t size;               /* Size of operation */
+    uint32_t duration;          /* Duration of operation, in microseconds */
+    uint32_t thread;            /* ID of the thread issuing the operation */
+    unsigned op;                /* H5FD_LOG_TRACE_OP_* */
+    H5FD_mem_t type;            /* Type of file memory */
+} trace_rec_t;
+
+/* Number & size of the operations of each kind issued */
+typedef struct trace_totals_t {
+    size_t nops[3];             /* Number of operations, by H5FD_LOG_TRACE_OP_* */
+    hsize_t nbytes[3];          /* Bytes transferred, by H5FD_LOG_TRACE_OP_* */
+} trace_totals_t;
+
+/* internal variables */
+static const char *prog = NULL;
+static const char *driver = "sec2";
+static const char *filename = TRACE_REPLAY_FILE;
+static unsigned nworkers = 1;
+static hbool_t timed = FALSE;
+static hbool_t record_trace = FALSE;
+
+/* commandline options : long and short form */
+static const char *s_opts = "hc:d:o:rt";
+static struct long_options l_opts[] = {
+    { "help", no_arg, 'h' },
+    { "concurrency", require_arg, 'c' },
+    { "driver", require_arg, 'd' },
+    { "output", require_arg, 'o' },
+    { "record", no_arg, 'r' },
+    { "timed", no_arg, 't' },
+    { NULL, 0, '\0' }
+};
+
+/*
+ * Function:    error
+ * Purpose:     Display error message and exit.
+ */
+static void
+error(const char *fmt, ...)
+{
+    va_list ap;
+
+    va_start(ap, fmt);
+    HDfprintf(stderr, "%s: error: ", prog);
+    HDvfprintf(stderr, fmt, ap);
+    HDfprintf(stderr, "\n");
+    va_end(ap);
+    HDexit(EXIT_FAILURE);
+}
+
+/*
+ * Function:    usage
+ * Purpose:     Print a usage message.
+ */
+static void
+usage(void)
+{
+    HDfprintf(stdout, "usage: %s [OPTIONS] TRACE\n", prog);
+    HDfprintf(stdout, "  OPTIONS\n");
+    HDfprintf(stdout, "     -h, --help                 Print this usage message and exit\n");
+    HDfprintf(stdout, "     -c N, --concurrency=N      Number of processes replaying the trace\n");
+    HDfprintf(stdout, "                                [default: 1]\n");
+    HDfprintf(stdout, "     -d D, --driver=D           File driver to replay against: sec2, stdio,\n");
+    HDfprintf(stdout, "                                core");
+#ifdef H5_HAVE_DIRECT
+    HDfprintf(stdout, " or direct");
+#endif /* H5_HAVE_DIRECT */
+    HDfprintf(stdout, " [default: sec2]\n");
+    HDfprintf(stdout, "     -o F, --output=F           File to replay into [default: %s]\n", TRACE_REPLAY_FILE);
+    HDfprintf(stdout, "     -r, --record               Record a trace of a fixed I/O pattern into\n");
+    HDfprintf(stdout, "                                TRACE instead of replaying it\n");
+    HDfprintf(stdout, "     -t, --timed                Issue operations at their recorded times\n");
+    HDfprintf(stdout, "                                instead of back to back\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "  TRACE is written by the log driver with the H5FD_LOG_TRACE flag.\n");
+    HDfprintf(stdout, "\n");
+    HDfflush(stdout);
+}
+
+/*
+ * Function:    now_usec
+ * Purpose:     Current time of day, in microseconds.
+ */
+static uint64_t
+now_usec(void)
+{
+    struct timeval tv;
+
+    HDgettimeofday(&tv, NULL);
+    return ((uint64_t)tv.tv_sec * 1000000) + (uint64_t)tv.tv_usec;
+}
+
+/*
+ * Function:    decode_le
+ * Purpose:     Decode an NBYTES-long little-endian unsigned integer and
+ *              advance *PP past it.
+ */
+static uint64_t
+decode_le(const unsigned char **pp, unsigned nbytes)
+{
+    uint64_t n = 0;
+    unsigned u;
+
+    for (u = 0; u < nbytes; u++)
+        n |= (uint64_t)(*pp)[u] << (8 * u);
+    *pp += nbytes;
+
+    return n;
+}
+
+/*
+ * Function:    load_trace
+ * Purpose:     Read & decode all the records in a trace file.
+ * Return:      The records (the caller frees them), with their number in
+ *              NRECS_P and the end of the highest address accessed in
+ *              MAX_END_P.  Exits on error.
+ */
+static trace_rec_t *
+load_trace(const char *name, size_t *nrecs_p, haddr_t *max_end_p)
+{
+    FILE *fp;
+    unsigned char hdr[H5FD_LOG_TRACE_HDR_SIZE];
+    unsigned char buf[H5FD_LOG_TRACE_REC_SIZE];
+    const unsigned char *p;
+    trace_rec_t *recs = NULL;
+    size_t nalloc = 0, nrecs = 0;
+    haddr_t max_end = 0;
+    unsigned version;
+
+    if (NULL == (fp = HDfopen(name, "rb")))
+        error("unable to open trace file '%s'", name);
+
+    if (1 != HDfread(hdr, sizeof(hdr), (size_t)1, fp) ||
+            HDmemcmp(hdr, H5FD_LOG_TRACE_MAGIC, (size_t)H5FD_LOG_TRACE_MAGIC_LEN))
+        error("'%s' is not a binary I/O trace", name);
+    p = hdr + H5FD_LOG_TRACE_MAGIC_LEN;
+    version = (unsigned)decode_le(&p, 4);
+    if (H5FD_LOG_TRACE_VERSION != version)
+        error("unsupported trace version %u", version);
+
+    while (1 == HDfread(buf, sizeof(buf), (size_t)1, fp)) {
+        trace_rec_t *rec;
+
+        if (nrecs == nalloc) {
+            nalloc = nalloc ? nalloc * 2 : 4096;
+            if (NULL == (recs = (trace_rec_t *)HDrealloc(recs, nalloc * sizeof(trace_rec_t))))
+                error("out of memory");
+        }
+        rec = &recs[nrecs++];
+
+        p = buf;
+        rec->time = decode_le(&p, 8);
+        rec->addr = (haddr_t)decode_le(&p, 8);
+        rec->size = (hsize_t)decode_le(&p, 8);
+        rec->duration = (uint32_t)decode_le(&p, 4);
+        rec->thread = (uint32_t)decode_le(&p, 4);
+        rec->op = *p++;
+        rec->type = (H5FD_mem_t)*p++;
+
+        if (rec->op > H5FD_LOG_TRACE_OP_TRUNCATE || rec->type >= H5FD_MEM_NTYPES)
+            error("corrupt record %lu in trace", (unsigned long)(nrecs - 1));
+        if (rec->addr + rec->size > max_end)
+            max_end = rec->addr + rec->size;
+    }
+
+    if (!HDfeof(fp))
+        error("unable to read trace file '%s'", name);
+    HDfclose(fp);
+
+    *nrecs_p = nrecs;
+    *max_end_p = max_end;
+    return recs;
+}
+
+/*
+ * Function:    make_fapl
+ * Purpose:     Create a file access property list for the chosen driver.
+ * Return:      The property list.  Exits on error.
+ */
+static hid_t
+make_fapl(void)
+{
+    hid_t fapl;
+    herr_t status = FAIL;
+
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        error("unable to create file access property list");
+
+    if (!HDstrcmp(driver, "sec2"))
+        status = H5Pset_fapl_sec2(fapl);
+    else if (!HDstrcmp(driver, "stdio"))
+        status = H5Pset_fapl_stdio(fapl);
+    else if (!HDstrcmp(driver, "core"))
+        status = H5Pset_fapl_core(fapl, (size_t)ONE_MB, FALSE);
+#ifdef H5_HAVE_DIRECT
+    else if (!HDstrcmp(driver, "direct"))
+        status = H5Pset_fapl_direct(fapl, (size_t)4096, (size_t)4096, (size_t)(16 * ONE_MB));
+#endif /* H5_HAVE_DIRECT */
+    else
+        error("unknown driver '%s'", driver);
+
+    if (status < 0)
+        error("unable to set '%s' driver", driver);
+
+    return fapl;
+}
+
+/*
+ * Function:    replay
+ * Purpose:     Issue this worker's share of the trace against FILENAME,
+ *              counting the operations issued in TOTALS.
+ * Return:      0 on success, -1 on failure.
+ */
+static int
+replay(const trace_rec_t *recs, size_t nrecs, haddr_t max_end, unsigned worker,
+    hbool_t by_thread, trace_totals_t *totals)
+{
+    H5FD_t *file = NULL;
+    hid_t fapl = -1;
+    unsigned char *buf = NULL;
+    size_t buf_size = 1;
+    uint64_t start;
+    size_t u;
+
+    HDmemset(totals, 0, sizeof(*totals));
+
+    /* Get a buffer large enough for the largest operation */
+    for (u = 0; u < nrecs; u++)
+        if (recs[u].size > buf_size)
+            buf_size = (size_t)recs[u].size;
+    if (NULL == (buf = (unsigned char *)HDmalloc(buf_size)))
+        return -1;
+    HDmemset(buf, 0xa5, buf_size);
+
+    fapl = make_fapl();
+    if (NULL == (file = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT, fapl, HADDR_UNDEF)))
+        goto error;
+    if (H5FDset_eoa(file, H5FD_MEM_DEFAULT, max_end) < 0)
+        goto error;
+
+    start = now_usec();
+    for (u = 0; u < nrecs; u++) {
+        const trace_rec_t *rec = &recs[u];
+
+        /* Skip the operations that belong to other workers */
+        if (((by_thread ? rec->thread : u) % nworkers) != worker)
+            continue;
+
+        if (timed) {
+            uint64_t elapsed = now_usec() - start;
+
+            if (rec->time > elapsed) {
+                struct timespec ts;
+
+                ts.tv_sec = (time_t)((rec->time - elapsed) / 1000000);
+                ts.tv_nsec = (long)(((rec->time - elapsed) % 1000000) * 1000);
+                HDnanosleep(&ts, NULL);
+            }
+        }
+
+        switch (rec->op) {
+            case H5FD_LOG_TRACE_OP_READ:
+                if (H5FDread(file, rec->type, H5P_DEFAULT, rec->addr, (size_t)rec->size, buf) < 0)
+                    goto error;
+                break;
+
+            case H5FD_LOG_TRACE_OP_WRITE:
+                if (H5FDwrite(file, rec->type, H5P_DEFAULT, rec->addr, (size_t)rec->size, buf) < 0)
+                    goto error;
+                break;
+
+            case H5FD_LOG_TRACE_OP_TRUNCATE:
+                if (H5FDset_eoa(file, H5FD_MEM_DEFAULT, rec->addr) < 0)
+                    goto error;
+                if (H5FDtruncate(file, H5P_DEFAULT, FALSE) < 0)
+                    goto error;
+                if (H5FDset_eoa(file, H5FD_MEM_DEFAULT, max_end) < 0)
+                    goto error;
+                break;
+
+            default:
+                goto error;
+        }
+        totals->nops[rec->op]++;
+        totals->nbytes[rec->op] += rec->size;
+    }
+
+    if (H5FDclose(file) < 0)
+        goto error;
+    if (H5Pclose(fapl) < 0)
+        goto error;
+    HDfree(buf);
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        if (file)
+            H5FDclose(file);
+        H5Pclose(fapl);
+    } H5E_END_TRY;
+    HDfree(buf);
+    return -1;
+}
+
+/*
+ * Function:    record
+ * Purpose:     Record a trace of a fixed pattern of operations into NAME,
+ *              counting the operations issued in TOTALS.  The pattern
+ *              writes blocks of varying sizes and memory types, reads back
+ *              every other one and truncates the file to half its size.
+ *              Exits on error.
+ */
+static void
+record(const char *name, trace_totals_t *totals)
+{
+    H5FD_t *file;
+    hid_t fapl;
+    unsigned char *buf;
+    haddr_t addr[RECORD_NBLOCKS + 1];
+    size_t u;
+
+    if (NULL == (buf = (unsigned char *)HDmalloc((size_t)(8 * RECORD_BLOCK_SIZE))))
+        error("out of memory");
+    HDmemset(buf, 0xa5, (size_t)(8 * RECORD_BLOCK_SIZE));
+    HDmemset(totals, 0, sizeof(*totals));
+
+    /* Lay out the blocks, from 1 to 8 RECORD_BLOCK_SIZE units long */
+    addr[0] = 0;
+    for (u = 0; u < RECORD_NBLOCKS; u++)
+        addr[u + 1] = addr[u] + (haddr_t)((1 + u % 8) * RECORD_BLOCK_SIZE);
+
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        error("unable to create file access property list");
+    if (H5Pset_fapl_log(fapl, name, H5FD_LOG_TRACE, (size_t)0) < 0)
+        error("unable to set log driver");
+    if (NULL == (file = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl, HADDR_UNDEF)))
+        error("unable to create '%s'", filename);
+    if (H5FDset_eoa(file, H5FD_MEM_DEFAULT, addr[RECORD_NBLOCKS]) < 0)
+        error("unable to set EOA");
+
+    for (u = 0; u < RECORD_NBLOCKS; u++) {
+        H5FD_mem_t type = (H5FD_mem_t)(H5FD_MEM_SUPER + (int)(u % (H5FD_MEM_NTYPES - 1)));
+        size_t size = (size_t)(addr[u + 1] - addr[u]);
+
+        if (H5FDwrite(file, type, H5P_DEFAULT, addr[u], size, buf) < 0)
+            error("unable to write block %lu", (unsigned long)u);
+        totals->nops[H5FD_LOG_TRACE_OP_WRITE]++;
+        totals->nbytes[H5FD_LOG_TRACE_OP_WRITE] += size;
+    }
+    for (u = 0; u < RECORD_NBLOCKS; u += 2) {
+        H5FD_mem_t type = (H5FD_mem_t)(H5FD_MEM_SUPER + (int)(u % (H5FD_MEM_NTYPES - 1)));
+        size_t size = (size_t)(addr[u + 1] - addr[u]);
+
+        if (H5FDread(file, type, H5P_DEFAULT, addr[u], size, buf) < 0)
+            error("unable to read block %lu", (unsigned long)u);
+        totals->nops[H5FD_LOG_TRACE_OP_READ]++;
+        totals->nbytes[H5FD_LOG_TRACE_OP_READ] += size;
+    }
+
+    if (H5FDset_eoa(file, H5FD_MEM_DEFAULT, addr[RECORD_NBLOCKS / 2]) < 0)
+        error("unable to set EOA");
+    if (H5FDtruncate(file, H5P_DEFAULT, FALSE) < 0)
+        error("unable to truncate '%s'", filename);
+    totals->nops[H5FD_LOG_TRACE_OP_TRUNCATE]++;
+
+    if (H5FDclose(file) < 0)
+        error("unable to close '%s'", filename);
+    H5Pclose(fapl);
+    HDfree(buf);
+}
+
+/*
+ * Function:    print_totals
+ * Purpose:     Report the number of operations & bytes in TOTALS.
+ */
+static void
+print_totals(const trace_totals_t *totals)
+{
+    HDfprintf(stdout, "Reads: %lu (%Hu bytes)\n", (unsigned long)totals->nops[H5FD_LOG_TRACE_OP_READ], totals->nbytes[H5FD_LOG_TRACE_OP_READ]);
+    HDfprintf(stdout, "Writes: %lu (%Hu bytes)\n", (unsigned long)totals->nops[H5FD_LOG_TRACE_OP_WRITE], totals->nbytes[H5FD_LOG_TRACE_OP_WRITE]);
+    HDfprintf(stdout, "Truncates: %lu\n", (unsigned long)totals->nops[H5FD_LOG_TRACE_OP_TRUNCATE]);
+}
+
+/*
+ * Function:    main
+ * Purpose:     Run the program
+ * Return:      EXIT_SUCCESS or EXIT_FAILURE
+ */
+int
+main(int argc, char **argv)
+{
+    trace_rec_t *recs;
+    size_t nrecs, u;
+    haddr_t max_end;
+    hbool_t by_thread = FALSE;
+    trace_totals_t expected;        /* Operations in the trace */
+    trace_totals_t replayed;        /* Operations replayed */
+    H5FD_t *file;
+    hid_t fapl;
+    uint64_t start, stop;
+    double total_time;
+    int opt;
+
+    prog = argv[0];
+
+    /* Initialize h5tools lib */
+    h5tools_init();
+
+    while ((opt = get_option(argc, (const char **)argv, s_opts, l_opts)) > 0) {
+        switch ((char)opt) {
+        case 'c':
+            nworkers = (unsigned)HDstrtoul(opt_arg, NULL, 10);
+            if (nworkers < 1)
+                error("concurrency must be at least 1");
+            break;
+        case 'd':
+            driver = opt_arg;
+            break;
+        case 'o':
+            filename = opt_arg;
+            break;
+        case 'r':
+            record_trace = TRUE;
+            break;
+        case 't':
+            timed = TRUE;
+            break;
+        case '?':
+            usage();
+            HDexit(EXIT_FAILURE);
+            break;
+        case 'h':
+        default:
+            usage();
+            HDexit(EXIT_SUCCESS);
+            break;
+        }
+    }
+
+    if (opt_ind != argc - 1) {
+        usage();
+        HDexit(EXIT_FAILURE);
+    }
+
+#if !(defined(H5_HAVE_FORK) && defined(H5_HAVE_WAITPID))
+    if (nworkers > 1)
+        error("concurrent replay needs fork() and waitpid()");
+#endif
+
+    if (record_trace) {
+        record(argv[opt_ind], &expected);
+        print_totals(&expected);
+        if (!HDgetenv("HDF5_NOCLEANUP"))
+            HDremove(filename);
+        return EXIT_SUCCESS;
+    }
+
+    recs = load_trace(argv[opt_ind], &nrecs, &max_end);
+
+    /* Tally the work, and see whether the trace came from several threads */
+    HDmemset(&expected, 0, sizeof(expected));
+    for (u = 0; u < nrecs; u++) {
+        expected.nops[recs[u].op]++;
+        expected.nbytes[recs[u].op] += recs[u].size;
+        if (recs[u].thread != recs[0].thread)
+            by_thread = TRUE;
+    }
+
+    /* Create an empty file to replay into */
+    fapl = make_fapl();
+    if (NULL == (file = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl, HADDR_UNDEF)))
+        error("unable to create '%s'", filename);
+    if (H5FDclose(file) < 0)
+        error("unable to close '%s'", filename);
+    H5Pclose(fapl);
+
+    start = now_usec();
+    if (1 == nworkers) {
+        if (replay(recs, nrecs, max_end, 0, by_thread, &replayed) < 0)
+            error("replay failed");
+    }
+#if defined(H5_HAVE_FORK) && defined(H5_HAVE_WAITPID)
+    else {
+        unsigned w, nfailed = 0;
+        int fds[2];
+
+        /* Each process sends back what it replayed through a pipe */
+        if (HDpipe(fds) < 0)
+            error("unable to create pipe: %s", HDstrerror(errno));
+        for (w = 0; w < nworkers; w++) {
+            pid_t pid = HDfork();
+
+            if (pid < 0)
+                error("unable to fork: %s", HDstrerror(errno));
+            if (0 == pid) {
+                trace_totals_t totals;
+
+                HDclose(fds[0]);
+                if (replay(recs, nrecs, max_end, w, by_thread, &totals) < 0)
+                    HDexit(EXIT_FAILURE);
+                if (HDwrite(fds[1], &totals, sizeof(totals)) != (ssize_t)sizeof(totals))
+                    HDexit(EXIT_FAILURE);
+                HDexit(EXIT_SUCCESS);
+            }
+        }
+        HDclose(fds[1]);
+        for (w = 0; w < nworkers; w++) {
+            int status;
+
+            if (HDwaitpid(-1, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS)
+                nfailed++;
+        }
+        if (nfailed)
+            error("%u of %u replay processes failed", nfailed, nworkers);
+
+        HDmemset(&replayed, 0, sizeof(replayed));
+        for (w = 0; w < nworkers; w++) {
+            trace_totals_t totals;
+            unsigned op;
+
+            if (HDread(fds[0], &totals, sizeof(totals)) != (ssize_t)sizeof(totals))
+                error("unable to get the totals of replay process %u", w);
+            for (op = 0; op < 3; op++) {
+                replayed.nops[op] += totals.nops[op];
+                replayed.nbytes[op] += totals.nbytes[op];
+            }
+        }
+        HDclose(fds[0]);
+    }
+#endif
+    stop = now_usec();
+    total_time = (double)(stop - start) / (double)MICROSECOND;
+
+    HDfprintf(stdout, "Driver: %s, processes: %u%s\n", driver, nworkers, timed ? ", timed" : "");
+    print_totals(&replayed);
+    HDfprintf(stdout, "Replay Time: %.6fs\n", total_time);
+    HDfprintf(stdout, "Replay Throughput: %.2fMB/s\n",
+            MB_PER_SEC((replayed.nbytes[H5FD_LOG_TRACE_OP_READ] + replayed.nbytes[H5FD_LOG_TRACE_OP_WRITE]), total_time));
+
+    /* Every operation in the trace must have been replayed */
+    if (HDmemcmp(&replayed, &expected, sizeof(expected)))
+        error("replayed %lu reads, %lu writes & %lu truncates, but the trace has %lu, %lu & %lu",
+                (unsigned long)replayed.nops[H5FD_LOG_TRACE_OP_READ], (unsigned long)replayed.nops[H5FD_LOG_TRACE_OP_WRITE],
+                (unsigned long)replayed.nops[H5FD_LOG_TRACE_OP_TRUNCATE], (unsigned long)expected.nops[H5FD_LOG_TRACE_OP_READ],
+                (unsigned long)expected.nops[H5FD_LOG_TRACE_OP_WRITE], (unsigned long)expected.nops[H5FD_LOG_TRACE_OP_TRUNCATE]);
+
+    if (!HDgetenv("HDF5_NOCLEANUP"))
+        HDremove(filename);
+    HDfree(recs);
+
+    return EXIT_SUCCESS;
+}